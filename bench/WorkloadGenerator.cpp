@@ -0,0 +1,137 @@
+#include "WorkloadGenerator.h"
+#include "DayLayout.h"
+#include "md5.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+
+using namespace std;
+
+namespace Workload
+{
+    const char *const kPassword = "Bench2024";
+
+    namespace
+    {
+        const int kTasksPerDay = 12;
+        const char *const kReminderOptions[] = {"15分钟前", "30分钟前", "1小时前", "1天前"};
+        const int kReminderSeconds[] = {900, 1800, 3600, 86400};
+
+        struct Generator
+        {
+            const Options &options;
+            mt19937 rng;
+            time_t start;
+            int span_days;
+            vector<string> custom_categories;
+
+            Generator(const Options &opts, uint32_t seed) : options(opts), rng(seed)
+            {
+                start = options.start ? DayLayout::startOfDay(options.start)
+                                      : DayLayout::startOfDay(time(nullptr)) + 30 * 86400;
+                span_days = options.spanDays > 0 ? options.spanDays
+                                                 : max(1, static_cast<int>(options.tasks / kTasksPerDay));
+                for (size_t i = 0; i < options.customCategoryCount; ++i)
+                    custom_categories.push_back("自定义分类" + to_string(i + 1));
+            }
+
+            double unit() { return uniform_real_distribution<double>(0.0, 1.0)(rng); }
+            int below(int n) { return uniform_int_distribution<int>(0, n - 1)(rng); }
+
+            string name(size_t index)
+            {
+                static const char kLetters[] = "abcdefghijklmnopqrstuvwxyz";
+                string result = "任务 " + to_string(index) + " ";
+                while (result.size() < options.nameLength)
+                    result += kLetters[below(26)];
+                return result;
+            }
+
+            // previous 为当天的前一个任务，用于按比例生成重叠
+            Task next(size_t index, const Task *previous)
+            {
+                Task task;
+                if (previous && unit() < options.overlapRatio)
+                {
+                    // 从前一个任务进行中的某个时刻开始
+                    task.startTime = previous->startTime + below(max(1, previous->duration)) * 60;
+                    task.duration = clamp(static_cast<int>(lognormal_distribution<double>(log(45.0), 0.7)(rng)), 5, 600);
+                }
+                else
+                {
+                    time_t day = start + static_cast<time_t>(below(span_days)) * 86400;
+                    if (unit() < options.crossDayRatio)
+                    {
+                        task.startTime = day + (22 * 60 + 15 * below(6)) * 60;
+                        task.duration = 120 + below(480);
+                    }
+                    else
+                    {
+                        int hour = clamp(static_cast<int>(normal_distribution<double>(13.0, 3.5)(rng)), 6, 22);
+                        task.startTime = day + (hour * 60 + 15 * below(4)) * 60;
+                        // 中位数约 45 分钟的长尾分布
+                        task.duration = clamp(static_cast<int>(lognormal_distribution<double>(log(45.0), 0.7)(rng)), 5, 600);
+                    }
+                }
+
+                double p = unit();
+                task.priority = p < 0.2 ? Priority::HIGH : (p < 0.75 ? Priority::MEDIUM : Priority::LOW);
+                task.category = static_cast<Category>(below(4));
+                if (task.category == Category::OTHER && !custom_categories.empty())
+                    task.customCategory = custom_categories[below(static_cast<int>(custom_categories.size()))];
+                task.name = name(index);
+
+                if (unit() < options.reminderRatio)
+                {
+                    int option = below(4);
+                    task.reminderOption = kReminderOptions[option];
+                    task.reminderTime = task.startTime - kReminderSeconds[option];
+                }
+                return task;
+            }
+        };
+    }
+
+    vector<Task> generateTasks(const Options &options)
+    {
+        Generator generator(options, options.seed);
+        vector<Task> tasks;
+        tasks.reserve(options.tasks);
+        for (size_t i = 0; i < options.tasks; ++i)
+        {
+            const Task *previous = tasks.empty() ? nullptr : &tasks.back();
+            tasks.push_back(generator.next(i + 1, previous));
+        }
+
+        sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b)
+             { return a.startTime < b.startTime; });
+        for (size_t i = 0; i < tasks.size(); ++i)
+            tasks[i].id = static_cast<long long>(i + 1);
+        return tasks;
+    }
+
+    Task randomTask(const Options &options, uint64_t &state)
+    {
+        // 每次调用用新的种子构造生成器，调用方只需要保存一个整数状态
+        Generator generator(options, static_cast<uint32_t>(options.seed ^ (state * 2654435761u)));
+        ++state;
+        return generator.next(static_cast<size_t>(state), nullptr);
+    }
+
+    string userName(size_t index)
+    {
+        return "user" + to_string(index + 1);
+    }
+
+    bool writeUsers(const string &path, size_t users)
+    {
+        ofstream file(path, ios::out | ios::trunc);
+        if (!file.is_open())
+            return false;
+        const string hashed = md5(kPassword);
+        for (size_t i = 0; i < users; ++i)
+            file << userName(i) << " " << hashed << "\n";
+        return static_cast<bool>(file);
+    }
+}
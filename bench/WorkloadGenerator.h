@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Task.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 生成接近真实日程分布的任务，供基准测试、负载生成工具和压力测试共用
+namespace Workload
+{
+    struct Options
+    {
+        size_t tasks = 10000;
+        int spanDays = 0;              // 任务分布的天数，0 表示按平均每天 12 个任务推算
+        time_t start = 0;              // 第一天的零点，0 表示 30 天之后（保证提醒都在未来）
+        double overlapRatio = 0.3;     // 与当天前一个任务时间重叠的比例
+        double crossDayRatio = 0.04;   // 晚间开始、延续到次日的任务比例
+        double reminderRatio = 0.35;   // 设置了提醒的任务比例
+        size_t nameLength = 16;        // 任务名称的最小长度（字节）
+        size_t customCategoryCount = 5; // 自定义分类的种类数
+        uint32_t seed = 42;
+    };
+
+    // 按开始时间排序，ID 从 1 开始连续编号
+    vector<Task> generateTasks(const Options &options);
+
+    // 生成一个与给定选项分布一致的新任务（压力测试中的 add/update 操作），ID 由调用方填写
+    Task randomTask(const Options &options, uint64_t &state);
+
+    // 生成的用户名和统一的登录密码
+    string userName(size_t index);
+    extern const char *const kPassword;
+
+    // 写入 users.dat（用户名 + MD5 密码，与 UserManager 的格式一致）
+    bool writeUsers(const string &path, size_t users);
+}
\ No newline at end of file
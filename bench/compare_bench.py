@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""比较两次基准测试的 JSON 结果（--benchmark_out 的输出）。
+
+用法: compare_bench.py <基线.json> <本次结果.json> [--threshold 百分比]
+
+按用例名称逐项比较平均耗时，变慢超过阈值（默认 10%）的用例记为回退，存在回退时返回 1。
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    results = {}
+    for bench in data.get("benchmarks", []):
+        # 多次重复运行时只取平均值这一行
+        if bench.get("run_type") == "aggregate" and bench.get("aggregate_name") != "mean":
+            continue
+        name = bench.get("run_name", bench["name"])
+        results[name] = bench["real_time"] * TIME_UNITS[bench.get("time_unit", "ns")]
+    return results
+
+
+def format_ns(ns):
+    for unit in ("s", "ms", "us"):
+        if ns >= TIME_UNITS[unit]:
+            return "%.3f %s" % (ns / TIME_UNITS[unit], unit)
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description="比较基准测试结果与基线")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="判定为回退的变慢百分比")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print("%-40s %14s %14s %9s" % ("用例", "基线", "本次", "变化"))
+    for name, now in current.items():
+        before = baseline.get(name)
+        if before is None:
+            print("%-40s %14s %14s %9s" % (name, "-", format_ns(now), "新增"))
+            continue
+        change = (now - before) / before * 100.0 if before > 0 else 0.0
+        mark = ""
+        if change > args.threshold:
+            regressions += 1
+            mark = "  <-- 回退"
+        print("%-40s %14s %14s %+8.1f%%%s" % (name, format_ns(before), format_ns(now), change, mark))
+
+    for name in baseline.keys() - current.keys():
+        print("%-40s %14s %14s %9s" % (name, format_ns(baseline[name]), "-", "缺失"))
+
+    if regressions:
+        print("\n%d 个用例比基线慢 %.0f%% 以上" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
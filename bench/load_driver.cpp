@@ -0,0 +1,291 @@
+// 压力测试驱动：多个线程共享一个 TaskManager，按比例重放添加/修改/删除/查询/提醒扫描的混合负载，
+// 报告各操作的吞吐量以及 p50/p99 延迟
+//
+// 用法: scheduler_loadtest [-d 目录] [选项]
+//   --user 名称     使用的用户（默认 user1，通常先用 scheduler_workload_gen 生成数据）
+//   --threads N     并发线程数（默认 4）
+//   --seconds N     运行时长（默认 10）
+//   --mix 配比      各操作的权重，默认 query=60,add=15,update=10,delete=5,reminder=10
+//   --seed N        随机种子（默认 1）
+//
+// 环境变量 SCHEDULER_METRICS_FILE / SCHEDULER_METRICS_SOCKET 导出指标，SCHEDULER_TRACE 导出跟踪文件
+//
+// 注意：测试会真实修改该用户的任务文件
+
+#include "TaskManager.h"
+#include "DayLayout.h"
+#include "WorkloadGenerator.h"
+#include "Logger.h"
+#include "MetricsExporter.h"
+#include "Trace.h"
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    enum Operation
+    {
+        OP_QUERY,
+        OP_ADD,
+        OP_UPDATE,
+        OP_DELETE,
+        OP_REMINDER,
+        OP_COUNT
+    };
+
+    const char *const kOperationNames[OP_COUNT] = {"query", "add", "update", "delete", "reminder"};
+
+    // 每个线程独立记录，结束后合并，避免计时本身引入锁竞争
+    struct ThreadResult
+    {
+        array<vector<int64_t>, OP_COUNT> latencies_ns;
+        array<uint64_t, OP_COUNT> failures{};
+    };
+
+    struct Shared
+    {
+        TaskManager &manager;
+        Workload::Options options;
+        time_t first_day;
+        int span_days;
+        atomic<long long> max_id;
+        atomic<bool> stop{false};
+        array<int, OP_COUNT> weights;
+    };
+
+    // 查询模拟一次视图刷新：复制全部任务，再截取某一天的片段并做冲突排序
+    bool runQuery(Shared &shared, mt19937 &rng)
+    {
+        vector<Task> tasks = shared.manager.getAllTasks();
+        time_t day = shared.first_day + uniform_int_distribution<int>(0, shared.span_days - 1)(rng) * 86400;
+        DayLayout::SegmentList segments = DayLayout::getTasksForDay(tasks, day);
+        DayLayout::sortTasksWithConflicts(segments, day);
+        return true;
+    }
+
+    void worker(Shared &shared, uint64_t thread_index, uint32_t seed, ThreadResult &result)
+    {
+        mt19937 rng(seed);
+        discrete_distribution<int> pick_op(shared.weights.begin(), shared.weights.end());
+        uint64_t task_state = thread_index << 40; // 各线程生成的任务名称互不重复
+
+        while (!shared.stop.load(memory_order_relaxed))
+        {
+            int op = pick_op(rng);
+            long long id = uniform_int_distribution<long long>(1, max(1LL, shared.max_id.load()))(rng);
+            Task task;
+            if (op == OP_ADD || op == OP_UPDATE)
+                task = Workload::randomTask(shared.options, task_state);
+
+            auto started = chrono::steady_clock::now();
+            bool ok = true;
+            switch (op)
+            {
+            case OP_QUERY:
+                ok = runQuery(shared, rng);
+                break;
+            case OP_ADD:
+                ok = shared.manager.addTask(task);
+                if (ok)
+                    shared.max_id.fetch_add(1);
+                break;
+            case OP_UPDATE:
+                task.id = id;
+                ok = shared.manager.updateTask(task);
+                break;
+            case OP_DELETE:
+                ok = shared.manager.deleteTask(id);
+                break;
+            case OP_REMINDER:
+                shared.manager.deliverDueReminders();
+                break;
+            }
+            auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - started).count();
+
+            result.latencies_ns[op].push_back(elapsed);
+            if (!ok)
+                ++result.failures[op];
+        }
+    }
+
+    bool parseMix(const string &text, array<int, OP_COUNT> &weights)
+    {
+        weights.fill(0);
+        stringstream ss(text);
+        string item;
+        while (getline(ss, item, ','))
+        {
+            size_t eq = item.find('=');
+            if (eq == string::npos)
+                return false;
+            string name = item.substr(0, eq);
+            auto it = find(begin(kOperationNames), end(kOperationNames), name);
+            if (it == end(kOperationNames))
+                return false;
+            weights[it - begin(kOperationNames)] = stoi(item.substr(eq + 1));
+        }
+        return any_of(weights.begin(), weights.end(), [](int w)
+                      { return w > 0; });
+    }
+
+    double percentileUs(vector<int64_t> &values, double p)
+    {
+        if (values.empty())
+            return 0.0;
+        size_t index = min(values.size() - 1, static_cast<size_t>(p * values.size()));
+        nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index] / 1000.0;
+    }
+}
+
+static void print_usage(const char *program)
+{
+    cerr << "用法: " << program << " [-d 目录] [--user 名称] [--threads N] [--seconds N]\n"
+         << "       [--mix query=60,add=15,update=10,delete=5,reminder=10] [--seed N]" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    string data_dir;
+    string user = Workload::userName(0);
+    int threads = 4;
+    int seconds = 10;
+    uint32_t seed = 1;
+    array<int, OP_COUNT> weights = {60, 15, 10, 5, 10};
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            string arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                print_usage(argv[0]);
+                return 2;
+            }
+            string value = argv[++i];
+            if (arg == "-d")
+                data_dir = value;
+            else if (arg == "--user")
+                user = value;
+            else if (arg == "--threads")
+                threads = max(1, stoi(value));
+            else if (arg == "--seconds")
+                seconds = max(1, stoi(value));
+            else if (arg == "--seed")
+                seed = static_cast<uint32_t>(stoul(value));
+            else if (arg == "--mix" && parseMix(value, weights))
+                continue;
+            else
+            {
+                print_usage(argv[0]);
+                return 2;
+            }
+        }
+    }
+    catch (const exception &)
+    {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    if (!data_dir.empty() && chdir(data_dir.c_str()) != 0)
+    {
+        cerr << "无法进入目录 " << data_dir << ": " << strerror(errno) << endl;
+        return 1;
+    }
+
+    // TaskManager 的每次操作都会写一条 INFO 日志，测试期间默认只保留警告和错误
+    if (!getenv("SCHEDULER_LOG_LEVEL"))
+        Logger::instance().setLevel(LogLevel::WARN);
+
+    // 设置 SCHEDULER_METRICS_FILE / SCHEDULER_METRICS_SOCKET 时同时导出指标
+    MetricsExporter metrics_exporter;
+    metrics_exporter.startFromEnvironment();
+    // 设置 SCHEDULER_TRACE 时记录跟踪区间（包括 tasks_mutex 的等待），结束后写入该文件
+    string trace_path = Trace::startFromEnvironment();
+
+    TaskManager manager;
+    manager.setCurrentUser(user);
+    vector<Task> initial = manager.getAllTasks();
+    if (initial.empty())
+    {
+        cerr << "用户 " << user << " 没有任务，请先用 scheduler_workload_gen 生成数据" << endl;
+        return 1;
+    }
+
+    Shared shared{manager, Workload::Options(), 0, 1, {0}, {false}, weights};
+    shared.first_day = DayLayout::startOfDay(initial.front().startTime);
+    shared.span_days = max(1, static_cast<int>((initial.back().startTime - shared.first_day) / 86400) + 1);
+    shared.options.start = shared.first_day;
+    shared.options.spanDays = shared.span_days;
+    long long max_id = 0;
+    for (const auto &task : initial)
+        max_id = max(max_id, task.id);
+    shared.max_id = max_id;
+
+    cout << "用户 " << user << "：" << initial.size() << " 个任务，" << threads << " 个线程，运行 " << seconds << " 秒" << endl;
+    initial.clear();
+    initial.shrink_to_fit();
+
+    vector<ThreadResult> results(threads);
+    vector<thread> workers;
+    auto started = chrono::steady_clock::now();
+    for (int i = 0; i < threads; ++i)
+        workers.emplace_back(worker, ref(shared), static_cast<uint64_t>(i + 1), seed + i, ref(results[i]));
+    this_thread::sleep_for(chrono::seconds(seconds));
+    shared.stop = true;
+    for (auto &t : workers)
+        t.join();
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+    char line[128];
+    snprintf(line, sizeof(line), "%-10s %10s %8s %12s %12s %12s %12s",
+             "op", "count", "failed", "ops/s", "p50(us)", "p99(us)", "max(us)");
+    cout << line << "\n";
+    uint64_t total = 0;
+    for (int op = 0; op < OP_COUNT; ++op)
+    {
+        vector<int64_t> merged;
+        uint64_t failures = 0;
+        for (auto &r : results)
+        {
+            merged.insert(merged.end(), r.latencies_ns[op].begin(), r.latencies_ns[op].end());
+            failures += r.failures[op];
+        }
+        if (merged.empty())
+            continue;
+        total += merged.size();
+        double max_us = *max_element(merged.begin(), merged.end()) / 1000.0;
+        double p50 = percentileUs(merged, 0.50);
+        double p99 = percentileUs(merged, 0.99);
+        snprintf(line, sizeof(line), "%-10s %10zu %8llu %12.1f %12.1f %12.1f %12.1f",
+                 kOperationNames[op], merged.size(), static_cast<unsigned long long>(failures),
+                 merged.size() / elapsed, p50, p99, max_us);
+        cout << line << "\n";
+    }
+    cout << "总吞吐量: " << static_cast<uint64_t>(total / elapsed) << " ops/s" << endl;
+
+    if (!trace_path.empty())
+    {
+        Trace::stop();
+        long long events = Trace::dump(trace_path);
+        cout << "跟踪事件: " << events << "，已写入 " << trace_path << endl;
+    }
+
+    return 0;
+}
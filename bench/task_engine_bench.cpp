@@ -0,0 +1,338 @@
+// 任务引擎的微基准测试（Google Benchmark）
+//
+// 每个用例分别在 100、1万、100万个任务的规模下运行，任务由 Workload::generateTasks 按接近真实日程的分布生成：
+// 平均每天约 12 个任务，开始时间集中在白天，时长呈长尾分布，约三成与前一个任务重叠，少量任务跨天，约三分之一设置提醒。
+//
+// 结果输出为 JSON 以便与保存的基线比较，见 bench/compare_bench.py 和 CMake 目标 bench_compare
+
+#include "TaskManager.h"
+#include "TaskFile.h"
+#include "TaskStore.h"
+#include "DayLayout.h"
+#include "Logger.h"
+#include "WorkloadGenerator.h"
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    const char *kUser = "bench";
+
+    // 生成任务的时间基准：固定在未来，保证提醒扫描时没有任务到期，扫描不会修改数据
+    time_t baseTime()
+    {
+        static const time_t base = DayLayout::startOfDay(time(nullptr)) + 30 * 86400;
+        return base;
+    }
+
+    vector<Task> generateTasks(size_t count)
+    {
+        Workload::Options options;
+        options.tasks = count;
+        options.start = baseTime();
+        return Workload::generateTasks(options);
+    }
+
+    // 同一规模的数据在各用例之间共享，避免重复生成百万级任务
+    const vector<Task> &tasksOfSize(size_t count)
+    {
+        static map<size_t, vector<Task>> cache;
+        auto it = cache.find(count);
+        if (it == cache.end())
+            it = cache.emplace(count, generateTasks(count)).first;
+        return it->second;
+    }
+
+    string tasksFile(size_t count)
+    {
+        return string(kUser) + to_string(count) + "_tasks.dat";
+    }
+
+    // 写好对应规模的任务文件，返回对应的用户名
+    string prepareUser(size_t count)
+    {
+        static set<size_t> written;
+        if (written.insert(count).second)
+            TaskFile::rewrite(tasksFile(count), tasksOfSize(count));
+        return string(kUser) + to_string(count);
+    }
+
+    // 已加载好任务的 TaskManager（按规模缓存）
+    TaskManager &managerOfSize(size_t count)
+    {
+        static map<size_t, unique_ptr<TaskManager>> cache;
+        auto &manager = cache[count];
+        if (!manager)
+        {
+            manager = make_unique<TaskManager>();
+            manager->setCurrentUser(prepareUser(count));
+        }
+        return *manager;
+    }
+
+    // 任务最密集的一天，用于单日视图相关的用例
+    time_t busiestDay(const vector<Task> &tasks)
+    {
+        map<time_t, int> counts;
+        for (const auto &task : tasks)
+            ++counts[DayLayout::startOfDay(task.startTime)];
+        return max_element(counts.begin(), counts.end(), [](const auto &a, const auto &b)
+                           { return a.second < b.second; })
+            ->first;
+    }
+
+    void sizes(benchmark::internal::Benchmark *b)
+    {
+        b->Arg(100)->Arg(10000)->Arg(1000000);
+    }
+}
+
+// loadTasks：setCurrentUser 读取整个任务文件并检查过期提醒
+static void BM_LoadTasks(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    const string user = prepareUser(count);
+    for (auto _ : state)
+    {
+        TaskManager manager;
+        manager.setCurrentUser(user);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LoadTasks)->Apply(sizes)->Unit(benchmark::kMillisecond);
+
+// rewriteTasksFile：删除、修改任务和持久化提醒状态时重写整个文件
+static void BM_RewriteTasksFile(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    const vector<Task> &tasks = tasksOfSize(count);
+    const string path = "rewrite_" + tasksFile(count);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(TaskFile::rewrite(path, tasks));
+    state.SetItemsProcessed(state.iterations() * count);
+    unlink(path.c_str());
+}
+BENCHMARK(BM_RewriteTasksFile)->Apply(sizes)->Unit(benchmark::kMillisecond);
+
+// addTask：重复检查、追加写文件、有序插入
+static void BM_AddTask(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    const string user = "add_" + prepareUser(count);
+    TaskFile::rewrite(user + "_tasks.dat", tasksOfSize(count));
+    TaskManager manager;
+    manager.setCurrentUser(user);
+
+    Task task;
+    task.duration = 60;
+    time_t start = baseTime() - 86400;
+    long long n = 0;
+    for (auto _ : state)
+    {
+        task.name = "新任务 " + to_string(++n);
+        task.startTime = start - n * 60;
+        benchmark::DoNotOptimize(manager.addTask(task));
+    }
+    unlink((user + "_tasks.dat").c_str());
+}
+BENCHMARK(BM_AddTask)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_GetTaskById(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    TaskManager &manager = managerOfSize(count);
+    mt19937 rng(7);
+    uniform_int_distribution<long long> id_dist(1, static_cast<long long>(count));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(manager.getTaskById(id_dist(rng)));
+}
+BENCHMARK(BM_GetTaskById)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// getAllTasks：每次视图刷新都会复制一份完整的任务列表
+static void BM_GetAllTasks(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    TaskManager &manager = managerOfSize(count);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(manager.getAllTasks());
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_GetAllTasks)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// get_tasks_for_day：从全部任务中截取某一天的显示片段
+static void BM_GetTasksForDay(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    const time_t day = busiestDay(tasks);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(DayLayout::getTasksForDay(tasks, day));
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+BENCHMARK(BM_GetTasksForDay)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// sort_tasks_with_conflicts：对最忙一天的片段做冲突标记和排序
+static void BM_SortTasksWithConflicts(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    const time_t day = busiestDay(tasks);
+    const DayLayout::SegmentList segments = DayLayout::getTasksForDay(tasks, day);
+    for (auto _ : state)
+    {
+        DayLayout::SegmentList copy = segments;
+        DayLayout::sortTasksWithConflicts(copy, day);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.counters["segments"] = static_cast<double>(segments.size());
+}
+BENCHMARK(BM_SortTasksWithConflicts)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// 一次月视图刷新：在同一个快照的内存池中生成 42 天的片段，每轮刷新前整体回收
+static void BM_RefreshArenaMonth(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    const time_t first_day = DayLayout::startOfDay(busiestDay(tasks)) - 21 * 86400;
+    DayLayout::Snapshot snapshot(tasks);
+    size_t segment_count = 0;
+    for (auto _ : state)
+    {
+        snapshot.releaseSegments();
+        segment_count = 0;
+        for (int d = 0; d < 42; ++d)
+            segment_count += snapshot.segmentsForDay(first_day + d * 86400).size();
+        benchmark::DoNotOptimize(segment_count);
+    }
+    state.counters["segments"] = static_cast<double>(segment_count);
+}
+BENCHMARK(BM_RefreshArenaMonth)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// update_days_with_tasks_cache：收集所有有任务的日期（月视图的标记）
+static void BM_DaysWithTasksCache(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    for (auto _ : state)
+    {
+        set<time_t> days;
+        for (const auto &task : tasks)
+            DayLayout::addTaskDays(task, days);
+        benchmark::DoNotOptimize(days.size());
+    }
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+BENCHMARK(BM_DaysWithTasksCache)->Apply(sizes)->Unit(benchmark::kMillisecond);
+
+// 提醒扫描：遍历所有任务查找到期提醒（数据全部在未来，扫描不产生提醒）
+static void BM_ReminderScan(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    TaskManager &manager = managerOfSize(count);
+    for (auto _ : state)
+        manager.deliverDueReminders();
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ReminderScan)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// 每个任务占用的内存：Task（含字符串的堆内存，按 libstdc++ 的短字符串优化计算）与 TaskStore 的紧凑记录
+static void BM_TaskMemory(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    size_t store_bytes = 0;
+    for (auto _ : state)
+    {
+        TaskStore store;
+        for (const auto &task : tasks)
+            store.push_back(task);
+        store.sortByStartTime();
+        store_bytes = store.memoryBytes();
+        benchmark::DoNotOptimize(store_bytes);
+    }
+
+    auto heap_bytes = [](const string &s)
+    { return s.capacity() > 15 ? s.capacity() + 1 : 0; };
+    size_t task_bytes = tasks.size() * sizeof(Task);
+    for (const auto &task : tasks)
+        task_bytes += heap_bytes(task.name) + heap_bytes(task.customCategory) + heap_bytes(task.reminderOption);
+    state.counters["task_bytes"] = static_cast<double>(task_bytes) / tasks.size();
+    state.counters["record_bytes"] = static_cast<double>(store_bytes) / tasks.size();
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+BENCHMARK(BM_TaskMemory)->Apply(sizes)->Unit(benchmark::kMillisecond);
+
+// 提醒扫描的遍历本身（查找下一个提醒时刻）：vector<Task> 与紧凑记录对比
+static void BM_ScanTasks(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    for (auto _ : state)
+    {
+        time_t next = 0;
+        for (const auto &task : tasks)
+        {
+            if (task.reminderTime > 0 && !task.reminded && (next == 0 || task.reminderTime < next))
+                next = task.reminderTime;
+        }
+        benchmark::DoNotOptimize(next);
+    }
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+BENCHMARK(BM_ScanTasks)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_ScanRecords(benchmark::State &state)
+{
+    const vector<Task> &tasks = tasksOfSize(state.range(0));
+    TaskStore store;
+    for (const auto &task : tasks)
+        store.push_back(task);
+    store.sortByStartTime();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(store.nextReminderTime());
+    state.SetItemsProcessed(state.iterations() * tasks.size());
+}
+BENCHMARK(BM_ScanRecords)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+// 主循环投递模式下计算下一次提醒时刻
+static void BM_NextReminderTime(benchmark::State &state)
+{
+    const size_t count = state.range(0);
+    TaskManager &manager = managerOfSize(count);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(manager.nextReminderTime());
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_NextReminderTime)->Apply(sizes)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    // 任务文件写在临时目录中，结束后清理
+    char dir_template[] = "/tmp/scheduler_bench_XXXXXX";
+    const char *dir = mkdtemp(dir_template);
+    if (!dir || chdir(dir) != 0)
+    {
+        cerr << "无法创建临时目录" << endl;
+        return 1;
+    }
+
+    // TaskManager 的每次操作都会写一条 INFO 日志，基准运行期间默认只保留警告和错误
+    if (!getenv("SCHEDULER_LOG_LEVEL"))
+        Logger::instance().setLevel(LogLevel::WARN);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    error_code ec;
+    filesystem::remove_all(dir, ec);
+    return 0;
+}
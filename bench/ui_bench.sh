@@ -0,0 +1,52 @@
+#!/bin/bash
+# 界面基准测试：生成日程数据，在无显示环境下启动 SchedulerApp 的界面基准测试模式
+#
+# 用法: bench/ui_bench.sh [任务数] [脚本] [结果文件]
+#   任务数   默认 5000，从今天开始按平均每天 12 个任务分布
+#   脚本     SCHEDULER_UI_BENCH 的值，默认 1（使用内置脚本），格式见 src/UiBenchmark.h
+#   结果文件 JSON 结果的保存路径，默认 ui_bench.json
+#
+# 有 xvfb-run 时在 Xvfb 下运行，否则使用 GTK 的 Broadway 后端（需要 broadwayd）
+# 报告中的分配次数需要以 -DSCHEDULER_ALLOC_STATS=ON 构建
+
+set -e
+
+tasks=${1:-5000}
+script=${2:-1}
+output=$(realpath -m "${3:-ui_bench.json}")
+
+bin_dir=$(realpath "$(dirname "$0")/../output/${BUILD_TYPE:-Release}")
+app="$bin_dir/SchedulerApp"
+generator="$bin_dir/scheduler_workload_gen"
+if [ ! -x "$app" ] || [ ! -x "$generator" ]; then
+    echo "未找到 $app 或 $generator，请先编译" >&2
+    exit 1
+fi
+
+data_dir=$(mktemp -d)
+broadway_pid=""
+cleanup() {
+    [ -n "$broadway_pid" ] && kill "$broadway_pid" 2>/dev/null
+    rm -rf "$data_dir"
+}
+trap cleanup EXIT
+
+"$generator" -d "$data_dir" --tasks "$tasks" --start "$(date +%Y-%m-%d)"
+
+export SCHEDULER_UI_BENCH="$script"
+export SCHEDULER_UI_BENCH_USER=user1
+export SCHEDULER_UI_BENCH_OUT="$output"
+export SCHEDULER_DESKTOP_NOTIFICATIONS=0
+
+cd "$data_dir"
+if command -v xvfb-run >/dev/null; then
+    xvfb-run -a -s "-screen 0 1280x800x24" "$app"
+elif command -v broadwayd >/dev/null; then
+    broadwayd :5 >/dev/null 2>&1 &
+    broadway_pid=$!
+    sleep 1
+    GDK_BACKEND=broadway BROADWAY_DISPLAY=:5 "$app"
+else
+    echo "需要 xvfb-run 或 broadwayd" >&2
+    exit 1
+fi
@@ -3,8 +3,8 @@
 # 默认路径为当前目录的 CMakeLists.txt
 cmake_file="CMakeLists.txt"
 
-# 使用 grep 和 sed 提取主要的 add_executable 目标名（跳过 resource_generator）
-target_name=$(grep -Eo 'add_executable\([^)]+\)' "$cmake_file" | grep -v "resource_generator" | head -n 1 | sed -E 's/add_executable\(\s*([^ ]+).*/\1/')
+# 使用 grep 和 sed 提取主要的 add_executable 目标名（跳过命令行工具、守护进程和回归测试）
+target_name=$(grep -Eo 'add_executable\([^)]+\)' "$cmake_file" | grep -v -e "scheduler_" -e "_test " | head -n 1 | sed -E 's/add_executable\(\s*([^ ]+).*/\1/')
 
 # 输出结果
 if [ -n "$target_name" ]; then
@@ -58,11 +58,6 @@ fi
 cd ../output/Release || exit
 printf "\n尝试运行编译后的程序...\n\n"
 
-# 清理临时文件
-echo "清理临时文件..."
-rm -f resource_generator
-echo "临时文件清理完成"
-
 ./"$target_name"
 exit
 
@@ -93,11 +88,6 @@ fi
 cd ../output/Debug || exit
 printf "\n尝试运行编译后的程序...\n\n"
 
-# 清理临时文件
-echo "清理临时文件..."
-rm -f resource_generator
-echo "临时文件清理完成"
-
 ./"$target_name"
 exit
 
@@ -0,0 +1,161 @@
+#include "AllocCounter.h"
+
+#ifdef SCHEDULER_ALLOC_STATS
+
+#include "Metrics.h"
+#include "Trace.h"
+#include <malloc.h>
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+
+using namespace std;
+
+namespace
+{
+    thread_local uint64_t t_count = 0;
+    thread_local uint64_t t_bytes = 0;
+    // 本线程分配减去本线程释放的字节数（按 malloc_usable_size 计），跨线程释放时可能为负，只用差值
+    thread_local int64_t t_live = 0;
+    thread_local int64_t t_peak = 0;
+
+    void *counted_alloc(size_t size)
+    {
+        void *p = malloc(size ? size : 1);
+        if (p)
+        {
+            ++t_count;
+            t_bytes += size;
+            t_live += static_cast<int64_t>(malloc_usable_size(p));
+            t_peak = max(t_peak, t_live);
+        }
+        return p;
+    }
+
+    void counted_free(void *p)
+    {
+        if (!p)
+            return;
+        t_live -= static_cast<int64_t>(malloc_usable_size(p));
+        free(p);
+    }
+
+    struct OpMetrics
+    {
+        Metrics::Counter &calls;
+        Metrics::Counter &count;
+        Metrics::Counter &bytes;
+        Metrics::Gauge &peak;
+        Metrics::Gauge *heap_delta; // 只有采样堆占用的操作才注册
+    };
+
+    // 按名称指针缓存，避免每次结束都查找注册表
+    OpMetrics &opMetrics(const char *name, bool heap)
+    {
+        static mutex cache_mutex;
+        static map<const char *, OpMetrics> cache;
+        lock_guard<mutex> lock(cache_mutex);
+        auto it = cache.find(name);
+        if (it == cache.end())
+        {
+            string labels = string("op=\"") + name + "\"";
+            it = cache.emplace(name, OpMetrics{
+                                         Metrics::counter("scheduler_alloc_ops_total", "统计过分配的操作次数", labels),
+                                         Metrics::counter("scheduler_alloc_count_total", "操作期间 operator new 的调用次数", labels),
+                                         Metrics::counter("scheduler_alloc_bytes_total", "操作期间 operator new 分配的字节数", labels),
+                                         Metrics::gauge("scheduler_alloc_peak_bytes", "单次操作中未释放字节数的最大峰值", labels),
+                                         nullptr,
+                                     })
+                     .first;
+        }
+        if (heap && !it->second.heap_delta)
+            it->second.heap_delta = &Metrics::gauge("scheduler_alloc_heap_delta_bytes", "最近一次操作前后整个进程 malloc 堆占用的变化（含 g_malloc）",
+                                                    string("op=\"") + name + "\"");
+        return it->second;
+    }
+
+    int64_t heapInUse()
+    {
+        return static_cast<int64_t>(mallinfo2().uordblks);
+    }
+}
+
+AllocCounter::Snapshot AllocCounter::current()
+{
+    return {t_count, t_bytes};
+}
+
+AllocCounter::Scope::Scope(const char *name, Heap heap)
+    : m_name(name), m_start(current()), m_live_start(t_live), m_outer_peak(t_peak),
+      m_heap_start(heap == Heap::SAMPLE ? heapInUse() : -1)
+{
+    t_peak = t_live;
+}
+
+AllocCounter::Scope::~Scope()
+{
+    Snapshot now = current();
+    const uint64_t count = now.count - m_start.count;
+    const uint64_t bytes = now.bytes - m_start.bytes;
+    const int64_t peak = max<int64_t>(0, t_peak - m_live_start);
+    const bool sample_heap = m_heap_start >= 0;
+    const int64_t heap_delta = sample_heap ? heapInUse() - m_heap_start : 0;
+    t_peak = max(m_outer_peak, t_peak);
+
+    OpMetrics &metrics = opMetrics(m_name, sample_heap);
+    metrics.calls.inc();
+    metrics.count.inc(count);
+    metrics.bytes.inc(bytes);
+    metrics.peak.setMax(peak); // 同一操作可能在多个线程上同时结束
+    if (sample_heap)
+        metrics.heap_delta->set(heap_delta);
+
+    if (Trace::enabled())
+    {
+        Trace::counter(m_name, "allocs", static_cast<int64_t>(count));
+        Trace::counter(m_name, "alloc_bytes", static_cast<int64_t>(bytes));
+        Trace::counter(m_name, "peak_bytes", peak);
+    }
+}
+
+void *operator new(size_t size)
+{
+    if (void *p = counted_alloc(size))
+        return p;
+    throw bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    if (void *p = counted_alloc(size))
+        return p;
+    throw bad_alloc();
+}
+
+void *operator new(size_t size, const nothrow_t &) noexcept
+{
+    return counted_alloc(size);
+}
+
+void *operator new[](size_t size, const nothrow_t &) noexcept
+{
+    return counted_alloc(size);
+}
+
+void operator delete(void *p) noexcept { counted_free(p); }
+void operator delete[](void *p) noexcept { counted_free(p); }
+void operator delete(void *p, size_t) noexcept { counted_free(p); }
+void operator delete[](void *p, size_t) noexcept { counted_free(p); }
+void operator delete(void *p, const nothrow_t &) noexcept { counted_free(p); }
+void operator delete[](void *p, const nothrow_t &) noexcept { counted_free(p); }
+
+#else
+
+AllocCounter::Snapshot AllocCounter::current()
+{
+    return {};
+}
+
+#endif
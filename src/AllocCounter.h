@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 堆分配统计，仅在以 -DSCHEDULER_ALLOC_STATS=ON 构建时开启（替换全局 operator new/delete），
+// 否则 current() 恒为 0、Scope 为空对象，不产生任何开销。
+// 计数是线程局部的，不加锁；GTK 的 C 层分配（g_malloc 等）不经过 operator new，
+// 只能通过 Scope 记录的整个进程 malloc 堆占用变化间接体现
+namespace AllocCounter
+{
+    struct Snapshot
+    {
+        uint64_t count = 0; // 分配次数
+        uint64_t bytes = 0; // 分配字节数
+    };
+
+    constexpr bool enabled()
+    {
+#ifdef SCHEDULER_ALLOC_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    Snapshot current();
+
+    // 统计一次命名操作期间本线程的分配次数、字节数和占用峰值，析构时记入指标
+    // scheduler_alloc_*{op="<name>"}，开启跟踪时同时写入以 name 命名的计数器轨道。
+    // name 必须是字符串字面量。可以嵌套，内层的分配同时计入外层。
+    // 整个进程的 malloc 堆占用（mallinfo2 要锁住并遍历所有 arena）只在 Heap::SAMPLE 时前后各采样一次，
+    // 用于 update_all_views、loadTasks 这类外层操作；一次刷新中调用几十次的内层函数不采样，以免影响它们的耗时
+    class Scope
+    {
+    public:
+        enum class Heap
+        {
+            SKIP,
+            SAMPLE
+        };
+
+#ifdef SCHEDULER_ALLOC_STATS
+        explicit Scope(const char *name, Heap heap = Heap::SKIP);
+        ~Scope();
+#else
+        explicit Scope(const char *, Heap = Heap::SKIP) {}
+#endif
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+#ifdef SCHEDULER_ALLOC_STATS
+    private:
+        const char *m_name;
+        Snapshot m_start;
+        int64_t m_live_start;  // 开始时本线程未释放的字节数
+        int64_t m_outer_peak;  // 外层作用域到目前为止的峰值
+        int64_t m_heap_start;  // 开始时整个进程的 malloc 堆占用，不采样时为 -1
+#endif
+    };
+}
\ No newline at end of file
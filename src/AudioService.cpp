@@ -0,0 +1,78 @@
+#include "AudioService.h"
+#include <iostream>
+
+#ifdef EMBEDDED_RESOURCES_ENABLED
+#include "embedded_resources.h"
+#endif
+
+using namespace std;
+
+AudioService &AudioService::instance()
+{
+    static AudioService service;
+    return service;
+}
+
+bool AudioService::init()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_initialized)
+    {
+        m_initialized = true;
+        m_ready = decode();
+        if (m_ready)
+        {
+            for (auto &voice : m_voices)
+                voice.setBuffer(m_buffer);
+            cout << "提醒音效已解码: " << m_buffer.getDuration().asMilliseconds() << "ms, "
+                 << m_buffer.getChannelCount() << " 声道, " << m_buffer.getSampleRate() << "Hz" << endl;
+        }
+    }
+    return m_ready;
+}
+
+bool AudioService::decode()
+{
+#ifdef EMBEDDED_RESOURCES_ENABLED
+    // 直接从资源包的只读数据解码，不经过临时文件
+    GBytes *bytes = EmbeddedResources::notificationSound();
+    if (!bytes)
+        return false;
+    gsize size = 0;
+    const void *data = g_bytes_get_data(bytes, &size);
+    bool ok = m_buffer.loadFromMemory(data, size);
+    g_bytes_unref(bytes);
+#else
+    // 使用外部音频文件
+    bool ok = m_buffer.loadFromFile("notification.mp3");
+#endif
+    if (!ok)
+        cerr << "提醒音效解码失败" << endl;
+    return ok;
+}
+
+void AudioService::playNotification()
+{
+    if (!init())
+        return;
+
+    lock_guard<mutex> lock(m_mutex);
+    for (auto &voice : m_voices)
+    {
+        if (voice.getStatus() != sf::Sound::Playing)
+        {
+            // sf::Sound::play 由 SFML 的音频线程负责混音，这里立即返回
+            voice.play();
+            return;
+        }
+    }
+    ++m_dropped;
+    cerr << "所有声道都在播放，忽略本次提醒音效" << endl;
+}
+
+void AudioService::stopAll()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto &voice : m_voices)
+        voice.stop();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+using namespace std;
+
+// 进程内常驻的提醒音效服务
+// 启动时把提醒音效解码为 PCM 缓冲区，之后每次播放都直接从内存取样，
+// 不再写临时文件，也不再启动外部播放器进程；同时播放的声音数量有上限
+class AudioService
+{
+public:
+    static constexpr size_t kMaxVoices = 4; // 同时播放的最大声音数量
+
+    static AudioService &instance();
+
+    // 解码提醒音效，只在第一次调用时真正解码；失败返回 false
+    bool init();
+    // 播放提醒音效（不阻塞），所有声道都在播放时本次请求被丢弃
+    void playNotification();
+    // 停止所有正在播放的声音
+    void stopAll();
+
+    bool isReady() const { return m_ready; }
+    uint64_t droppedCount() const { return m_dropped; }
+
+private:
+    AudioService() = default;
+    AudioService(const AudioService &) = delete;
+    AudioService &operator=(const AudioService &) = delete;
+
+    bool decode();
+
+    mutex m_mutex;
+    bool m_initialized = false;
+    bool m_ready = false;
+    sf::SoundBuffer m_buffer;               // 解码后的 PCM 数据，所有声道共享
+    array<sf::Sound, kMaxVoices> m_voices;  // 固定的声道池
+    atomic<uint64_t> m_dropped{0};          // 因声道占满而丢弃的播放次数
+};
\ No newline at end of file
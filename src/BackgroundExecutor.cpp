@@ -0,0 +1,284 @@
+#include "BackgroundExecutor.h"
+#include "Logger.h"
+#include <pthread.h>
+#include <algorithm>
+#include <exception>
+
+using namespace std;
+
+// 当前线程所属的线程池和工作线程编号，用于把工作线程内提交的任务放进自己的队列
+static thread_local const BackgroundExecutor *t_owner = nullptr;
+static thread_local size_t t_worker_index = 0;
+
+BackgroundExecutor::BackgroundExecutor(size_t workers, size_t queue_capacity)
+    : m_capacity(max<size_t>(1, queue_capacity))
+{
+    if (workers == 0)
+        workers = min<size_t>(4, max<size_t>(2, thread::hardware_concurrency()));
+
+    for (size_t i = 0; i < workers; ++i)
+        m_workers.push_back(make_unique<Worker>());
+    for (size_t i = 0; i < workers; ++i)
+        m_workers[i]->worker_thread = thread(&BackgroundExecutor::worker_loop, this, i);
+}
+
+BackgroundExecutor::~BackgroundExecutor()
+{
+    shutdown();
+}
+
+bool BackgroundExecutor::push_to(size_t index, Priority priority, Job &job, bool bounded)
+{
+    Worker &worker = *m_workers[index];
+    lock_guard<mutex> lock(worker.queue_mutex);
+    if (bounded && worker.size >= m_capacity)
+        return false;
+    worker.queues[static_cast<size_t>(priority)].push_back(move(job));
+    ++worker.size;
+    return true;
+}
+
+bool BackgroundExecutor::submit(Priority priority, Job job)
+{
+    // 先计入待执行数，避免任务入队后被其他线程取走时计数出现负数
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopping)
+            return false;
+        ++m_pending;
+    }
+
+    // 工作线程内提交的任务优先放进自己的队列，其他线程轮询分配
+    const size_t count = m_workers.size();
+    size_t start = (t_owner == this) ? t_worker_index : m_next_worker++ % count;
+    bool queued = false;
+    for (size_t i = 0; i < count && !queued; ++i)
+        queued = push_to((start + i) % count, priority, job, true);
+
+    if (!queued)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            --m_pending;
+        }
+        ++m_rejected;
+        LOG_WARN("BackgroundExecutor", "后台任务队列已满，任务被拒绝");
+        return false;
+    }
+
+    m_cv.notify_one();
+    return true;
+}
+
+void BackgroundExecutor::parallel_for(size_t count, const function<void(size_t)> &body)
+{
+    if (count == 0)
+        return;
+
+    // 下标通过原子计数领取；帮手任务可能在全部完成之后才被执行，
+    // 这时它领不到下标，直接返回而不会访问 body，共享状态由 shared_ptr 保持
+    struct State
+    {
+        size_t count;
+        const function<void(size_t)> *body;
+        atomic<size_t> next{0};
+        mutex done_mutex;
+        condition_variable done_cv;
+        size_t done = 0;
+        atomic<bool> failed{false};
+        exception_ptr error; // body 抛出的第一个异常，由 done_mutex 保护
+    };
+    auto state = make_shared<State>();
+    state->count = count;
+    state->body = &body;
+
+    auto drain = [](State &s)
+    {
+        size_t finished = 0;
+        // 异常在这里捕获：抛出的下标同样计为完成，否则调用线程永远等不到 done == count。
+        // 出错之后领到的下标不再执行，只计数
+        for (size_t i = s.next++; i < s.count; i = s.next++)
+        {
+            if (!s.failed.load(memory_order_relaxed))
+            {
+                try
+                {
+                    (*s.body)(i);
+                }
+                catch (...)
+                {
+                    lock_guard<mutex> lock(s.done_mutex);
+                    if (!s.error)
+                        s.error = current_exception();
+                    s.failed.store(true, memory_order_relaxed);
+                }
+            }
+            ++finished;
+        }
+        if (finished > 0)
+        {
+            lock_guard<mutex> lock(s.done_mutex);
+            s.done += finished;
+            if (s.done == s.count)
+                s.done_cv.notify_all();
+        }
+    };
+
+    size_t helpers = min(count - 1, m_workers.size());
+    for (size_t i = 0; i < helpers; ++i)
+    {
+        if (!submit(Priority::HIGH, [state, drain]()
+                    { drain(*state); }))
+            break;
+    }
+
+    drain(*state);
+    unique_lock<mutex> lock(state->done_mutex);
+    state->done_cv.wait(lock, [&state]()
+                        { return state->done == state->count; });
+    if (state->error)
+        rethrow_exception(state->error);
+}
+
+BackgroundExecutor::TimerId BackgroundExecutor::schedule_after(chrono::milliseconds delay, Priority priority, Job job)
+{
+    TimerId id;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopping)
+            return 0;
+        id = ++m_next_timer_id;
+        m_timers.emplace(id, make_pair(priority, move(job)));
+        m_timer_heap.push_back({chrono::steady_clock::now() + delay, id});
+        push_heap(m_timer_heap.begin(), m_timer_heap.end(), greater<Delayed>());
+    }
+    // 唤醒一个空闲线程重新计算最近的到期时间
+    m_cv.notify_one();
+    return id;
+}
+
+bool BackgroundExecutor::cancel(TimerId id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    // 堆中的条目留到到期时再丢弃
+    return m_timers.erase(id) > 0;
+}
+
+void BackgroundExecutor::shutdown()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopping)
+            return;
+        m_stopping = true;
+        m_timers.clear();
+        m_timer_heap.clear();
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers)
+    {
+        if (worker->worker_thread.joinable())
+            worker->worker_thread.join();
+    }
+}
+
+bool BackgroundExecutor::try_pop(size_t index, Job &job)
+{
+    // 先按优先级从自己的队列头部取
+    {
+        Worker &own = *m_workers[index];
+        lock_guard<mutex> lock(own.queue_mutex);
+        for (auto &queue : own.queues)
+        {
+            if (!queue.empty())
+            {
+                job = move(queue.front());
+                queue.pop_front();
+                --own.size;
+                return true;
+            }
+        }
+    }
+
+    // 再从其他线程的队列尾部窃取
+    const size_t count = m_workers.size();
+    for (size_t i = 1; i < count; ++i)
+    {
+        Worker &victim = *m_workers[(index + i) % count];
+        lock_guard<mutex> lock(victim.queue_mutex);
+        for (auto &queue : victim.queues)
+        {
+            if (!queue.empty())
+            {
+                job = move(queue.back());
+                queue.pop_back();
+                --victim.size;
+                ++m_stolen;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void BackgroundExecutor::promote_due_timers(size_t index)
+{
+    auto now = chrono::steady_clock::now();
+    while (!m_timer_heap.empty() && m_timer_heap.front().deadline <= now)
+    {
+        TimerId id = m_timer_heap.front().id;
+        pop_heap(m_timer_heap.begin(), m_timer_heap.end(), greater<Delayed>());
+        m_timer_heap.pop_back();
+
+        auto it = m_timers.find(id);
+        if (it == m_timers.end())
+            continue; // 已取消
+        // 延时任务在提交时已被接受，到期后不受队列上限限制
+        push_to(index, it->second.first, it->second.second, false);
+        m_timers.erase(it);
+        ++m_pending;
+    }
+}
+
+void BackgroundExecutor::worker_loop(size_t index)
+{
+    t_owner = this;
+    t_worker_index = index;
+    // 线程名会出现在跟踪文件和调试器中（最长 15 个字符）
+    string name = "sched-worker-" + to_string(index);
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+
+    while (true)
+    {
+        Job job;
+        if (try_pop(index, job))
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                --m_pending;
+            }
+            try
+            {
+                job();
+            }
+            catch (const exception &e)
+            {
+                LOG_ERROR("BackgroundExecutor", "后台任务异常: " << e.what());
+            }
+            ++m_executed;
+            continue;
+        }
+
+        unique_lock<mutex> lock(m_mutex);
+        promote_due_timers(index);
+        if (m_pending > 0)
+            continue;
+        if (m_stopping)
+            break;
+
+        if (m_timer_heap.empty())
+            m_cv.wait(lock);
+        else
+            m_cv.wait_until(lock, m_timer_heap.front().deadline);
+    }
+}
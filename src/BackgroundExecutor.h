@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// 应用共享的后台线程池（不依赖 GTK）
+// 每个工作线程有自己的有界队列，空闲时从其他线程的队列尾部窃取任务；
+// 支持三级优先级、延时任务和有序关闭（关闭时执行完已入队的任务，丢弃未到期的延时任务）
+class BackgroundExecutor
+{
+public:
+    enum class Priority
+    {
+        HIGH,
+        NORMAL,
+        LOW
+    };
+
+    using Job = function<void()>;
+    using TimerId = uint64_t;
+
+    // workers 为 0 时按 CPU 核数选择（2~4 个）；queue_capacity 为每个工作线程的队列上限
+    explicit BackgroundExecutor(size_t workers = 0, size_t queue_capacity = 256);
+    ~BackgroundExecutor();
+
+    BackgroundExecutor(const BackgroundExecutor &) = delete;
+    BackgroundExecutor &operator=(const BackgroundExecutor &) = delete;
+
+    // 提交任务；所有队列已满或已关闭时返回 false
+    bool submit(Priority priority, Job job);
+    // 延时执行任务，返回可用于取消的ID；已关闭时返回 0
+    TimerId schedule_after(chrono::milliseconds delay, Priority priority, Job job);
+    // 取消尚未到期的延时任务，已开始执行的任务无法取消
+    bool cancel(TimerId id);
+    // 停止接受新任务，执行完已入队的任务后等待所有工作线程退出
+    void shutdown();
+
+    // 对 [0, count) 的每个下标执行 body，返回时全部完成。
+    // 调用线程也参与执行，工作线程繁忙或队列已满时退化为在调用线程上顺序执行，
+    // 因此在工作线程内调用也不会死锁。body 抛出异常时其余尚未开始的下标不再执行，
+    // 等已开始的下标结束后在调用线程上重新抛出第一个异常
+    void parallel_for(size_t count, const function<void(size_t)> &body);
+
+    size_t worker_count() const { return m_workers.size(); }
+    uint64_t executed_count() const { return m_executed; }
+    uint64_t stolen_count() const { return m_stolen; }
+    uint64_t rejected_count() const { return m_rejected; }
+
+private:
+    static constexpr size_t kPriorityCount = 3;
+
+    struct Worker
+    {
+        mutex queue_mutex;
+        array<deque<Job>, kPriorityCount> queues; // 按优先级分开的队列
+        size_t size = 0;
+        thread worker_thread;
+    };
+
+    struct Delayed
+    {
+        chrono::steady_clock::time_point deadline;
+        TimerId id;
+        bool operator>(const Delayed &other) const { return deadline > other.deadline; }
+    };
+
+    void worker_loop(size_t index);
+    bool try_pop(size_t index, Job &job);
+    bool push_to(size_t index, Priority priority, Job &job, bool bounded);
+    void promote_due_timers(size_t index); // 调用时需持有 m_mutex
+
+    const size_t m_capacity;
+    vector<unique_ptr<Worker>> m_workers;
+    atomic<size_t> m_next_worker{0};
+
+    mutex m_mutex; // 保护以下成员
+    condition_variable m_cv;
+    size_t m_pending = 0; // 所有队列中等待执行的任务数
+    bool m_stopping = false;
+    vector<Delayed> m_timer_heap; // 按到期时间的小根堆
+    unordered_map<TimerId, pair<Priority, Job>> m_timers;
+    TimerId m_next_timer_id = 0;
+
+    atomic<uint64_t> m_executed{0};
+    atomic<uint64_t> m_stolen{0};
+    atomic<uint64_t> m_rejected{0};
+};
\ No newline at end of file
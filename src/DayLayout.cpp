@@ -0,0 +1,192 @@
+#include "DayLayout.h"
+#include "AllocCounter.h"
+#include "Trace.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace DayLayout
+{
+    time_t startOfDay(time_t t)
+    {
+        tm day_tm = *localtime(&t);
+        day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
+        return mktime(&day_tm);
+    }
+
+    // 获取某一天应该显示的任务片段
+    SegmentList getTasksForDay(const vector<Task> &tasks, time_t day_time, pmr::memory_resource *resource)
+    {
+        Trace::Span span("DayLayout::getTasksForDay", "layout");
+        AllocCounter::Scope alloc_scope("getTasksForDay");
+        SegmentList segments(resource);
+
+        // 当天 00:00 与次日 00:00
+        time_t start_of_day = startOfDay(day_time);
+        time_t end_of_day = start_of_day + 86400;
+
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            const Task &task = tasks[i];
+            time_t task_end = endTime(task);
+
+            // —— 与今日窗口有重叠的任务
+            if (task_end > start_of_day && task.startTime < end_of_day)
+            {
+                TaskSegment seg;
+                seg.task_index = static_cast<uint32_t>(i);
+                seg.priority = task.priority;
+                seg.id = task.id;
+
+                // 显示区间：最早 00:00，最晚 23:59
+                seg.display_start = max(task.startTime, start_of_day);
+                seg.display_end = min(task_end, end_of_day - 60);
+
+                seg.is_cross_day = (task.startTime < start_of_day) || (task_end > end_of_day);
+                seg.is_first_segment = (task.startTime >= start_of_day);
+                seg.has_conflict = false;
+                seg.is_highest_priority_in_conflict = false;
+
+                segments.push_back(seg);
+            }
+
+            // —— 前一天跨到今日 00:00 的“零长度”占位
+            if (task_end == start_of_day && task.startTime < start_of_day)
+            {
+                TaskSegment seg;
+                seg.task_index = static_cast<uint32_t>(i);
+                seg.priority = task.priority;
+                seg.id = task.id;
+
+                seg.display_start = start_of_day;
+                seg.display_end = start_of_day;
+                seg.is_cross_day = true;
+                seg.is_first_segment = false;
+                seg.has_conflict = false;
+                seg.is_highest_priority_in_conflict = false;
+
+                segments.push_back(seg);
+            }
+        }
+
+        // 按 display_start 排序
+        sort(segments.begin(), segments.end(),
+             [](const TaskSegment &a, const TaskSegment &b)
+             { return a.display_start < b.display_start; });
+        return segments;
+    }
+
+    // 检查两个任务段是否重叠
+    bool tasksOverlap(const TaskSegment &task1, const TaskSegment &task2)
+    {
+        // 两个时间段重叠的条件：
+        // task1开始时间 < task2结束时间 && task1结束时间 > task2开始时间
+        return task1.display_start < task2.display_end && task1.display_end > task2.display_start;
+    }
+
+    // 对任务进行冲突感知排序
+    void sortTasksWithConflicts(SegmentList &segments, time_t day_time)
+    {
+        Trace::Span span("DayLayout::sortTasksWithConflicts", "layout");
+        AllocCounter::Scope alloc_scope("sortTasksWithConflicts");
+        // 计算当天 00:00
+        time_t start_of_day = startOfDay(day_time);
+
+        // 1. 标记冲突
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            segments[i].has_conflict = false;
+            segments[i].is_highest_priority_in_conflict = false;
+            for (size_t j = 0; j < segments.size(); ++j)
+            {
+                if (i != j && tasksOverlap(segments[i], segments[j]))
+                {
+                    segments[i].has_conflict = true;
+                    break;
+                }
+            }
+        }
+
+        // 2. 在每个冲突组中标记最高优先级
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            if (!segments[i].has_conflict)
+                continue;
+
+            // 找到冲突组（自身和与之重叠的片段）内最高（数值最小）的 priority
+            Priority highest = segments[i].priority;
+            for (size_t j = 0; j < segments.size(); ++j)
+            {
+                if (i != j && tasksOverlap(segments[i], segments[j]) &&
+                    static_cast<int>(segments[j].priority) < static_cast<int>(highest))
+                    highest = segments[j].priority;
+            }
+            if (segments[i].priority == highest)
+                segments[i].is_highest_priority_in_conflict = true;
+        }
+
+        // 3. 排序：按 display_start -> priority -> id
+        sort(segments.begin(), segments.end(),
+             [start_of_day](const TaskSegment &a, const TaskSegment &b)
+             {
+                 // 有效开始直接用 display_start，23:59 不会被误当成次日 00:00
+                 if (a.display_start != b.display_start)
+                     return a.display_start < b.display_start;
+                 // 相同开始时间，则高优先级（数值小）靠前
+                 if (a.priority != b.priority)
+                     return static_cast<int>(a.priority) < static_cast<int>(b.priority);
+                 // 最后按 id 保持稳定
+                 return a.id < b.id;
+             });
+    }
+
+    // 将任务涉及的每一天（当天零点）加入集合
+    void addTaskDays(const Task &task, set<time_t> &days)
+    {
+        time_t task_end = endTime(task);
+
+        // 将任务开始时间标准化为当天的零点
+        tm start_day_tm = *localtime(&task.startTime);
+        start_day_tm.tm_hour = 0;
+        start_day_tm.tm_min = 0;
+        start_day_tm.tm_sec = 0;
+        time_t start_day = mktime(&start_day_tm);
+
+        // 将任务结束时间标准化为当天的零点
+        tm end_day_tm = *localtime(&task_end);
+        end_day_tm.tm_hour = 0;
+        end_day_tm.tm_min = 0;
+        end_day_tm.tm_sec = 0;
+        time_t end_day = mktime(&end_day_tm);
+
+        // 为任务涉及的每一天都添加到缓存中
+        for (time_t current_day = start_day; current_day <= end_day; current_day += 86400)
+        {
+            days.insert(current_day);
+        }
+    }
+
+    Snapshot::Snapshot(vector<Task> tasks)
+        : m_tasks(move(tasks)), m_buffer(new byte[kInitialBytes]), m_arena(m_buffer.get(), kInitialBytes)
+    {
+    }
+
+    void Snapshot::reset(vector<Task> tasks)
+    {
+        m_tasks = move(tasks);
+        releaseSegments();
+    }
+
+    void Snapshot::releaseSegments()
+    {
+        // 归还向上游申请的内存，之后从初始缓冲区重新开始分配
+        m_arena.release();
+    }
+
+    SegmentList Snapshot::segmentsForDay(time_t day_time)
+    {
+        SegmentList segments = getTasksForDay(m_tasks, day_time, &m_arena);
+        sortTasksWithConflicts(segments, day_time);
+        return segments;
+    }
+}
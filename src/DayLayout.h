@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Task.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 某一天中一个任务的显示片段（跨天任务在每一天各有一个片段）
+// 片段不复制任务的字符串，只记录任务在所属任务列表中的下标，名称、分类等从任务本身读取；
+// id 和优先级是排序键，一并保存，排序时不需要回查任务
+struct TaskSegment
+{
+    uint32_t task_index; // 在 getTasksForDay 所用任务列表中的下标
+    Priority priority;
+    long long id;
+    time_t display_start;                 // 在当天显示的开始时间
+    time_t display_end;                   // 在当天显示的结束时间
+    bool is_cross_day;                    // 是否是跨天任务片段
+    bool is_first_segment;                // 是否是第一个片段（用于显示任务名称等）
+    bool has_conflict;                    // 是否与其他任务有时间冲突
+    bool is_highest_priority_in_conflict; // 是否是冲突组中的最高优先级任务
+};
+
+// 日期与冲突相关的计算（不依赖 GTK，供界面、命令行和基准测试共用）
+namespace DayLayout
+{
+    // 给定时刻所在当天的 00:00（本地时间）
+    time_t startOfDay(time_t t);
+
+    using SegmentList = pmr::vector<TaskSegment>;
+
+    // 任务的结束时刻
+    inline time_t endTime(const Task &task) { return task.startTime + task.duration * 60; }
+
+    // 获取某一天应该显示的任务片段，按 display_start 排序；片段内存从 resource 分配
+    SegmentList getTasksForDay(const vector<Task> &tasks, time_t day_time,
+                               pmr::memory_resource *resource = pmr::get_default_resource());
+
+    // 检查两个任务段是否重叠
+    bool tasksOverlap(const TaskSegment &task1, const TaskSegment &task2);
+
+    // 标记冲突和冲突组内的最高优先级，并按 display_start -> priority -> id 排序
+    void sortTasksWithConflicts(SegmentList &segments, time_t day_time);
+
+    // 一次界面刷新所用的任务快照和片段内存。
+    // 片段分配在单调内存池中，只追加不释放，reset 时整体回收；片段的 task_index 指向 tasks()
+    class Snapshot
+    {
+    public:
+        explicit Snapshot(vector<Task> tasks);
+
+        Snapshot(const Snapshot &) = delete;
+        Snapshot &operator=(const Snapshot &) = delete;
+
+        // 换成新的任务快照并回收之前分配的所有片段，调用前不能再有片段引用本对象
+        void reset(vector<Task> tasks);
+        // 只回收片段，任务快照不变
+        void releaseSegments();
+
+        const vector<Task> &tasks() const { return m_tasks; }
+        const Task &task(const TaskSegment &segment) const { return m_tasks[segment.task_index]; }
+
+        // 某一天排好序、标记好冲突的片段
+        SegmentList segmentsForDay(time_t day_time);
+
+    private:
+        static constexpr size_t kInitialBytes = 32 * 1024; // 约 800 个片段，普通的一次刷新不需要再向上游申请
+
+        vector<Task> m_tasks;
+        unique_ptr<byte[]> m_buffer;
+        pmr::monotonic_buffer_resource m_arena;
+    };
+
+    // 将任务涉及的每一天（当天零点）加入集合
+    void addTaskDays(const Task &task, set<time_t> &days);
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "IdleScheduler.h"
+#include "Metrics.h"
+#include "Trace.h"
+#include <algorithm>
+
+using namespace std;
+
+IdleScheduler::IdleScheduler(int64_t budget_us) : m_budget_us(budget_us)
+{
+}
+
+IdleScheduler::~IdleScheduler()
+{
+    if (m_idle_connection)
+        m_idle_connection.disconnect();
+}
+
+void IdleScheduler::post(const string &key, Priority priority, Step step)
+{
+    cancel(key);
+    m_jobs.push_back({key, priority, m_next_sequence++, make_shared<Step>(move(step))});
+    ensure_idle_source();
+}
+
+void IdleScheduler::cancel(const string &key)
+{
+    m_jobs.erase(remove_if(m_jobs.begin(), m_jobs.end(), [&key](const Job &job)
+                           { return job.key == key; }),
+                 m_jobs.end());
+}
+
+void IdleScheduler::cancel_all()
+{
+    m_jobs.clear();
+    if (m_idle_connection)
+        m_idle_connection.disconnect();
+}
+
+void IdleScheduler::set_priority(const string &key, Priority priority)
+{
+    for (Job &job : m_jobs)
+    {
+        if (job.key == key)
+            job.priority = priority;
+    }
+}
+
+bool IdleScheduler::is_pending(const string &key) const
+{
+    return any_of(m_jobs.begin(), m_jobs.end(), [&key](const Job &job)
+                  { return job.key == key; });
+}
+
+void IdleScheduler::ensure_idle_source()
+{
+    if (m_idle_connection.connected())
+        return;
+    // 默认空闲优先级低于 GDK 重绘，分片之间界面可以正常绘制
+    m_idle_connection = Glib::signal_idle().connect(sigc::mem_fun(*this, &IdleScheduler::on_idle),
+                                                    Glib::PRIORITY_DEFAULT_IDLE);
+}
+
+bool IdleScheduler::on_idle()
+{
+    Trace::Span trace_span("IdleScheduler 分片", "ui");
+    const int64_t frame_start = g_get_monotonic_time();
+    int64_t elapsed = 0;
+
+    while (!m_jobs.empty() && elapsed < m_budget_us)
+    {
+        // 取优先级最高、提交最早的任务
+        auto job_it = min_element(m_jobs.begin(), m_jobs.end(), [](const Job &a, const Job &b)
+                                  {
+                                      if (a.priority != b.priority)
+                                          return a.priority < b.priority;
+                                      return a.sequence < b.sequence; });
+
+        // 步骤执行期间可能提交或取消任务，先按 key 记下当前任务
+        string key = job_it->key;
+        uint64_t sequence = job_it->sequence;
+        shared_ptr<Step> step = job_it->step;
+        bool has_more = (*step)();
+        ++m_stats.steps;
+
+        if (!has_more)
+        {
+            m_jobs.erase(remove_if(m_jobs.begin(), m_jobs.end(), [&key, sequence](const Job &job)
+                                   { return job.key == key && job.sequence == sequence; }),
+                         m_jobs.end());
+        }
+        elapsed = g_get_monotonic_time() - frame_start;
+    }
+
+    // 超出预算的帧本来就已经拖慢了主循环，这里只记入统计和指标，不在主线程上输出
+    static Metrics::Histogram &frame_time = Metrics::histogram("scheduler_ui_idle_frame_seconds", "一次空闲分片的耗时");
+    static Metrics::Counter &overruns = Metrics::counter("scheduler_ui_idle_overruns_total", "超出时间预算的空闲分片数");
+    ++m_stats.frames;
+    m_stats.total_us += elapsed;
+    m_stats.max_frame_us = max(m_stats.max_frame_us, elapsed);
+    frame_time.record(elapsed);
+    if (elapsed > m_budget_us)
+    {
+        ++m_stats.overruns;
+        overruns.inc();
+    }
+
+    return !m_jobs.empty();
+}
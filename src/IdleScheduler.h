@@ -0,0 +1,74 @@
+#pragma once
+
+#include <glibmm.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 基于 Glib::signal_idle 的协作式分片调度器
+// 大的界面重建被拆成多个小步骤，每次空闲回调只执行不超过时间预算的步骤，
+// 空闲源的优先级低于重绘，因此每个分片之间 GTK 都有机会处理输入和绘制
+class IdleScheduler
+{
+public:
+    // 数值越小越先执行
+    enum class Priority
+    {
+        VISIBLE,   // 当前可见的内容（滚动到尚未构建完的列表区域时提升到这一级）
+        NORMAL,    // 可见区域之外的内容（列表首屏之后的行）
+        BACKGROUND // 缓存等不直接显示的数据
+    };
+
+    // 一个分片步骤：完成一小段工作，返回 true 表示还有剩余工作
+    using Step = function<bool()>;
+
+    // 统计信息：每次空闲回调视为一帧
+    struct Stats
+    {
+        uint64_t frames = 0;       // 执行过的分片（帧）数
+        uint64_t steps = 0;        // 执行过的步骤数
+        uint64_t overruns = 0;     // 超出预算的帧数
+        int64_t max_frame_us = 0;  // 单帧最长耗时（微秒）
+        int64_t total_us = 0;      // 累计耗时（微秒）
+    };
+
+    explicit IdleScheduler(int64_t budget_us = 4000);
+    ~IdleScheduler();
+
+    IdleScheduler(const IdleScheduler &) = delete;
+    IdleScheduler &operator=(const IdleScheduler &) = delete;
+
+    // 提交任务；相同 key 的未完成任务会被替换（例如同一个列表被重新构建）
+    void post(const string &key, Priority priority, Step step);
+    void cancel(const string &key);
+    void cancel_all();
+    // 调整尚未完成的任务的优先级，例如用户滚动到仍在分片构建的列表区域时提升为 VISIBLE；没有该任务时什么也不做
+    void set_priority(const string &key, Priority priority);
+    bool is_pending(const string &key) const;
+    bool is_idle() const { return m_jobs.empty(); }
+
+    const Stats &stats() const { return m_stats; }
+    int64_t budget_us() const { return m_budget_us; }
+
+private:
+    struct Job
+    {
+        string key;
+        Priority priority;
+        uint64_t sequence;     // 同优先级内按提交顺序执行
+        shared_ptr<Step> step; // 共享持有，步骤执行期间任务列表变化也不影响其状态
+    };
+
+    bool on_idle();
+    void ensure_idle_source();
+
+    int64_t m_budget_us;
+    uint64_t m_next_sequence = 0;
+    vector<Job> m_jobs;
+    sigc::connection m_idle_connection;
+    Stats m_stats;
+};
@@ -0,0 +1,298 @@
+#include "Logger.h"
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+    int64_t nowMicros()
+    {
+        return chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    long currentTid()
+    {
+        thread_local long tid = static_cast<long>(syscall(SYS_gettid));
+        return tid;
+    }
+
+    const char *envOr(const char *name, const char *fallback)
+    {
+        const char *value = getenv(name);
+        return value && *value ? value : fallback;
+    }
+}
+
+Logger &Logger::instance()
+{
+    // 不析构：其他静态对象析构时仍可能写日志，进程退出时由 atexit 停止后台线程并写出剩余消息
+    static Logger *logger = []()
+    {
+        Logger *created = new Logger();
+        atexit([]()
+               { Logger::instance().shutdown(); });
+        return created;
+    }();
+    return *logger;
+}
+
+Logger::Logger()
+{
+    for (size_t i = 0; i < kQueueCapacity; ++i)
+        m_slots[i].sequence.store(i, memory_order_relaxed);
+
+    m_level = parseLevel(envOr("SCHEDULER_LOG_LEVEL", "info"), LogLevel::INFO);
+    const char *file = getenv("SCHEDULER_LOG_FILE");
+    if (file && *file)
+        setFile(file, static_cast<size_t>(atol(envOr("SCHEDULER_LOG_MAX_KB", "1024"))) * 1024,
+                atoi(envOr("SCHEDULER_LOG_MAX_FILES", "3")));
+
+    m_thread = thread(&Logger::sinkLoop, this);
+}
+
+const char *Logger::levelName(LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::DEBUG:
+        return "DEBUG";
+    case LogLevel::INFO:
+        return "INFO";
+    case LogLevel::WARN:
+        return "WARN";
+    case LogLevel::ERROR:
+        return "ERROR";
+    case LogLevel::OFF:
+        return "OFF";
+    }
+    return "?";
+}
+
+LogLevel Logger::parseLevel(const string &name, LogLevel fallback)
+{
+    static const LogLevel kLevels[] = {LogLevel::DEBUG, LogLevel::INFO, LogLevel::WARN, LogLevel::ERROR, LogLevel::OFF};
+    for (LogLevel level : kLevels)
+    {
+        string upper;
+        for (char c : name)
+            upper += static_cast<char>(toupper(static_cast<unsigned char>(c)));
+        if (upper == levelName(level))
+            return level;
+    }
+    return fallback;
+}
+
+void Logger::setFile(const string &path, size_t max_bytes, int max_files)
+{
+    lock_guard<mutex> lock(m_sink_mutex);
+    if (m_file.is_open())
+        m_file.close();
+    m_path = path;
+    m_max_bytes = max_bytes > 0 ? max_bytes : 1024 * 1024;
+    m_max_files = max(0, max_files);
+    m_file_bytes = 0;
+    if (m_path.empty())
+        return;
+
+    m_file.open(m_path, ios::out | ios::app);
+    if (!m_file.is_open())
+    {
+        cerr << "无法打开日志文件 " << m_path << "，改为输出到标准错误" << endl;
+        m_path.clear();
+        return;
+    }
+    m_file.seekp(0, ios::end);
+    m_file_bytes = static_cast<size_t>(max<streamoff>(0, m_file.tellp()));
+}
+
+void Logger::log(LogLevel level, const char *tag, string message)
+{
+    Record record{nowMicros(), currentTid(), level, tag, move(message)};
+
+    if (m_stopping.load(memory_order_acquire))
+    {
+        // 后台线程已经停止（进程正在退出），直接写出
+        lock_guard<mutex> lock(m_sink_mutex);
+        write(record);
+        if (m_file.is_open())
+            m_file.flush();
+        return;
+    }
+
+    if (!tryPush(move(record)))
+    {
+        m_dropped.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+    m_accepted.fetch_add(1, memory_order_release);
+
+    // 与 sinkLoop 中的栅栏配对（Dekker 式）：写入槽位和读取休眠标记不能重排，
+    // 后台线程要么在再次检查时看到这条消息，要么这里看到它已休眠并唤醒它
+    atomic_thread_fence(memory_order_seq_cst);
+    if (m_sleeping.load(memory_order_relaxed))
+    {
+        lock_guard<mutex> lock(m_wake_mutex);
+        m_wake.notify_one();
+    }
+}
+
+bool Logger::tryPush(Record &&record)
+{
+    uint64_t pos = m_enqueue_pos.load(memory_order_relaxed);
+    Slot *slot;
+    while (true)
+    {
+        slot = &m_slots[pos % kQueueCapacity];
+        uint64_t sequence = slot->sequence.load(memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0)
+        {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false; // 队列已满
+        else
+            pos = m_enqueue_pos.load(memory_order_relaxed);
+    }
+    slot->record = move(record);
+    slot->sequence.store(pos + 1, memory_order_release);
+    return true;
+}
+
+bool Logger::hasPending() const
+{
+    const Slot &slot = m_slots[m_dequeue_pos % kQueueCapacity];
+    return slot.sequence.load(memory_order_acquire) == m_dequeue_pos + 1;
+}
+
+bool Logger::tryPop(Record &record)
+{
+    if (!hasPending())
+        return false;
+    Slot &slot = m_slots[m_dequeue_pos % kQueueCapacity];
+    record = move(slot.record);
+    slot.sequence.store(m_dequeue_pos + kQueueCapacity, memory_order_release);
+    ++m_dequeue_pos;
+    return true;
+}
+
+void Logger::sinkLoop()
+{
+    Record record;
+    while (true)
+    {
+        uint64_t batch = 0;
+        {
+            lock_guard<mutex> lock(m_sink_mutex);
+            while (tryPop(record))
+            {
+                write(record);
+                ++batch;
+            }
+            if (batch > 0)
+            {
+                // 每批只刷新一次
+                if (m_file.is_open())
+                    m_file.flush();
+                else
+                    cerr.flush();
+            }
+        }
+        if (batch > 0)
+        {
+            m_written.fetch_add(batch, memory_order_release);
+            lock_guard<mutex> lock(m_wake_mutex);
+            m_flushed.notify_all();
+        }
+
+        unique_lock<mutex> lock(m_wake_mutex);
+        if (m_stopping.load(memory_order_acquire) && !hasPending())
+            return;
+        m_sleeping.store(true, memory_order_relaxed);
+        // 设置休眠标记后再检查一次，避免错过刚放入的消息；栅栏保证这次检查不会提前到设置标记之前，
+        // 唤醒因此不会丢失，空闲时无需定时醒来
+        atomic_thread_fence(memory_order_seq_cst);
+        if (!hasPending() && !m_stopping.load(memory_order_acquire))
+            m_wake.wait(lock);
+        m_sleeping.store(false, memory_order_relaxed);
+    }
+}
+
+void Logger::flush()
+{
+    uint64_t target = m_accepted.load(memory_order_acquire);
+    unique_lock<mutex> lock(m_wake_mutex);
+    m_wake.notify_one();
+    while (m_written.load(memory_order_acquire) < target && !m_stopping.load(memory_order_acquire))
+        m_flushed.wait_for(lock, chrono::milliseconds(50));
+}
+
+void Logger::shutdown()
+{
+    {
+        lock_guard<mutex> lock(m_wake_mutex);
+        if (m_stopping.exchange(true))
+            return;
+        m_wake.notify_one();
+    }
+    if (m_thread.joinable())
+        m_thread.join();
+
+    uint64_t dropped = m_dropped.load();
+    if (dropped > 0)
+        cerr << "日志队列已满，共丢弃 " << dropped << " 条消息" << endl;
+}
+
+void Logger::write(const Record &record)
+{
+    time_t seconds = static_cast<time_t>(record.time_us / 1000000);
+    tm local = {};
+    localtime_r(&seconds, &local);
+    char prefix[64];
+    size_t len = strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &local);
+    snprintf(prefix + len, sizeof(prefix) - len, ".%03d %-5s", static_cast<int>(record.time_us / 1000 % 1000),
+             levelName(record.level));
+
+    string line;
+    line.reserve(record.message.size() + 64);
+    line += prefix;
+    line += " [";
+    line += record.tag;
+    line += "] tid=";
+    line += to_string(record.tid);
+    line += ' ';
+    line += record.message;
+    line += '\n';
+
+    if (!m_file.is_open())
+    {
+        cerr << line;
+        return;
+    }
+    if (m_file_bytes + line.size() > m_max_bytes)
+        rotateIfNeeded();
+    m_file << line;
+    m_file_bytes += line.size();
+}
+
+// 当前文件改名为 .1，原有的 .1 ~ .N-1 依次后移，超出保留数量的删除
+void Logger::rotateIfNeeded()
+{
+    m_file.close();
+    if (m_max_files > 0)
+    {
+        remove((m_path + "." + to_string(m_max_files)).c_str());
+        for (int i = m_max_files - 1; i >= 1; --i)
+            rename((m_path + "." + to_string(i)).c_str(), (m_path + "." + to_string(i + 1)).c_str());
+        rename(m_path.c_str(), (m_path + ".1").c_str());
+    }
+    m_file.open(m_path, ios::out | ios::trunc);
+    m_file_bytes = 0;
+}
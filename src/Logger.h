@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// 异步分级日志
+// 调用线程只格式化消息并放入无锁的环形队列，由后台线程批量写出，不再每条消息 endl 刷新一次。
+// 默认写到标准错误；设置 SCHEDULER_LOG_FILE 后写入文件，超过 SCHEDULER_LOG_MAX_KB（默认 1024）时轮转，
+// 保留 <文件>.1 ~ <文件>.N（N 为 SCHEDULER_LOG_MAX_FILES，默认 3）。运行时级别由 SCHEDULER_LOG_LEVEL 设置。
+// 队列满时丢弃消息并计数，不阻塞调用线程。
+//
+// 用法: LOG_INFO("TaskManager", "正在添加任务: " << name << ", ID为: " << id);
+// LOG_DEBUG 在编译期按 SCHEDULER_LOG_COMPILE_LEVEL 去除（Release 构建默认去除）
+enum class LogLevel
+{
+    DEBUG,
+    INFO,
+    WARN,
+    ERROR,
+    OFF
+};
+
+class Logger
+{
+public:
+    static Logger &instance();
+
+    bool enabled(LogLevel level) const { return level >= m_level.load(memory_order_relaxed); }
+    void setLevel(LogLevel level) { m_level = level; }
+    // path 为空时写到标准错误
+    void setFile(const string &path, size_t max_bytes = 1024 * 1024, int max_files = 3);
+
+    void log(LogLevel level, const char *tag, string message);
+    // 等待队列中已有的消息全部写出
+    void flush();
+    // 停止后台线程并写出剩余消息（进程退出时自动调用），之后的消息在调用线程同步写出
+    void shutdown();
+
+    uint64_t droppedCount() const { return m_dropped.load(memory_order_relaxed); }
+
+    static const char *levelName(LogLevel level);
+    static LogLevel parseLevel(const string &name, LogLevel fallback);
+
+    Logger(const Logger &) = delete;
+    Logger &operator=(const Logger &) = delete;
+
+private:
+    Logger();
+    ~Logger() = default;
+
+    struct Record
+    {
+        int64_t time_us;
+        long tid;
+        LogLevel level;
+        const char *tag;
+        string message;
+    };
+
+    // 有界多生产者环形队列（每个槽位带序号，生产者之间只用 CAS 竞争写入位置）
+    struct Slot
+    {
+        atomic<uint64_t> sequence;
+        Record record;
+    };
+    static constexpr size_t kQueueCapacity = 8192;
+
+    bool tryPush(Record &&record);
+    bool tryPop(Record &record);
+    bool hasPending() const;
+    void sinkLoop();
+    void write(const Record &record); // 调用时需持有 m_sink_mutex
+    void rotateIfNeeded();
+
+    atomic<LogLevel> m_level{LogLevel::INFO};
+    array<Slot, kQueueCapacity> m_slots;
+    atomic<uint64_t> m_enqueue_pos{0};
+    uint64_t m_dequeue_pos = 0; // 只由后台线程访问
+    atomic<uint64_t> m_dropped{0};
+    atomic<uint64_t> m_written{0};
+    atomic<uint64_t> m_accepted{0};
+
+    // 后台线程空闲时在条件变量上休眠，生产者只在它休眠时才加锁唤醒
+    mutex m_wake_mutex;
+    condition_variable m_wake;
+    condition_variable m_flushed;
+    atomic<bool> m_sleeping{false};
+    atomic<bool> m_stopping{false};
+
+    // 输出目标只由后台线程使用（setFile 时加锁）
+    mutex m_sink_mutex;
+    string m_path;
+    ofstream m_file;
+    size_t m_file_bytes = 0;
+    size_t m_max_bytes = 1024 * 1024;
+    int m_max_files = 3;
+
+    thread m_thread;
+};
+
+#ifndef SCHEDULER_LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define SCHEDULER_LOG_COMPILE_LEVEL 1
+#else
+#define SCHEDULER_LOG_COMPILE_LEVEL 0
+#endif
+#endif
+
+#define SCHEDULER_LOG(level, tag, expr)                                 \
+    do                                                                  \
+    {                                                                   \
+        Logger &scheduler_logger_ = Logger::instance();                 \
+        if (scheduler_logger_.enabled(level))                           \
+        {                                                               \
+            ostringstream scheduler_log_stream_;                        \
+            scheduler_log_stream_ << expr;                              \
+            scheduler_logger_.log(level, tag, scheduler_log_stream_.str()); \
+        }                                                               \
+    } while (0)
+
+#if SCHEDULER_LOG_COMPILE_LEVEL <= 0
+#define LOG_DEBUG(tag, expr) SCHEDULER_LOG(LogLevel::DEBUG, tag, expr)
+#else
+#define LOG_DEBUG(tag, expr) \
+    do                       \
+    {                        \
+    } while (0)
+#endif
+#define LOG_INFO(tag, expr) SCHEDULER_LOG(LogLevel::INFO, tag, expr)
+#define LOG_WARN(tag, expr) SCHEDULER_LOG(LogLevel::WARN, tag, expr)
+#define LOG_ERROR(tag, expr) SCHEDULER_LOG(LogLevel::ERROR, tag, expr)
\ No newline at end of file
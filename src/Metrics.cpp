@@ -0,0 +1,205 @@
+#include "Metrics.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+using namespace std;
+
+namespace Metrics
+{
+    int Histogram::bucketIndex(int64_t micros)
+    {
+        if (micros < kSubBuckets)
+            return micros < 0 ? 0 : static_cast<int>(micros);
+        int exponent = 63 - __builtin_clzll(static_cast<uint64_t>(micros));
+        if (exponent > kMaxExponent)
+            return kBucketCount - 1;
+        int sub = static_cast<int>((micros >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+        return kSubBuckets + (exponent - kSubBucketBits) * kSubBuckets + sub;
+    }
+
+    int64_t Histogram::bucketUpperBound(int index)
+    {
+        if (index < kSubBuckets)
+            return index;
+        int exponent = (index - kSubBuckets) / kSubBuckets + kSubBucketBits;
+        int sub = (index - kSubBuckets) % kSubBuckets;
+        return (static_cast<int64_t>(kSubBuckets + sub + 1) << (exponent - kSubBucketBits)) - 1;
+    }
+
+    void Histogram::record(int64_t micros)
+    {
+        if (micros < 0)
+            micros = 0;
+        m_buckets[bucketIndex(micros)].fetch_add(1, memory_order_relaxed);
+        m_sum.fetch_add(static_cast<uint64_t>(micros), memory_order_relaxed);
+        m_count.fetch_add(1, memory_order_relaxed);
+    }
+
+    int64_t Histogram::percentile(double q) const
+    {
+        uint64_t total = count();
+        if (total == 0)
+            return 0;
+        uint64_t target = static_cast<uint64_t>(q * total);
+        if (target >= total)
+            target = total - 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < kBucketCount; ++i)
+        {
+            seen += m_buckets[i].load(memory_order_relaxed);
+            if (seen > target)
+                return bucketUpperBound(i);
+        }
+        return bucketUpperBound(kBucketCount - 1);
+    }
+
+    uint64_t Histogram::countAtOrBelow(int64_t micros) const
+    {
+        uint64_t result = 0;
+        for (int i = 0; i < kBucketCount && bucketUpperBound(i) <= micros; ++i)
+            result += m_buckets[i].load(memory_order_relaxed);
+        return result;
+    }
+
+    namespace
+    {
+        enum class Type
+        {
+            COUNTER,
+            GAUGE,
+            HISTOGRAM
+        };
+
+        struct Entry
+        {
+            string name;
+            string help;
+            string labels;
+            Type type;
+            unique_ptr<Counter> counter;
+            unique_ptr<Gauge> gauge;
+            unique_ptr<Histogram> histogram;
+        };
+
+        // 导出时使用的桶边界（秒）
+        const double kExportBuckets[] = {0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025,
+                                         0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60, 300};
+
+        mutex registry_mutex;
+
+        // 按 "名称{标签}" 排序，同名的指标连续输出
+        map<string, Entry> &registry()
+        {
+            static map<string, Entry> entries;
+            return entries;
+        }
+
+        Entry &lookup(const string &name, const string &help, const string &labels, Type type)
+        {
+            lock_guard<mutex> lock(registry_mutex);
+            Entry &entry = registry()[name + "{" + labels + "}"];
+            if (entry.name.empty())
+            {
+                entry.name = name;
+                entry.help = help;
+                entry.labels = labels;
+                entry.type = type;
+                if (type == Type::COUNTER)
+                    entry.counter = make_unique<Counter>();
+                else if (type == Type::GAUGE)
+                    entry.gauge = make_unique<Gauge>();
+                else
+                    entry.histogram = make_unique<Histogram>();
+            }
+            else if (entry.type != type)
+            {
+                // 同一名称和标签先后按不同类型注册是编程错误，继续下去会解引用空指针
+                fprintf(stderr, "指标 %s{%s} 已按另一种类型注册\n", name.c_str(), labels.c_str());
+                abort();
+            }
+            return entry;
+        }
+
+        string withLabels(const string &labels, const string &extra = "")
+        {
+            if (labels.empty() && extra.empty())
+                return "";
+            if (labels.empty() || extra.empty())
+                return "{" + labels + extra + "}";
+            return "{" + labels + "," + extra + "}";
+        }
+
+        // 桶边界保持 %g 的短格式（le 标签的取值不变）；_sum 用 17 位有效数字，
+        // 累计到数千秒以上时 %g 的 6 位会截断，rate(_sum) 随之抖动
+        string formatSeconds(double seconds, bool exact = false)
+        {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), exact ? "%.17g" : "%g", seconds);
+            return buffer;
+        }
+    }
+
+    Counter &counter(const string &name, const string &help, const string &labels)
+    {
+        return *lookup(name, help, labels, Type::COUNTER).counter;
+    }
+
+    Gauge &gauge(const string &name, const string &help, const string &labels)
+    {
+        return *lookup(name, help, labels, Type::GAUGE).gauge;
+    }
+
+    Histogram &histogram(const string &name, const string &help, const string &labels)
+    {
+        return *lookup(name, help, labels, Type::HISTOGRAM).histogram;
+    }
+
+    string renderPrometheus()
+    {
+        lock_guard<mutex> lock(registry_mutex);
+        ostringstream out;
+        string family;
+        for (const auto &item : registry())
+        {
+            const Entry &entry = item.second;
+            if (entry.name != family)
+            {
+                family = entry.name;
+                static const char *kTypeNames[] = {"counter", "gauge", "histogram"};
+                out << "# HELP " << entry.name << " " << entry.help << "\n";
+                out << "# TYPE " << entry.name << " " << kTypeNames[static_cast<int>(entry.type)] << "\n";
+            }
+
+            switch (entry.type)
+            {
+            case Type::COUNTER:
+                out << entry.name << withLabels(entry.labels) << " " << entry.counter->value() << "\n";
+                break;
+            case Type::GAUGE:
+                out << entry.name << withLabels(entry.labels) << " " << entry.gauge->value() << "\n";
+                break;
+            case Type::HISTOGRAM:
+            {
+                const Histogram &h = *entry.histogram;
+                for (double le : kExportBuckets)
+                {
+                    out << entry.name << "_bucket" << withLabels(entry.labels, "le=\"" + formatSeconds(le) + "\"") << " "
+                        << h.countAtOrBelow(static_cast<int64_t>(le * 1e6)) << "\n";
+                }
+                // 总数也从各桶累加，与上面的累积桶保持单调
+                uint64_t total = h.countAtOrBelow(INT64_MAX);
+                out << entry.name << "_bucket" << withLabels(entry.labels, "le=\"+Inf\"") << " " << total << "\n";
+                out << entry.name << "_sum" << withLabels(entry.labels) << " " << formatSeconds(h.sumMicros() / 1e6, true) << "\n";
+                out << entry.name << "_count" << withLabels(entry.labels) << " " << total << "\n";
+                break;
+            }
+            }
+        }
+        return out.str();
+    }
+}
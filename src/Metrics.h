@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// 进程内的指标：计数器、仪表和延迟直方图
+// 注册时加锁，之后的更新只有原子操作；指标对象在进程生命周期内地址不变，
+// 热路径上用函数内的静态引用缓存，例如:
+//   static Metrics::Histogram &load_time = Metrics::histogram("scheduler_task_load_seconds", "读取任务文件的耗时");
+//   Metrics::ScopedTimer timer(load_time);
+// 导出为 Prometheus 文本格式，见 MetricsExporter
+namespace Metrics
+{
+    class Counter
+    {
+    public:
+        void inc(uint64_t n = 1) { m_value.fetch_add(n, memory_order_relaxed); }
+        uint64_t value() const { return m_value.load(memory_order_relaxed); }
+
+    private:
+        atomic<uint64_t> m_value{0};
+    };
+
+    class Gauge
+    {
+    public:
+        void set(int64_t v) { m_value.store(v, memory_order_relaxed); }
+        void add(int64_t n) { m_value.fetch_add(n, memory_order_relaxed); }
+        // 只在 v 大于当前值时更新，多个线程同时更新时保留最大值
+        void setMax(int64_t v)
+        {
+            int64_t current = m_value.load(memory_order_relaxed);
+            while (v > current && !m_value.compare_exchange_weak(current, v, memory_order_relaxed))
+            {
+            }
+        }
+        int64_t value() const { return m_value.load(memory_order_relaxed); }
+
+    private:
+        atomic<int64_t> m_value{0};
+    };
+
+    // HDR 风格的对数-线性直方图，数值单位为微秒：
+    // 每个 2 的幂区间再等分为 16 个子桶，相对误差不超过 1/16，覆盖 0 到约 2^40 微秒（约 12 天）
+    class Histogram
+    {
+    public:
+        static constexpr int kSubBucketBits = 4;
+        static constexpr int kSubBuckets = 1 << kSubBucketBits;
+        static constexpr int kMaxExponent = 40;
+        static constexpr int kBucketCount = (kMaxExponent - kSubBucketBits + 1) * kSubBuckets + kSubBuckets;
+
+        void record(int64_t micros);
+        uint64_t count() const { return m_count.load(memory_order_relaxed); }
+        uint64_t sumMicros() const { return m_sum.load(memory_order_relaxed); }
+        // 百分位（0~1），返回所在子桶的上界，没有数据时返回 0
+        int64_t percentile(double q) const;
+        // 小于等于 micros 的记录数，用于导出 Prometheus 的累积桶
+        uint64_t countAtOrBelow(int64_t micros) const;
+
+        static int bucketIndex(int64_t micros);
+        static int64_t bucketUpperBound(int index);
+
+    private:
+        array<atomic<uint64_t>, kBucketCount> m_buckets{};
+        atomic<uint64_t> m_count{0};
+        atomic<uint64_t> m_sum{0};
+    };
+
+    // 同名指标返回同一个对象；labels 为 Prometheus 标签，例如 "op=\"add\""
+    Counter &counter(const string &name, const string &help, const string &labels = "");
+    Gauge &gauge(const string &name, const string &help, const string &labels = "");
+    Histogram &histogram(const string &name, const string &help, const string &labels = "");
+
+    // 所有已注册指标的 Prometheus 文本格式
+    string renderPrometheus();
+
+    // 作用域计时，析构时把耗时（微秒）记入直方图
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Histogram &histogram) : m_histogram(histogram), m_start(chrono::steady_clock::now()) {}
+        ~ScopedTimer()
+        {
+            m_histogram.record(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start).count());
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        Histogram &m_histogram;
+        chrono::steady_clock::time_point m_start;
+    };
+}
\ No newline at end of file
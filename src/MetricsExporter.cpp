@@ -0,0 +1,248 @@
+#include "MetricsExporter.h"
+#include "Metrics.h"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+MetricsExporter::~MetricsExporter()
+{
+    stop();
+}
+
+namespace
+{
+    // 把 suffix 插在文件名的扩展名之前（没有扩展名时接在末尾），保留 textfile 收集器要求的 .prom
+    string withSuffix(const string &path, const string &suffix)
+    {
+        if (path.empty() || suffix.empty())
+            return path;
+        size_t slash = path.rfind('/');
+        size_t dot = path.rfind('.');
+        if (dot == string::npos || (slash != string::npos && dot < slash) || dot == (slash == string::npos ? 0 : slash + 1))
+            return path + suffix;
+        return path.substr(0, dot) + suffix + path.substr(dot);
+    }
+
+    // 路径上的套接字是否仍有进程在监听（连接被拒绝或文件不存在说明是异常退出留下的）
+    bool socketInUse(const sockaddr_un &addr)
+    {
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+            return false;
+        bool in_use = connect(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) == 0;
+        close(fd);
+        return in_use;
+    }
+}
+
+bool MetricsExporter::startFromEnvironment(const string &suffix)
+{
+    const char *file = getenv("SCHEDULER_METRICS_FILE");
+    const char *socket = getenv("SCHEDULER_METRICS_SOCKET");
+    const char *interval = getenv("SCHEDULER_METRICS_INTERVAL");
+    if ((!file || !*file) && (!socket || !*socket))
+        return false;
+    return start(withSuffix(file ? file : "", suffix), withSuffix(socket ? socket : "", suffix), interval ? atoi(interval) : 15);
+}
+
+bool MetricsExporter::start(const string &file_path, const string &socket_path, int interval_seconds)
+{
+    stop();
+    m_file_path = file_path;
+    m_socket_path = socket_path;
+    m_interval_seconds = interval_seconds > 0 ? interval_seconds : 15;
+
+    if (!m_socket_path.empty())
+    {
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        if (m_socket_path.size() >= sizeof(addr.sun_path))
+        {
+            cerr << "指标套接字路径过长: " << m_socket_path << endl;
+            return false;
+        }
+        strcpy(addr.sun_path, m_socket_path.c_str());
+        if (socketInUse(addr))
+        {
+            cerr << "指标套接字 " << m_socket_path << " 已被另一个进程使用" << endl;
+            m_socket_path.clear();
+            return false;
+        }
+        unlink(m_socket_path.c_str()); // 上次异常退出留下的套接字文件
+
+        // 套接字文件在 bind 时按 umask 创建，先收紧 umask，使其从创建起就只有当前用户可以抓取
+        // （bind 之后再 chmod 会留下一段按原 umask 可访问的窗口）。umask 是进程级的，这期间其他线程创建的文件同样只对当前用户开放
+        m_listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        bool bound = false;
+        if (m_listen_fd >= 0)
+        {
+            mode_t old_mask = umask(0177);
+            bound = bind(m_listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0;
+            umask(old_mask);
+        }
+        if (!bound || listen(m_listen_fd, 4) != 0)
+        {
+            cerr << "无法监听指标套接字 " << m_socket_path << ": " << strerror(errno) << endl;
+            if (m_listen_fd >= 0)
+                close(m_listen_fd);
+            m_listen_fd = -1;
+            m_socket_path.clear();
+            return false;
+        }
+        struct stat st;
+        if (stat(m_socket_path.c_str(), &st) == 0)
+        {
+            m_socket_dev = st.st_dev;
+            m_socket_ino = st.st_ino;
+        }
+    }
+
+    m_wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_wake_fd < 0)
+    {
+        cerr << "无法创建 eventfd: " << strerror(errno) << endl;
+        stop();
+        return false;
+    }
+
+    m_thread = thread(&MetricsExporter::run, this);
+    cout << "指标导出已启动"
+         << (m_file_path.empty() ? "" : "，文件: " + m_file_path)
+         << (m_socket_path.empty() ? "" : "，套接字: " + m_socket_path) << endl;
+    return true;
+}
+
+void MetricsExporter::stop()
+{
+    if (m_thread.joinable())
+    {
+        uint64_t one = 1;
+        if (write(m_wake_fd, &one, sizeof(one)) < 0)
+            cerr << "无法唤醒指标导出线程: " << strerror(errno) << endl;
+        m_thread.join();
+        // 退出前写最后一次，保留进程结束时的数值
+        if (!m_file_path.empty())
+            writeFile();
+    }
+    if (m_listen_fd >= 0)
+    {
+        close(m_listen_fd);
+        // 路径可能已经被别的进程换成了它自己的套接字，只删除本进程创建的那个文件
+        struct stat st;
+        if (stat(m_socket_path.c_str(), &st) == 0 && st.st_dev == m_socket_dev && st.st_ino == m_socket_ino)
+            unlink(m_socket_path.c_str());
+        m_listen_fd = -1;
+    }
+    if (m_wake_fd >= 0)
+    {
+        close(m_wake_fd);
+        m_wake_fd = -1;
+    }
+}
+
+void MetricsExporter::run()
+{
+    auto next_write = chrono::steady_clock::now();
+    while (true)
+    {
+        if (!m_file_path.empty() && chrono::steady_clock::now() >= next_write)
+        {
+            writeFile();
+            next_write = chrono::steady_clock::now() + chrono::seconds(m_interval_seconds);
+        }
+
+        int timeout_ms = -1;
+        if (!m_file_path.empty())
+            timeout_ms = static_cast<int>(max<int64_t>(0, chrono::duration_cast<chrono::milliseconds>(
+                                                             next_write - chrono::steady_clock::now())
+                                                             .count()));
+
+        pollfd fds[2] = {{m_wake_fd, POLLIN, 0}, {m_listen_fd, POLLIN, 0}};
+        int ready = poll(fds, m_listen_fd >= 0 ? 2 : 1, timeout_ms);
+        if (ready < 0 && errno != EINTR)
+        {
+            cerr << "指标导出线程 poll 失败: " << strerror(errno) << endl;
+            return;
+        }
+        if (fds[0].revents & POLLIN)
+            return;
+        if (m_listen_fd >= 0 && (fds[1].revents & POLLIN))
+        {
+            int client = accept4(m_listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client >= 0)
+            {
+                serveClient(client);
+                close(client);
+            }
+        }
+    }
+}
+
+void MetricsExporter::writeFile()
+{
+    string tmp_path = m_file_path + ".tmp";
+    {
+        ofstream out(tmp_path, ios::out | ios::trunc);
+        if (!out.is_open())
+        {
+            cerr << "无法写入指标文件: " << tmp_path << endl;
+            return;
+        }
+        out << Metrics::renderPrometheus();
+    }
+    if (rename(tmp_path.c_str(), m_file_path.c_str()) != 0)
+        cerr << "无法更新指标文件 " << m_file_path << ": " << strerror(errno) << endl;
+}
+
+void MetricsExporter::serveClient(int client_fd)
+{
+    // 等待最多 100 毫秒读取请求；没有请求（例如 socat 只读）时直接返回文本
+    char request[512];
+    ssize_t len = 0;
+    pollfd pfd = {client_fd, POLLIN, 0};
+    if (poll(&pfd, 1, 100) > 0)
+        len = recv(client_fd, request, sizeof(request), MSG_DONTWAIT);
+
+    string body = Metrics::renderPrometheus();
+    string response;
+    if (len >= 4 && memcmp(request, "GET ", 4) == 0)
+    {
+        response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\nContent-Length: " +
+                   to_string(body.size()) + "\r\nConnection: close\r\n\r\n";
+    }
+    response += body;
+
+    const char *p = response.data();
+    size_t remaining = response.size();
+    while (remaining > 0)
+    {
+        ssize_t written = send(client_fd, p, remaining, MSG_NOSIGNAL);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN)
+            {
+                pollfd out = {client_fd, POLLOUT, 0};
+                if (poll(&out, 1, 1000) > 0)
+                    continue;
+            }
+            return;
+        }
+        p += written;
+        remaining -= static_cast<size_t>(written);
+    }
+}
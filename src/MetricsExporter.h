@@ -0,0 +1,44 @@
+#pragma once
+
+#include <sys/types.h>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// 把 Metrics 中的指标以 Prometheus 文本格式导出，在独立线程中运行：
+// - 指标文件：每隔 interval 秒写一次（先写临时文件再改名，可直接交给 node_exporter 的 textfile 收集器）
+// - Unix 套接字：每个连接返回一次当前指标；请求以 "GET " 开头时按 HTTP 应答，
+//   因此 curl --unix-socket <路径> http://localhost/metrics 和 socat 都可以抓取
+class MetricsExporter
+{
+public:
+    MetricsExporter() = default;
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter &) = delete;
+    MetricsExporter &operator=(const MetricsExporter &) = delete;
+
+    // 读取 SCHEDULER_METRICS_FILE、SCHEDULER_METRICS_SOCKET、SCHEDULER_METRICS_INTERVAL，
+    // 两个路径都未设置时不启动，返回 false。
+    // 图形界面和守护进程读取同一组变量，suffix 插在两个路径的扩展名之前区分进程，
+    // 例如守护进程传 ".reminderd"，metrics.prom 变为 metrics.reminderd.prom
+    bool startFromEnvironment(const string &suffix = "");
+    // 任一路径可以为空。套接字路径上已有仍在应答的套接字（另一个进程正在导出）时不接管，返回 false
+    bool start(const string &file_path, const string &socket_path, int interval_seconds = 15);
+    void stop();
+
+private:
+    void run();
+    void writeFile();
+    void serveClient(int client_fd);
+
+    string m_file_path;
+    string m_socket_path;
+    int m_interval_seconds = 15;
+    int m_listen_fd = -1;
+    dev_t m_socket_dev = 0; // 本进程创建的套接字文件，停止时只删除仍是它的路径
+    ino_t m_socket_ino = 0;
+    int m_wake_fd = -1;
+    thread m_thread;
+};
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include "NotificationCenter.h"
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+NotificationCenter::NotificationCenter() : m_text_box(Gtk::ORIENTATION_VERTICAL, 2)
+{
+    set_transition_type(Gtk::REVEALER_TRANSITION_TYPE_SLIDE_DOWN);
+    set_reveal_child(false);
+
+    m_title_label.set_xalign(0);
+    m_body_label.set_xalign(0);
+    m_body_label.set_line_wrap(true);
+    m_body_label.set_max_width_chars(60);
+    m_more_label.set_xalign(0);
+    m_more_label.get_style_context()->add_class("remind-label");
+
+    m_text_box.pack_start(m_title_label, Gtk::PACK_SHRINK);
+    m_text_box.pack_start(m_body_label, Gtk::PACK_SHRINK);
+    m_text_box.pack_start(m_more_label, Gtk::PACK_SHRINK);
+
+    m_info_bar.set_message_type(Gtk::MESSAGE_INFO);
+    m_info_bar.set_show_close_button(true);
+    if (auto *content = dynamic_cast<Gtk::Container *>(m_info_bar.get_content_area()))
+        content->add(m_text_box);
+    m_info_bar.signal_response().connect(sigc::mem_fun(*this, &NotificationCenter::on_info_bar_response));
+
+    add(m_info_bar);
+    show_all();
+    m_more_label.hide();
+}
+
+void NotificationCenter::post(const string &title, const string &body, bool desktop)
+{
+    Notification notification{title, body};
+    if (desktop && m_desktop_enabled)
+        send_desktop(notification);
+
+    m_queue.push_back(move(notification));
+    if (m_queue.size() > kMaxQueued)
+    {
+        cerr << "通知队列已满，丢弃最早的一条通知" << endl;
+        m_queue.pop_front();
+    }
+
+    if (!m_showing)
+        show_next();
+    else
+        update_more_label();
+}
+
+void NotificationCenter::show_next()
+{
+    if (m_queue.empty())
+    {
+        m_showing = false;
+        set_reveal_child(false);
+        return;
+    }
+
+    const Notification &notification = m_queue.front();
+    m_title_label.set_markup("<b>" + Glib::Markup::escape_text(notification.title) + "</b>");
+    m_body_label.set_text(notification.body);
+    m_queue.pop_front();
+    update_more_label();
+
+    m_showing = true;
+    set_reveal_child(true);
+
+    m_dismiss_timer.disconnect();
+    m_dismiss_timer = Glib::signal_timeout().connect([this]()
+                                                     {
+        dismiss_current();
+        return false; }, kDisplayMs);
+}
+
+void NotificationCenter::dismiss_current()
+{
+    m_dismiss_timer.disconnect();
+    show_next();
+}
+
+void NotificationCenter::on_info_bar_response(int)
+{
+    dismiss_current();
+}
+
+void NotificationCenter::update_more_label()
+{
+    if (m_queue.empty())
+    {
+        m_more_label.hide();
+        return;
+    }
+    m_more_label.set_text("还有 " + to_string(m_queue.size()) + " 条通知");
+    m_more_label.show();
+}
+
+void NotificationCenter::send_desktop(const Notification &notification)
+{
+    if (m_bus)
+    {
+        call_notify(notification);
+        return;
+    }
+
+    // 首次使用时异步连接会话总线，连接建立前的通知先缓存
+    m_desktop_backlog.push_back(notification);
+    if (m_desktop_backlog.size() > kMaxQueued)
+        m_desktop_backlog.pop_front();
+    if (!m_bus_requested)
+    {
+        m_bus_requested = true;
+        Gio::DBus::Connection::get(Gio::DBus::BUS_TYPE_SESSION, sigc::mem_fun(*this, &NotificationCenter::on_bus_ready));
+    }
+}
+
+void NotificationCenter::on_bus_ready(Glib::RefPtr<Gio::AsyncResult> &result)
+{
+    try
+    {
+        m_bus = Gio::DBus::Connection::get_finish(result);
+    }
+    catch (const Glib::Error &ex)
+    {
+        cerr << "无法连接会话总线，停用桌面通知: " << ex.what() << endl;
+        m_desktop_enabled = false;
+        m_desktop_backlog.clear();
+        return;
+    }
+
+    // 积压的通知只发最后一条，前面的已经由它替换
+    if (!m_desktop_backlog.empty())
+    {
+        Notification last = m_desktop_backlog.back();
+        m_desktop_backlog.clear();
+        call_notify(last);
+    }
+}
+
+void NotificationCenter::call_notify(const Notification &notification)
+{
+    // org.freedesktop.Notifications.Notify(susssasa{sv}i) -> u
+    vector<Glib::VariantBase> args = {
+        Glib::Variant<Glib::ustring>::create("我的日历"),
+        Glib::Variant<guint32>::create(m_desktop_id),
+        Glib::Variant<Glib::ustring>::create("appointment-soon"),
+        Glib::Variant<Glib::ustring>::create(notification.title),
+        Glib::Variant<Glib::ustring>::create(notification.body),
+        Glib::Variant<vector<Glib::ustring>>::create({}),
+        Glib::Variant<map<Glib::ustring, Glib::VariantBase>>::create({}),
+        Glib::Variant<gint32>::create(-1)};
+
+    m_bus->call("/org/freedesktop/Notifications", "org.freedesktop.Notifications", "Notify",
+                Glib::VariantContainerBase::create_tuple(args),
+                sigc::mem_fun(*this, &NotificationCenter::on_notify_finished),
+                "org.freedesktop.Notifications");
+}
+
+void NotificationCenter::on_notify_finished(Glib::RefPtr<Gio::AsyncResult> &result)
+{
+    try
+    {
+        Glib::VariantContainerBase reply = m_bus->call_finish(result);
+        Glib::Variant<guint32> id;
+        reply.get_child(id, 0);
+        m_desktop_id = id.get();
+    }
+    catch (const Glib::Error &ex)
+    {
+        // 没有通知服务时只保留应用内横幅
+        cerr << "桌面通知发送失败: " << ex.what() << endl;
+    }
+}
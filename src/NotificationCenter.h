@@ -0,0 +1,59 @@
+#pragma once
+
+#include <gtkmm.h>
+#include <deque>
+#include <string>
+
+using namespace std;
+
+// 非阻塞的通知区域：主窗口顶部的横幅队列，可选同时发送桌面通知
+// 通知依次显示，到时自动消失或由用户关闭，整个过程不进入嵌套主循环
+class NotificationCenter : public Gtk::Revealer
+{
+public:
+    NotificationCenter();
+
+    // 加入一条通知，立即返回；desktop 为 true 时同时发送桌面通知
+    void post(const string &title, const string &body, bool desktop = true);
+
+    // 是否通过 org.freedesktop.Notifications 发送桌面通知
+    void set_desktop_notifications_enabled(bool enabled) { m_desktop_enabled = enabled; }
+    size_t pending_count() const { return m_queue.size(); }
+
+private:
+    struct Notification
+    {
+        string title;
+        string body;
+    };
+
+    static constexpr size_t kMaxQueued = 20;       // 队列上限，超出时丢弃最早的通知
+    static constexpr unsigned kDisplayMs = 8000;   // 每条横幅的显示时长
+
+    void show_next();
+    void dismiss_current();
+    void on_info_bar_response(int response_id);
+    void update_more_label();
+
+    // 桌面通知（异步 D-Bus 调用）
+    void send_desktop(const Notification &notification);
+    void call_notify(const Notification &notification);
+    void on_bus_ready(Glib::RefPtr<Gio::AsyncResult> &result);
+    void on_notify_finished(Glib::RefPtr<Gio::AsyncResult> &result);
+
+    Gtk::InfoBar m_info_bar;
+    Gtk::Box m_text_box;
+    Gtk::Label m_title_label;
+    Gtk::Label m_body_label;
+    Gtk::Label m_more_label;
+
+    deque<Notification> m_queue;
+    bool m_showing = false;
+    sigc::connection m_dismiss_timer;
+
+    bool m_desktop_enabled = true;
+    bool m_bus_requested = false;
+    Glib::RefPtr<Gio::DBus::Connection> m_bus;
+    deque<Notification> m_desktop_backlog; // 会话总线连接建立前的桌面通知
+    guint32 m_desktop_id = 0;              // 上一条桌面通知的ID，新通知替换旧通知而不是层层堆叠
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "RealtimeTimer.h"
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+RealtimeTimer::RealtimeTimer()
+{
+    m_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (m_fd < 0)
+        cerr << "无法创建 timerfd: " << strerror(errno) << endl;
+}
+
+RealtimeTimer::~RealtimeTimer()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+bool RealtimeTimer::arm_at(time_t when)
+{
+    if (m_fd < 0)
+        return false;
+
+    itimerspec spec = {};
+    // it_value 全零表示停止定时器，过去的时刻至少设为纪元后 1 秒
+    spec.it_value.tv_sec = when > 0 ? when : 1;
+    if (timerfd_settime(m_fd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, nullptr) != 0)
+    {
+        cerr << "设置 timerfd 失败: " << strerror(errno) << endl;
+        return false;
+    }
+    return true;
+}
+
+void RealtimeTimer::disarm()
+{
+    if (m_fd < 0)
+        return;
+    itimerspec spec = {};
+    timerfd_settime(m_fd, 0, &spec, nullptr);
+}
+
+RealtimeTimer::Event RealtimeTimer::consume()
+{
+    if (m_fd < 0)
+        return Event::NONE;
+
+    uint64_t expirations = 0;
+    ssize_t n = read(m_fd, &expirations, sizeof(expirations));
+    if (n == static_cast<ssize_t>(sizeof(expirations)))
+        return Event::EXPIRED;
+    // 设置了 TFD_TIMER_CANCEL_ON_SET 时，系统时间被修改会让 read 以 ECANCELED 失败
+    if (n < 0 && errno == ECANCELED)
+        return Event::CLOCK_CHANGED;
+    return Event::NONE;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ctime>
+
+// 基于 timerfd 的墙上时间定时器（不依赖 GLib，可以接入任意事件循环）
+// 定时器按 CLOCK_REALTIME 的绝对时刻触发：系统挂起期间错过的时刻在唤醒后立即触发，
+// 系统时间被修改时（手动调整、NTP 跳变）文件描述符同样变为可读，调用方据此重新设置
+class RealtimeTimer
+{
+public:
+    enum class Event
+    {
+        NONE,         // 没有事件（被其他原因唤醒）
+        EXPIRED,      // 到达设定时刻
+        CLOCK_CHANGED // 系统时间被修改，需要重新设置
+    };
+
+    RealtimeTimer();
+    ~RealtimeTimer();
+
+    RealtimeTimer(const RealtimeTimer &) = delete;
+    RealtimeTimer &operator=(const RealtimeTimer &) = delete;
+
+    bool is_valid() const { return m_fd >= 0; }
+    int fd() const { return m_fd; }
+
+    // 在指定的墙上时刻触发（已过去的时刻会立即触发）
+    bool arm_at(time_t when);
+    void disarm();
+    // 文件描述符可读后调用，读取并返回发生的事件
+    Event consume();
+
+private:
+    int m_fd = -1;
+};
\ No newline at end of file
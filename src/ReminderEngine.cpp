@@ -0,0 +1,131 @@
+#include "ReminderEngine.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+using namespace std;
+
+// 记录每条提醒从 reminderTime 到实际取出投递的延迟；合并窗口会让提醒提前最多几秒，提前的单独计数
+void ReminderEngine::recordDelivery(const vector<Task> &digest)
+{
+    static Metrics::Histogram &lateness = Metrics::histogram("scheduler_reminder_lateness_seconds", "提醒实际投递时刻与提醒时间的差");
+    static Metrics::Counter &delivered = Metrics::counter("scheduler_reminders_delivered_total", "投递的提醒条数");
+    static Metrics::Counter &early = Metrics::counter("scheduler_reminders_early_total", "因合并窗口提前投递的提醒条数");
+
+    int64_t now_us = chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    for (const auto &task : digest)
+    {
+        int64_t late_us = now_us - static_cast<int64_t>(task.reminderTime) * 1000000;
+        if (late_us < 0)
+            early.inc();
+        lateness.record(late_us);
+    }
+    delivered.inc(digest.size());
+}
+
+void ReminderEngine::setCoalescing(int window_seconds, int min_interval_seconds)
+{
+    m_window = max(0, window_seconds);
+    m_min_interval = max(0, min_interval_seconds);
+}
+
+time_t ReminderEngine::horizon(time_t now) const
+{
+    return now + m_window.load();
+}
+
+void ReminderEngine::add(const Task &task)
+{
+    m_pending.push_back(task);
+}
+
+vector<Task> ReminderEngine::take(time_t now)
+{
+    vector<Task> digest;
+    if (!m_pending.empty() && now >= m_last_digest_time + m_min_interval.load())
+    {
+        digest.swap(m_pending);
+        m_last_digest_time = now;
+        recordDelivery(digest);
+    }
+    return digest;
+}
+
+vector<Task> ReminderEngine::takeAll()
+{
+    vector<Task> digest;
+    digest.swap(m_pending);
+    recordDelivery(digest);
+    return digest;
+}
+
+time_t ReminderEngine::nextDelivery(time_t next_reminder) const
+{
+    if (!m_pending.empty())
+        return m_last_digest_time + m_min_interval.load();
+    return next_reminder;
+}
+
+static string formatReminderTime(time_t t)
+{
+    string str = ctime(&t);
+    if (!str.empty() && str.back() == '\n')
+    {
+        str.pop_back();
+    }
+    return str;
+}
+
+ReminderEngine::Digest ReminderEngine::format(const vector<Task> &reminders)
+{
+    Digest digest;
+    if (reminders.size() == 1)
+    {
+        const Task &task = reminders.front();
+        digest.title = "提醒";
+        digest.message = task.name + " 任务提醒！\n开始时间: " + formatReminderTime(task.startTime) +
+                         "\n提醒时间: " + formatReminderTime(task.reminderTime);
+        return digest;
+    }
+
+    // 摘要最多列出前若干个任务，其余只给出数量
+    const size_t kMaxListed = 10;
+    vector<Task> sorted = reminders;
+    sort(sorted.begin(), sorted.end(), [](const Task &a, const Task &b)
+         { return a.startTime < b.startTime; });
+
+    digest.title = "提醒（" + to_string(sorted.size()) + " 个任务）";
+    digest.message = "有 " + to_string(sorted.size()) + " 个任务需要提醒：";
+    for (size_t i = 0; i < sorted.size() && i < kMaxListed; ++i)
+    {
+        char time_buf[32];
+        strftime(time_buf, sizeof(time_buf), "%m-%d %H:%M", localtime(&sorted[i].startTime));
+        digest.message += "\n" + string(time_buf) + "  " + sorted[i].name;
+    }
+    if (sorted.size() > kMaxListed)
+    {
+        digest.message += "\n……以及其余 " + to_string(sorted.size() - kMaxListed) + " 个任务";
+    }
+    return digest;
+}
+
+string ReminderEngine::daemonLockPath(const string &username)
+{
+    return username + "_reminderd.lock";
+}
+
+bool ReminderEngine::isDaemonRunning(const string &username)
+{
+    int fd = open(daemonLockPath(username).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false; // 没有锁文件，守护进程从未启动过
+
+    // 能拿到锁说明没有守护进程持有它，立即释放
+    bool running = flock(fd, LOCK_EX | LOCK_NB) != 0 && errno == EWOULDBLOCK;
+    close(fd);
+    return running;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Task.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 提醒的合并与限流规则以及摘要文本，GUI 中的 TaskManager 和独立的提醒守护进程共用
+// 本身不加锁，由调用方保证同一时刻只有一个线程使用（设置参数除外）
+class ReminderEngine
+{
+public:
+    struct Digest
+    {
+        string title;
+        string message;
+    };
+
+    // 提醒时间落在 now + window_seconds 之内的任务合并为一条摘要，
+    // 相邻两条摘要之间至少间隔 min_interval_seconds 秒，期间到期的提醒累积到下一条摘要
+    void setCoalescing(int window_seconds, int min_interval_seconds);
+
+    // 本轮应收集的提醒时间上限（合并窗口内即将到期的提醒提前并入）
+    time_t horizon(time_t now) const;
+    void add(const Task &task);
+    bool hasPending() const { return !m_pending.empty(); }
+    // 限流允许时取出所有累积的提醒，否则返回空
+    vector<Task> take(time_t now);
+    // 无视限流取出所有累积的提醒（停止时补发）
+    vector<Task> takeAll();
+    // 下一次需要处理的时刻：有累积的提醒时为限流结束的时刻，否则为 next_reminder
+    time_t nextDelivery(time_t next_reminder) const;
+
+    // 生成摘要文本：单个任务沿用原来的提醒格式，多个任务列出按开始时间排序的前若干个
+    static Digest format(const vector<Task> &reminders);
+
+    // 提醒守护进程的锁文件：守护进程运行期间持有排他锁，GUI 检测到后不再自己投递提醒
+    static string daemonLockPath(const string &username);
+    static bool isDaemonRunning(const string &username);
+
+private:
+    static void recordDelivery(const vector<Task> &digest);
+
+    atomic<int> m_window{10};
+    atomic<int> m_min_interval{30};
+    vector<Task> m_pending;
+    time_t m_last_digest_time = 0;
+};
\ No newline at end of file
@@ -1,4 +1,8 @@
 #include "SchedulerApp.h"
+#include "AudioService.h"
+#include "Metrics.h"
+#include "AllocCounter.h"
+#include "Trace.h"
 #include <iostream>
 #include <vector>
 #include <algorithm>
@@ -6,6 +10,8 @@
 #include <string>
 #include <regex>
 #include <set>
+#include <map>
+#include <memory>
 
 #ifdef EMBEDDED_RESOURCES_ENABLED
 #include "embedded_resources.h"
@@ -13,6 +19,14 @@
 
 using namespace std;
 
+// 分片渲染参数：首屏同步构建的数量，以及每个空闲分片步骤处理的数量
+static const size_t kVisibleRowCount = 64;      // 日程列表首屏行数
+static const size_t kRowsPerStep = 128;         // 日程列表每步追加的行数
+static const size_t kVisibleCardCount = 8;      // 详情列表首屏卡片数
+static const size_t kCardsPerStep = 4;          // 详情列表每步追加的卡片数
+static const size_t kSyncCacheTaskLimit = 2000; // 任务数不超过该值时同步重建日期缓存
+static const size_t kCacheTasksPerStep = 512;   // 日期缓存每步处理的任务数
+
 // 辅助函数，将 time_t 转换为 Y-m-d H:M 格式的字符串
 string time_t_to_datetime_string(time_t time)
 {
@@ -37,75 +51,15 @@ string SchedulerApp::format_timespan(time_t start_time, time_t end_time)
     return string(start_buf) + " - " + string(end_buf);
 }
 
-// 获取某一天应该显示的任务片段
-vector<SchedulerApp::TaskSegment> SchedulerApp::get_tasks_for_day(time_t day_time)
+// 开始一次日视图刷新：取一份任务快照，各天的片段都从它的内存池分配。
+// 上一次的快照没有被尚未完成的分片任务持有时，直接复用它的内存
+shared_ptr<DayLayout::Snapshot> SchedulerApp::begin_day_layout()
 {
-    vector<TaskSegment> segments;
-
-    // 当天 00:00 与次日 00:00
-    tm day_tm = *localtime(&day_time);
-    day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
-    time_t start_of_day = mktime(&day_tm);
-    time_t end_of_day = start_of_day + 86400;
-
-    for (const auto &task : m_task_manager.getAllTasks())
-    {
-        time_t task_end = task.startTime + task.duration * 60;
-
-        // —— 与今日窗口有重叠的任务
-        if (task_end > start_of_day && task.startTime < end_of_day)
-        {
-            TaskSegment seg;
-            seg.id = task.id;
-            seg.name = task.name;
-            seg.original_start = task.startTime;
-            seg.original_end = task_end;
-            seg.priority = task.priority;
-            seg.category = task.category;
-            seg.customCategory = task.customCategory;
-            seg.reminderOption = task.reminderOption;
-
-            // 显示区间：最早 00:00，最晚 23:59
-            seg.display_start = max(task.startTime, start_of_day);
-            seg.display_end = min(task_end, end_of_day - 60);
-
-            seg.is_cross_day = (task.startTime < start_of_day) || (task_end > end_of_day);
-            seg.is_first_segment = (task.startTime >= start_of_day);
-            seg.has_conflict = false;
-            seg.is_highest_priority_in_conflict = false;
-
-            segments.push_back(seg);
-        }
-
-        // —— 前一天跨到今日 00:00 的“零长度”占位
-        if (task_end == start_of_day && task.startTime < start_of_day)
-        {
-            TaskSegment seg;
-            seg.id = task.id;
-            seg.name = task.name;
-            seg.original_start = task.startTime;
-            seg.original_end = task_end;
-            seg.priority = task.priority;
-            seg.category = task.category;
-            seg.customCategory = task.customCategory;
-            seg.reminderOption = task.reminderOption;
-
-            seg.display_start = start_of_day;
-            seg.display_end = start_of_day;
-            seg.is_cross_day = true;
-            seg.is_first_segment = false;
-            seg.has_conflict = false;
-            seg.is_highest_priority_in_conflict = false;
-
-            segments.push_back(seg);
-        }
-    }
-
-    // 按 display_start 排序
-    sort(segments.begin(), segments.end(),
-         [](const TaskSegment &a, const TaskSegment &b)
-         { return a.display_start < b.display_start; });
-    return segments;
+    if (m_day_layout && m_day_layout.use_count() == 1)
+        m_day_layout->reset(m_task_manager.getAllTasks());
+    else
+        m_day_layout = make_shared<DayLayout::Snapshot>(m_task_manager.getAllTasks());
+    return m_day_layout;
 }
 
 // 格式化跨天任务的时间显示
@@ -134,80 +88,6 @@ string SchedulerApp::format_cross_day_timespan(const TaskSegment &segment)
     return string(start_buf) + " - " + string(end_buf);
 }
 
-// 检查两个任务段是否重叠
-bool SchedulerApp::tasks_overlap(const TaskSegment &task1, const TaskSegment &task2)
-{
-    // 两个时间段重叠的条件：
-    // task1开始时间 < task2结束时间 && task1结束时间 > task2开始时间
-    return task1.display_start < task2.display_end && task1.display_end > task2.display_start;
-}
-
-// 对任务进行冲突感知排序
-vector<SchedulerApp::TaskSegment> SchedulerApp::sort_tasks_with_conflicts(
-    vector<TaskSegment> &segments, time_t day_time)
-{
-    // 计算当天 00:00
-    tm day_tm = *localtime(&day_time);
-    day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
-    time_t start_of_day = mktime(&day_tm);
-
-    // 1. 标记冲突
-    for (size_t i = 0; i < segments.size(); ++i)
-    {
-        segments[i].has_conflict = false;
-        segments[i].is_highest_priority_in_conflict = false;
-        for (size_t j = 0; j < segments.size(); ++j)
-        {
-            if (i != j && tasks_overlap(segments[i], segments[j]))
-            {
-                segments[i].has_conflict = true;
-                break;
-            }
-        }
-    }
-
-    // 2. 在每个冲突组中标记最高优先级
-    for (size_t i = 0; i < segments.size(); ++i)
-    {
-        if (!segments[i].has_conflict)
-            continue;
-
-        vector<TaskSegment *> conflict_group;
-        conflict_group.push_back(&segments[i]);
-        for (size_t j = 0; j < segments.size(); ++j)
-        {
-            if (i != j && tasks_overlap(segments[i], segments[j]))
-                conflict_group.push_back(&segments[j]);
-        }
-
-        // 找到组内最高（数值最小）的 priority
-        Priority highest = Priority::LOW;
-        for (auto *seg : conflict_group)
-        {
-            if (static_cast<int>(seg->priority) < static_cast<int>(highest))
-                highest = seg->priority;
-        }
-        if (segments[i].priority == highest)
-            segments[i].is_highest_priority_in_conflict = true;
-    }
-
-    // 3. 排序：按 display_start -> priority -> id
-    sort(segments.begin(), segments.end(),
-         [start_of_day](const TaskSegment &a, const TaskSegment &b)
-         {
-             // 有效开始直接用 display_start，23:59 不会被误当成次日 00:00
-             if (a.display_start != b.display_start)
-                 return a.display_start < b.display_start;
-             // 相同开始时间，则高优先级（数值小）靠前
-             if (a.priority != b.priority)
-                 return static_cast<int>(a.priority) < static_cast<int>(b.priority);
-             // 最后按 id 保持稳定
-             return a.id < b.id;
-         });
-
-    return segments;
-}
-
 // 辅助函数，将 Priority 枚举转换为字符串
 string SchedulerApp::priority_to_string(Priority p)
 {
@@ -338,6 +218,44 @@ SchedulerApp::SchedulerApp() : Gtk::Application("org.cpp.scheduler.app")
     m_current_view_mode = ViewMode::WEEK; // 初始化为周视图
     m_is_editing_task = false;            // 初始化编辑状态
     m_editing_task_id = -1;
+
+    // TaskManager 的后台工作都在共享线程池上执行，结果经由同一个 Dispatcher 回到界面线程
+    m_ui_dispatcher.connect(sigc::mem_fun(*this, &SchedulerApp::on_ui_dispatch));
+    m_task_manager.setExecutor(&m_executor);
+    m_task_manager.setNotificationSound([]()
+                                        { AudioService::instance().playNotification(); });
+    m_task_manager.setUiDispatcher([this](function<void()> fn)
+                                   { post_to_ui(move(fn)); });
+    m_ui_bench = UiBenchmark::from_environment();
+    m_metrics_exporter.startFromEnvironment();
+
+    // SCHEDULER_TRACE 设置时从启动开始记录跟踪区间，应用退出时写入文件
+    m_trace_path = Trace::startFromEnvironment();
+    signal_shutdown().connect([this]()
+                              {
+        if (!m_trace_path.empty())
+            Trace::dump(m_trace_path); });
+}
+
+void SchedulerApp::post_to_ui(function<void()> fn)
+{
+    {
+        lock_guard<mutex> lock(m_ui_queue_mutex);
+        m_ui_queue.push_back(move(fn));
+    }
+    m_ui_dispatcher.emit();
+}
+
+// 在 GTK 线程中执行后台线程转交的所有回调
+void SchedulerApp::on_ui_dispatch()
+{
+    vector<function<void()>> pending;
+    {
+        lock_guard<mutex> lock(m_ui_queue_mutex);
+        pending.swap(m_ui_queue);
+    }
+    for (auto &fn : pending)
+        fn();
 }
 
 // 静态工厂方法，创建应用实例
@@ -351,17 +269,6 @@ void SchedulerApp::on_activate()
 {
     try
     {
-#ifdef EMBEDDED_RESOURCES_ENABLED
-        // 使用嵌入的XML资源
-        std::string xml_content = EmbeddedResources::getXMLContent();
-        m_builder = Gtk::Builder::create_from_string(xml_content);
-#else
-        // 使用外部XML文件
-        m_builder = Gtk::Builder::create_from_file("GUIDesign.xml");
-#endif
-
-        get_widgets();
-
         auto css_provider = Gtk::CssProvider::create();
         const char *css = R"(
 .task-card {
@@ -425,30 +332,20 @@ listbox row:selected:focus .category-tag {
         Gtk::StyleContext::add_provider_for_screen(
             Gdk::Screen::get_default(), css_provider, GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
 
-        if (task_tree_view)
-        {
-            m_refTreeModel = Gtk::ListStore::create(m_Columns);
-            task_tree_view->set_model(m_refTreeModel);
-        }
-
-        connect_signals();
-
         // 初始化系统托盘图标
         setup_tray_icon();
 
-        if (login_window)
-            add_window(*login_window);
-        if (main_window)
-            add_window(*main_window);
-        if (register_window)
-            add_window(*register_window);
-        if (change_password_window)
-            add_window(*change_password_window);
-        if (help_window)
-            add_window(*help_window);
-        if (add_task_dialog)
-            add_window(*add_task_dialog);
-        if (login_window)
+        // 启动时解码一次提醒音效，之后的提醒直接从内存播放
+        AudioService::instance().init();
+
+        if (m_ui_bench)
+        {
+            start_ui_bench();
+            return;
+        }
+
+        // 启动时只构建登录窗口，其余窗口在首次使用时再构建
+        if (ensure_ui(UiFragment::LOGIN) && login_window)
             login_window->show();
     }
     catch (const Glib::FileError &ex)
@@ -463,173 +360,232 @@ listbox row:selected:focus .category-tag {
 
 void SchedulerApp::update_days_with_tasks_cache()
 {
-    m_days_with_tasks.clear();
-    vector<Task> all_tasks = m_task_manager.getAllTasks();
-    for (const auto &task : all_tasks)
-    {
-        time_t task_end = task.startTime + task.duration * 60;
+    Trace::Span trace_span("SchedulerApp::update_days_with_tasks_cache", "ui");
+    AllocCounter::Scope alloc_scope("update_days_with_tasks_cache");
+    m_idle_scheduler.cancel("days_with_tasks_cache");
+    auto all_tasks = make_shared<vector<Task>>(m_task_manager.getAllTasks());
 
-        // 将任务开始时间标准化为当天的零点
-        tm start_day_tm = *localtime(&task.startTime);
-        start_day_tm.tm_hour = 0;
-        start_day_tm.tm_min = 0;
-        start_day_tm.tm_sec = 0;
-        time_t start_day = mktime(&start_day_tm);
-
-        // 将任务结束时间标准化为当天的零点
-        tm end_day_tm = *localtime(&task_end);
-        end_day_tm.tm_hour = 0;
-        end_day_tm.tm_min = 0;
-        end_day_tm.tm_sec = 0;
-        time_t end_day = mktime(&end_day_tm);
-
-        // 为任务涉及的每一天都添加到缓存中
-        for (time_t current_day = start_day; current_day <= end_day; current_day += 86400)
-        {
-            m_days_with_tasks.insert(current_day);
-        }
-    }
-}
-
-// 从 Builder 中获取所有控件指针
-void SchedulerApp::get_widgets()
-{
-    // --- 获取窗口和对话框 ---
-    m_builder->get_widget("login_window", login_window);
-    m_builder->get_widget("register_window", register_window);
-    m_builder->get_widget("main_window", main_window);
-    m_builder->get_widget("help_window", help_window);
-    m_builder->get_widget("change_password_window", change_password_window);
-    m_builder->get_widget("add_task_dialog", add_task_dialog);
-
-    // --- 登录/注册/改密 控件 ---
-    m_builder->get_widget("login_username_entry", login_username_entry);
-    m_builder->get_widget("login_password_entry", login_password_entry);
-    m_builder->get_widget("register_username_entry", register_username_entry);
-    m_builder->get_widget("register_password_entry", register_password_entry);
-    m_builder->get_widget("register_confirm_password_entry", register_confirm_password_entry);
-    m_builder->get_widget("cp_username_entry", cp_username_entry);
-    m_builder->get_widget("cp_old_password_entry", cp_old_password_entry);
-    m_builder->get_widget("cp_new_password_entry", cp_new_password_entry);
-    m_builder->get_widget("cp_confirm_new_password_entry", cp_confirm_new_password_entry);
-    m_builder->get_widget("cp_old_password_label", cp_old_password_label);
-
-    // --- "添加任务" 对话框控件 ---
-    m_builder->get_widget("task_name_entry", task_name_entry);
-    m_builder->get_widget("task_start_time_button", task_start_time_button);
-    m_builder->get_widget("task_duration_spin", task_duration_spin);
-    m_builder->get_widget("task_end_time_label", task_end_time_label);
-    m_builder->get_widget("task_priority_combo", task_priority_combo);
-    m_builder->get_widget("task_category_combo", task_category_combo);
-    m_builder->get_widget("task_custom_category_entry", task_custom_category_entry);
-    m_builder->get_widget("task_reminder_combo", task_reminder_combo);
-    m_builder->get_widget("task_reminder_entry", task_reminder_entry);
-
-    // --- 主界面控件 ---
-    m_builder->get_widget("settings_button", settings_button);
-    m_builder->get_widget("menu_item_minimize", menu_item_minimize);
-    m_builder->get_widget("menu_item_logout", menu_item_logout);
-    m_builder->get_widget("menu_item_change_password", menu_item_change_password);
-    m_builder->get_widget("menu_item_delete_account", menu_item_delete_account);
-    m_builder->get_widget("menu_item_help", menu_item_help);
-
-    m_builder->get_widget("main_stack", m_main_stack);
-    m_builder->get_widget("month_view_pane", m_month_view_pane);
-    m_builder->get_widget("month_header_grid", m_month_header_grid);
-    m_builder->get_widget("month_view_grid", m_month_view_grid);
-    m_builder->get_widget("week_header_grid", m_week_header_grid);
-    m_builder->get_widget("date_navigation_box", m_date_navigation_box);
-    m_builder->get_widget("current_date_label", m_current_date_label);
-    m_builder->get_widget("prev_button", m_prev_button);
-    m_builder->get_widget("next_button", m_next_button);
-    m_builder->get_widget("month_view_button", m_month_view_button);
-    m_builder->get_widget("week_view_button", m_week_view_button);
-    m_builder->get_widget("agenda_view_button", m_agenda_view_button);
-    m_builder->get_widget("agenda_add_task_button", m_agenda_add_task_button);
-    m_builder->get_widget("agenda_delete_task_button", m_agenda_delete_task_button);
-    m_builder->get_widget("today_indicator_box", m_today_indicator_box);
-    m_builder->get_widget("today_button", m_today_button);
-    m_builder->get_widget("week_of_year_label", m_week_of_year_label);
-    m_builder->get_widget("selected_day_events_listbox", m_selected_day_events_listbox);
-    m_builder->get_widget("week_selected_day_events_listbox", m_week_selected_day_events_listbox);
-    m_builder->get_widget("task_tree_view", task_tree_view);
+    if (all_tasks->size() <= kSyncCacheTaskLimit)
+    {
+        m_days_with_tasks.clear();
+        for (const auto &task : *all_tasks)
+            DayLayout::addTaskDays(task, m_days_with_tasks);
+        return;
+    }
 
-    // --- 右键上下文菜单 ---
-    m_builder->get_widget("task_context_menu", m_task_context_menu);
-    m_builder->get_widget("empty_space_context_menu", m_empty_space_context_menu);
-    m_builder->get_widget("ctx_menu_delete_task", m_ctx_menu_delete_task);
-    m_builder->get_widget("ctx_menu_add_task", m_ctx_menu_add_task);
-    m_builder->get_widget("ctx_menu_revise_task", m_ctx_menu_revise_task);
+    // 任务较多时在空闲时分片重建，完成后整体替换缓存并刷新日期上的任务标记
+    auto days = make_shared<set<time_t>>();
+    size_t next = 0;
+    m_idle_scheduler.post("days_with_tasks_cache", IdleScheduler::Priority::BACKGROUND,
+                          [this, all_tasks, days, next]() mutable
+                          {
+                              size_t end = min(all_tasks->size(), next + kCacheTasksPerStep);
+                              for (; next < end; ++next)
+                                  DayLayout::addTaskDays((*all_tasks)[next], *days);
+                              if (next < all_tasks->size())
+                                  return true;
+
+                              m_days_with_tasks.swap(*days);
+                              if (m_current_view_mode == ViewMode::MONTH)
+                                  populate_month_view();
+                              else if (m_current_view_mode == ViewMode::WEEK)
+                                  populate_week_view();
+                              return false;
+                          });
+}
+
+// 界面片段对应的文件名（src/ui/<name>.ui）
+const char *SchedulerApp::ui_fragment_name(UiFragment fragment)
+{
+    switch (fragment)
+    {
+    case UiFragment::LOGIN:
+        return "login_window";
+    case UiFragment::MAIN:
+        return "main_window";
+    case UiFragment::REGISTER:
+        return "register_window";
+    case UiFragment::CHANGE_PASSWORD:
+        return "change_password_window";
+    case UiFragment::HELP:
+        return "help_window";
+    case UiFragment::ADD_TASK:
+        return "add_task_dialog";
+    }
+    return "";
+}
+
+// 按需构建界面片段：首次调用时解析对应的 .ui、获取控件并连接信号，之后直接返回
+bool SchedulerApp::ensure_ui(UiFragment fragment)
+{
+    if (m_builders.count(fragment))
+        return true;
 
-    // 为任务持续时间选择器设置范围和步长
-    if (task_duration_spin)
+    string name = ui_fragment_name(fragment);
+    Glib::RefPtr<Gtk::Builder> builder;
+    try
     {
-        auto adjustment = Gtk::Adjustment::create(30.0, 1.0, 999999.0, 5.0, 30.0, 0.0);
-        task_duration_spin->set_adjustment(adjustment);
-        task_duration_spin->set_digits(0);
+#ifdef EMBEDDED_RESOURCES_ENABLED
+        // 直接从编译进程序的资源包解析界面片段
+        builder = Gtk::Builder::create_from_resource(EmbeddedResources::uiResourcePath(name));
+#else
+        // 使用外部界面文件
+        builder = Gtk::Builder::create_from_file("ui/" + name + ".ui");
+#endif
+    }
+    catch (const Glib::FileError &ex)
+    {
+        cerr << "文件错误: " << ex.what() << endl;
+        return false;
+    }
+    catch (const Gio::ResourceError &ex)
+    {
+        cerr << "资源错误: " << ex.what() << endl;
+        return false;
+    }
+    catch (const Gtk::BuilderError &ex)
+    {
+        cerr << "Builder错误: " << ex.what() << endl;
+        return false;
     }
+    catch (const Glib::MarkupError &ex)
+    {
+        cerr << "界面片段 " << name << " 解析错误: " << ex.what() << endl;
+        return false;
+    }
+    m_builders[fragment] = builder;
 
-    for (int i = 0; i < 7; ++i)
+    Gtk::Window *window = nullptr;
+    switch (fragment)
     {
-        m_builder->get_widget("week_day_button_" + to_string(i), m_week_day_buttons[i]);
-        m_builder->get_widget("week_day_label_" + to_string(i), m_week_day_labels[i]);
+    case UiFragment::LOGIN:
+        load_login_ui(builder);
+        window = login_window;
+        break;
+    case UiFragment::MAIN:
+        load_main_ui(builder);
+        window = main_window;
+        break;
+    case UiFragment::REGISTER:
+        load_register_ui(builder);
+        window = register_window;
+        break;
+    case UiFragment::CHANGE_PASSWORD:
+        load_change_password_ui(builder);
+        window = change_password_window;
+        break;
+    case UiFragment::HELP:
+        load_help_ui(builder);
+        window = help_window;
+        break;
+    case UiFragment::ADD_TASK:
+        load_add_task_ui(builder);
+        window = add_task_dialog;
+        break;
     }
+
+    if (window)
+        add_window(*window);
+    return window != nullptr;
 }
 
-void SchedulerApp::connect_signals()
+// --- 登录窗口 ---
+void SchedulerApp::load_login_ui(const Glib::RefPtr<Gtk::Builder> &builder)
 {
-    Gtk::Button *login_button = nullptr, *register_button = nullptr,
-                *cp_confirm_button = nullptr, *add_task_ok_button = nullptr, *add_task_cancel_button = nullptr;
-    Gtk::LinkButton *show_register_button = nullptr, *show_change_password_button = nullptr;
+    builder->get_widget("login_window", login_window);
+    builder->get_widget("login_username_entry", login_username_entry);
+    builder->get_widget("login_password_entry", login_password_entry);
 
-    // --- 窗口和对话框信号 ---
-    m_builder->get_widget("login_button", login_button);
+    Gtk::Button *login_button = nullptr;
+    Gtk::LinkButton *show_register_button = nullptr, *show_change_password_button = nullptr;
+    builder->get_widget("login_button", login_button);
     if (login_button)
         login_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_login_button_clicked));
-    m_builder->get_widget("show_register_button", show_register_button);
+    builder->get_widget("show_register_button", show_register_button);
     if (show_register_button)
         show_register_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_show_register_button_clicked));
-    m_builder->get_widget("show_change_password_button", show_change_password_button);
+    builder->get_widget("show_change_password_button", show_change_password_button);
     if (show_change_password_button)
         show_change_password_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_show_change_password_button_clicked));
-    m_builder->get_widget("register_button", register_button);
+    // --- 登录窗口关闭事件处理 ---
+    if (login_window)
+        login_window->signal_delete_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_login_window_delete_event));
+}
+
+// --- 注册窗口 ---
+void SchedulerApp::load_register_ui(const Glib::RefPtr<Gtk::Builder> &builder)
+{
+    builder->get_widget("register_window", register_window);
+    builder->get_widget("register_username_entry", register_username_entry);
+    builder->get_widget("register_password_entry", register_password_entry);
+    builder->get_widget("register_confirm_password_entry", register_confirm_password_entry);
+
+    Gtk::Button *register_button = nullptr;
+    builder->get_widget("register_button", register_button);
     if (register_button)
         register_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_register_button_clicked));
     if (register_window)
         register_window->signal_delete_event().connect([this](GdkEventAny *)
                                                        { if(register_window) register_window->hide(); return true; });
-    m_builder->get_widget("cp_confirm_button", cp_confirm_button);
+}
+
+// --- 修改密码窗口 ---
+void SchedulerApp::load_change_password_ui(const Glib::RefPtr<Gtk::Builder> &builder)
+{
+    builder->get_widget("change_password_window", change_password_window);
+    builder->get_widget("cp_username_entry", cp_username_entry);
+    builder->get_widget("cp_old_password_entry", cp_old_password_entry);
+    builder->get_widget("cp_new_password_entry", cp_new_password_entry);
+    builder->get_widget("cp_confirm_new_password_entry", cp_confirm_new_password_entry);
+    builder->get_widget("cp_old_password_label", cp_old_password_label);
+
+    Gtk::Button *cp_confirm_button = nullptr;
+    builder->get_widget("cp_confirm_button", cp_confirm_button);
     if (cp_confirm_button)
         cp_confirm_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_cp_confirm_button_clicked));
     if (change_password_window)
         change_password_window->signal_delete_event().connect([this](GdkEventAny *)
                                                               { if(change_password_window) change_password_window->hide(); return true; });
-    // --- 主窗口关闭事件处理 ---
-    if (main_window)
-        main_window->signal_delete_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_main_window_delete_event));
-    // --- 登录窗口关闭事件处理 ---
-    if (login_window)
-        login_window->signal_delete_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_login_window_delete_event));
+}
+
+// --- 帮助窗口 ---
+void SchedulerApp::load_help_ui(const Glib::RefPtr<Gtk::Builder> &builder)
+{
+    builder->get_widget("help_window", help_window);
+
     Gtk::Button *help_close_button = nullptr;
-    m_builder->get_widget("help_close_button", help_close_button);
-    help_close_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_help_close_button_clicked));
-    // --- "设置"菜单信号 ---
-    if (menu_item_minimize)
-        menu_item_minimize->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_minimize_activated));
-    if (menu_item_logout)
-        menu_item_logout->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_logout_activated));
-    if (menu_item_change_password)
-        menu_item_change_password->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_change_password_activated));
-    if (menu_item_delete_account)
-        menu_item_delete_account->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_delete_account_activated));
-    if (menu_item_help)
-        menu_item_help->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_help_activated));
+    builder->get_widget("help_close_button", help_close_button);
+    if (help_close_button)
+        help_close_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_help_close_button_clicked));
+}
+
+// --- "添加任务" 对话框 ---
+void SchedulerApp::load_add_task_ui(const Glib::RefPtr<Gtk::Builder> &builder)
+{
+    builder->get_widget("add_task_dialog", add_task_dialog);
+    builder->get_widget("task_name_entry", task_name_entry);
+    builder->get_widget("task_start_time_button", task_start_time_button);
+    builder->get_widget("task_duration_spin", task_duration_spin);
+    builder->get_widget("task_end_time_label", task_end_time_label);
+    builder->get_widget("task_priority_combo", task_priority_combo);
+    builder->get_widget("task_category_combo", task_category_combo);
+    builder->get_widget("task_custom_category_entry", task_custom_category_entry);
+    builder->get_widget("task_reminder_combo", task_reminder_combo);
+    builder->get_widget("task_reminder_entry", task_reminder_entry);
 
-    // --- “添加任务”对话框信号 ---
-    m_builder->get_widget("add_task_ok_button", add_task_ok_button);
+    // 为任务持续时间选择器设置范围和步长
+    if (task_duration_spin)
+    {
+        auto adjustment = Gtk::Adjustment::create(30.0, 1.0, 999999.0, 5.0, 30.0, 0.0);
+        task_duration_spin->set_adjustment(adjustment);
+        task_duration_spin->set_digits(0);
+    }
+
+    Gtk::Button *add_task_ok_button = nullptr, *add_task_cancel_button = nullptr;
+    builder->get_widget("add_task_ok_button", add_task_ok_button);
     if (add_task_ok_button)
         add_task_ok_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_add_task_ok_button_clicked));
-    m_builder->get_widget("add_task_cancel_button", add_task_cancel_button);
+    builder->get_widget("add_task_cancel_button", add_task_cancel_button);
     if (add_task_cancel_button)
         add_task_cancel_button->signal_clicked().connect(sigc::mem_fun(*this, &SchedulerApp::on_add_task_cancel_button_clicked));
     if (task_start_time_button)
@@ -643,6 +599,101 @@ void SchedulerApp::connect_signals()
         task_reminder_entry->signal_focus_in_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_reminder_entry_focus_in));
         task_reminder_entry->signal_focus_out_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_reminder_entry_focus_out));
     }
+}
+
+// --- 主界面（含设置菜单和右键菜单） ---
+void SchedulerApp::load_main_ui(const Glib::RefPtr<Gtk::Builder> &builder)
+{
+    builder->get_widget("main_window", main_window);
+
+    builder->get_widget("settings_button", settings_button);
+    builder->get_widget("menu_item_minimize", menu_item_minimize);
+    builder->get_widget("menu_item_logout", menu_item_logout);
+    builder->get_widget("menu_item_change_password", menu_item_change_password);
+    builder->get_widget("menu_item_delete_account", menu_item_delete_account);
+    builder->get_widget("menu_item_help", menu_item_help);
+    builder->get_widget("menu_item_trace", menu_item_trace);
+
+    builder->get_widget("main_stack", m_main_stack);
+    builder->get_widget("month_view_pane", m_month_view_pane);
+    builder->get_widget("month_header_grid", m_month_header_grid);
+    builder->get_widget("month_view_grid", m_month_view_grid);
+    builder->get_widget("week_header_grid", m_week_header_grid);
+    builder->get_widget("date_navigation_box", m_date_navigation_box);
+    builder->get_widget("current_date_label", m_current_date_label);
+    builder->get_widget("prev_button", m_prev_button);
+    builder->get_widget("next_button", m_next_button);
+    builder->get_widget("month_view_button", m_month_view_button);
+    builder->get_widget("week_view_button", m_week_view_button);
+    builder->get_widget("agenda_view_button", m_agenda_view_button);
+    builder->get_widget("agenda_add_task_button", m_agenda_add_task_button);
+    builder->get_widget("agenda_delete_task_button", m_agenda_delete_task_button);
+    builder->get_widget("today_indicator_box", m_today_indicator_box);
+    builder->get_widget("today_button", m_today_button);
+    builder->get_widget("week_of_year_label", m_week_of_year_label);
+    builder->get_widget("selected_day_events_listbox", m_selected_day_events_listbox);
+    builder->get_widget("week_selected_day_events_listbox", m_week_selected_day_events_listbox);
+    builder->get_widget("task_tree_view", task_tree_view);
+
+    // --- 右键上下文菜单 ---
+    builder->get_widget("task_context_menu", m_task_context_menu);
+    builder->get_widget("empty_space_context_menu", m_empty_space_context_menu);
+    builder->get_widget("ctx_menu_delete_task", m_ctx_menu_delete_task);
+    builder->get_widget("ctx_menu_add_task", m_ctx_menu_add_task);
+    builder->get_widget("ctx_menu_revise_task", m_ctx_menu_revise_task);
+
+    for (int i = 0; i < 7; ++i)
+    {
+        builder->get_widget("week_day_button_" + to_string(i), m_week_day_buttons[i]);
+        builder->get_widget("week_day_label_" + to_string(i), m_week_day_labels[i]);
+    }
+
+    // 周视图时间轴是自绘控件，不在 Glade 中定义，放入预留的容器
+    builder->get_widget("week_timeline_box", m_week_timeline_box);
+    if (m_week_timeline_box)
+    {
+        m_week_timeline = Gtk::make_managed<WeekTimelineView>();
+        m_week_timeline_box->pack_start(*m_week_timeline, true, true, 0);
+        m_week_timeline->show();
+    }
+
+    // 提醒横幅叠加在主窗口顶部，同样在代码中创建
+    builder->get_widget("notification_box", m_notification_box);
+    if (m_notification_box)
+    {
+        m_notification_center = Gtk::make_managed<NotificationCenter>();
+        // SCHEDULER_DESKTOP_NOTIFICATIONS=0 时只显示应用内横幅
+        const char *desktop = g_getenv("SCHEDULER_DESKTOP_NOTIFICATIONS");
+        m_notification_center->set_desktop_notifications_enabled(!desktop || string(desktop) != "0");
+        m_notification_box->pack_start(*m_notification_center, false, false, 0);
+        m_notification_center->show();
+    }
+
+    if (task_tree_view)
+    {
+        m_refTreeModel = Gtk::ListStore::create(m_Columns);
+        task_tree_view->set_model(m_refTreeModel);
+    }
+
+    // --- 主窗口关闭事件处理 ---
+    if (main_window)
+        main_window->signal_delete_event().connect(sigc::mem_fun(*this, &SchedulerApp::on_main_window_delete_event));
+    // --- "设置"菜单信号 ---
+    if (menu_item_minimize)
+        menu_item_minimize->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_minimize_activated));
+    if (menu_item_logout)
+        menu_item_logout->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_logout_activated));
+    if (menu_item_change_password)
+        menu_item_change_password->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_change_password_activated));
+    if (menu_item_delete_account)
+        menu_item_delete_account->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_delete_account_activated));
+    if (menu_item_help)
+        menu_item_help->signal_activate().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_help_activated));
+    if (menu_item_trace)
+    {
+        menu_item_trace->set_active(Trace::enabled());
+        menu_item_trace->signal_toggled().connect(sigc::mem_fun(*this, &SchedulerApp::on_menu_item_trace_toggled));
+    }
 
     // --- 主界面导航和视图切换信号 ---
     if (m_prev_button)
@@ -678,6 +729,30 @@ void SchedulerApp::connect_signals()
     if (m_week_selected_day_events_listbox)
         m_week_selected_day_events_listbox->signal_button_press_event().connect(sigc::bind(sigc::mem_fun(*this, &SchedulerApp::on_list_box_button_press), m_week_selected_day_events_listbox));
 
+    // 列表首屏之后的行在空闲时以 NORMAL 优先级分片追加；用户滚动到已追加内容的末尾附近时，
+    // 剩余部分马上就会进入视野，提升为 VISIBLE，排在缓存重建等其他空闲任务之前
+    auto promote_on_scroll = [this](const Glib::RefPtr<Gtk::Adjustment> &adjustment, const string &job_key)
+    {
+        if (!adjustment)
+            return;
+        Gtk::Adjustment *raw = adjustment.get();
+        adjustment->signal_value_changed().connect([this, raw, job_key]()
+                                                   {
+            if (raw->get_value() + 2 * raw->get_page_size() >= raw->get_upper())
+                m_idle_scheduler.set_priority(job_key, IdleScheduler::Priority::VISIBLE); });
+    };
+    if (task_tree_view)
+        promote_on_scroll(task_tree_view->get_vadjustment(), "agenda_rows");
+    if (m_selected_day_events_listbox)
+        promote_on_scroll(m_selected_day_events_listbox->get_adjustment(), "month_day_cards");
+    if (m_week_selected_day_events_listbox)
+        promote_on_scroll(m_week_selected_day_events_listbox->get_adjustment(), "week_day_cards");
+    if (m_week_timeline)
+    {
+        m_week_timeline->signal_block_pressed().connect(sigc::mem_fun(*this, &SchedulerApp::on_task_label_button_press));
+        m_week_timeline->signal_empty_pressed().connect(sigc::mem_fun(*this, &SchedulerApp::on_week_timeline_empty_press));
+    }
+
     // 为日程列表视图（Agenda View）设置列
     if (task_tree_view)
     {
@@ -717,6 +792,8 @@ void SchedulerApp::connect_signals()
                     new_selected_tm.tm_mday -= new_selected_tm.tm_wday;
                     new_selected_tm.tm_mday += i;
                     this->m_selected_date = mktime(&new_selected_tm);
+                    if (this->m_week_timeline)
+                        this->m_week_timeline->set_selected_day(this->m_selected_date);
                     
                     this->update_selected_day_details();
                     this->update_date_label_and_indicator();
@@ -746,6 +823,11 @@ void SchedulerApp::on_login_button_clicked()
     switch (login_result)
     {
     case UserManager::LoginResult::SUCCESS:
+        if (!ensure_ui(UiFragment::MAIN))
+        {
+            show_message("界面错误", "无法加载主界面。");
+            return;
+        }
         m_current_user = username;
         m_task_manager.setCurrentUser(m_current_user);
         login_password_entry->set_text("");
@@ -771,6 +853,7 @@ void SchedulerApp::on_login_button_clicked()
 
 void SchedulerApp::on_show_register_button_clicked()
 {
+    ensure_ui(UiFragment::REGISTER);
     if (register_window)
     {
         register_window->show();
@@ -779,6 +862,7 @@ void SchedulerApp::on_show_register_button_clicked()
 
 void SchedulerApp::on_show_change_password_button_clicked()
 {
+    ensure_ui(UiFragment::CHANGE_PASSWORD);
     m_is_changing_password_from_main = false;
     if (change_password_window && cp_username_entry && cp_old_password_entry && cp_old_password_label && cp_new_password_entry && cp_confirm_new_password_entry)
     {
@@ -916,7 +1000,9 @@ void SchedulerApp::on_show_window()
 
 void SchedulerApp::on_quit_app()
 {
-    m_task_manager.stopReminderThread();
+    m_idle_scheduler.cancel_all();
+    AudioService::instance().stopAll();
+    stop_reminder_delivery();
     if (m_timer_connection)
         m_timer_connection.disconnect();
     quit(); // 正常退出应用程序
@@ -947,7 +1033,7 @@ bool SchedulerApp::on_main_window_delete_event(GdkEventAny *)
         main_window->hide();
         return true; // 阻止默认关闭行为
     case 2:          // 直接退出程序
-        m_task_manager.stopReminderThread();
+        stop_reminder_delivery();
         if (m_timer_connection)
             m_timer_connection.disconnect();
         quit();
@@ -959,6 +1045,7 @@ bool SchedulerApp::on_main_window_delete_event(GdkEventAny *)
 
 void SchedulerApp::on_agenda_add_task_button_clicked()
 {
+    ensure_ui(UiFragment::ADD_TASK);
     if (add_task_dialog)
     {
         // 重置编辑状态，确保这是添加任务而不是修改任务
@@ -999,6 +1086,7 @@ void SchedulerApp::on_agenda_delete_task_button_clicked()
         {
             update_days_with_tasks_cache(); // 更新缓存
             update_all_views();
+            schedule_status_refresh();
             show_message("成功", "任务已删除。");
         }
         else
@@ -1021,7 +1109,8 @@ void SchedulerApp::on_menu_item_minimize_activated()
 void SchedulerApp::on_menu_item_logout_activated()
 {
     item_show_.set_sensitive(false);
-    m_task_manager.stopReminderThread();
+    m_idle_scheduler.cancel_all();
+    stop_reminder_delivery();
     if (m_timer_connection)
     {
         m_timer_connection.disconnect();
@@ -1037,6 +1126,7 @@ void SchedulerApp::on_menu_item_logout_activated()
 
 void SchedulerApp::on_menu_item_change_password_activated()
 {
+    ensure_ui(UiFragment::CHANGE_PASSWORD);
     m_is_changing_password_from_main = true;
     if (change_password_window && cp_username_entry && cp_old_password_entry && cp_old_password_label && cp_new_password_entry && cp_confirm_new_password_entry)
     {
@@ -1077,12 +1167,42 @@ void SchedulerApp::on_menu_item_delete_account_activated()
 // 帮助菜单项激活处理函数
 void SchedulerApp::on_menu_item_help_activated()
 {
+    ensure_ui(UiFragment::HELP);
     if (help_window)
     {
         help_window->show();
     }
 }
 
+// 跟踪菜单项：勾选时开始记录，取消勾选时停止并导出到文件
+void SchedulerApp::on_menu_item_trace_toggled()
+{
+    if (menu_item_trace->get_active())
+    {
+        Trace::start();
+        if (m_notification_center)
+            m_notification_center->post("性能跟踪", "已开始记录，再次点击菜单项停止并导出。", false);
+        return;
+    }
+
+    Trace::stop();
+    string path = m_trace_path;
+    if (path.empty())
+    {
+        char name[64];
+        time_t now = time(nullptr);
+        strftime(name, sizeof(name), "scheduler_trace_%Y%m%d_%H%M%S.json", localtime(&now));
+        path = name;
+    }
+    long long count = Trace::dump(path);
+    if (count < 0)
+        show_message("导出失败", "无法写入跟踪文件 " + path + "。");
+    else if (m_notification_center)
+        m_notification_center->post("性能跟踪", "已导出 " + to_string(count) + " 个事件到 " + path +
+                                                 "，可在 ui.perfetto.dev 或 chrome://tracing 中打开。",
+                                    false);
+}
+
 // --- 主界面信号处理函数 ---
 
 void SchedulerApp::on_prev_button_clicked()
@@ -1151,6 +1271,7 @@ void SchedulerApp::on_view_button_clicked(ViewMode new_mode)
 // --- 右键菜单处理函数 ---
 void SchedulerApp::on_ctx_menu_add_task_activated()
 {
+    ensure_ui(UiFragment::ADD_TASK);
     if (add_task_dialog)
     {
         // 重置编辑状态，确保这是添加任务而不是修改任务
@@ -1188,6 +1309,7 @@ void SchedulerApp::on_ctx_menu_delete_task_activated()
         {
             update_days_with_tasks_cache(); // 更新缓存
             update_all_views();
+            schedule_status_refresh();
             show_message("成功", "任务已删除。");
         }
         else
@@ -1203,8 +1325,8 @@ void SchedulerApp::on_ctx_menu_revise_task_activated()
 {
     if (m_context_menu_task_id != -1)
     {
-        Task *task = m_task_manager.getTaskById(m_context_menu_task_id);
-        if (task)
+        optional<Task> task = m_task_manager.getTaskById(m_context_menu_task_id);
+        if (task && ensure_ui(UiFragment::ADD_TASK))
         {
             m_is_editing_task = true;
             m_editing_task_id = m_context_menu_task_id;
@@ -1235,7 +1357,7 @@ void SchedulerApp::update_task_context_menu_availability(long long task_id)
     if (!m_ctx_menu_revise_task)
         return;
 
-    Task *task = m_task_manager.getTaskById(task_id);
+    optional<Task> task = m_task_manager.getTaskById(task_id);
     if (!task)
     {
         m_ctx_menu_revise_task->set_sensitive(false);
@@ -1260,6 +1382,11 @@ void SchedulerApp::update_task_context_menu_availability(long long task_id)
 
 void SchedulerApp::update_all_views()
 {
+    UiBenchmark::Scope bench_scope(m_ui_bench.get(), "update_all_views");
+    static Metrics::Histogram &refresh_time = Metrics::histogram("scheduler_ui_refresh_seconds", "界面刷新函数的耗时", "function=\"update_all_views\"");
+    Metrics::ScopedTimer metrics_timer(refresh_time);
+    Trace::Span trace_span("SchedulerApp::update_all_views", "ui");
+    AllocCounter::Scope alloc_scope("update_all_views", AllocCounter::Scope::Heap::SAMPLE);
     if (!m_main_stack)
         return;
 
@@ -1310,6 +1437,11 @@ void SchedulerApp::update_view_specific_layout()
 // 填充月视图
 void SchedulerApp::populate_month_view()
 {
+    UiBenchmark::Scope bench_scope(m_ui_bench.get(), "populate_month_view");
+    static Metrics::Histogram &refresh_time = Metrics::histogram("scheduler_ui_refresh_seconds", "界面刷新函数的耗时", "function=\"populate_month_view\"");
+    Metrics::ScopedTimer metrics_timer(refresh_time);
+    Trace::Span trace_span("SchedulerApp::populate_month_view", "ui");
+    AllocCounter::Scope alloc_scope("populate_month_view");
     if (!m_month_view_grid || !m_month_header_grid)
         return;
 
@@ -1429,9 +1561,14 @@ void SchedulerApp::populate_month_view()
 // 填充周视图
 void SchedulerApp::populate_week_view()
 {
+    UiBenchmark::Scope bench_scope(m_ui_bench.get(), "populate_week_view");
+    static Metrics::Histogram &refresh_time = Metrics::histogram("scheduler_ui_refresh_seconds", "界面刷新函数的耗时", "function=\"populate_week_view\"");
+    Metrics::ScopedTimer metrics_timer(refresh_time);
+    Trace::Span trace_span("SchedulerApp::populate_week_view", "ui");
+    AllocCounter::Scope alloc_scope("populate_week_view");
     tm iterator_tm = *localtime(&m_displayed_date);
     iterator_tm.tm_mday -= iterator_tm.tm_wday;
-    mktime(&iterator_tm);
+    time_t week_start = mktime(&iterator_tm);
     tm selected_tm = *localtime(&m_selected_date);
 
     for (int col = 0; col < 7; ++col)
@@ -1482,12 +1619,62 @@ void SchedulerApp::populate_week_view()
         mktime(&iterator_tm);
     }
 
+    populate_week_timeline(week_start);
     update_selected_day_details();
 }
 
+// 填充周视图时间轴：跨天任务沿用 DayLayout 的分段结果
+void SchedulerApp::populate_week_timeline(time_t week_start)
+{
+    Trace::Span trace_span("SchedulerApp::populate_week_timeline", "ui");
+    if (!m_week_timeline)
+        return;
+
+    tm day_tm = *localtime(&week_start);
+    day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
+
+    shared_ptr<DayLayout::Snapshot> layout = begin_day_layout();
+    vector<vector<WeekTimelineView::Block>> days(7);
+    for (int d = 0; d < 7; ++d)
+    {
+        tm current_tm = day_tm;
+        current_tm.tm_mday += d;
+        time_t day_time = mktime(&current_tm);
+        time_t end_of_day = day_time + 86400;
+
+        DayLayout::SegmentList task_segments = layout->segmentsForDay(day_time);
+
+        days[d].reserve(task_segments.size());
+        for (const auto &segment : task_segments)
+        {
+            const Task &task = layout->task(segment);
+            WeekTimelineView::Block block;
+            block.id = segment.id;
+            block.label = format_cross_day_timespan(segment) + " " + task.name;
+            if (segment.is_cross_day && !segment.is_first_segment)
+                block.label += " (续)";
+            block.display_start = segment.display_start;
+            block.display_end = segment.display_end;
+            block.continues_next_day = DayLayout::endTime(task) > end_of_day;
+            block.priority = segment.priority;
+            block.has_conflict = segment.has_conflict;
+            block.is_highest_priority_in_conflict = segment.is_highest_priority_in_conflict;
+            days[d].push_back(move(block));
+        }
+    }
+
+    m_week_timeline->set_week(week_start, move(days));
+    m_week_timeline->set_selected_day(m_selected_date);
+}
+
 // 更新选定日期的任务详情列表
 void SchedulerApp::update_selected_day_details()
 {
+    UiBenchmark::Scope bench_scope(m_ui_bench.get(), "update_selected_day_details");
+    static Metrics::Histogram &refresh_time = Metrics::histogram("scheduler_ui_refresh_seconds", "界面刷新函数的耗时", "function=\"update_selected_day_details\"");
+    Metrics::ScopedTimer metrics_timer(refresh_time);
+    Trace::Span trace_span("SchedulerApp::update_selected_day_details", "ui");
+    AllocCounter::Scope alloc_scope("update_selected_day_details");
     Gtk::ListBox *current_list_box = nullptr;
     if (m_current_view_mode == ViewMode::MONTH)
     {
@@ -1501,6 +1688,10 @@ void SchedulerApp::update_selected_day_details()
     if (!current_list_box)
         return;
 
+    // 同一列表尚未完成的分片构建作废
+    const string job_key = (current_list_box == m_selected_day_events_listbox) ? "month_day_cards" : "week_day_cards";
+    m_idle_scheduler.cancel(job_key);
+
     for (auto *child : current_list_box->get_children())
     {
         current_list_box->remove(*child);
@@ -1510,138 +1701,11 @@ void SchedulerApp::update_selected_day_details()
     time_t current_time = time(nullptr);
 
     // 使用新的跨天任务处理逻辑
-    vector<TaskSegment> task_segments = get_tasks_for_day(m_selected_date);
-    task_segments = sort_tasks_with_conflicts(task_segments, m_selected_date);
-
-    bool has_tasks_today = false;
-    for (const auto &segment : task_segments)
-    {
-        has_tasks_today = true;
-        auto row = Gtk::make_managed<Gtk::ListBoxRow>();
-        auto event_box = Gtk::make_managed<Gtk::EventBox>();
-
-        auto card_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_VERTICAL, 8);
-        card_box->get_style_context()->add_class("task-card");
-
-        auto line1_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_HORIZONTAL, 0);
-        auto time_label = Gtk::make_managed<Gtk::Label>(format_cross_day_timespan(segment));
-        auto name_label = Gtk::make_managed<Gtk::Label>();
-
-        // 跨天任务片段的名称显示
-        string display_name = segment.name;
-        if (segment.is_cross_day && !segment.is_first_segment)
-        {
-            display_name = segment.name + " (续)";
-        }
-        else if (segment.is_cross_day && segment.is_first_segment)
-        {
-            tm original_end_tm = *localtime(&segment.original_end);
-            char end_date_buf[20];
-            strftime(end_date_buf, sizeof(end_date_buf), "%m.%d", &original_end_tm);
-            display_name = segment.name + " (至" + string(end_date_buf) + ")";
-        }
-
-        name_label->set_markup("<b>" + display_name + "</b>");
-        name_label->set_hexpand(true);
-        name_label->set_halign(Gtk::ALIGN_START);
-
-        // 使用原始任务的时间计算状态
-        Task temp_task;
-        temp_task.id = segment.id;
-        temp_task.name = segment.name;
-        temp_task.startTime = segment.original_start;
-        temp_task.duration = (segment.original_end - segment.original_start) / 60;
-        temp_task.priority = segment.priority;
-        temp_task.category = segment.category;
-        temp_task.customCategory = segment.customCategory;
-        temp_task.reminderOption = segment.reminderOption;
-
-        string status = get_task_status(temp_task, current_time);
-        auto status_label = Gtk::make_managed<Gtk::Label>(status);
-        status_label->set_halign(Gtk::ALIGN_END);
-        status_label->set_margin_end(10);
-
-        line1_box->pack_start(*time_label, false, false, 10);
-        line1_box->pack_start(*name_label, true, true);
-
-        // 只在有冲突时显示优先级标签
-        if (segment.has_conflict)
-        {
-            auto priority_label = Gtk::make_managed<Gtk::Label>(priority_to_string(segment.priority));
-            priority_label->get_style_context()->add_class("category-tag");
-            priority_label->set_margin_end(5);
-
-            // 如果是冲突组中的最高优先级任务，添加特殊样式类
-            if (segment.is_highest_priority_in_conflict)
-            {
-                priority_label->get_style_context()->add_class("priority-highest");
-                priority_label->set_markup("<b>" + priority_to_string(segment.priority) + "</b>");
-            }
-
-            line1_box->pack_start(*priority_label, false, false, 0);
-        }
-
-        line1_box->pack_start(*status_label, false, false);
-
-        auto line2_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_HORIZONTAL, 10);
-        auto category_label = Gtk::make_managed<Gtk::Label>(category_to_string(temp_task));
-        category_label->get_style_context()->add_class("category-tag");
-
-        // 如果有冲突，添加冲突标签
-        if (segment.has_conflict)
-        {
-            auto conflict_label = Gtk::make_managed<Gtk::Label>("冲突");
-            conflict_label->get_style_context()->add_class("category-tag");
-            conflict_label->set_markup("<span color='red'><b>冲突</b></span>");
-            line2_box->pack_start(*conflict_label, false, false, 0);
-        }
-
-        auto alarm_icon = Gtk::make_managed<Gtk::Image>();
-        alarm_icon->set_from_icon_name("alarm-symbolic", Gtk::ICON_SIZE_MENU);
-
-        // 获取正确的提醒时间显示，特别是对于已提醒的任务
-        string reminder_display = segment.reminderOption;
-
-        // 查找对应的完整任务以获取提醒状态信息
-        Task *full_task = m_task_manager.getTaskById(segment.id);
-        if (full_task && full_task->reminded && full_task->reminderTime > 0)
-        {
-            // 已提醒的任务，重新计算显示
-            reminder_display = update_reminder_option_display(full_task->reminderTime, segment.original_start);
-        }
-
-        auto remind_label = Gtk::make_managed<Gtk::Label>("提醒时间：" + reminder_display);
-        remind_label->get_style_context()->add_class("remind-label");
-
-        line2_box->pack_start(*category_label, false, false, 0);
-        line2_box->pack_start(*alarm_icon, false, false, 0);
-        line2_box->pack_start(*remind_label, false, false, 0);
-
-        card_box->pack_start(*line1_box, false, false, 0);
-        card_box->pack_start(*line2_box, false, false, 0);
-
-        event_box->add(*card_box);
-        row->add(*event_box);
-        row->set_data("task_id", new long long(segment.id));
-
-        event_box->signal_button_press_event().connect([this, task_id = segment.id](GdkEventButton *event)
-                                                       {
-            if (event->type == GDK_BUTTON_PRESS && event->button == GDK_BUTTON_SECONDARY) {
-                if (m_task_context_menu) {
-                    m_context_menu_task_id = task_id;
-                    m_context_menu_date = 0;
-                    update_task_context_menu_availability(task_id);
-                    m_task_context_menu->popup_at_pointer((GdkEvent*)event);
-                }
-                return true;
-            }
-            return false; });
-
-        current_list_box->add(*row);
-    }
+    shared_ptr<DayLayout::Snapshot> layout = begin_day_layout();
+    DayLayout::SegmentList task_segments = layout->segmentsForDay(m_selected_date);
 
     // 如果当日没有任务，显示提示信息
-    if (!has_tasks_today)
+    if (task_segments.empty())
     {
         auto row = Gtk::make_managed<Gtk::ListBoxRow>();
         auto event_box = Gtk::make_managed<Gtk::EventBox>();
@@ -1671,9 +1735,153 @@ void SchedulerApp::update_selected_day_details()
             return false; });
 
         current_list_box->add(*row);
+        current_list_box->show_all();
+        return;
     }
 
+    // 先同步构建首屏可见的卡片，其余卡片在空闲时分片追加；
+    // 分片任务持有快照，片段所在的内存在任务完成或被取消前不会被回收
+    size_t next = 0;
+    append_task_cards(current_list_box, *layout, task_segments, next, kVisibleCardCount, current_time);
     current_list_box->show_all();
+
+    if (next < task_segments.size())
+    {
+        m_idle_scheduler.post(job_key, IdleScheduler::Priority::NORMAL,
+                              [this, current_list_box, layout, segments = move(task_segments), next, current_time]() mutable
+                              {
+                                  append_task_cards(current_list_box, *layout, segments, next, kCardsPerStep, current_time);
+                                  return next < segments.size();
+                              });
+    }
+}
+
+// 追加 [next, next + count) 范围内的任务卡片，next 随之前移
+void SchedulerApp::append_task_cards(Gtk::ListBox *list_box, const DayLayout::Snapshot &layout, const DayLayout::SegmentList &segments,
+                                     size_t &next, size_t count, time_t current_time)
+{
+    Trace::Span trace_span("SchedulerApp::append_task_cards", "ui");
+    size_t end = min(segments.size(), next + count);
+    for (; next < end; ++next)
+    {
+        Gtk::ListBoxRow *row = create_task_card_row(layout.task(segments[next]), segments[next], current_time);
+        list_box->add(*row);
+        row->show_all();
+    }
+}
+
+// 构建选中日详情中的一张任务卡片
+Gtk::ListBoxRow *SchedulerApp::create_task_card_row(const Task &task, const TaskSegment &segment, time_t current_time)
+{
+    auto row = Gtk::make_managed<Gtk::ListBoxRow>();
+    auto event_box = Gtk::make_managed<Gtk::EventBox>();
+
+    auto card_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_VERTICAL, 8);
+    card_box->get_style_context()->add_class("task-card");
+
+    auto line1_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_HORIZONTAL, 0);
+    auto time_label = Gtk::make_managed<Gtk::Label>(format_cross_day_timespan(segment));
+    auto name_label = Gtk::make_managed<Gtk::Label>();
+
+    // 跨天任务片段的名称显示
+    string display_name = task.name;
+    if (segment.is_cross_day && !segment.is_first_segment)
+    {
+        display_name = task.name + " (续)";
+    }
+    else if (segment.is_cross_day && segment.is_first_segment)
+    {
+        time_t original_end = DayLayout::endTime(task);
+        tm original_end_tm = *localtime(&original_end);
+        char end_date_buf[20];
+        strftime(end_date_buf, sizeof(end_date_buf), "%m.%d", &original_end_tm);
+        display_name = task.name + " (至" + string(end_date_buf) + ")";
+    }
+
+    name_label->set_markup("<b>" + display_name + "</b>");
+    name_label->set_hexpand(true);
+    name_label->set_halign(Gtk::ALIGN_START);
+
+    // 使用原始任务的时间计算状态
+    string status = get_task_status(task, current_time);
+    auto status_label = Gtk::make_managed<Gtk::Label>(status);
+    status_label->set_halign(Gtk::ALIGN_END);
+    status_label->set_margin_end(10);
+
+    line1_box->pack_start(*time_label, false, false, 10);
+    line1_box->pack_start(*name_label, true, true);
+
+    // 只在有冲突时显示优先级标签
+    if (segment.has_conflict)
+    {
+        auto priority_label = Gtk::make_managed<Gtk::Label>(priority_to_string(segment.priority));
+        priority_label->get_style_context()->add_class("category-tag");
+        priority_label->set_margin_end(5);
+
+        // 如果是冲突组中的最高优先级任务，添加特殊样式类
+        if (segment.is_highest_priority_in_conflict)
+        {
+            priority_label->get_style_context()->add_class("priority-highest");
+            priority_label->set_markup("<b>" + priority_to_string(segment.priority) + "</b>");
+        }
+
+        line1_box->pack_start(*priority_label, false, false, 0);
+    }
+
+    line1_box->pack_start(*status_label, false, false);
+
+    auto line2_box = Gtk::make_managed<Gtk::Box>(Gtk::ORIENTATION_HORIZONTAL, 10);
+    auto category_label = Gtk::make_managed<Gtk::Label>(category_to_string(task));
+    category_label->get_style_context()->add_class("category-tag");
+
+    // 如果有冲突，添加冲突标签
+    if (segment.has_conflict)
+    {
+        auto conflict_label = Gtk::make_managed<Gtk::Label>("冲突");
+        conflict_label->get_style_context()->add_class("category-tag");
+        conflict_label->set_markup("<span color='red'><b>冲突</b></span>");
+        line2_box->pack_start(*conflict_label, false, false, 0);
+    }
+
+    auto alarm_icon = Gtk::make_managed<Gtk::Image>();
+    alarm_icon->set_from_icon_name("alarm-symbolic", Gtk::ICON_SIZE_MENU);
+
+    // 获取正确的提醒时间显示，特别是对于已提醒的任务
+    string reminder_display = task.reminderOption;
+    if (task.reminded && task.reminderTime > 0)
+    {
+        // 已提醒的任务，重新计算显示
+        reminder_display = update_reminder_option_display(task.reminderTime, task.startTime);
+    }
+
+    auto remind_label = Gtk::make_managed<Gtk::Label>("提醒时间：" + reminder_display);
+    remind_label->get_style_context()->add_class("remind-label");
+
+    line2_box->pack_start(*category_label, false, false, 0);
+    line2_box->pack_start(*alarm_icon, false, false, 0);
+    line2_box->pack_start(*remind_label, false, false, 0);
+
+    card_box->pack_start(*line1_box, false, false, 0);
+    card_box->pack_start(*line2_box, false, false, 0);
+
+    event_box->add(*card_box);
+    row->add(*event_box);
+    row->set_data("task_id", new long long(segment.id));
+
+    event_box->signal_button_press_event().connect([this, task_id = segment.id](GdkEventButton *event)
+                                                   {
+        if (event->type == GDK_BUTTON_PRESS && event->button == GDK_BUTTON_SECONDARY) {
+            if (m_task_context_menu) {
+                m_context_menu_task_id = task_id;
+                m_context_menu_date = 0;
+                update_task_context_menu_availability(task_id);
+                m_task_context_menu->popup_at_pointer((GdkEvent*)event);
+            }
+            return true;
+        }
+        return false; });
+
+    return row;
 }
 
 void SchedulerApp::update_date_label_and_indicator()
@@ -1831,6 +2039,24 @@ bool SchedulerApp::on_list_box_button_press(GdkEventButton *event, Gtk::ListBox
     return false;
 }
 
+// 周视图时间轴空白处点击：左键选中该日，右键以点击位置的时间预填“添加任务”
+bool SchedulerApp::on_week_timeline_empty_press(GdkEventButton *event, time_t clicked_time)
+{
+    if (event->type != GDK_BUTTON_PRESS)
+        return false;
+
+    m_selected_date = clicked_time;
+    update_all_views();
+
+    if (event->button == GDK_BUTTON_SECONDARY && m_empty_space_context_menu)
+    {
+        m_context_menu_task_id = -1;
+        m_context_menu_date = clicked_time;
+        m_empty_space_context_menu->popup_at_pointer((GdkEvent *)event);
+    }
+    return true;
+}
+
 // --- 其余函数 ---
 
 void SchedulerApp::on_add_task_ok_button_clicked()
@@ -1867,7 +2093,7 @@ void SchedulerApp::on_add_task_ok_button_clicked()
     else
     {
         // 编辑现有任务时，获取原任务信息
-        Task *originalTask = m_task_manager.getTaskById(m_editing_task_id);
+        optional<Task> originalTask = m_task_manager.getTaskById(m_editing_task_id);
         if (!originalTask)
         {
             show_message("错误", "找不到要编辑的任务。");
@@ -1958,7 +2184,7 @@ void SchedulerApp::on_add_task_ok_button_clicked()
             // 修改提醒时间验证逻辑，考虑编辑模式的特殊情况
             if (m_is_editing_task)
             {
-                Task *originalTask = m_task_manager.getTaskById(m_editing_task_id);
+                optional<Task> originalTask = m_task_manager.getTaskById(m_editing_task_id);
                 if (originalTask && originalTask->reminded)
                 {
                     // 已提醒的任务：保持原提醒时间，但需要重新计算显示
@@ -2009,7 +2235,7 @@ void SchedulerApp::on_add_task_ok_button_clicked()
     {
         // 编辑模式：保留原任务ID和已提醒状态
         newTask.id = m_editing_task_id;
-        Task *originalTask = m_task_manager.getTaskById(m_editing_task_id);
+        optional<Task> originalTask = m_task_manager.getTaskById(m_editing_task_id);
         if (originalTask && originalTask->reminded)
         {
             newTask.reminded = true;
@@ -2026,6 +2252,7 @@ void SchedulerApp::on_add_task_ok_button_clicked()
     {
         update_days_with_tasks_cache(); // 更新缓存
         update_all_views();
+        schedule_status_refresh();
         if (m_is_editing_task)
         {
             show_message("成功", "任务已修改。");
@@ -2160,7 +2387,7 @@ void SchedulerApp::on_add_task_fields_changed()
     // 如果正在编辑已提醒的任务，当开始时间变化时重新计算提醒选项显示
     if (m_is_editing_task && task_reminder_entry && task_reminder_combo)
     {
-        Task *originalTask = m_task_manager.getTaskById(m_editing_task_id);
+        optional<Task> originalTask = m_task_manager.getTaskById(m_editing_task_id);
         if (originalTask && originalTask->reminded && originalTask->reminderTime > 0 && m_selected_start_time > 0)
         {
             // 重新计算提醒选项显示
@@ -2463,13 +2690,40 @@ void SchedulerApp::apply_edit_task_constraints(const Task &task)
 }
 void SchedulerApp::update_task_list()
 {
+    UiBenchmark::Scope bench_scope(m_ui_bench.get(), "update_task_list");
+    static Metrics::Histogram &refresh_time = Metrics::histogram("scheduler_ui_refresh_seconds", "界面刷新函数的耗时", "function=\"update_task_list\"");
+    Metrics::ScopedTimer metrics_timer(refresh_time);
+    Trace::Span trace_span("SchedulerApp::update_task_list", "ui");
+    AllocCounter::Scope alloc_scope("update_task_list");
     if (!m_refTreeModel)
         return;
+    m_idle_scheduler.cancel("agenda_rows");
     m_refTreeModel->clear();
-    vector<Task> tasks = m_task_manager.getAllTasks();
+    auto tasks = make_shared<vector<Task>>(m_task_manager.getAllTasks());
     time_t current_time = time(nullptr); // 使用一致的时间戳
-    for (const auto &task : tasks)
+
+    // 先同步填充首屏可见的行，其余行在空闲时分片追加
+    size_t next = 0;
+    append_task_rows(*tasks, next, kVisibleRowCount, current_time);
+    if (next < tasks->size())
     {
+        m_idle_scheduler.post("agenda_rows", IdleScheduler::Priority::NORMAL,
+                              [this, tasks, next, current_time]() mutable
+                              {
+                                  append_task_rows(*tasks, next, kRowsPerStep, current_time);
+                                  return next < tasks->size();
+                              });
+    }
+}
+
+// 向日程列表追加 [next, next + count) 范围内的任务行，next 随之前移
+void SchedulerApp::append_task_rows(const vector<Task> &tasks, size_t &next, size_t count, time_t current_time)
+{
+    Trace::Span trace_span("SchedulerApp::append_task_rows", "ui");
+    size_t end = min(tasks.size(), next + count);
+    for (; next < end; ++next)
+    {
+        const Task &task = tasks[next];
         Gtk::TreeModel::Row row = *(m_refTreeModel->append());
         row[m_Columns.m_col_id] = task.id;
         row[m_Columns.m_col_name] = task.name;
@@ -2528,16 +2782,294 @@ void SchedulerApp::on_login_success()
 {
     item_show_.set_sensitive(true);
     update_days_with_tasks_cache(); // 更新缓存
+    // 回调经由 UI 转发函数在 GTK 线程中执行
     m_task_manager.setReminderCallback([this](const string &title, const string &msg)
-                                       { Glib::signal_idle().connect_once([this, title, msg]()
-                                                                          { 
-            this->show_message(title, msg); 
-            this->update_all_views(); }); });
-    m_task_manager.startReminderThread();
+                                       {
+            this->on_reminder(title, msg);
+            this->update_all_views();
+            this->schedule_status_refresh(); });
+    start_reminder_delivery();
+    // 不再每 60 秒整体刷新，而是在下一个状态变化的时刻刷新受影响的行
+    schedule_status_refresh();
+}
+
+// 计算 now 之后最近一次会改变界面显示的时刻：
+// 任务开始（未开始→进行中）、任务结束（进行中→已结束）、提醒时间到达，以及次日零点（“今日”高亮）
+time_t SchedulerApp::next_status_transition(time_t now) const
+{
+    tm next_day_tm = *localtime(&now);
+    next_day_tm.tm_mday += 1;
+    next_day_tm.tm_hour = next_day_tm.tm_min = next_day_tm.tm_sec = 0;
+    next_day_tm.tm_isdst = -1;
+    // 任务的三种时刻在 TaskManager 锁内扫描记录得到，不复制整个任务列表
+    return m_task_manager.nextStatusTransition(now, mktime(&next_day_tm));
+}
+
+// 重新布置状态变化定时器（一次性），任务增删改后都需要调用
+void SchedulerApp::schedule_status_refresh()
+{
+    // 任务变化后同时重新对齐提醒定时器
+    arm_reminder_timer();
+
+    if (m_timer_connection)
+        m_timer_connection.disconnect();
+    if (m_current_user.empty())
+        return;
+
+    time_t now = time(nullptr);
+    m_last_status_refresh = now;
+    time_t next = next_status_transition(now);
+
+    // GLib 超时基于单调时钟，挂起期间不计时；最长等待一小时，唤醒后总能重新对齐墙上时间
+    const gint64 max_delay_ms = 3600 * 1000;
+    gint64 delay_ms = static_cast<gint64>(next) * 1000 - g_get_real_time() / 1000;
+    delay_ms = max<gint64>(0, min(delay_ms, max_delay_ms));
+
     m_timer_connection = Glib::signal_timeout().connect([this]()
                                                         {
-        this->update_all_views();
-        return true; }, 60000);
+        this->on_status_transition();
+        return false; }, static_cast<unsigned int>(delay_ms));
 }
 
-void SchedulerApp::on_reminder(const string &title, const string &msg) { show_message(title, msg); }
\ No newline at end of file
+// 定时器到点：找出自上次刷新以来跨过状态边界的任务，只刷新这些行
+void SchedulerApp::on_status_transition()
+{
+    time_t now = time(nullptr);
+    time_t last = m_last_status_refresh;
+
+    tm last_day_tm = *localtime(&last);
+    tm now_day_tm = *localtime(&now);
+    if (last_day_tm.tm_yday != now_day_tm.tm_yday || last_day_tm.tm_year != now_day_tm.tm_year)
+    {
+        // 跨过零点：“今日”高亮和日期标签都会变化，整体刷新一次
+        update_all_views();
+        schedule_status_refresh();
+        return;
+    }
+
+    vector<long long> changed_ids = m_task_manager.getStatusChangedIds(last, now);
+    refresh_task_status_rows(changed_ids, now);
+    schedule_status_refresh();
+}
+
+// 只刷新状态发生变化的任务：日程列表改写对应行的状态列，选中日详情仅在受影响时重建
+void SchedulerApp::refresh_task_status_rows(const vector<long long> &changed_ids, time_t now)
+{
+    if (changed_ids.empty())
+        return;
+
+    // 跨过边界的任务通常只有几个，逐个按 id 取出
+    map<long long, Task> changed_tasks;
+    for (long long id : changed_ids)
+    {
+        if (optional<Task> task = m_task_manager.getTaskById(id))
+            changed_tasks[id] = move(*task);
+    }
+
+    if (m_refTreeModel)
+    {
+        for (const auto &row : m_refTreeModel->children())
+        {
+            auto it = changed_tasks.find(row[m_Columns.m_col_id]);
+            if (it == changed_tasks.end())
+                continue;
+            row[m_Columns.m_col_reminder_status] = get_reminder_status(it->second);
+            row[m_Columns.m_col_task_status] = get_task_status(it->second, now);
+        }
+    }
+
+    if (m_current_view_mode == ViewMode::MONTH || m_current_view_mode == ViewMode::WEEK)
+    {
+        tm day_tm = *localtime(&m_selected_date);
+        day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
+        time_t start_of_day = mktime(&day_tm);
+        time_t end_of_day = start_of_day + 86400;
+        for (const auto &entry : changed_tasks)
+        {
+            const Task &task = entry.second;
+            time_t task_end = task.startTime + task.duration * 60;
+            if (task_end >= start_of_day && task.startTime < end_of_day)
+            {
+                update_selected_day_details();
+                break;
+            }
+        }
+    }
+}
+
+// 提醒只进入通知队列，不弹出模态对话框，主循环不会因为提醒而阻塞
+void SchedulerApp::on_reminder(const string &title, const string &msg)
+{
+    if (m_notification_center)
+        m_notification_center->post(title, msg);
+    else
+        cout << title << ": " << msg << endl;
+}
+
+void SchedulerApp::start_reminder_delivery()
+{
+    // 独立的提醒守护进程在运行时由它负责提醒，界面只作为客户端。守护进程可能在登录之后才启动或中途退出，
+    // 因此两种模式都照常启动，由 TaskManager 在每次投递前检查守护进程的锁
+    m_task_manager.setDeferToDaemon(true);
+    if (ReminderEngine::isDaemonRunning(m_current_user))
+        cout << "检测到提醒守护进程，界面不再自行投递提醒。" << endl;
+
+    const char *mode = g_getenv("SCHEDULER_REMINDER_DELIVERY");
+    m_mainloop_reminders = mode && string(mode) == "mainloop";
+    if (m_mainloop_reminders)
+    {
+        if (!m_reminder_timer)
+            m_reminder_timer = make_unique<RealtimeTimer>();
+        if (m_reminder_timer->is_valid())
+        {
+            m_reminder_io_connection.disconnect();
+            m_reminder_io_connection = Glib::signal_io().connect(sigc::mem_fun(*this, &SchedulerApp::on_reminder_timer),
+                                                                 m_reminder_timer->fd(), Glib::IO_IN, Glib::PRIORITY_DEFAULT);
+            arm_reminder_timer();
+            cout << "提醒由主循环定时器投递。" << endl;
+            return;
+        }
+        cerr << "timerfd 不可用，改用后台扫描投递提醒。" << endl;
+        m_mainloop_reminders = false;
+    }
+    m_task_manager.startReminders();
+}
+
+void SchedulerApp::stop_reminder_delivery()
+{
+    if (m_reminder_io_connection)
+        m_reminder_io_connection.disconnect();
+    if (m_reminder_timer)
+        m_reminder_timer->disarm();
+    // 两种模式下都由它补发被限流的提醒
+    m_task_manager.stopReminders();
+}
+
+void SchedulerApp::arm_reminder_timer()
+{
+    if (!m_mainloop_reminders || !m_reminder_io_connection.connected())
+        return;
+
+    time_t next = m_task_manager.nextReminderTime();
+    if (next > 0)
+        m_reminder_timer->arm_at(next);
+    else
+        m_reminder_timer->disarm();
+}
+
+bool SchedulerApp::on_reminder_timer(Glib::IOCondition)
+{
+    if (m_reminder_timer->consume() == RealtimeTimer::Event::CLOCK_CHANGED)
+        cout << "系统时间已变化，重新设置提醒定时器。" << endl;
+
+    // 回调直接在主线程执行（其中会刷新视图并重新设置定时器）
+    m_task_manager.deliverDueReminders();
+    arm_reminder_timer();
+    return true;
+}
+// --- 界面基准测试模式 ---
+
+// 跳过登录，直接打开主窗口并按帧执行脚本
+void SchedulerApp::start_ui_bench()
+{
+    if (!ensure_ui(UiFragment::MAIN) || !main_window)
+    {
+        cerr << "界面基准测试: 无法加载主界面" << endl;
+        quit();
+        return;
+    }
+
+    m_current_user = m_ui_bench->user();
+    m_task_manager.setCurrentUser(m_current_user);
+
+    // 任务最多的一天（busiest 操作的目标），在开始计时之前算好
+    map<time_t, int> day_counts;
+    for (const auto &task : m_task_manager.getAllTasks())
+        ++day_counts[DayLayout::startOfDay(task.startTime)];
+    auto busiest = max_element(day_counts.begin(), day_counts.end(), [](const auto &a, const auto &b)
+                               { return a.second < b.second; });
+    m_ui_bench_busiest_day = busiest != day_counts.end() ? busiest->first : time(nullptr);
+    cout << "界面基准测试: 用户 " << m_current_user << "，" << day_counts.size() << " 天有任务" << endl;
+
+    time(&m_displayed_date);
+    time(&m_selected_date);
+    m_current_view_mode = ViewMode::WEEK;
+    main_window->show();
+    update_days_with_tasks_cache();
+    update_all_views();
+
+    // 每帧的更新阶段检查一次：上一步触发的空闲分片已经全部完成，且上一帧已经绘制，才开始下一步
+    main_window->add_tick_callback(sigc::mem_fun(*this, &SchedulerApp::on_ui_bench_tick));
+}
+
+bool SchedulerApp::on_ui_bench_tick(const Glib::RefPtr<Gdk::FrameClock> &)
+{
+    if (!m_idle_scheduler.is_idle())
+        return true;
+
+    if (m_ui_bench_step_running)
+    {
+        m_ui_bench->step_settled(count_widgets());
+        m_ui_bench_step_running = false;
+    }
+    if (m_ui_bench->finished())
+    {
+        m_ui_bench->report();
+        Glib::signal_idle().connect_once([this]()
+                                         { on_quit_app(); });
+        return false;
+    }
+
+    run_ui_bench_step(m_ui_bench->begin_step());
+    m_ui_bench->step_returned();
+    m_ui_bench_step_running = true;
+    return true;
+}
+
+void SchedulerApp::run_ui_bench_step(const string &action)
+{
+    if (action == "month")
+        on_view_button_clicked(ViewMode::MONTH);
+    else if (action == "week")
+        on_view_button_clicked(ViewMode::WEEK);
+    else if (action == "agenda")
+        on_view_button_clicked(ViewMode::AGENDA);
+    else if (action == "next")
+        on_next_button_clicked();
+    else if (action == "prev")
+        on_prev_button_clicked();
+    else if (action == "today")
+        on_today_button_clicked();
+    else if (action == "busiest")
+    {
+        m_displayed_date = m_selected_date = m_ui_bench_busiest_day;
+        update_all_views();
+    }
+    else if (action == "select")
+    {
+        // 与点击日期格相同：选中后一天并刷新
+        tm selected_tm = *localtime(&m_selected_date);
+        selected_tm.tm_mday += 1;
+        selected_tm.tm_isdst = -1;
+        m_selected_date = mktime(&selected_tm);
+        update_all_views();
+    }
+    else
+        cerr << "界面基准测试: 未知操作 " << action << endl;
+}
+
+static void count_widget(GtkWidget *widget, gpointer data)
+{
+    ++*static_cast<int *>(data);
+    if (GTK_IS_CONTAINER(widget))
+        gtk_container_forall(GTK_CONTAINER(widget), count_widget, data);
+}
+
+// 主窗口中的控件总数（包括容器内部的子控件）
+int SchedulerApp::count_widgets() const
+{
+    int count = 0;
+    if (main_window)
+        count_widget(GTK_WIDGET(main_window->gobj()), &count);
+    return count;
+}
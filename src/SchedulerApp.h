@@ -3,8 +3,19 @@
 #include <gtkmm.h>
 #include "UserManager.h"
 #include "TaskManager.h"
+#include "DayLayout.h"
+#include "BackgroundExecutor.h"
+#include "RealtimeTimer.h"
+#include "WeekTimelineView.h"
+#include "IdleScheduler.h"
+#include "NotificationCenter.h"
+#include "UiBenchmark.h"
+#include "MetricsExporter.h"
 #include <ctime>
 #include <set>
+#include <map>
+#include <mutex>
+#include <functional>
 #include <vector>
 #include <libayatana-appindicator/app-indicator.h>
 
@@ -14,7 +25,7 @@ public:
     // 构造函数
     SchedulerApp();
 
-    // 提醒回调函数，在后台线程触发提醒时被调用
+    // 提醒回调函数，后台提醒扫描触发提醒后经 Dispatcher 转到界面线程调用
     void on_reminder(const string &title, const string &msg);
     // 登录成功后调用的函数，用于启动后台服务
     void on_login_success();
@@ -61,8 +72,19 @@ public:
 
     ModelColumns m_Columns; // TreeView 列模型的实例
 
+    // 界面片段：每个顶层窗口对应 src/ui 下的一个 .ui 文件，首次使用时才构建
+    enum class UiFragment
+    {
+        LOGIN,
+        MAIN,
+        REGISTER,
+        CHANGE_PASSWORD,
+        HELP,
+        ADD_TASK
+    };
+
     // UI元素指针
-    Glib::RefPtr<Gtk::Builder> m_builder;
+    map<UiFragment, Glib::RefPtr<Gtk::Builder>> m_builders; // 已构建的界面片段
     Gtk::Window *login_window = nullptr, *register_window = nullptr, *main_window = nullptr, *help_window = nullptr, *change_password_window = nullptr;
     Gtk::Dialog *add_task_dialog = nullptr;
     Gtk::Entry *login_username_entry = nullptr, *login_password_entry = nullptr;
@@ -81,6 +103,7 @@ public:
     Gtk::MenuItem *menu_item_change_password = nullptr;
     Gtk::MenuItem *menu_item_delete_account = nullptr;
     Gtk::MenuItem *menu_item_help = nullptr;
+    Gtk::CheckMenuItem *menu_item_trace = nullptr;
 
     // 主界面控件
     Gtk::Paned *m_month_view_pane = nullptr;
@@ -100,6 +123,10 @@ public:
     Gtk::RadioButton *m_week_day_buttons[7] = {nullptr};
     Gtk::Label *m_week_day_labels[7] = {nullptr};
     sigc::connection m_week_day_signal_connections[7];
+    Gtk::Box *m_week_timeline_box = nullptr;
+    WeekTimelineView *m_week_timeline = nullptr; // 周视图 7×24 小时时间轴
+    Gtk::Box *m_notification_box = nullptr;
+    NotificationCenter *m_notification_center = nullptr; // 提醒横幅队列（不阻塞主循环）
 
     // 右键上下文菜单
     Gtk::Menu *m_task_context_menu = nullptr, *m_empty_space_context_menu = nullptr;
@@ -119,6 +146,16 @@ public:
     Gtk::Entry *task_reminder_entry = nullptr;
     time_t m_selected_start_time = 0; // "添加任务"对话框中选择的开始时间
 
+    // 后台线程池与界面线程转发：声明在业务逻辑处理器之前，保证它们比 TaskManager 活得更久
+    Glib::Dispatcher m_ui_dispatcher;         // 后台结果统一经由它回到 GTK 线程
+    mutex m_ui_queue_mutex;
+    vector<function<void()>> m_ui_queue;
+    BackgroundExecutor m_executor;            // 应用共享的后台线程池
+    MetricsExporter m_metrics_exporter;       // SCHEDULER_METRICS_FILE / SCHEDULER_METRICS_SOCKET 设置时导出指标
+    string m_trace_path;                      // SCHEDULER_TRACE 指定的跟踪文件，退出时写入
+    void post_to_ui(function<void()> fn);     // 可在任意线程调用
+    void on_ui_dispatch();
+
     // 业务逻辑处理器和状态
     UserManager m_user_manager;
     TaskManager m_task_manager;
@@ -130,27 +167,63 @@ public:
     time_t m_displayed_date;
     time_t m_selected_date;
 
-    // 用于管理定时器
+    // 用于管理定时器：只在下一个任务状态变化的时刻触发一次
     sigc::connection m_timer_connection;
+    time_t m_last_status_refresh = 0; // 上次按状态刷新界面的时刻
 
     // 实现系统托盘图标
     void setup_tray_icon();
 
 private:
     set<time_t> m_days_with_tasks;       // 缓存有任务的日期
+    IdleScheduler m_idle_scheduler;      // 大列表和缓存重建的空闲分片调度
+    shared_ptr<DayLayout::Snapshot> m_day_layout; // 最近一次刷新的任务快照和片段内存，分片构建中的卡片列表共同持有
     void update_days_with_tasks_cache(); // 更新缓存的方法
 
-    // UI初始化和管理
-    void get_widgets();
-    void connect_signals();
+    // 状态变化定时器：计算下一次状态变化时刻并只刷新受影响的行
+    time_t next_status_transition(time_t now) const;
+    void schedule_status_refresh();
+    void on_status_transition();
+    void refresh_task_status_rows(const vector<long long> &changed_ids, time_t now);
+
+    // 主循环提醒投递（SCHEDULER_REMINDER_DELIVERY=mainloop 时启用）：timerfd 接入 GLib 主循环，
+    // 对准下一条提醒的时刻触发，不需要后台轮询，也不经过其他线程
+    bool m_mainloop_reminders = false;
+    unique_ptr<RealtimeTimer> m_reminder_timer;
+    sigc::connection m_reminder_io_connection;
+    void start_reminder_delivery();
+    void stop_reminder_delivery();
+    void arm_reminder_timer();
+    bool on_reminder_timer(Glib::IOCondition condition);
+
+    // 界面基准测试模式（SCHEDULER_UI_BENCH），见 UiBenchmark.h
+    unique_ptr<UiBenchmark> m_ui_bench;
+    bool m_ui_bench_step_running = false;
+    time_t m_ui_bench_busiest_day = 0;
+    void start_ui_bench();
+    void run_ui_bench_step(const string &action);
+    bool on_ui_bench_tick(const Glib::RefPtr<Gdk::FrameClock> &clock);
+    int count_widgets() const;
+
+    // UI初始化和管理（按界面片段延迟构建）
+    static const char *ui_fragment_name(UiFragment fragment);
+    bool ensure_ui(UiFragment fragment);
+    void load_login_ui(const Glib::RefPtr<Gtk::Builder> &builder);
+    void load_main_ui(const Glib::RefPtr<Gtk::Builder> &builder);
+    void load_register_ui(const Glib::RefPtr<Gtk::Builder> &builder);
+    void load_change_password_ui(const Glib::RefPtr<Gtk::Builder> &builder);
+    void load_help_ui(const Glib::RefPtr<Gtk::Builder> &builder);
+    void load_add_task_ui(const Glib::RefPtr<Gtk::Builder> &builder);
     void show_message(const string &title, const string &msg);
 
     // UI更新和辅助函数
     void update_all_views();
     void update_view_specific_layout();
     void update_task_list();
+    void append_task_rows(const vector<Task> &tasks, size_t &next, size_t count, time_t current_time);
     void populate_month_view();
     void populate_week_view();
+    void populate_week_timeline(time_t week_start);
     void update_selected_day_details();
     void update_date_label_and_indicator();
     void update_view_switcher_ui();
@@ -167,31 +240,13 @@ private:
     string format_timespan(time_t start_time, time_t end_time);
     string update_reminder_option_display(time_t reminder_time, time_t start_time);
 
-    // 跨天任务处理相关函数
-    struct TaskSegment
-    {
-        long long id;
-        string name;
-        time_t display_start;  // 在当天显示的开始时间
-        time_t display_end;    // 在当天显示的结束时间
-        time_t original_start; // 原始任务开始时间
-        time_t original_end;   // 原始任务结束时间
-        Priority priority;
-        Category category;
-        string customCategory;
-        string reminderOption;
-        bool is_cross_day;                    // 是否是跨天任务片段
-        bool is_first_segment;                // 是否是第一个片段（用于显示任务名称等）
-        bool has_conflict;                    // 是否与其他任务有时间冲突
-        bool is_highest_priority_in_conflict; // 是否是冲突组中的最高优先级任务
-    };
-    vector<TaskSegment> get_tasks_for_day(time_t day_time);
+    // 跨天任务处理相关函数（片段的计算在 DayLayout 中）
+    shared_ptr<DayLayout::Snapshot> begin_day_layout();
+    Gtk::ListBoxRow *create_task_card_row(const Task &task, const TaskSegment &segment, time_t current_time);
+    void append_task_cards(Gtk::ListBox *list_box, const DayLayout::Snapshot &layout, const DayLayout::SegmentList &segments,
+                           size_t &next, size_t count, time_t current_time);
     string format_cross_day_timespan(const TaskSegment &segment);
 
-    // 冲突检测和排序相关函数
-    bool tasks_overlap(const TaskSegment &task1, const TaskSegment &task2);
-    vector<TaskSegment> sort_tasks_with_conflicts(vector<TaskSegment> &segments, time_t day_time);
-
     // 登录界面信号处理函数
     void on_login_button_clicked();
     void on_show_register_button_clicked();
@@ -215,6 +270,7 @@ private:
     bool on_task_label_button_press(GdkEventButton *event, long long task_id, time_t date);
     bool on_tree_view_button_press(GdkEventButton *event);
     bool on_list_box_button_press(GdkEventButton *event, Gtk::ListBox *listbox);
+    bool on_week_timeline_empty_press(GdkEventButton *event, time_t clicked_time);
     void on_ctx_menu_add_task_activated();
     void on_ctx_menu_delete_task_activated();
     void on_ctx_menu_revise_task_activated();
@@ -225,6 +281,7 @@ private:
     void on_menu_item_change_password_activated();
     void on_menu_item_delete_account_activated();
     void on_menu_item_help_activated();
+    void on_menu_item_trace_toggled();
 
     // "添加任务" 对话框的信号处理
     void on_add_task_ok_button_clicked();
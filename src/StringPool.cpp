@@ -0,0 +1,62 @@
+#include "StringPool.h"
+
+using namespace std;
+
+StringPool::StringPool()
+{
+    m_entries.push_back({0, 0});
+}
+
+StringPool::Handle StringPool::store(string_view text)
+{
+    if (text.empty())
+        return kEmpty;
+    Handle handle = static_cast<Handle>(m_entries.size());
+    m_entries.push_back({static_cast<uint32_t>(m_data.size()), static_cast<uint32_t>(text.size())});
+    m_data.append(text.data(), text.size());
+    return handle;
+}
+
+StringPool::Handle StringPool::intern(string_view text)
+{
+    if (text.empty())
+        return kEmpty;
+    auto it = m_interned.find(text);
+    if (it != m_interned.end())
+        return it->second;
+    Handle handle = store(text);
+    m_interned.emplace(string(text), handle);
+    return handle;
+}
+
+void StringPool::clear()
+{
+    m_data.clear();
+    m_entries.resize(1);
+    m_interned.clear();
+}
+
+void StringPool::reserve(size_t strings, size_t bytes)
+{
+    m_entries.reserve(strings + 1);
+    m_data.reserve(bytes);
+}
+
+StringPool::Handle StringPool::append(const StringPool &other)
+{
+    Handle shift = static_cast<Handle>(m_entries.size() - 1);
+    uint32_t base = static_cast<uint32_t>(m_data.size());
+    m_entries.reserve(m_entries.size() + other.m_entries.size() - 1);
+    for (size_t i = 1; i < other.m_entries.size(); ++i)
+        m_entries.push_back({other.m_entries[i].offset + base, other.m_entries[i].length});
+    m_data.append(other.m_data);
+    return shift;
+}
+
+size_t StringPool::memoryBytes() const
+{
+    size_t interned = 0;
+    for (const auto &entry : m_interned)
+        interned += sizeof(entry) + 32 + entry.first.capacity(); // 32：红黑树节点的指针和颜色
+    return m_data.capacity() + m_entries.capacity() * sizeof(Entry) + interned;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// 保存在一块连续内存中的字符串，通过 32 位句柄引用。
+// store 每次追加一份；intern 对相同内容只保存一份，适合分类、提醒选项这类取值很少的字段。
+// 单个字符串不能释放，不再使用的字符串由持有者统计，在合适的时候整体重建（见 TaskStore）。
+// 本身不加锁
+class StringPool
+{
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kEmpty = 0; // 空串，不占用存储
+
+    StringPool();
+
+    Handle store(string_view text);
+    Handle intern(string_view text);
+    string_view view(Handle handle) const
+    {
+        const Entry &entry = m_entries[handle];
+        return string_view(m_data.data() + entry.offset, entry.length);
+    }
+
+    void clear();
+    void reserve(size_t strings, size_t bytes);
+    // 把另一个池的全部字符串接到末尾（不做 intern），other 中的句柄 h 变为 h + 返回值；
+    // 空串句柄不变，调用方需自行区分
+    Handle append(const StringPool &other);
+
+    size_t stringCount() const { return m_entries.size() - 1; }
+    size_t dataBytes() const { return m_data.size(); }
+    // 占用的内存（字符数据、句柄表和 intern 表的估计值）
+    size_t memoryBytes() const;
+
+private:
+    struct Entry
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    string m_data; // 所有字符串首尾相接
+    vector<Entry> m_entries;
+    map<string, Handle, less<>> m_interned;
+};
\ No newline at end of file
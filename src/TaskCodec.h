@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Task.h"
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+// 任务文件记录的编解码，由编译期的字段列表生成（文件格式见 TaskFile.h）：
+// 定长字段按列表顺序紧密排列，作为一整块拷贝；字符串字段各带 size_t 长度前缀，依次跟在定长块之后。
+// 增删字段只需修改下面的 Fixed / Strings 列表，编码和解码自动保持一致。
+// 所有函数都在内存缓冲区上操作，没有虚函数调用和逐字段的流状态检查
+namespace TaskCodec
+{
+    template <auto Member>
+    struct Field;
+
+    template <class Class, class Type, Type Class::*Member>
+    struct Field<Member>
+    {
+        using type = Type;
+        static constexpr size_t size = sizeof(Type);
+        static Type &get(Class &object) { return object.*Member; }
+        static const Type &get(const Class &object) { return object.*Member; }
+    };
+
+    // 定长字段：按原始字节存储，要求可平凡复制
+    template <auto... Members>
+    struct FixedFields
+    {
+        static_assert((is_trivially_copyable_v<typename Field<Members>::type> && ...), "定长字段必须可平凡复制");
+
+        static constexpr size_t size = (Field<Members>::size + ...);
+
+        static void pack(const Task &task, char *out)
+        {
+            ((memcpy(out, &Field<Members>::get(task), Field<Members>::size), out += Field<Members>::size), ...);
+        }
+
+        static void unpack(const char *in, Task &task)
+        {
+            ((memcpy(&Field<Members>::get(task), in, Field<Members>::size), in += Field<Members>::size), ...);
+        }
+    };
+
+    // 字符串字段：size_t 长度前缀 + 内容
+    template <auto... Members>
+    struct StringFields
+    {
+        static_assert((is_same_v<typename Field<Members>::type, string> && ...), "字符串字段必须是 std::string");
+
+        static constexpr size_t count = sizeof...(Members);
+
+        static size_t encodedSize(const Task &task)
+        {
+            return ((sizeof(size_t) + Field<Members>::get(task).size()) + ...);
+        }
+
+        static char *pack(const Task &task, char *out)
+        {
+            (packOne(Field<Members>::get(task), out), ...);
+            return out;
+        }
+
+        // 剩余数据不足时返回 false
+        static bool unpack(const char *&in, const char *end, Task &task)
+        {
+            return (unpackOne(in, end, Field<Members>::get(task)) && ...);
+        }
+
+        // 只根据长度前缀跳过，不拷贝内容（查找记录边界时使用）
+        static bool skip(const char *&in, const char *end)
+        {
+            return (skipOne<Members>(in, end) && ...);
+        }
+
+    private:
+        template <auto>
+        static bool skipOne(const char *&in, const char *end)
+        {
+            size_t len;
+            if (static_cast<size_t>(end - in) < sizeof(len))
+                return false;
+            memcpy(&len, in, sizeof(len));
+            if (static_cast<size_t>(end - in) - sizeof(len) < len)
+                return false;
+            in += sizeof(len) + len;
+            return true;
+        }
+
+        static void packOne(const string &value, char *&out)
+        {
+            size_t len = value.size();
+            memcpy(out, &len, sizeof(len));
+            memcpy(out + sizeof(len), value.data(), len);
+            out += sizeof(len) + len;
+        }
+
+        static bool unpackOne(const char *&in, const char *end, string &value)
+        {
+            size_t len;
+            if (static_cast<size_t>(end - in) < sizeof(len))
+                return false;
+            memcpy(&len, in, sizeof(len));
+            if (static_cast<size_t>(end - in) - sizeof(len) < len)
+                return false;
+            value.assign(in + sizeof(len), len);
+            in += sizeof(len) + len;
+            return true;
+        }
+    };
+
+    using Fixed = FixedFields<&Task::id, &Task::startTime, &Task::duration, &Task::priority, &Task::category,
+                              &Task::reminderTime, &Task::reminded>;
+    using Strings = StringFields<&Task::name, &Task::customCategory, &Task::reminderOption>;
+
+    // 追加一条记录，每条记录只扩展一次缓冲区
+    inline void encode(string &out, const Task &task)
+    {
+        size_t offset = out.size();
+        out.resize(offset + Fixed::size + Strings::encodedSize(task));
+        char *p = &out[offset];
+        Fixed::pack(task, p);
+        Strings::pack(task, p + Fixed::size);
+    }
+
+    // 从 [p, end) 解码一条记录并前移 p；剩余数据不足一条完整记录时返回 false，p 不变
+    inline bool decode(const char *&p, const char *end, Task &task)
+    {
+        if (static_cast<size_t>(end - p) < Fixed::size)
+            return false;
+        const char *cursor = p + Fixed::size;
+        if (!Strings::unpack(cursor, end, task))
+            return false;
+        Fixed::unpack(p, task);
+        p = cursor;
+        return true;
+    }
+
+    // 跳过一条完整的记录，语义同 decode
+    inline bool skip(const char *&p, const char *end)
+    {
+        if (static_cast<size_t>(end - p) < Fixed::size)
+            return false;
+        const char *cursor = p + Fixed::size;
+        if (!Strings::skip(cursor, end))
+            return false;
+        p = cursor;
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "TaskFile.h"
+#include "Logger.h"
+#include "TaskCodec.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+namespace TaskFile
+{
+    // 读写时的缓冲区大小：攒满一块再交给流，避免每个字段一次 read/write
+    static const size_t kChunkBytes = 1 << 20;
+
+    // 按块读入文件并逐条解码；块尾被截断的记录留到下一块开头继续解码，
+    // 文件末尾不完整的记录被忽略
+    static bool decodeFile(const string &path, const function<void(Task &)> &visit)
+    {
+        ifstream file(path, ios::binary);
+        if (!file.is_open())
+            return false;
+
+        string buffer(kChunkBytes, '\0');
+        size_t pending = 0; // 缓冲区开头尚未解码的字节数
+        Task t;
+        while (true)
+        {
+            if (pending == buffer.size())
+                buffer.resize(buffer.size() * 2); // 单条记录超过缓冲区大小
+            file.read(&buffer[pending], static_cast<streamsize>(buffer.size() - pending));
+            size_t filled = pending + static_cast<size_t>(file.gcount());
+            if (filled == pending)
+                break;
+
+            const char *p = buffer.data();
+            const char *end = p + filled;
+            while (TaskCodec::decode(p, end, t))
+                visit(t);
+
+            pending = static_cast<size_t>(end - p);
+            if (pending > 0 && p != buffer.data())
+                memmove(&buffer[0], p, pending);
+        }
+        return true;
+    }
+
+    static bool flush(ofstream &file, string &buffer)
+    {
+        file.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+        return !file.fail();
+    }
+
+    void encodeRecord(string &out, const Task &task)
+    {
+        TaskCodec::encode(out, task);
+    }
+
+    bool decodeRecord(const char *&p, const char *end, Task &task)
+    {
+        return TaskCodec::decode(p, end, task);
+    }
+
+    bool readAll(const string &path, string &data)
+    {
+        ifstream file(path, ios::binary | ios::ate);
+        if (!file.is_open())
+            return false;
+        streamoff size = file.tellg();
+        if (size < 0)
+            return false;
+        data.resize(static_cast<size_t>(size));
+        file.seekg(0);
+        file.read(&data[0], size);
+        data.resize(static_cast<size_t>(file.gcount()));
+        return true;
+    }
+
+    // 记录没有分隔标记，只能从头逐条跳过；跳过只读长度前缀，比解码快得多
+    vector<size_t> splitRecords(const string &data, size_t chunks)
+    {
+        chunks = max<size_t>(1, chunks);
+        const char *begin = data.data();
+        const char *end = begin + data.size();
+        const char *p = begin;
+
+        vector<size_t> bounds{0};
+        size_t target = data.size() / chunks;
+        while (TaskCodec::skip(p, end))
+        {
+            size_t offset = static_cast<size_t>(p - begin);
+            if (bounds.size() < chunks && offset >= target)
+            {
+                bounds.push_back(offset);
+                target = data.size() / chunks * bounds.size();
+            }
+        }
+        size_t last = static_cast<size_t>(p - begin);
+        if (bounds.back() != last)
+            bounds.push_back(last);
+        return bounds;
+    }
+
+    bool load(const string &path, vector<Task> &tasks)
+    {
+        tasks.clear();
+        return decodeFile(path, [&tasks](Task &t)
+                          { tasks.push_back(move(t)); });
+    }
+
+    bool append(const string &path, const Task &task)
+    {
+        ofstream file(path, ios::binary | ios::app);
+        if (!file.is_open())
+        {
+            LOG_ERROR("TaskFile", "错误: 无法打开任务文件进行追加: " << path);
+            return false;
+        }
+        string buffer;
+        TaskCodec::encode(buffer, task);
+        return flush(file, buffer);
+    }
+
+    bool rewrite(const string &path, const vector<Task> &tasks)
+    {
+        return rewrite(path, tasks.size(), [&tasks](size_t i, Task &t)
+                       { t = tasks[i]; });
+    }
+
+    bool forEach(const string &path, const function<void(const Task &)> &visit)
+    {
+        return decodeFile(path, [&visit](Task &t)
+                          { visit(t); });
+    }
+
+    bool rewrite(const string &path, size_t count, const function<void(size_t, Task &)> &fill)
+    {
+        ofstream file(path, ios::binary | ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_ERROR("TaskFile", "错误: 无法打开任务文件进行重写: " << path);
+            return false;
+        }
+        string buffer;
+        buffer.reserve(kChunkBytes + 256);
+        Task t;
+        for (size_t i = 0; i < count; ++i)
+        {
+            fill(i, t);
+            TaskCodec::encode(buffer, t);
+            if (buffer.size() >= kChunkBytes && !flush(file, buffer))
+                break;
+        }
+        if (!flush(file, buffer))
+        {
+            LOG_ERROR("TaskFile", "错误: 写入任务文件失败: " << path);
+            return false;
+        }
+        return true;
+    }
+}
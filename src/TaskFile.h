@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Task.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 任务文件的二进制格式（<用户名>_tasks.dat）
+// 每条记录依次为 id、startTime、duration、priority、category、reminderTime、reminded 的原始字节，
+// 之后是 name、customCategory、reminderOption 三个带 size_t 长度前缀的字符串。
+// 字段列表只在 TaskCodec.h 中定义一次，编解码代码由它在编译期生成
+namespace TaskFile
+{
+    // 读取整个文件；文件不存在或无法打开时返回 false，末尾不完整的记录被忽略
+    bool load(const string &path, vector<Task> &tasks);
+    // 在文件末尾追加一条记录
+    bool append(const string &path, const Task &task);
+    // 用给定的任务列表重写整个文件
+    bool rewrite(const string &path, const vector<Task> &tasks);
+
+    // 逐条读取/写入：记录都经由同一个 Task 对象传递，字符串缓冲区在记录之间复用，
+    // 不需要先在内存中构造整个 vector<Task>（TaskManager 直接与内部存储交换）
+    bool forEach(const string &path, const function<void(const Task &)> &visit);
+    bool rewrite(const string &path, size_t count, const function<void(size_t, Task &)> &fill);
+
+    // 并行载入：readAll 一次读入整个文件；splitRecords 按字节数把其中完整的记录大致均分为 chunks 段，
+    // 返回各段的起始偏移，最后一个元素是最后一条完整记录的结尾。各段可以在不同线程上用 decodeRecord 独立解码
+    bool readAll(const string &path, string &data);
+    vector<size_t> splitRecords(const string &data, size_t chunks);
+
+    // 单条记录与内存缓冲区之间的编解码
+    void encodeRecord(string &out, const Task &task);
+    // 从 [p, end) 解码一条记录并前移 p；不足一条完整记录时返回 false，p 不变
+    bool decodeRecord(const char *&p, const char *end, Task &task);
+}
\ No newline at end of file
@@ -1,129 +1,106 @@
 #include "TaskManager.h"
-#include <iostream>
 #include <algorithm>
 #include <fstream>
 #include <mutex>
 #include <atomic>
 #include <chrono>
-#include <thread>
-#include <condition_variable>
 #include <vector>
 #include <ctime>
-#include <sstream> // 新增：用于命令拼接和输出
-#include <SFML/Audio.hpp>
-#include <unistd.h> // 用于getcwd（Linux/macOS
-#include <cstdlib>  // 用于system函数
-
-#ifdef EMBEDDED_RESOURCES_ENABLED
-#include "embedded_resources.h"
-#endif
+#include <filesystem>
+#include <thread>
+#include "TaskFile.h"
+#include "AllocCounter.h"
+#include "Logger.h"
+#include "Metrics.h"
+#include "Trace.h"
 
 using namespace std;
-// 获取当前工作目录（跨平台）
-string getCurrentWorkingDir()
+
+namespace
 {
-    char buffer[1024];
-#ifdef _WIN32
-    if (_getcwd(buffer, sizeof(buffer)) != nullptr)
+    // 任务管理相关的指标，首次使用时注册
+    struct TaskMetrics
     {
-        return string(buffer);
-    }
-#else
-    if (getcwd(buffer, sizeof(buffer)) != nullptr)
+        Metrics::Histogram &load_time = Metrics::histogram("scheduler_task_load_seconds", "读取并排序任务文件的耗时");
+        Metrics::Histogram &rewrite_time = Metrics::histogram("scheduler_task_file_rewrite_seconds", "重写整个任务文件的耗时");
+        Metrics::Histogram &append_time = Metrics::histogram("scheduler_task_file_append_seconds", "向任务文件追加一条记录的耗时");
+        Metrics::Histogram &scan_time = Metrics::histogram("scheduler_reminder_scan_seconds", "一次提醒扫描的耗时");
+        Metrics::Counter &adds = Metrics::counter("scheduler_task_operations_total", "任务增删改的次数", "op=\"add\"");
+        Metrics::Counter &updates = Metrics::counter("scheduler_task_operations_total", "任务增删改的次数", "op=\"update\"");
+        Metrics::Counter &deletes = Metrics::counter("scheduler_task_operations_total", "任务增删改的次数", "op=\"delete\"");
+        Metrics::Counter &add_failures = Metrics::counter("scheduler_task_operation_failures_total", "失败的任务增删改次数", "op=\"add\"");
+        Metrics::Counter &update_failures = Metrics::counter("scheduler_task_operation_failures_total", "失败的任务增删改次数", "op=\"update\"");
+        Metrics::Counter &delete_failures = Metrics::counter("scheduler_task_operation_failures_total", "失败的任务增删改次数", "op=\"delete\"");
+        Metrics::Counter &digests = Metrics::counter("scheduler_reminder_digests_total", "投递的提醒摘要条数");
+        Metrics::Gauge &task_count = Metrics::gauge("scheduler_tasks", "当前用户的任务数");
+        Metrics::Gauge &store_bytes = Metrics::gauge("scheduler_task_store_bytes", "任务记录及其字符串占用的内存");
+    };
+
+    TaskMetrics &metrics()
     {
-        return string(buffer);
+        static TaskMetrics instance;
+        return instance;
     }
-#endif
-    return "未知目录";
-}
 
-// 在新线程中播放MP3（使用mpg123命令行工具）
-void playMp3InThread(const string &mp3Path)
-{
-    try
-    {
-        // 检查文件是否存在
-        ifstream fileCheck(mp3Path);
-        if (!fileCheck.good())
-        {
-            cerr << "音频文件不存在: " << mp3Path << endl;
-            cerr << "当前工作目录: " << getCurrentWorkingDir() << endl;
-            return;
-        }
+    // 超过这个大小（约 10 万个任务）的任务文件并行解码
+    const size_t kParallelLoadBytes = 8 << 20;
 
-        // 跨平台播放命令（使用mpg123）
-        string cmd;
-#ifdef _WIN32
-        // Windows: 假设mpg123已添加到环境变量，或使用绝对路径
-        cmd = "mpg123 \"" + mp3Path + "\" 2>&1";
-#else
-        // Linux/macOS: 直接使用系统安装的mpg123
-        cmd = "mpg123 \"" + mp3Path + "\" 2>&1";
-#endif
-
-        // 执行命令并输出结果（方便调试）
-        cout << "执行播放命令: " << cmd << endl;
-        int exitCode = system(cmd.c_str());
-        if (exitCode != 0)
-        {
-            cerr << "音频播放失败，退出码: " << exitCode << endl;
-        }
-        else
-        {
-            cout << "音频播放完成" << endl;
-        }
-    }
-    catch (const exception &e)
+    // 解码 data 中 [begin, end) 的记录并追加到 store
+    void decodeRecords(const string &data, size_t begin, size_t end, TaskStore &store)
     {
-        cerr << "播放线程错误: " << e.what() << endl;
+        store.reserve((end - begin) / 64);
+        const char *p = data.data() + begin;
+        const char *last = data.data() + end;
+        Task task;
+        while (TaskFile::decodeRecord(p, last, task))
+            store.push_back(task);
     }
 }
 
-// 启动音频播放线程（外部调用入口）
+// 播放提醒音效（外部调用入口），在后台线程池上执行，不阻塞调用线程
 void TaskManager::playNotificationSound()
 {
-#ifdef EMBEDDED_RESOURCES_ENABLED
-    // 使用嵌入的音频资源
-    thread mp3Thread([]()
-                     {
-        try {
-            // 创建临时文件路径
-            string tempPath = "/tmp/notification_temp.mp3";
-            
-            // 将嵌入的音频数据写入临时文件
-            if (EmbeddedResources::writeAudioToTempFile(tempPath)) {
-                playMp3InThread(tempPath);
-                
-                // 播放完成后删除临时文件
-                std::remove(tempPath.c_str());
-            } else {
-                cerr << "无法创建临时音频文件" << endl;
-            }
-        } catch (const exception &e) {
-            cerr << "嵌入音频播放错误: " << e.what() << endl;
-        } });
-    mp3Thread.detach();
-#else
-    // 使用外部音频文件
-    const string mp3Path = "notification.mp3";
-
-    // 启动新线程播放，避免阻塞
-    thread mp3Thread(playMp3InThread, mp3Path);
-    mp3Thread.detach(); // 线程后台运行，无需等待
-#endif
+    if (notification_sound)
+        executor().submit(BackgroundExecutor::Priority::NORMAL, notification_sound);
 }
 
 // TaskManager 构造函数
-TaskManager::TaskManager() : next_id(1), m_running(false)
+TaskManager::TaskManager() : next_id(1)
+{
+    // 互斥锁等成员会自动默认构造
+}
+
+TaskManager::~TaskManager()
 {
-    // 互斥锁、条件变量和线程对象会自动默认构造
-    // 原子布尔值 m_running 初始化为 false
+    stopReminders();
+}
+
+// 获取任务锁；发生竞争时把等待时间记为跟踪区间
+unique_lock<mutex> TaskManager::lockTasks() const
+{
+    unique_lock<mutex> lock(tasks_mutex, try_to_lock);
+    if (!lock.owns_lock())
+    {
+        Trace::Span wait("tasks_mutex 等待", "lock");
+        lock.lock();
+    }
+    return lock;
+}
+
+BackgroundExecutor &TaskManager::executor()
+{
+    if (m_executor)
+        return *m_executor;
+    if (!m_own_executor)
+        m_own_executor = make_unique<BackgroundExecutor>();
+    return *m_own_executor;
 }
 
 // 设置当前用户，加载其任务列表
 void TaskManager::setCurrentUser(const string &username)
 {
-    lock_guard<mutex> lock(tasks_mutex);
+    Trace::Span span("TaskManager::setCurrentUser", "task");
+    auto lock = lockTasks();
 
     current_user = username;
     tasks_file = username + "_tasks.dat";
@@ -136,15 +113,16 @@ void TaskManager::setCurrentUser(const string &username)
     // 修复程序关闭期间错过提醒的BUG
     // 2. 清理过期的、未提醒的任务
     time_t now = time(nullptr);
-    bool changes_made = false;
-    for (auto &task : tasks)
+    bool changes_made = tasks.droppedDuplicates() > 0; // 丢弃了重复 ID 的记录时同样重写文件
+    for (TaskRecord &task : tasks)
     {
+        time_t reminder_time = tasks.reminderTime(task);
         // 条件：需要提醒 + 提醒时间已过去 + 未提醒
-        if (task.reminderTime > 0 && task.reminderTime <= now && !task.reminded)
+        if (reminder_time > 0 && reminder_time <= now && !task.reminded())
         {
-            task.reminded = true; // 将其标记为已提醒
+            task.setReminded(true); // 将其标记为已提醒
             changes_made = true;  // 标记有变动，需要存盘
-            cout << "过期提醒: 任务 '" << task.name << "' (ID: " << task.id << ") 未能成功提醒，被强制标记为已提醒。" << endl;
+            LOG_INFO("TaskManager", "过期提醒: 任务 '" << tasks.name(task) << "' (ID: " << task.id << ") 未能成功提醒，被强制标记为已提醒。");
         }
     }
 
@@ -154,355 +132,340 @@ void TaskManager::setCurrentUser(const string &username)
         rewriteTasksFile();
     }
 
-    cout << "任务管理器已为用户 " << username << " 设置。任务将从 " << tasks_file << " 加载。" << endl;
+    LOG_INFO("TaskManager", "任务管理器已为用户 " << username << " 设置。任务将从 " << tasks_file << " 加载。");
 }
 
 // 添加一个新任务
 bool TaskManager::addTask(const Task &task)
 {
-    lock_guard<mutex> lock(tasks_mutex);
+    Trace::Span span("TaskManager::addTask", "task");
+    auto lock = lockTasks();
 
-    // 只检查完全相同的任务（同名且同开始时间）
-    for (const auto &existing_task : tasks)
+    // 只检查完全相同的任务（同名且同开始时间），记录按开始时间有序，只需查看开始时间在同一分钟的一段
+    const int32_t start_minutes = TaskRecord::toMinutes(task.startTime);
+    for (auto it = tasks.lowerBound(task.startTime); it != tasks.end() && it->start_minutes == start_minutes; ++it)
     {
-        if (existing_task.name == task.name && existing_task.startTime == task.startTime)
+        const TaskRecord &existing_task = *it;
+        if (tasks.startTime(existing_task) == task.startTime && tasks.name(existing_task) == task.name)
         {
-            cerr << "错误: 一个同名且同开始时间的任务已存在。" << endl;
+            LOG_WARN("TaskManager", "错误: 一个同名且同开始时间的任务已存在。");
+            metrics().add_failures.inc();
             return false;
         }
     }
 
     Task newTask = task;
     newTask.id = next_id++;
-    tasks.push_back(newTask);
+    tasks.insert(newTask);
     saveTask(newTask);
-    sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b)
-         { return a.startTime < b.startTime; });
+    metrics().adds.inc();
+    metrics().task_count.set(static_cast<int64_t>(tasks.size()));
+    metrics().store_bytes.set(static_cast<int64_t>(tasks.memoryBytes()));
 
-    cout << "正在添加任务: " << newTask.name << ", ID为: " << newTask.id << endl;
+    LOG_INFO("TaskManager", "正在添加任务: " << newTask.name << ", ID为: " << newTask.id);
     return true;
 }
 
 // 根据ID删除一个任务
 bool TaskManager::deleteTask(long long taskId)
 {
-    lock_guard<mutex> lock(tasks_mutex);
+    Trace::Span span("TaskManager::deleteTask", "task");
+    auto lock = lockTasks();
 
-    auto it = find_if(tasks.begin(), tasks.end(), [taskId](const Task &task)
-                      { return task.id == taskId; });
-
-    if (it != tasks.end())
+    if (tasks.erase(taskId))
     {
-        tasks.erase(it);
         rewriteTasksFile();
-        cout << "成功删除ID为 " << taskId << " 的任务。" << endl;
+        metrics().deletes.inc();
+        metrics().task_count.set(static_cast<int64_t>(tasks.size()));
+        metrics().store_bytes.set(static_cast<int64_t>(tasks.memoryBytes()));
+        LOG_INFO("TaskManager", "成功删除ID为 " << taskId << " 的任务。");
         return true;
     }
 
-    cerr << "错误: 未找到ID为 " << taskId << " 的任务。" << endl;
+    LOG_ERROR("TaskManager", "错误: 未找到ID为 " << taskId << " 的任务。");
+    metrics().delete_failures.inc();
     return false;
 }
 
 // 根据ID修改任务
 bool TaskManager::updateTask(const Task &task)
 {
-    lock_guard<mutex> lock(tasks_mutex);
-
-    auto it = find_if(tasks.begin(), tasks.end(), [task](const Task &t)
-                      { return t.id == task.id; });
+    Trace::Span span("TaskManager::updateTask", "task");
+    auto lock = lockTasks();
 
-    if (it != tasks.end())
+    if (tasks.assign(task)) // 用新任务替换旧任务，并移到按开始时间排序的新位置
     {
-        *it = task; // 用新任务替换旧任务
-        // 重新排序任务列表
-        sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b)
-             { return a.startTime < b.startTime; });
         rewriteTasksFile(); // 重写整个文件
-        cout << "成功修改ID为 " << task.id << " 的任务。" << endl;
+        metrics().updates.inc();
+        metrics().store_bytes.set(static_cast<int64_t>(tasks.memoryBytes()));
+        LOG_INFO("TaskManager", "成功修改ID为 " << task.id << " 的任务。");
         return true;
     }
 
-    cerr << "错误: 未找到ID为 " << task.id << " 的任务。" << endl;
+    LOG_ERROR("TaskManager", "错误: 未找到ID为 " << task.id << " 的任务。");
+    metrics().update_failures.inc();
     return false;
 }
 
-// 根据ID获取任务指针
-Task *TaskManager::getTaskById(long long taskId)
+// 根据ID获取任务的副本
+optional<Task> TaskManager::getTaskById(long long taskId) const
 {
-    lock_guard<mutex> lock(tasks_mutex);
-
-    auto it = find_if(tasks.begin(), tasks.end(), [taskId](const Task &task)
-                      { return task.id == taskId; });
+    auto lock = lockTasks();
 
-    if (it != tasks.end())
+    if (const TaskRecord *record = tasks.find(taskId))
     {
-        return &(*it);
+        return tasks.get(*record);
     }
 
-    return nullptr;
+    return nullopt;
 }
 
 // 获取所有任务的副本
 vector<Task> TaskManager::getAllTasks() const
 {
-    lock_guard<mutex> lock(tasks_mutex);
-    return tasks;
+    Trace::Span span("TaskManager::getAllTasks", "task");
+    AllocCounter::Scope alloc_scope("getAllTasks");
+    auto lock = lockTasks();
+    return tasks.toTasks();
+}
+
+time_t TaskManager::nextStatusTransition(time_t now, time_t limit) const
+{
+    auto lock = lockTasks();
+    return tasks.nextStatusTransition(now, limit);
+}
+
+vector<long long> TaskManager::getStatusChangedIds(time_t last, time_t now) const
+{
+    auto lock = lockTasks();
+    vector<long long> ids;
+    tasks.collectStatusChanges(last, now, ids);
+    return ids;
 }
 
 void TaskManager::loadTasks()
 {
-    ifstream file(tasks_file, ios::binary);
-    if (!file.is_open())
+    Trace::Span span("TaskManager::loadTasks", "task");
+    AllocCounter::Scope alloc_scope("loadTasks", AllocCounter::Scope::Heap::SAMPLE);
+    Metrics::ScopedTimer timer(metrics().load_time);
+    tasks.clear();
+
+    // 多核机器上的大文件按记录边界切成若干段，在线程池上分别解码、排序，再归并；
+    // 其余情况逐块读取、在当前线程解码（单核时切分和归并只会增加开销）
+    error_code ec;
+    uintmax_t file_size = filesystem::file_size(tasks_file, ec);
+    bool loaded;
+    if (!ec && file_size >= kParallelLoadBytes && thread::hardware_concurrency() > 1)
     {
-        cout << "用户 " << current_user << " 没有已存在的任务文件。将创建一个新的。" << endl;
+        loaded = loadTasksParallel();
+    }
+    else
+    {
+        loaded = TaskFile::forEach(tasks_file, [this](const Task &task)
+                                   { tasks.push_back(task); });
+        tasks.sortByStartTime();
+    }
+    if (!loaded)
+    {
+        LOG_INFO("TaskManager", "用户 " << current_user << " 没有已存在的任务文件。将创建一个新的。");
+        metrics().task_count.set(0);
         return;
     }
 
-    tasks.clear();
-    long long max_id = 0;
+    if (size_t duplicates = tasks.droppedDuplicates())
+        LOG_WARN("TaskManager", "任务文件中有 " << duplicates << " 条记录的 ID 与之前的记录重复，已丢弃（每个 ID 保留最先出现的一条）。");
 
-    while (file.peek() != EOF && !file.fail())
+    long long max_id = 0;
+    for (const TaskRecord &task : tasks)
     {
-        Task t;
-        file.read(reinterpret_cast<char *>(&t.id), sizeof(t.id));
-        file.read(reinterpret_cast<char *>(&t.startTime), sizeof(t.startTime));
-        file.read(reinterpret_cast<char *>(&t.duration), sizeof(t.duration));
-        file.read(reinterpret_cast<char *>(&t.priority), sizeof(t.priority));
-        file.read(reinterpret_cast<char *>(&t.category), sizeof(t.category));
-        file.read(reinterpret_cast<char *>(&t.reminderTime), sizeof(t.reminderTime));
-        file.read(reinterpret_cast<char *>(&t.reminded), sizeof(t.reminded));
-
-        if (file.fail())
-            break;
-
-        size_t name_len;
-        file.read(reinterpret_cast<char *>(&name_len), sizeof(name_len));
-        if (name_len > 0)
+        if (task.id > max_id)
         {
-            vector<char> name_buf(name_len);
-            file.read(name_buf.data(), name_len);
-            t.name.assign(name_buf.data(), name_len);
-        }
-        if (file.fail())
-            break;
-
-        size_t custom_cat_len;
-        file.read(reinterpret_cast<char *>(&custom_cat_len), sizeof(custom_cat_len));
-        if (custom_cat_len > 0)
-        {
-            vector<char> custom_cat_buf(custom_cat_len);
-            file.read(custom_cat_buf.data(), custom_cat_len);
-            t.customCategory.assign(custom_cat_buf.data(), custom_cat_len);
-        }
-        if (file.fail())
-            break;
-
-        size_t reminder_opt_len;
-        file.read(reinterpret_cast<char *>(&reminder_opt_len), sizeof(reminder_opt_len));
-        if (reminder_opt_len > 0)
-        {
-            vector<char> reminder_opt_buf(reminder_opt_len);
-            file.read(reminder_opt_buf.data(), reminder_opt_len);
-            t.reminderOption.assign(reminder_opt_buf.data(), reminder_opt_len);
-        }
-        if (file.fail())
-            break;
-
-        tasks.push_back(t);
-        if (t.id > max_id)
-        {
-            max_id = t.id;
+            max_id = task.id;
         }
     }
-    file.close();
-
     next_id = max_id + 1;
 
-    sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b)
-         { return a.startTime < b.startTime; });
+    metrics().task_count.set(static_cast<int64_t>(tasks.size()));
+    metrics().store_bytes.set(static_cast<int64_t>(tasks.memoryBytes()));
 
-    cout << "已加载 " << tasks.size() << " 个任务。下一个ID是 " << next_id << endl;
+    LOG_INFO("TaskManager", "已加载 " << tasks.size() << " 个任务。下一个ID是 " << next_id);
 }
 
-void TaskManager::saveTask(const Task &task)
+// 整个文件读入内存后分段并行解码，再由 mergeSorted 并行排序、归并到 tasks
+bool TaskManager::loadTasksParallel()
 {
-    ofstream file(tasks_file, ios::binary | ios::app);
-    if (!file.is_open())
-    {
-        cerr << "错误: 无法打开任务文件进行追加: " << tasks_file << endl;
-        return;
-    }
-
-    file.write(reinterpret_cast<const char *>(&task.id), sizeof(task.id));
-    file.write(reinterpret_cast<const char *>(&task.startTime), sizeof(task.startTime));
-    file.write(reinterpret_cast<const char *>(&task.duration), sizeof(task.duration));
-    file.write(reinterpret_cast<const char *>(&task.priority), sizeof(task.priority));
-    file.write(reinterpret_cast<const char *>(&task.category), sizeof(task.category));
-    file.write(reinterpret_cast<const char *>(&task.reminderTime), sizeof(task.reminderTime));
-    file.write(reinterpret_cast<const char *>(&task.reminded), sizeof(task.reminded));
-
-    size_t name_len = task.name.length();
-    file.write(reinterpret_cast<const char *>(&name_len), sizeof(name_len));
-    if (name_len > 0)
-    {
-        file.write(task.name.c_str(), name_len);
-    }
-
-    size_t custom_cat_len = task.customCategory.length();
-    file.write(reinterpret_cast<const char *>(&custom_cat_len), sizeof(custom_cat_len));
-    if (custom_cat_len > 0)
-    {
-        file.write(task.customCategory.c_str(), custom_cat_len);
-    }
-
-    size_t reminder_opt_len = task.reminderOption.length();
-    file.write(reinterpret_cast<const char *>(&reminder_opt_len), sizeof(reminder_opt_len));
-    if (reminder_opt_len > 0)
-    {
-        file.write(task.reminderOption.c_str(), reminder_opt_len);
-    }
+    string data;
+    if (!TaskFile::readAll(tasks_file, data))
+        return false;
+
+    vector<size_t> bounds = TaskFile::splitRecords(data, executor().worker_count() * 2 + 2);
+    vector<TaskStore> parts(bounds.size() - 1);
+    executor().parallel_for(parts.size(), [&](size_t i)
+                            { decodeRecords(data, bounds[i], bounds[i + 1], parts[i]); });
+    tasks.mergeSorted(parts, executor());
+    LOG_DEBUG("TaskManager", "任务文件分 " << parts.size() << " 段并行解码");
+    return true;
+}
 
-    file.close();
+void TaskManager::saveTask(const Task &task)
+{
+    Trace::Span span("TaskManager::saveTask", "task");
+    Metrics::ScopedTimer timer(metrics().append_time);
+    TaskFile::append(tasks_file, task);
 }
 
 void TaskManager::rewriteTasksFile()
 {
-    ofstream file(tasks_file, ios::binary | ios::trunc);
-    if (!file.is_open())
+    Trace::Span span("TaskManager::rewriteTasksFile", "task");
+    AllocCounter::Scope alloc_scope("rewriteTasksFile", AllocCounter::Scope::Heap::SAMPLE);
+    Metrics::ScopedTimer timer(metrics().rewrite_time);
+    // 按顺序写出，回调的序号与遍历位置一致
+    auto it = tasks.begin();
+    TaskFile::rewrite(tasks_file, tasks.size(), [this, &it](size_t, Task &task)
+                      { tasks.fill(*it++, task); });
+}
+
+// 启动提醒扫描
+void TaskManager::startReminders()
+{
+    lock_guard<mutex> scan_lock(m_scan_state->scan_mutex);
+    if (m_scan_state->running)
     {
-        cerr << "错误: 无法打开任务文件进行重写: " << tasks_file << endl;
+        LOG_INFO("TaskManager", "提醒扫描已在运行。");
         return;
     }
+    m_scan_state->running = true;
+    scheduleReminderScan(++m_scan_state->generation);
+    LOG_INFO("TaskManager", "提醒扫描已启动。");
+}
 
-    for (const auto &task : tasks)
+// 停止提醒扫描：取消尚未到期的扫描，并等待正在执行的扫描结束
+void TaskManager::stopReminders()
+{
+    lock_guard<mutex> scan_lock(m_scan_state->scan_mutex);
+    if (m_scan_state->running)
     {
-        file.write(reinterpret_cast<const char *>(&task.id), sizeof(task.id));
-        file.write(reinterpret_cast<const char *>(&task.startTime), sizeof(task.startTime));
-        file.write(reinterpret_cast<const char *>(&task.duration), sizeof(task.duration));
-        file.write(reinterpret_cast<const char *>(&task.priority), sizeof(task.priority));
-        file.write(reinterpret_cast<const char *>(&task.category), sizeof(task.category));
-        file.write(reinterpret_cast<const char *>(&task.reminderTime), sizeof(task.reminderTime));
-        file.write(reinterpret_cast<const char *>(&task.reminded), sizeof(task.reminded));
-
-        size_t name_len = task.name.length();
-        file.write(reinterpret_cast<const char *>(&name_len), sizeof(name_len));
-        if (name_len > 0)
-        {
-            file.write(task.name.c_str(), name_len);
-        }
-
-        size_t custom_cat_len = task.customCategory.length();
-        file.write(reinterpret_cast<const char *>(&custom_cat_len), sizeof(custom_cat_len));
-        if (custom_cat_len > 0)
-        {
-            file.write(task.customCategory.c_str(), custom_cat_len);
-        }
-
-        size_t reminder_opt_len = task.reminderOption.length();
-        file.write(reinterpret_cast<const char *>(&reminder_opt_len), sizeof(reminder_opt_len));
-        if (reminder_opt_len > 0)
+        m_scan_state->running = false;
+        if (m_scan_timer)
         {
-            file.write(task.reminderOption.c_str(), reminder_opt_len);
+            executor().cancel(m_scan_timer);
+            m_scan_timer = 0;
         }
+        LOG_INFO("TaskManager", "提醒扫描已停止。");
     }
-    file.close();
+
+    // 已标记为已提醒但还在限流中的任务（两种投递模式都可能有），停止前补发，避免提醒丢失
+    if (m_reminder_engine.hasPending())
+        fireReminderDigest(m_reminder_engine.takeAll(), true);
 }
 
-// 启动提醒线程
-void TaskManager::startReminderThread()
+void TaskManager::scheduleReminderScan(uint64_t generation)
 {
-    if (m_running)
-    {
-        cout << "提醒线程已在运行。" << endl;
-        return;
-    }
-    m_running = true;
-    reminder_thread = thread(&TaskManager::reminderCheckLoop, this);
-    cout << "提醒线程已启动。" << endl;
+    // 后台轮询间隔：5s
+    shared_ptr<ScanState> state = m_scan_state;
+    m_scan_timer = executor().schedule_after(chrono::seconds(5), BackgroundExecutor::Priority::NORMAL,
+                                             [this, state, generation]()
+                                             {
+                                                 lock_guard<mutex> scan_lock(state->scan_mutex);
+                                                 if (!state->running || generation != state->generation)
+                                                     return;
+                                                 vector<Task> digest = takeReminderDigest(time(nullptr));
+                                                 if (!digest.empty())
+                                                     fireReminderDigest(digest, true);
+                                                 scheduleReminderScan(generation); });
 }
 
-// 停止提醒线程
-void TaskManager::stopReminderThread()
+// 收集到期的提醒并按限流规则取出本次要投递的摘要
+vector<Task> TaskManager::takeReminderDigest(time_t now)
 {
-    if (!m_running)
+    Trace::Span span("TaskManager::takeReminderDigest", "task");
+    auto lock = lockTasks();
+    Metrics::ScopedTimer timer(metrics().scan_time);
+
+    size_t newly_due = 0;
+    // 守护进程在运行时由它投递，这里只把已经到期的标记为已提醒，合并窗口内尚未到期的保持原样留给守护进程。
+    // 守护进程对提醒时间晚于其上一次投递检查的已标记提醒照常投递（见 reminderd.cpp 的 is_pending），
+    // 它处理不及时的时候提醒也不会因为这里先标记而丢失。检查和投递之间守护进程恰好启动时，
+    // 这一轮的提醒仍可能投递两次
+    const bool daemon_running = m_defer_to_daemon && ReminderEngine::isDaemonRunning(current_user);
+    // 即将到期（合并窗口内）的提醒提前并入本次摘要，避免紧接着再弹一次
+    time_t horizon = daemon_running ? now : m_reminder_engine.horizon(now);
+
+    vector<TaskRecord *> due;
+    tasks.collectDueReminders(horizon, due);
+    for (TaskRecord *record : due)
     {
-        return;
+        record->setReminded(true);
+        ++newly_due;
+        if (!daemon_running)
+            m_reminder_engine.add(tasks.get(*record));
     }
-    m_running = false;
-    m_cv.notify_one();
-    if (reminder_thread.joinable())
+
+    if (newly_due > 0)
     {
-        reminder_thread.join();
+        if (daemon_running)
+            LOG_INFO("TaskManager", "提醒守护进程正在运行，" << newly_due << " 个到期提醒由它投递，只持久化'已提醒'状态。");
+        else
+            LOG_INFO("TaskManager", "为 " << newly_due << " 个任务持久化'已提醒'状态。");
+        rewriteTasksFile();
     }
-    cout << "提醒线程已停止。" << endl;
+
+    lock.unlock();
+
+    // 限流：距离上一条摘要不足最小间隔时，继续累积到下一轮
+    return m_reminder_engine.take(now);
 }
 
-// 提醒检查循环（后台线程执行函数）
-void TaskManager::reminderCheckLoop()
+time_t TaskManager::nextReminderTime()
 {
-    cout << "进入提醒检查循环。" << endl;
+    lock_guard<mutex> scan_lock(m_scan_state->scan_mutex);
+    auto lock = lockTasks();
+    time_t next = tasks.nextReminderTime();
+    // 有被限流的提醒时，下一次投递就是限流结束的时刻
+    return m_reminder_engine.nextDelivery(next);
+}
 
-    while (m_running)
+void TaskManager::deliverDueReminders()
+{
+    vector<Task> digest;
     {
-        unique_lock<mutex> lock(tasks_mutex);
-
-        // 后台轮询间隔：5s
-        if (m_cv.wait_for(lock, chrono::seconds(5), [this]
-                          { return !m_running.load(); }))
-        {
-            break;
-        }
-
-        if (!m_running)
-            break;
-
-        vector<Task> reminders_to_fire;
-        bool changes_made = false;
-        time_t now = time(nullptr);
+        lock_guard<mutex> scan_lock(m_scan_state->scan_mutex);
+        digest = takeReminderDigest(time(nullptr));
+    }
+    // 回调在当前线程同步执行，必须先释放扫描锁：界面的回调会重新布置提醒定时器，
+    // 其中调用的 nextReminderTime 同样要取扫描锁
+    if (!digest.empty())
+        fireReminderDigest(digest, false);
+}
 
-        for (auto &task : tasks)
-        {
-            if (task.reminderTime > 0 && task.reminderTime <= now && !task.reminded)
-            {
-                task.reminded = true;
-                changes_made = true;
-                reminders_to_fire.push_back(task);
-            }
-        }
+void TaskManager::setReminderCoalescing(int window_seconds, int min_interval_seconds)
+{
+    m_reminder_engine.setCoalescing(window_seconds, min_interval_seconds);
+}
 
-        if (changes_made)
-        {
-            cout << "为 " << reminders_to_fire.size() << " 个任务持久化'已提醒'状态。" << endl;
-            rewriteTasksFile();
-        }
+// 把一批到期的提醒合并为一次回调和一次提示音
+void TaskManager::fireReminderDigest(const vector<Task> &reminders, bool via_dispatcher)
+{
+    if (!reminder_callback || reminders.empty())
+        return;
 
-        lock.unlock();
+    metrics().digests.inc();
+    ReminderEngine::Digest digest = ReminderEngine::format(reminders);
+    dispatchReminder(digest.title, digest.message, via_dispatcher);
+    playNotificationSound();
+}
 
-        for (const auto &task_to_remind : reminders_to_fire)
-        {
-            if (reminder_callback)
-            {
-                string startTimeStr = ctime(&task_to_remind.startTime);
-                if (!startTimeStr.empty() && startTimeStr.back() == '\n')
-                {
-                    startTimeStr.pop_back();
-                }
-
-                string reminderTimeStr = ctime(&task_to_remind.reminderTime);
-                if (!reminderTimeStr.empty() && reminderTimeStr.back() == '\n')
-                {
-                    reminderTimeStr.pop_back();
-                }
-
-                string msg = task_to_remind.name + " 任务提醒！\n开始时间: " + startTimeStr +
-                             "\n提醒时间: " + reminderTimeStr;
-
-                reminder_callback("提醒", msg);
-                // 创建一个新的线程来播放音频
-
-                playNotificationSound();
-            }
-        }
+// 提醒回调交给界面线程执行；主循环投递或没有注册转发函数时直接在当前线程调用
+void TaskManager::dispatchReminder(const string &title, const string &msg, bool via_dispatcher)
+{
+    if (via_dispatcher && ui_dispatcher)
+    {
+        ReminderCallback callback = reminder_callback;
+        ui_dispatcher([callback, title, msg]()
+                      { callback(title, msg); });
+    }
+    else
+    {
+        reminder_callback(title, msg);
     }
-    cout << "退出提醒检查循环。" << endl;
 }
\ No newline at end of file
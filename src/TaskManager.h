@@ -1,26 +1,43 @@
 #pragma once
 
 #include "Task.h"
+#include "TaskStore.h"
+#include "BackgroundExecutor.h"
+#include "ReminderEngine.h"
+#include <optional>
 #include <vector>
 #include <string>
-#include <thread>
 #include <mutex>
 #include <atomic>
-#include <condition_variable>
+#include <memory>
 #include <functional>
 
 class TaskManager
 {
 public:
     TaskManager();
+    ~TaskManager();
     void setCurrentUser(const string &username);
     bool addTask(const Task &task);
     bool deleteTask(long long taskId);
     bool updateTask(const Task &task);
-    Task *getTaskById(long long taskId);
+    optional<Task> getTaskById(long long taskId) const;
     vector<Task> getAllTasks() const;
-    void startReminderThread();
-    void stopReminderThread();
+    // 界面状态刷新使用，在锁内直接扫描记录，不复制任务：
+    // now 之后最近一次任务开始、结束或未提醒的提醒到达的时刻（没有更早的时刻时返回 limit），
+    // 以及在 (last, now] 内跨过这些时刻的任务 id
+    time_t nextStatusTransition(time_t now, time_t limit) const;
+    vector<long long> getStatusChangedIds(time_t last, time_t now) const;
+    // 启动/停止提醒扫描（在后台线程池上周期执行）
+    void startReminders();
+    void stopReminders();
+
+    // 指定应用共享的后台线程池（提醒扫描、提示音和大文件的并行载入）；未指定时第一次使用时按 CPU 核数创建一个
+    void setExecutor(BackgroundExecutor *executor) { m_executor = executor; }
+
+    // 把结果转交给界面线程执行的函数（由SchedulerApp注册，内部使用 Glib::Dispatcher）
+    using UiDispatcher = function<void(function<void()>)>;
+    void setUiDispatcher(UiDispatcher dispatcher) { ui_dispatcher = move(dispatcher); }
 
     // 定义提醒回调函数类型（参数：提醒标题、内容）
     using ReminderCallback = function<void(const string &, const string &)>;
@@ -31,29 +48,65 @@ public:
         reminder_callback = move(callback);
     }
 
+    // 提示音由调用方提供（界面和守护进程使用 AudioService），未设置时不播放
+    void setNotificationSound(function<void()> play) { notification_sound = move(play); }
     void playNotificationSound();
 
+    // 提醒合并设置：提醒时间落在 now + window_seconds 之内的任务合并为一条摘要提醒，
+    // 相邻两条摘要之间至少间隔 min_interval_seconds 秒，期间到期的提醒累积到下一条摘要
+    void setReminderCoalescing(int window_seconds, int min_interval_seconds);
+
+    // 让出给独立的提醒守护进程：每次投递前检查守护进程的锁（守护进程可能在登录之后才启动），
+    // 它在运行时本进程不投递，只把已经到期的提醒标记为已提醒
+    void setDeferToDaemon(bool defer) { m_defer_to_daemon = defer; }
+
+    // 主循环投递模式：不调用 startReminders，由调用方按 nextReminderTime 设置定时器，
+    // 到时在自己的线程中调用 deliverDueReminders，回调直接在该线程执行（不持有内部锁，回调中可以调用 nextReminderTime 等）
+    time_t nextReminderTime();  // 下一次需要投递的时刻，没有待投递的提醒时返回 0
+    void deliverDueReminders(); // 投递已到期的提醒（同样遵循合并和限流规则）
+
 private:
     string tasks_file;
-    vector<Task> tasks;
+    TaskStore tasks;
     long long next_id;
     string current_user;
 
     ReminderCallback reminder_callback; // 保存回调函数
+    UiDispatcher ui_dispatcher;         // 未设置时回调在后台线程直接执行
+    function<void()> notification_sound;
 
     // 文件操作
     void loadTasks();
+    bool loadTasksParallel();
     void saveTask(const Task &task);
     void rewriteTasksFile();
 
-    // 提醒线程相关
-    void reminderCheckLoop();
+    // 提醒扫描相关
+    BackgroundExecutor &executor();
+    vector<Task> takeReminderDigest(time_t now);    // 调用时需持有扫描锁，返回本次应投递的摘要
+    void scheduleReminderScan(uint64_t generation); // 调用时需持有扫描锁
+    void fireReminderDigest(const vector<Task> &reminders, bool via_dispatcher);
+    void dispatchReminder(const string &title, const string &msg, bool via_dispatcher);
+
+    // 提醒合并与限流（累积的提醒由扫描锁保护）
+    ReminderEngine m_reminder_engine;
+    atomic<bool> m_defer_to_daemon{false};
 
-    // 线程和互斥锁成员
-    thread reminder_thread;
+    // 线程池和互斥锁成员
+    BackgroundExecutor *m_executor = nullptr;
+    unique_ptr<BackgroundExecutor> m_own_executor;
     mutable mutex tasks_mutex; // 可变的互斥锁，以便在const成员函数中使用
-    atomic<bool> m_running;
+    unique_lock<mutex> lockTasks() const;
 
-    // 新增：条件变量，用于唤醒睡眠中的线程
-    condition_variable m_cv;
+    // 提醒扫描是一个到期后重新安排自己的延时任务。
+    // 扫描状态由任务和 TaskManager 共同持有：停止之后才出队的旧扫描在锁内发现
+    // running 为 false 或代数不符就直接返回，不会再访问已经析构的 TaskManager
+    struct ScanState
+    {
+        mutex scan_mutex; // 同一时刻只有一次扫描
+        bool running = false;
+        uint64_t generation = 0;
+    };
+    shared_ptr<ScanState> m_scan_state = make_shared<ScanState>();
+    BackgroundExecutor::TimerId m_scan_timer = 0;
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "StringPool.h"
+#include "Task.h"
+#include <cstdint>
+#include <ctime>
+
+using namespace std;
+
+// TaskStore 中一个任务的 32 字节紧凑记录（Task 本身约 150 字节，另加字符串的堆内存）：
+// 时间以分钟为单位、相对 kEpochBase 存为 32 位整数，优先级、分类和标志位合在一个字节里，字符串只保存句柄。
+// 界面和命令行产生的时间都是整分钟；不是整分钟的时间或超过 65535 种的分类/提醒选项
+// 由 TaskStore 按 id 另存原值（记录中的时间为向下取整的近似值，只用于排序和扫描），转换时不丢失信息
+struct TaskRecord
+{
+    static constexpr time_t kEpochBase = 946684800; // 2000-01-01 00:00:00 UTC
+
+    long long id;
+    int32_t start_minutes;    // 相对 kEpochBase 的分钟数
+    int32_t reminder_minutes; // 同上；reminderTime 为 0（不提醒）时同样按 0 换算，可以精确还原
+    int32_t duration;         // 分钟
+    StringPool::Handle name;
+    uint16_t custom_category; // intern 池中的句柄
+    uint16_t reminder_option;
+    uint8_t packed; // 低 2 位优先级，其上 2 位分类，再上 1 位已提醒，再上 1 位有溢出值
+
+    static constexpr int32_t kZeroMinutes = -static_cast<int32_t>(kEpochBase / 60); // reminderTime 为 0 时的分钟值
+    static constexpr uint8_t kRemindedBit = 1 << 4;
+    static constexpr uint8_t kOverflowBit = 1 << 5;
+
+    static int32_t toMinutes(time_t t);
+    static time_t fromMinutes(int32_t minutes) { return kEpochBase + static_cast<time_t>(minutes) * 60; }
+    static bool representable(time_t t);
+
+    time_t startTime() const { return fromMinutes(start_minutes); }
+    time_t reminderTime() const { return fromMinutes(reminder_minutes); }
+    time_t endTime() const { return fromMinutes(start_minutes) + static_cast<time_t>(duration) * 60; }
+    Priority priority() const { return static_cast<Priority>(packed & 0x3); }
+    Category category() const { return static_cast<Category>((packed >> 2) & 0x3); }
+    bool reminded() const { return packed & kRemindedBit; }
+    void setReminded(bool reminded) { packed = static_cast<uint8_t>(reminded ? (packed | kRemindedBit) : (packed & ~kRemindedBit)); }
+    bool hasOverflow() const { return packed & kOverflowBit; }
+};
+static_assert(sizeof(TaskRecord) == 32, "TaskRecord 应保持 32 字节");
\ No newline at end of file
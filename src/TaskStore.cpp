@@ -0,0 +1,400 @@
+#include "TaskStore.h"
+#include "BackgroundExecutor.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+int32_t TaskRecord::toMinutes(time_t t)
+{
+    // 向下取整，早于 kEpochBase 的时间也落在所在分钟的起点
+    time_t delta = t - kEpochBase;
+    time_t minutes = delta / 60 - (delta % 60 < 0 ? 1 : 0);
+    minutes = max<time_t>(numeric_limits<int32_t>::min(), min<time_t>(numeric_limits<int32_t>::max(), minutes));
+    return static_cast<int32_t>(minutes);
+}
+
+bool TaskRecord::representable(time_t t)
+{
+    return fromMinutes(toMinutes(t)) == t;
+}
+
+bool TaskStore::IdSet::insert(long long id)
+{
+    // 与 TaskTree 的 id 索引相同的规则：不超过现有位图两倍（再加少量余量）的 id 扩展位图
+    if (id >= 0 && static_cast<size_t>(id) < m_dense.size() * 2 + 1024)
+    {
+        if (static_cast<size_t>(id) >= m_dense.size())
+            m_dense.resize(max(static_cast<size_t>(id) + 1, m_dense.size() * 2));
+        if (m_dense[id])
+            return false;
+        m_dense[id] = true;
+        return true;
+    }
+    return m_sparse.insert(id).second;
+}
+
+void TaskStore::IdSet::clear()
+{
+    vector<bool>().swap(m_dense);
+    unordered_set<long long>().swap(m_sparse);
+}
+
+void TaskStore::clear()
+{
+    m_tree.clear();
+    m_pending.clear();
+    m_pending_ids.clear();
+    m_dropped_duplicates = 0;
+    m_strings.clear();
+    m_symbols.clear();
+    m_overflow.clear();
+    m_garbage_bytes = 0;
+}
+
+void TaskStore::reserve(size_t count)
+{
+    m_pending.reserve(count);
+    // 名称通常在 32 字节以内
+    m_strings.reserve(count, count * 32);
+}
+
+uint16_t TaskStore::internSymbol(const string &text, bool &overflow)
+{
+    StringPool::Handle handle = m_symbols.intern(text);
+    if (handle <= numeric_limits<uint16_t>::max())
+        return static_cast<uint16_t>(handle);
+    overflow = true;
+    return StringPool::kEmpty;
+}
+
+TaskRecord TaskStore::makeRecord(const Task &task)
+{
+    bool overflow = !TaskRecord::representable(task.startTime) || !TaskRecord::representable(task.reminderTime);
+
+    TaskRecord record;
+    record.id = task.id;
+    record.start_minutes = TaskRecord::toMinutes(task.startTime);
+    record.reminder_minutes = TaskRecord::toMinutes(task.reminderTime);
+    record.duration = task.duration;
+    record.name = m_strings.store(task.name);
+    record.custom_category = internSymbol(task.customCategory, overflow);
+    record.reminder_option = internSymbol(task.reminderOption, overflow);
+    record.packed = static_cast<uint8_t>((static_cast<unsigned>(task.priority) & 0x3) |
+                                         ((static_cast<unsigned>(task.category) & 0x3) << 2));
+    record.setReminded(task.reminded);
+
+    if (overflow)
+    {
+        record.packed |= TaskRecord::kOverflowBit;
+        m_overflow[task.id] = {task.startTime, task.reminderTime, task.customCategory, task.reminderOption};
+    }
+    return record;
+}
+
+bool TaskStore::push_back(const Task &task)
+{
+    // 在生成记录之前检查，被丢弃的记录不占用字符串池，也不会覆盖保留记录的溢出值
+    if (!m_pending_ids.insert(task.id) || m_tree.find(task.id))
+    {
+        ++m_dropped_duplicates;
+        return false;
+    }
+    m_pending.push_back(makeRecord(task));
+    return true;
+}
+
+void TaskStore::sortByStartTime()
+{
+    if (m_pending.empty())
+        return;
+    if (m_tree.empty())
+    {
+        sort(m_pending.begin(), m_pending.end(), TaskTree::keyLess);
+        m_tree.assignSorted(m_pending);
+    }
+    else
+    {
+        for (const auto &record : m_pending)
+            m_tree.insert(record);
+    }
+    vector<TaskRecord>().swap(m_pending);
+    m_pending_ids.clear();
+}
+
+bool TaskStore::insert(const Task &task)
+{
+    if (m_tree.find(task.id))
+        return false;
+    return m_tree.insert(makeRecord(task));
+}
+
+bool TaskStore::assign(const Task &task)
+{
+    TaskRecord *existing = m_tree.find(task.id);
+    if (!existing)
+        return false;
+    releaseStrings(*existing);
+    m_tree.replace(makeRecord(task));
+    compactIfNeeded();
+    return true;
+}
+
+bool TaskStore::erase(long long id)
+{
+    const TaskRecord *existing = m_tree.find(id);
+    if (!existing)
+        return false;
+    releaseStrings(*existing);
+    m_tree.erase(id);
+    compactIfNeeded();
+    return true;
+}
+
+void TaskStore::mergeSorted(vector<TaskStore> &parts, BackgroundExecutor &executor)
+{
+    clear();
+    executor.parallel_for(parts.size(), [&parts](size_t i)
+                          { sort(parts[i].m_pending.begin(), parts[i].m_pending.end(), TaskTree::keyLess); });
+
+    size_t total = 0;
+    size_t name_bytes = 0;
+    for (const auto &part : parts)
+    {
+        total += part.m_pending.size();
+        name_bytes += part.m_strings.dataBytes();
+    }
+    m_pending.reserve(total);
+    m_strings.reserve(total, name_bytes);
+
+    // 各部分依次接到暂存区末尾，记下每个有序段的起点。
+    // 各部分内部的重复 id 已在 push_back 时丢弃，这里丢弃与前面部分重复的（文件中靠后的）记录
+    vector<size_t> runs{0};
+    IdSet seen;
+    for (auto &part : parts)
+    {
+        m_dropped_duplicates += part.m_dropped_duplicates;
+        StringPool::Handle name_shift = m_strings.append(part.m_strings);
+        // 分类和提醒选项只有少数几种，逐个重新 intern 得到句柄映射
+        vector<StringPool::Handle> symbols(part.m_symbols.stringCount() + 1, StringPool::kEmpty);
+        for (StringPool::Handle h = 1; h < symbols.size(); ++h)
+            symbols[h] = m_symbols.intern(part.m_symbols.view(h));
+
+        for (TaskRecord record : part.m_pending)
+        {
+            if (!seen.insert(record.id))
+            {
+                ++m_dropped_duplicates;
+                m_garbage_bytes += part.m_strings.view(record.name).size();
+                if (record.hasOverflow())
+                    part.m_overflow.erase(record.id); // 溢出值属于被丢弃的记录，不能并入
+                continue;
+            }
+            if (record.name != StringPool::kEmpty)
+                record.name += name_shift;
+            if (record.hasOverflow())
+            {
+                // 字符串的原值已经在溢出表中
+                record.custom_category = record.reminder_option = StringPool::kEmpty;
+            }
+            else if (symbols[record.custom_category] > numeric_limits<uint16_t>::max() ||
+                     symbols[record.reminder_option] > numeric_limits<uint16_t>::max())
+            {
+                // 合并后句柄超出 16 位，改存到溢出表
+                m_overflow[record.id] = {record.startTime(), record.reminderTime(),
+                                         string(part.m_symbols.view(record.custom_category)),
+                                         string(part.m_symbols.view(record.reminder_option))};
+                record.custom_category = record.reminder_option = StringPool::kEmpty;
+                record.packed |= TaskRecord::kOverflowBit;
+            }
+            else
+            {
+                record.custom_category = static_cast<uint16_t>(symbols[record.custom_category]);
+                record.reminder_option = static_cast<uint16_t>(symbols[record.reminder_option]);
+            }
+            m_pending.push_back(record);
+        }
+        m_overflow.merge(part.m_overflow);
+        runs.push_back(m_pending.size());
+        part.clear();
+    }
+    parts.clear();
+
+    // 逐轮两两归并相邻的有序段；同一轮中各对互不重叠，可以并行
+    while (runs.size() > 2)
+    {
+        auto first = m_pending.begin();
+        executor.parallel_for((runs.size() - 1) / 2, [&](size_t i)
+                              { inplace_merge(first + runs[2 * i], first + runs[2 * i + 1], first + runs[2 * i + 2], TaskTree::keyLess); });
+        vector<size_t> merged;
+        for (size_t i = 0; i < runs.size(); i += 2)
+            merged.push_back(runs[i]);
+        if (merged.back() != runs.back())
+            merged.push_back(runs.back());
+        runs = move(merged);
+    }
+
+    m_tree.assignSorted(m_pending);
+    vector<TaskRecord>().swap(m_pending);
+}
+
+time_t TaskStore::nextReminderTime() const
+{
+    int32_t next_minutes = numeric_limits<int32_t>::max();
+    time_t next_overflow = 0;
+    m_tree.forEachLeaf([&](const TaskRecord *records, size_t count)
+                       {
+                           for (size_t i = 0; i < count; ++i)
+                           {
+                               const TaskRecord &record = records[i];
+                               // 已提醒和带溢出值的记录都不常见，合在一次判断里
+                               if (record.packed & (TaskRecord::kRemindedBit | TaskRecord::kOverflowBit))
+                               {
+                                   if (record.reminded())
+                                       continue;
+                                   time_t reminder_time = overflowOf(record).reminderTime;
+                                   if (reminder_time > 0 && (next_overflow == 0 || reminder_time < next_overflow))
+                                       next_overflow = reminder_time;
+                                   continue;
+                               }
+                               if (record.reminder_minutes > TaskRecord::kZeroMinutes && record.reminder_minutes < next_minutes)
+                                   next_minutes = record.reminder_minutes;
+                           } });
+
+    time_t next = next_minutes == numeric_limits<int32_t>::max() ? 0 : TaskRecord::fromMinutes(next_minutes);
+    if (next_overflow > 0 && (next == 0 || next_overflow < next))
+        next = next_overflow;
+    return next;
+}
+
+void TaskStore::collectDueReminders(time_t horizon, vector<TaskRecord *> &out)
+{
+    // 整分钟的提醒时间 t 满足 t <= horizon 当且仅当其分钟值不大于 horizon 向下取整的分钟值
+    const int32_t horizon_minutes = TaskRecord::toMinutes(horizon);
+    m_tree.forEachLeaf([&](TaskRecord *records, size_t count)
+                       {
+                           for (size_t i = 0; i < count; ++i)
+                           {
+                               TaskRecord &record = records[i];
+                               if (record.packed & (TaskRecord::kRemindedBit | TaskRecord::kOverflowBit))
+                               {
+                                   if (record.reminded())
+                                       continue;
+                                   time_t reminder_time = overflowOf(record).reminderTime;
+                                   if (reminder_time > 0 && reminder_time <= horizon)
+                                       out.push_back(&record);
+                                   continue;
+                               }
+                               if (record.reminder_minutes > TaskRecord::kZeroMinutes && record.reminder_minutes <= horizon_minutes)
+                                   out.push_back(&record);
+                           } });
+}
+
+time_t TaskStore::nextStatusTransition(time_t now, time_t limit) const
+{
+    time_t next = limit;
+    m_tree.forEachLeaf([&](const TaskRecord *records, size_t count)
+                       {
+                           for (size_t i = 0; i < count; ++i)
+                           {
+                               const TaskRecord &record = records[i];
+                               time_t start = startTime(record);
+                               time_t end = start + static_cast<time_t>(record.duration) * 60;
+                               if (start > now)
+                                   next = min(next, start);
+                               else if (end > now)
+                                   next = min(next, end);
+                               if (!record.reminded())
+                               {
+                                   time_t reminder_time = reminderTime(record);
+                                   if (reminder_time > now)
+                                       next = min(next, reminder_time);
+                               }
+                           } });
+    return next;
+}
+
+void TaskStore::collectStatusChanges(time_t last, time_t now, vector<long long> &out) const
+{
+    auto crossed = [last, now](time_t boundary)
+    { return boundary > last && boundary <= now; };
+    m_tree.forEachLeaf([&](const TaskRecord *records, size_t count)
+                       {
+                           for (size_t i = 0; i < count; ++i)
+                           {
+                               const TaskRecord &record = records[i];
+                               time_t start = startTime(record);
+                               time_t end = start + static_cast<time_t>(record.duration) * 60;
+                               time_t reminder_time = reminderTime(record);
+                               if (crossed(start) || crossed(end) || (reminder_time > 0 && crossed(reminder_time)))
+                                   out.push_back(record.id);
+                           } });
+}
+
+void TaskStore::fill(const TaskRecord &record, Task &task) const
+{
+    task.id = record.id;
+    task.duration = record.duration;
+    task.priority = record.priority();
+    task.category = record.category();
+    task.reminded = record.reminded();
+    task.name.assign(m_strings.view(record.name));
+    if (record.hasOverflow())
+    {
+        const Overflow &overflow = overflowOf(record);
+        task.startTime = overflow.startTime;
+        task.reminderTime = overflow.reminderTime;
+        task.customCategory = overflow.customCategory;
+        task.reminderOption = overflow.reminderOption;
+        return;
+    }
+    task.startTime = record.startTime();
+    task.reminderTime = record.reminderTime();
+    task.customCategory.assign(m_symbols.view(record.custom_category));
+    task.reminderOption.assign(m_symbols.view(record.reminder_option));
+}
+
+Task TaskStore::get(const TaskRecord &record) const
+{
+    Task task;
+    fill(record, task);
+    return task;
+}
+
+vector<Task> TaskStore::toTasks() const
+{
+    vector<Task> tasks(m_tree.size());
+    size_t i = 0;
+    for (const auto &record : m_tree)
+        fill(record, tasks[i++]);
+    return tasks;
+}
+
+size_t TaskStore::memoryBytes() const
+{
+    size_t overflow = m_overflow.size() * (sizeof(pair<const long long, Overflow>) + 2 * sizeof(void *));
+    return m_tree.memoryBytes() + m_pending.capacity() * sizeof(TaskRecord) + m_strings.memoryBytes() +
+           m_symbols.memoryBytes() + overflow;
+}
+
+// intern 的字符串被多条记录共用，不计为垃圾
+void TaskStore::releaseStrings(const TaskRecord &record)
+{
+    m_garbage_bytes += m_strings.view(record.name).size();
+    if (record.hasOverflow())
+        m_overflow.erase(record.id);
+}
+
+// 垃圾超过名称数据的一半时重建名称池，只保留仍被引用的字符串
+void TaskStore::compactIfNeeded()
+{
+    if (m_garbage_bytes < 64 * 1024 || m_garbage_bytes * 2 < m_strings.dataBytes())
+        return;
+
+    StringPool compacted;
+    compacted.reserve(m_tree.size(), m_strings.dataBytes() - m_garbage_bytes);
+    for (auto &record : m_tree)
+        record.name = compacted.store(m_strings.view(record.name));
+    m_strings = move(compacted);
+    m_garbage_bytes = 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "StringPool.h"
+#include "Task.h"
+#include "TaskRecord.h"
+#include "TaskTree.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+class BackgroundExecutor;
+
+// TaskManager 内部的任务存储，按 (开始时间, id) 排序，记录保存在 TaskTree（B+ 树）中，任务 id 是稳定的句柄。
+// 任务的三个字符串不再各自占用堆内存：name 逐条追加到 StringPool，customCategory 和 reminderOption
+// 取值重复度高（"15分钟前"、少数几个自定义分类），intern 到另一个池中共用一份，记录中只保存句柄。
+// 不是整分钟的时间或超过 65535 种的分类/提醒选项在 m_overflow 中按 id 保存原值（见 TaskRecord.h）。
+// 对外仍以 Task 交换，读取时转换。本身不加锁，由 TaskManager 的 tasks_mutex 保护
+class TaskStore
+{
+public:
+    using iterator = TaskTree::iterator;
+    using const_iterator = TaskTree::const_iterator;
+
+    size_t size() const { return m_tree.size(); }
+    bool empty() const { return m_tree.empty(); }
+    void clear();
+    void reserve(size_t count);
+
+    // 载入时使用：先 push_back 到暂存区（不排序，不可见），全部追加完之后 sortByStartTime 一次排序并批量建树。
+    // 文件中 id 重复的记录只保留最先出现的一条，之后的丢弃并计数（push_back 返回 false）
+    bool push_back(const Task &task);
+    void sortByStartTime();
+    size_t droppedDuplicates() const { return m_dropped_duplicates; } // 上次 clear 以来丢弃的重复 id 记录数
+    // 按开始时间有序插入/替换/删除，都是 O(log n)；替换时开始时间变化的记录移到新位置。
+    // id 已存在（插入）或不存在（替换、删除）时返回 false
+    bool insert(const Task &task);
+    bool assign(const Task &task);
+    bool erase(long long id);
+    // 并行载入：各部分在不同线程上分别 push_back（尚未排序），在这里合并为一个有序的存储（当前内容被替换）：
+    // 各部分在线程池上分别排序，相邻的有序段逐轮两两归并后批量建树。parts 按文件中的顺序排列，
+    // 与前面部分 id 重复的记录被丢弃。parts 被清空
+    void mergeSorted(vector<TaskStore> &parts, BackgroundExecutor &executor);
+
+    // 按开始时间顺序遍历；迭代器和记录指针在下一次修改后失效
+    iterator begin() { return m_tree.begin(); }
+    iterator end() { return m_tree.end(); }
+    const_iterator begin() const { return m_tree.begin(); }
+    const_iterator end() const { return m_tree.end(); }
+    // 第一条开始时间所在分钟不早于 start 所在分钟的记录（同一分钟内的秒数由调用方比较）
+    const_iterator lowerBound(time_t start) const { return m_tree.lowerBound(TaskRecord::toMinutes(start)); }
+
+    TaskRecord *find(long long id) { return m_tree.find(id); } // 找不到时返回 nullptr
+    const TaskRecord *find(long long id) const { return m_tree.find(id); }
+
+    string_view name(const TaskRecord &record) const { return m_strings.view(record.name); }
+    // 精确的时间（记录中的分钟值对带溢出值的记录只是近似）
+    time_t startTime(const TaskRecord &record) const
+    {
+        return record.hasOverflow() ? overflowOf(record).startTime : record.startTime();
+    }
+    time_t reminderTime(const TaskRecord &record) const
+    {
+        return record.hasOverflow() ? overflowOf(record).reminderTime : record.reminderTime();
+    }
+
+    // 提醒扫描：逐个叶子直接比较分钟值，不逐条换算时间
+    time_t nextReminderTime() const;                                     // 最早的未提醒提醒时间，没有时返回 0
+    void collectDueReminders(time_t horizon, vector<TaskRecord *> &out); // 提醒时间不晚于 horizon 且未提醒的记录
+    // 界面状态刷新：now 之后最近的开始、结束或未提醒的提醒时刻（不晚于 limit）；以及在 (last, now] 内跨过这些时刻的任务 id
+    time_t nextStatusTransition(time_t now, time_t limit) const;
+    void collectStatusChanges(time_t last, time_t now, vector<long long> &out) const;
+    Task get(const TaskRecord &record) const;
+    // 把记录写入已有的 Task，字符串复用其缓冲区（逐条写文件时使用）
+    void fill(const TaskRecord &record, Task &task) const;
+    vector<Task> toTasks() const;
+
+    // 记录和字符串占用的内存
+    size_t memoryBytes() const;
+
+private:
+    // 紧凑记录放不下的原值
+    struct Overflow
+    {
+        time_t startTime;
+        time_t reminderTime;
+        string customCategory;
+        string reminderOption;
+    };
+
+    // 载入时已出现过的 id：id 由 TaskManager 顺序分配，通常是按 id 下标的位图，离散的大 id 放进哈希表
+    class IdSet
+    {
+    public:
+        bool insert(long long id); // 已存在时返回 false
+        void clear();
+
+    private:
+        vector<bool> m_dense;
+        unordered_set<long long> m_sparse;
+    };
+
+    const Overflow &overflowOf(const TaskRecord &record) const { return m_overflow.at(record.id); }
+    TaskRecord makeRecord(const Task &task);
+    uint16_t internSymbol(const string &text, bool &overflow);
+    void releaseStrings(const TaskRecord &record);
+    void compactIfNeeded();
+
+    TaskTree m_tree;
+    vector<TaskRecord> m_pending; // push_back 暂存，sortByStartTime 后清空
+    IdSet m_pending_ids;          // 暂存区中的 id，同上
+    size_t m_dropped_duplicates = 0;
+    StringPool m_strings;         // name
+    StringPool m_symbols;         // customCategory 和 reminderOption（intern）
+    unordered_map<long long, Overflow> m_overflow;
+    size_t m_garbage_bytes = 0; // 已删除或被替换的 name 仍占用的字节数
+};
\ No newline at end of file
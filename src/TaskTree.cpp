@@ -0,0 +1,450 @@
+#include "TaskTree.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+void TaskTree::clear()
+{
+    m_leaves.clear();
+    m_inners.clear();
+    m_free_leaves.clear();
+    m_free_inners.clear();
+    m_root = kNone;
+    m_height = 0;
+    m_first_leaf = kNone;
+    m_size = 0;
+    m_dense_index.clear();
+    m_sparse_index.clear();
+}
+
+TaskTree::NodeId TaskTree::allocLeaf()
+{
+    if (!m_free_leaves.empty())
+    {
+        NodeId leaf = m_free_leaves.back();
+        m_free_leaves.pop_back();
+        m_leaves[leaf].count = 0;
+        m_leaves[leaf].prev = m_leaves[leaf].next = kNone;
+        return leaf;
+    }
+    m_leaves.emplace_back();
+    return static_cast<NodeId>(m_leaves.size() - 1);
+}
+
+TaskTree::NodeId TaskTree::allocInner()
+{
+    if (!m_free_inners.empty())
+    {
+        NodeId inner = m_free_inners.back();
+        m_free_inners.pop_back();
+        m_inners[inner].count = 0;
+        return inner;
+    }
+    m_inners.emplace_back();
+    return static_cast<NodeId>(m_inners.size() - 1);
+}
+
+void TaskTree::freeLeaf(NodeId leaf)
+{
+    m_leaves[leaf].count = 0;
+    m_free_leaves.push_back(leaf);
+}
+
+void TaskTree::freeInner(NodeId inner)
+{
+    m_inners[inner].count = 0;
+    m_free_inners.push_back(inner);
+}
+
+void TaskTree::unlinkLeaf(NodeId leaf)
+{
+    Leaf &node = m_leaves[leaf];
+    if (node.prev != kNone)
+        m_leaves[node.prev].next = node.next;
+    else
+        m_first_leaf = node.next;
+    if (node.next != kNone)
+        m_leaves[node.next].prev = node.prev;
+}
+
+TaskTree::NodeId TaskTree::descend(const Key &key, Path &path) const
+{
+    NodeId node = m_root;
+    for (uint32_t level = 0; level < m_height; ++level)
+    {
+        const Inner &inner = m_inners[node];
+        uint32_t child = static_cast<uint32_t>(upper_bound(inner.keys, inner.keys + inner.count - 1, key) - inner.keys);
+        path.push_back({node, child});
+        node = inner.children[child];
+    }
+    return node;
+}
+
+bool TaskTree::insert(const TaskRecord &record)
+{
+    if (leafOf(record.id) != kNone)
+        return false;
+    if (m_root == kNone)
+    {
+        m_root = m_first_leaf = allocLeaf();
+        m_height = 0;
+    }
+
+    Path path;
+    NodeId leaf_id = descend(keyOf(record), path);
+    Leaf &leaf = m_leaves[leaf_id];
+    uint32_t index = static_cast<uint32_t>(upper_bound(leaf.records, leaf.records + leaf.count, record, keyLess) - leaf.records);
+    ++m_size;
+
+    if (leaf.count < kLeafCapacity)
+    {
+        copy_backward(leaf.records + index, leaf.records + leaf.count, leaf.records + leaf.count + 1);
+        leaf.records[index] = record;
+        ++leaf.count;
+        setLeafOf(record.id, leaf_id);
+        return true;
+    }
+
+    // 叶子已满：后一半移到新叶子，新记录放进所属的一半
+    const uint32_t half = kLeafCapacity / 2;
+    NodeId right_id = allocLeaf();
+    Leaf &right = m_leaves[right_id];
+    copy(leaf.records + half, leaf.records + kLeafCapacity, right.records);
+    right.count = kLeafCapacity - half;
+    leaf.count = half;
+    for (uint32_t i = 0; i < right.count; ++i)
+        setLeafOf(right.records[i].id, right_id);
+
+    right.prev = leaf_id;
+    right.next = leaf.next;
+    if (leaf.next != kNone)
+        m_leaves[leaf.next].prev = right_id;
+    leaf.next = right_id;
+
+    NodeId target_id = index <= half ? leaf_id : right_id;
+    Leaf &target = m_leaves[target_id];
+    if (target_id == right_id)
+        index -= half;
+    copy_backward(target.records + index, target.records + target.count, target.records + target.count + 1);
+    target.records[index] = record;
+    ++target.count;
+    setLeafOf(record.id, target_id);
+
+    insertIntoParent(path, leaf_id, keyOf(right.records[0]), right_id);
+    return true;
+}
+
+// 把分裂出的 right 插到 left 之后；父节点也满时继续向上分裂，根分裂时树增高一层
+void TaskTree::insertIntoParent(Path &path, NodeId left, const Key &separator, NodeId right)
+{
+    Key key = separator;
+    NodeId new_child = right;
+    while (!path.empty())
+    {
+        PathEntry entry = path.back();
+        path.pop_back();
+        Inner &inner = m_inners[entry.inner];
+        const uint32_t at = entry.child; // 新键放在 keys[at]，新子节点放在 children[at + 1]
+
+        if (inner.count < kInnerCapacity)
+        {
+            copy_backward(inner.keys + at, inner.keys + inner.count - 1, inner.keys + inner.count);
+            copy_backward(inner.children + at + 1, inner.children + inner.count, inner.children + inner.count + 1);
+            inner.keys[at] = key;
+            inner.children[at + 1] = new_child;
+            ++inner.count;
+            return;
+        }
+
+        // 内部节点已满：在临时数组中插入后对半分开，中间的键移到上一层
+        Key keys[kInnerCapacity];
+        NodeId children[kInnerCapacity + 1];
+        copy(inner.keys, inner.keys + at, keys);
+        keys[at] = key;
+        copy(inner.keys + at, inner.keys + kInnerCapacity - 1, keys + at + 1);
+        copy(inner.children, inner.children + at + 1, children);
+        children[at + 1] = new_child;
+        copy(inner.children + at + 1, inner.children + kInnerCapacity, children + at + 2);
+
+        const uint32_t left_count = (kInnerCapacity + 1) / 2;
+        NodeId right_id = allocInner();
+        Inner &sibling = m_inners[right_id];
+        inner.count = left_count;
+        copy(children, children + left_count, inner.children);
+        copy(keys, keys + left_count - 1, inner.keys);
+        sibling.count = kInnerCapacity + 1 - left_count;
+        copy(children + left_count, children + kInnerCapacity + 1, sibling.children);
+        copy(keys + left_count, keys + kInnerCapacity, sibling.keys);
+
+        key = keys[left_count - 1];
+        left = entry.inner;
+        new_child = right_id;
+    }
+
+    NodeId root = allocInner();
+    Inner &node = m_inners[root];
+    node.count = 2;
+    node.children[0] = left;
+    node.children[1] = new_child;
+    node.keys[0] = key;
+    m_root = root;
+    ++m_height;
+}
+
+bool TaskTree::erase(long long id)
+{
+    NodeId leaf_id = leafOf(id);
+    if (leaf_id == kNone)
+        return false;
+
+    Leaf &leaf = m_leaves[leaf_id];
+    TaskRecord *pos = find_if(leaf.records, leaf.records + leaf.count, [id](const TaskRecord &record)
+                              { return record.id == id; });
+    Path path;
+    descend(keyOf(*pos), path);
+    copy(pos + 1, leaf.records + leaf.count, pos);
+    --leaf.count;
+    clearLeafOf(id);
+    if (--m_size == 0)
+    {
+        clear();
+        return true;
+    }
+
+    if (leaf.count == 0)
+    {
+        unlinkLeaf(leaf_id);
+        freeLeaf(leaf_id);
+        removeFromParent(path);
+    }
+    else if (leaf.count < kLeafCapacity / 4 && !path.empty())
+    {
+        // 过于稀疏时与同一父节点下的相邻叶子合并，避免删除较多时叶子大量半空
+        PathEntry &parent = path.back();
+        const Inner &inner = m_inners[parent.inner];
+        if (parent.child + 1 < inner.count && leaf.count + m_leaves[inner.children[parent.child + 1]].count <= kLeafCapacity)
+        {
+            NodeId right = inner.children[parent.child + 1];
+            ++parent.child;
+            mergeLeaves(path, leaf_id, right);
+        }
+        else if (parent.child > 0 && leaf.count + m_leaves[inner.children[parent.child - 1]].count <= kLeafCapacity)
+        {
+            mergeLeaves(path, inner.children[parent.child - 1], leaf_id);
+        }
+    }
+    return true;
+}
+
+// right 的记录接到 left 末尾，然后删除 right；path 的最后一项指向 right
+void TaskTree::mergeLeaves(Path &path, NodeId left, NodeId right)
+{
+    Leaf &target = m_leaves[left];
+    const Leaf &source = m_leaves[right];
+    copy(source.records, source.records + source.count, target.records + target.count);
+    for (uint32_t i = 0; i < source.count; ++i)
+        setLeafOf(source.records[i].id, left);
+    target.count += source.count;
+    unlinkLeaf(right);
+    freeLeaf(right);
+    removeFromParent(path);
+}
+
+// 从父节点中删除 path 最后一项指向的子节点；父节点因此变空时继续向上删除
+void TaskTree::removeFromParent(Path &path)
+{
+    while (!path.empty())
+    {
+        PathEntry entry = path.back();
+        path.pop_back();
+        Inner &inner = m_inners[entry.inner];
+        // 同时删掉子节点左侧的分隔键，第一个子节点则删掉其右侧的
+        uint32_t key_index = entry.child > 0 ? entry.child - 1 : 0;
+        if (inner.count > 1)
+            copy(inner.keys + key_index + 1, inner.keys + inner.count - 1, inner.keys + key_index);
+        copy(inner.children + entry.child + 1, inner.children + inner.count, inner.children + entry.child);
+        if (--inner.count > 0)
+            break;
+        freeInner(entry.inner);
+    }
+
+    // 根只剩一个子节点时降低一层
+    while (m_height > 0 && m_inners[m_root].count == 1)
+    {
+        NodeId old_root = m_root;
+        m_root = m_inners[old_root].children[0];
+        freeInner(old_root);
+        --m_height;
+    }
+}
+
+bool TaskTree::replace(const TaskRecord &record)
+{
+    NodeId leaf_id = leafOf(record.id);
+    if (leaf_id == kNone)
+        return false;
+
+    Leaf &leaf = m_leaves[leaf_id];
+    TaskRecord *pos = find_if(leaf.records, leaf.records + leaf.count, [&record](const TaskRecord &existing)
+                              { return existing.id == record.id; });
+    // 开始时间不变（改名称、提醒状态等）时键不变，原地替换
+    if (pos->start_minutes == record.start_minutes)
+    {
+        *pos = record;
+        return true;
+    }
+    erase(record.id);
+    insert(record);
+    return true;
+}
+
+TaskRecord *TaskTree::find(long long id)
+{
+    return const_cast<TaskRecord *>(static_cast<const TaskTree *>(this)->find(id));
+}
+
+const TaskRecord *TaskTree::find(long long id) const
+{
+    NodeId leaf_id = leafOf(id);
+    if (leaf_id == kNone)
+        return nullptr;
+    const Leaf &leaf = m_leaves[leaf_id];
+    for (uint32_t i = 0; i < leaf.count; ++i)
+    {
+        if (leaf.records[i].id == id)
+            return &leaf.records[i];
+    }
+    return nullptr;
+}
+
+TaskTree::const_iterator TaskTree::lowerBound(int32_t start_minutes) const
+{
+    if (m_root == kNone)
+        return end();
+
+    const Key key{start_minutes, numeric_limits<long long>::min()};
+    Path path;
+    path.reserve(m_height);
+    NodeId leaf_id = descend(key, path);
+    const Leaf &leaf = m_leaves[leaf_id];
+    uint32_t pos = static_cast<uint32_t>(lower_bound(leaf.records, leaf.records + leaf.count, key, [](const TaskRecord &record, const Key &value)
+                                                     { return keyOf(record) < value; }) -
+                                         leaf.records);
+    // 本叶子中都小于 key 时，下一个叶子的第一条记录就是结果
+    if (pos == leaf.count)
+        return const_iterator(this, leaf.next, 0);
+    return const_iterator(this, leaf_id, pos);
+}
+
+void TaskTree::assignSorted(const vector<TaskRecord> &records)
+{
+    clear();
+    if (records.empty())
+        return;
+
+    // id 基本连续时（TaskManager 顺序分配）按最大 id 一次分配数组索引
+    long long max_id = -1;
+    for (const auto &record : records)
+        max_id = max(max_id, record.id);
+    if (max_id >= 0 && static_cast<size_t>(max_id) < records.size() * 4 + 1024)
+        m_dense_index.assign(static_cast<size_t>(max_id) + 1, kNone);
+
+    vector<NodeId> nodes;
+    vector<Key> first_keys;
+    nodes.reserve(records.size() / kLeafCapacity + 1);
+    first_keys.reserve(records.size() / kLeafCapacity + 1);
+    for (size_t i = 0; i < records.size(); i += kLeafCapacity)
+    {
+        NodeId leaf_id = allocLeaf();
+        Leaf &leaf = m_leaves[leaf_id];
+        leaf.count = static_cast<uint32_t>(min(kLeafCapacity, records.size() - i));
+        copy(records.begin() + i, records.begin() + i + leaf.count, leaf.records);
+        for (uint32_t j = 0; j < leaf.count; ++j)
+            setLeafOf(leaf.records[j].id, leaf_id);
+        if (!nodes.empty())
+        {
+            leaf.prev = nodes.back();
+            m_leaves[nodes.back()].next = leaf_id;
+        }
+        nodes.push_back(leaf_id);
+        first_keys.push_back(keyOf(leaf.records[0]));
+    }
+    m_first_leaf = nodes.front();
+    m_size = records.size();
+    buildInnerLevels(move(nodes), move(first_keys));
+}
+
+// 自底向上逐层建立内部节点，直到只剩一个根
+void TaskTree::buildInnerLevels(vector<NodeId> nodes, vector<Key> first_keys)
+{
+    m_height = 0;
+    while (nodes.size() > 1)
+    {
+        vector<NodeId> parents;
+        vector<Key> parent_keys;
+        for (size_t i = 0; i < nodes.size(); i += kInnerCapacity)
+        {
+            NodeId inner_id = allocInner();
+            Inner &inner = m_inners[inner_id];
+            inner.count = static_cast<uint32_t>(min(kInnerCapacity, nodes.size() - i));
+            for (uint32_t j = 0; j < inner.count; ++j)
+            {
+                inner.children[j] = nodes[i + j];
+                if (j > 0)
+                    inner.keys[j - 1] = first_keys[i + j];
+            }
+            parents.push_back(inner_id);
+            parent_keys.push_back(first_keys[i]);
+        }
+        nodes = move(parents);
+        first_keys = move(parent_keys);
+        ++m_height;
+    }
+    m_root = nodes.front();
+}
+
+TaskTree::NodeId TaskTree::leafOf(long long id) const
+{
+    if (id >= 0 && static_cast<size_t>(id) < m_dense_index.size() && m_dense_index[id] != kNone)
+        return m_dense_index[id];
+    if (m_sparse_index.empty())
+        return kNone;
+    auto it = m_sparse_index.find(id);
+    return it == m_sparse_index.end() ? kNone : it->second;
+}
+
+// 接着数组末尾的 id 扩展数组（按倍数增长），离得太远的放进哈希表
+void TaskTree::setLeafOf(long long id, NodeId leaf)
+{
+    if (id >= 0)
+    {
+        size_t index = static_cast<size_t>(id);
+        if (index >= m_dense_index.size() && index < m_dense_index.size() * 2 + 1024)
+            m_dense_index.resize(max(index + 1, m_dense_index.size() * 2), kNone);
+        if (index < m_dense_index.size())
+        {
+            m_dense_index[index] = leaf;
+            if (!m_sparse_index.empty())
+                m_sparse_index.erase(id);
+            return;
+        }
+    }
+    m_sparse_index[id] = leaf;
+}
+
+void TaskTree::clearLeafOf(long long id)
+{
+    if (id >= 0 && static_cast<size_t>(id) < m_dense_index.size())
+        m_dense_index[id] = kNone;
+    if (!m_sparse_index.empty())
+        m_sparse_index.erase(id);
+}
+
+size_t TaskTree::memoryBytes() const
+{
+    size_t sparse = m_sparse_index.size() * (sizeof(pair<const long long, NodeId>) + 2 * sizeof(void *)) +
+                    m_sparse_index.bucket_count() * sizeof(void *);
+    return m_leaves.size() * sizeof(Leaf) + m_inners.size() * sizeof(Inner) +
+           (m_free_leaves.capacity() + m_free_inners.capacity() + m_dense_index.capacity()) * sizeof(NodeId) + sparse;
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "TaskRecord.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// TaskStore 的有序容器：按 (start_minutes, id) 排序的 B+ 树。
+// 记录直接存放在叶子中（每个叶子 64 条，2 KB 连续内存），叶子之间双向链接，按序遍历和区间遍历只是顺着链表走；
+// 插入、删除和改变开始时间都是 O(log n)，只移动一个叶子内的记录，不再对整个数组排序或平移。
+//
+// 任务 id 就是稳定的句柄：树另外维护 id 到所在叶子的索引，记录在叶子之间移动（分裂、合并）时同步更新，
+// 按 id 查找不需要遍历。id 由 TaskManager 顺序分配，索引通常是一个按 id 下标的数组，
+// 离散的大 id 放进哈希表。迭代器和记录指针与 vector 一样在下一次修改之后失效，需要长期引用时保存 id。
+// 本身不加锁
+class TaskTree
+{
+public:
+    static constexpr size_t kLeafCapacity = 64;  // 每个叶子的记录数
+    static constexpr size_t kInnerCapacity = 64; // 每个内部节点的子节点数
+
+    using NodeId = uint32_t;
+    static constexpr NodeId kNone = static_cast<NodeId>(-1);
+
+    static bool keyLess(const TaskRecord &a, const TaskRecord &b)
+    {
+        if (a.start_minutes != b.start_minutes)
+            return a.start_minutes < b.start_minutes;
+        return a.id < b.id;
+    }
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using Tree = conditional_t<Const, const TaskTree, TaskTree>;
+        using iterator_category = forward_iterator_tag;
+        using value_type = TaskRecord;
+        using difference_type = ptrdiff_t;
+        using pointer = conditional_t<Const, const TaskRecord *, TaskRecord *>;
+        using reference = conditional_t<Const, const TaskRecord &, TaskRecord &>;
+
+        Iterator() = default;
+        Iterator(Tree *tree, NodeId leaf, uint32_t pos) : m_tree(tree), m_leaf(leaf), m_pos(pos) {}
+        template <bool C = Const, class = enable_if_t<!C>>
+        operator Iterator<true>() const { return Iterator<true>(m_tree, m_leaf, m_pos); }
+
+        reference operator*() const { return m_tree->m_leaves[m_leaf].records[m_pos]; }
+        pointer operator->() const { return &**this; }
+        Iterator &operator++()
+        {
+            if (++m_pos == m_tree->m_leaves[m_leaf].count)
+            {
+                m_leaf = m_tree->m_leaves[m_leaf].next;
+                m_pos = 0;
+            }
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        bool operator==(const Iterator &other) const { return m_leaf == other.m_leaf && m_pos == other.m_pos; }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+    private:
+        Tree *m_tree = nullptr;
+        NodeId m_leaf = kNone;
+        uint32_t m_pos = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    void clear();
+
+    // id 已存在时不插入，返回 false
+    bool insert(const TaskRecord &record);
+    bool erase(long long id);
+    // 替换 id 相同的记录，开始时间变化时移到新位置；找不到时返回 false
+    bool replace(const TaskRecord &record);
+    TaskRecord *find(long long id);
+    const TaskRecord *find(long long id) const;
+    // 用按 keyLess 排好序的记录批量建树，替换当前内容；叶子全部装满，O(n)
+    void assignSorted(const vector<TaskRecord> &records);
+
+    iterator begin() { return iterator(this, m_first_leaf, 0); }
+    iterator end() { return iterator(this, kNone, 0); }
+    const_iterator begin() const { return const_iterator(this, m_first_leaf, 0); }
+    const_iterator end() const { return const_iterator(this, kNone, 0); }
+    // 第一条 start_minutes 不小于给定值的记录
+    const_iterator lowerBound(int32_t start_minutes) const;
+
+    // 对每个叶子中的记录调用 visit(TaskRecord *records, size_t count)，按键的顺序；
+    // 顺序扫描（提醒扫描等）在一个叶子内是紧凑的数组循环
+    template <class Visit>
+    void forEachLeaf(Visit visit)
+    {
+        for (NodeId leaf = m_first_leaf; leaf != kNone; leaf = m_leaves[leaf].next)
+            visit(m_leaves[leaf].records, m_leaves[leaf].count);
+    }
+    template <class Visit>
+    void forEachLeaf(Visit visit) const
+    {
+        for (NodeId leaf = m_first_leaf; leaf != kNone; leaf = m_leaves[leaf].next)
+            visit(static_cast<const TaskRecord *>(m_leaves[leaf].records), m_leaves[leaf].count);
+    }
+
+    // 节点和 id 索引占用的内存
+    size_t memoryBytes() const;
+
+private:
+    struct Key
+    {
+        int32_t start_minutes;
+        long long id;
+
+        bool operator<(const Key &other) const
+        {
+            if (start_minutes != other.start_minutes)
+                return start_minutes < other.start_minutes;
+            return id < other.id;
+        }
+    };
+    static Key keyOf(const TaskRecord &record) { return {record.start_minutes, record.id}; }
+
+    struct Leaf
+    {
+        uint32_t count = 0;
+        NodeId prev = kNone;
+        NodeId next = kNone;
+        TaskRecord records[kLeafCapacity];
+    };
+
+    // keys[i] 是 children[i + 1] 子树中的最小键
+    struct Inner
+    {
+        uint32_t count = 0; // 子节点数
+        Key keys[kInnerCapacity - 1];
+        NodeId children[kInnerCapacity];
+    };
+
+    // 从根到叶子经过的内部节点及所走的子节点下标
+    struct PathEntry
+    {
+        NodeId inner;
+        uint32_t child;
+    };
+    using Path = vector<PathEntry>;
+
+    NodeId descend(const Key &key, Path &path) const;
+    NodeId allocLeaf();
+    NodeId allocInner();
+    void freeLeaf(NodeId leaf);
+    void freeInner(NodeId inner);
+    void unlinkLeaf(NodeId leaf);
+    void insertIntoParent(Path &path, NodeId left, const Key &separator, NodeId right);
+    void removeFromParent(Path &path);
+    void mergeLeaves(Path &path, NodeId left, NodeId right);
+    void buildInnerLevels(vector<NodeId> nodes, vector<Key> first_keys);
+
+    // id -> 所在叶子
+    NodeId leafOf(long long id) const;
+    void setLeafOf(long long id, NodeId leaf);
+    void clearLeafOf(long long id);
+
+    deque<Leaf> m_leaves; // deque：扩容时已有节点不移动
+    deque<Inner> m_inners;
+    vector<NodeId> m_free_leaves;
+    vector<NodeId> m_free_inners;
+    NodeId m_root = kNone;
+    uint32_t m_height = 0; // 根到叶子之间的内部节点层数，0 表示根就是叶子
+    NodeId m_first_leaf = kNone;
+    size_t m_size = 0;
+
+    vector<NodeId> m_dense_index;                   // 下标为 id
+    unordered_map<long long, NodeId> m_sparse_index; // 负数或远超任务数的 id
+};
\ No newline at end of file
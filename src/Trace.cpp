@@ -0,0 +1,199 @@
+#include "Trace.h"
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+namespace Trace
+{
+    atomic<bool> g_enabled{false};
+
+    namespace
+    {
+        const size_t kEventsPerThread = 1 << 16; // 每个线程最多保留最近 65536 个事件
+
+        struct Event
+        {
+            const char *name;
+            const char *category;
+            int64_t start_us;
+            int64_t duration_us; // 小于 0 表示计数器事件，此时 category 为曲线名
+            int64_t value;
+        };
+
+        // 缓冲区的锁只在本线程写入和导出时使用，正常情况下没有竞争
+        struct ThreadBuffer
+        {
+            mutex buffer_mutex;
+            vector<Event> events;
+            size_t next = 0;
+            bool wrapped = false;
+            long tid = 0;
+            string thread_name;
+        };
+
+        mutex registry_mutex;
+
+        // 线程退出后缓冲区仍由这里持有，导出时不会丢失已结束线程（例如线程池）的事件
+        vector<shared_ptr<ThreadBuffer>> &buffers()
+        {
+            static vector<shared_ptr<ThreadBuffer>> all;
+            return all;
+        }
+
+        ThreadBuffer &threadBuffer()
+        {
+            thread_local shared_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                buffer = make_shared<ThreadBuffer>();
+                buffer->events.resize(kEventsPerThread);
+                buffer->tid = static_cast<long>(syscall(SYS_gettid));
+                char name[32] = {0};
+                if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0)
+                    buffer->thread_name = name;
+                lock_guard<mutex> lock(registry_mutex);
+                buffers().push_back(buffer);
+            }
+            return *buffer;
+        }
+
+        void writeJsonString(ostream &out, const string &text)
+        {
+            out << '"';
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << ' ';
+                else
+                    out << c;
+            }
+            out << '"';
+        }
+    }
+
+    void start()
+    {
+        g_enabled = true;
+    }
+
+    void stop()
+    {
+        g_enabled = false;
+    }
+
+    int64_t nowMicros()
+    {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    namespace
+    {
+        void append(const Event &event)
+        {
+            ThreadBuffer &buffer = threadBuffer();
+            lock_guard<mutex> lock(buffer.buffer_mutex);
+            buffer.events[buffer.next] = event;
+            if (++buffer.next == buffer.events.size())
+            {
+                buffer.next = 0;
+                buffer.wrapped = true;
+            }
+        }
+    }
+
+    void record(const char *name, const char *category, int64_t start_us, int64_t duration_us)
+    {
+        append({name, category, start_us, duration_us, 0});
+    }
+
+    void counter(const char *name, const char *series, int64_t value)
+    {
+        append({name, series, nowMicros(), -1, value});
+    }
+
+    long long dump(const string &path)
+    {
+        ofstream out(path, ios::out | ios::trunc);
+        if (!out.is_open())
+        {
+            cerr << "无法写入跟踪文件: " << path << endl;
+            return -1;
+        }
+
+        vector<shared_ptr<ThreadBuffer>> all;
+        {
+            lock_guard<mutex> lock(registry_mutex);
+            all = buffers();
+        }
+
+        const long pid = static_cast<long>(getpid());
+        long long count = 0;
+        bool first = true;
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (const auto &buffer : all)
+        {
+            lock_guard<mutex> lock(buffer->buffer_mutex);
+            if (!buffer->thread_name.empty())
+            {
+                out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                    << ",\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+                writeJsonString(out, buffer->thread_name);
+                out << "}}";
+                first = false;
+            }
+
+            // 写满后从最旧的事件开始输出
+            size_t size = buffer->wrapped ? buffer->events.size() : buffer->next;
+            size_t begin = buffer->wrapped ? buffer->next : 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const Event &e = buffer->events[(begin + i) % buffer->events.size()];
+                out << (first ? "" : ",") << "\n{\"name\":";
+                writeJsonString(out, e.name);
+                if (e.duration_us < 0)
+                {
+                    out << ",\"ph\":\"C\",\"ts\":" << e.start_us << ",\"pid\":" << pid << ",\"args\":{";
+                    writeJsonString(out, e.category);
+                    out << ":" << e.value << "}}";
+                }
+                else
+                {
+                    out << ",\"cat\":";
+                    writeJsonString(out, e.category);
+                    out << ",\"ph\":\"X\",\"ts\":" << e.start_us << ",\"dur\":" << e.duration_us
+                        << ",\"pid\":" << pid << ",\"tid\":" << buffer->tid << "}";
+                }
+                first = false;
+                ++count;
+            }
+        }
+        out << "\n]}\n";
+        if (!out)
+        {
+            cerr << "写入跟踪文件失败: " << path << endl;
+            return -1;
+        }
+        cout << "已导出 " << count << " 个跟踪事件到 " << path << endl;
+        return count;
+    }
+
+    string startFromEnvironment()
+    {
+        const char *path = getenv("SCHEDULER_TRACE");
+        if (!path || !*path)
+            return "";
+        start();
+        return path;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// 轻量的跟踪区间记录，导出为 Chrome / Perfetto 可以打开的 trace JSON（chrome://tracing 或 ui.perfetto.dev）
+// 每个线程把事件写入自己的环形缓冲区（写满后覆盖最旧的事件），未开启时每个区间只有一次原子读取。
+// 区间名和分类必须是字符串字面量等静态存储的字符串，缓冲区只保存指针。
+//
+// 设置环境变量 SCHEDULER_TRACE=<文件> 时从启动开始记录，退出时写入该文件；
+// 图形界面中也可以在“设置”菜单里开始/停止记录
+namespace Trace
+{
+    extern atomic<bool> g_enabled;
+
+    inline bool enabled() { return g_enabled.load(memory_order_relaxed); }
+    void start();
+    void stop();
+
+    // 单调时钟微秒数
+    int64_t nowMicros();
+    void record(const char *name, const char *category, int64_t start_us, int64_t duration_us);
+    // 计数器事件（Perfetto 中显示为以 name 命名的计数器轨道，series 为其中一条曲线）
+    void counter(const char *name, const char *series, int64_t value);
+
+    // 把所有线程缓冲区中的事件写为 trace JSON，返回写入的事件数，失败时返回 -1
+    long long dump(const string &path);
+
+    // 读取 SCHEDULER_TRACE，设置时开始记录并返回文件路径，否则返回空字符串
+    string startFromEnvironment();
+
+    class Span
+    {
+    public:
+        Span(const char *name, const char *category)
+            : m_name(name), m_category(category), m_start(enabled() ? nowMicros() : -1)
+        {
+        }
+        ~Span()
+        {
+            if (m_start >= 0)
+                record(m_name, m_category, m_start, nowMicros() - m_start);
+        }
+
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+    private:
+        const char *m_name;
+        const char *m_category;
+        int64_t m_start;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "UiBenchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+namespace
+{
+    const char *kDefaultScript = "week,next*4,prev*4,busiest,select*6,month,next*6,prev*6,busiest,agenda,week,month";
+
+    int64_t elapsed_us(chrono::steady_clock::time_point start)
+    {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    }
+
+    int64_t percentile(vector<int64_t> values, double p)
+    {
+        if (values.empty())
+            return 0;
+        size_t index = min(values.size() - 1, static_cast<size_t>(p * values.size()));
+        nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    string json_escape(const string &text)
+    {
+        string result;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+}
+
+UiBenchmark::UiBenchmark(string user, vector<string> script, string output)
+    : m_user(move(user)), m_script(move(script)), m_output(move(output))
+{
+}
+
+unique_ptr<UiBenchmark> UiBenchmark::from_environment()
+{
+    const char *script = getenv("SCHEDULER_UI_BENCH");
+    if (!script || !*script || string(script) == "0")
+        return nullptr;
+
+    const char *user = getenv("SCHEDULER_UI_BENCH_USER");
+    const char *output = getenv("SCHEDULER_UI_BENCH_OUT");
+    vector<string> steps = parse_script(string(script) == "1" ? kDefaultScript : script);
+    if (steps.empty())
+    {
+        cerr << "界面基准测试脚本为空: " << script << endl;
+        return nullptr;
+    }
+    return unique_ptr<UiBenchmark>(new UiBenchmark(user && *user ? user : "user1", move(steps), output ? output : ""));
+}
+
+vector<string> UiBenchmark::parse_script(const string &text)
+{
+    vector<string> steps;
+    stringstream ss(text);
+    string item;
+    while (getline(ss, item, ','))
+    {
+        int repeat = 1;
+        size_t star = item.find('*');
+        if (star != string::npos)
+        {
+            repeat = max(1, atoi(item.c_str() + star + 1));
+            item.erase(star);
+        }
+        if (item.empty())
+            continue;
+        for (int i = 0; i < repeat; ++i)
+            steps.push_back(item);
+    }
+    return steps;
+}
+
+UiBenchmark::Scope::Scope(UiBenchmark *bench, const char *name) : m_bench(bench), m_name(name)
+{
+    if (!m_bench)
+        return;
+    m_alloc = AllocCounter::current();
+    m_start = chrono::steady_clock::now();
+}
+
+UiBenchmark::Scope::~Scope()
+{
+    if (m_bench)
+        m_bench->record(m_name, elapsed_us(m_start), m_alloc);
+}
+
+void UiBenchmark::record(const char *name, int64_t us, const AllocCounter::Snapshot &before)
+{
+    // 登录后第一次填充视图时还没有开始任何一步，记在一个初始步骤里
+    if (m_steps.empty())
+    {
+        m_steps.emplace_back();
+        m_steps.back().action = "(初始)";
+    }
+    AllocCounter::Snapshot now = AllocCounter::current();
+    m_steps.back().calls.push_back({name, us, now.count - before.count, now.bytes - before.bytes});
+}
+
+const string &UiBenchmark::begin_step()
+{
+    m_steps.emplace_back();
+    m_steps.back().action = m_script[m_next_step];
+    m_step_alloc = AllocCounter::current();
+    m_step_start = chrono::steady_clock::now();
+    return m_script[m_next_step++];
+}
+
+void UiBenchmark::step_returned()
+{
+    m_steps.back().sync_us = elapsed_us(m_step_start);
+}
+
+void UiBenchmark::step_settled(int widget_count)
+{
+    Step &step = m_steps.back();
+    step.settled_us = elapsed_us(m_step_start);
+    AllocCounter::Snapshot now = AllocCounter::current();
+    step.allocations = now.count - m_step_alloc.count;
+    step.bytes = now.bytes - m_step_alloc.bytes;
+    step.widgets = widget_count;
+}
+
+void UiBenchmark::report() const
+{
+    char line[160];
+    cout << "\n界面基准测试（用户 " << m_user << "）\n";
+    snprintf(line, sizeof(line), "%-4s %-10s %10s %12s %10s %12s %8s",
+             "#", "step", "sync(us)", "settled(us)", "allocs", "bytes", "widgets");
+    cout << line << "\n";
+    for (size_t i = 0; i < m_steps.size(); ++i)
+    {
+        const Step &s = m_steps[i];
+        snprintf(line, sizeof(line), "%-4zu %-10s %10lld %12lld %10llu %12llu %8d", i, s.action.c_str(),
+                 static_cast<long long>(s.sync_us), static_cast<long long>(s.settled_us),
+                 static_cast<unsigned long long>(s.allocations), static_cast<unsigned long long>(s.bytes), s.widgets);
+        cout << line << "\n";
+    }
+
+    // 按函数汇总每次调用的耗时和分配
+    map<string, vector<const Call *>> by_name;
+    for (const auto &step : m_steps)
+        for (const auto &call : step.calls)
+            by_name[call.name].push_back(&call);
+
+    snprintf(line, sizeof(line), "\n%-30s %6s %10s %10s %10s %12s", "function", "calls", "p50(us)", "max(us)", "total(us)", "allocs/call");
+    cout << line << "\n";
+    for (const auto &entry : by_name)
+    {
+        vector<int64_t> durations;
+        int64_t total = 0;
+        uint64_t allocations = 0;
+        for (const Call *call : entry.second)
+        {
+            durations.push_back(call->us);
+            total += call->us;
+            allocations += call->allocations;
+        }
+        snprintf(line, sizeof(line), "%-30s %6zu %10lld %10lld %10lld %12llu", entry.first.c_str(), durations.size(),
+                 static_cast<long long>(percentile(durations, 0.5)),
+                 static_cast<long long>(*max_element(durations.begin(), durations.end())),
+                 static_cast<long long>(total), static_cast<unsigned long long>(allocations / durations.size()));
+        cout << line << "\n";
+    }
+    if (!AllocCounter::enabled())
+        cout << "（未以 -DSCHEDULER_ALLOC_STATS=ON 构建，分配次数和字节数均为 0）\n";
+    cout << flush;
+
+    if (m_output.empty())
+        return;
+    ofstream out(m_output);
+    if (!out.is_open())
+    {
+        cerr << "无法写入界面基准测试结果: " << m_output << endl;
+        return;
+    }
+    out << "{\n  \"user\": \"" << json_escape(m_user) << "\",\n  \"steps\": [";
+    for (size_t i = 0; i < m_steps.size(); ++i)
+    {
+        const Step &s = m_steps[i];
+        out << (i ? "," : "") << "\n    {\"action\": \"" << json_escape(s.action) << "\", \"sync_us\": " << s.sync_us
+            << ", \"settled_us\": " << s.settled_us << ", \"allocations\": " << s.allocations
+            << ", \"bytes\": " << s.bytes << ", \"widgets\": " << s.widgets << ", \"calls\": [";
+        for (size_t j = 0; j < s.calls.size(); ++j)
+        {
+            const Call &c = s.calls[j];
+            out << (j ? ", " : "") << "{\"name\": \"" << c.name << "\", \"us\": " << c.us
+                << ", \"allocations\": " << c.allocations << ", \"bytes\": " << c.bytes << "}";
+        }
+        out << "]}";
+    }
+    out << "\n  ]\n}\n";
+    cout << "界面基准测试结果已写入 " << m_output << endl;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "AllocCounter.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 界面基准测试模式：设置环境变量 SCHEDULER_UI_BENCH 后，SchedulerApp 跳过登录，
+// 直接以 SCHEDULER_UI_BENCH_USER（默认 user1）的数据打开主窗口，按脚本逐步执行导航操作，
+// 记录视图填充函数每次调用的耗时和堆分配（需以 -DSCHEDULER_ALLOC_STATS=ON 构建），以及每一步执行完毕、界面空闲后的控件数，结束后输出报告并退出。
+//
+// SCHEDULER_UI_BENCH 为逗号分隔的操作列表，"操作*N" 表示重复 N 次，值为 1 时使用默认脚本。
+// 支持的操作: month week agenda next prev today busiest（跳到任务最多的一天） select（选中后一天）
+// SCHEDULER_UI_BENCH_OUT 指定时，另外把结果以 JSON 写入该文件
+class UiBenchmark
+{
+public:
+    // 未开启时返回空指针
+    static unique_ptr<UiBenchmark> from_environment();
+
+    // 记录一次函数调用；bench 为空时什么也不做
+    class Scope
+    {
+    public:
+        Scope(UiBenchmark *bench, const char *name);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        UiBenchmark *m_bench;
+        const char *m_name;
+        chrono::steady_clock::time_point m_start;
+        AllocCounter::Snapshot m_alloc;
+    };
+
+    const string &user() const { return m_user; }
+    bool finished() const { return m_next_step >= m_script.size(); }
+
+    // 开始下一步，返回要执行的操作
+    const string &begin_step();
+    // 操作本身（同步部分）已经返回
+    void step_returned();
+    // 空闲分片全部完成、界面已稳定
+    void step_settled(int widget_count);
+
+    // 输出文本报告，设置了输出文件时同时写入 JSON
+    void report() const;
+
+private:
+    struct Call
+    {
+        string name;
+        int64_t us;
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    struct Step
+    {
+        string action;
+        int64_t sync_us = 0;    // 操作返回时的耗时
+        int64_t settled_us = 0; // 到空闲分片全部完成为止的耗时
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        int widgets = 0;
+        vector<Call> calls;
+    };
+
+    UiBenchmark(string user, vector<string> script, string output);
+    static vector<string> parse_script(const string &text);
+    void record(const char *name, int64_t us, const AllocCounter::Snapshot &before);
+
+    string m_user;
+    vector<string> m_script;
+    string m_output;
+    size_t m_next_step = 0;
+    vector<Step> m_steps;
+    chrono::steady_clock::time_point m_step_start;
+    AllocCounter::Snapshot m_step_alloc;
+};
\ No newline at end of file
@@ -7,6 +7,28 @@
 #include <cwctype> // 宽字符处理
 #include <locale>  // 本地化支持
 #include <cstdio>  // for remove()
+#include "Logger.h"
+#include "Metrics.h"
+
+namespace
+{
+    // 用户管理相关的指标，首次使用时注册
+    struct UserMetrics
+    {
+        Metrics::Counter &login_success = Metrics::counter("scheduler_user_logins_total", "登录尝试次数", "result=\"success\"");
+        Metrics::Counter &login_user_not_found = Metrics::counter("scheduler_user_logins_total", "登录尝试次数", "result=\"user_not_found\"");
+        Metrics::Counter &login_incorrect_password = Metrics::counter("scheduler_user_logins_total", "登录尝试次数", "result=\"incorrect_password\"");
+        Metrics::Histogram &load_time = Metrics::histogram("scheduler_users_file_seconds", "读写用户文件的耗时", "op=\"load\"");
+        Metrics::Histogram &save_time = Metrics::histogram("scheduler_users_file_seconds", "读写用户文件的耗时", "op=\"save\"");
+        Metrics::Gauge &user_count = Metrics::gauge("scheduler_users", "已注册的用户数");
+    };
+
+    UserMetrics &metrics()
+    {
+        static UserMetrics instance;
+        return instance;
+    }
+}
 
 UserManager::UserManager()
 {
@@ -35,9 +57,9 @@ bool UserManager::isPasswordValid(const string &password)
     }
 
     // 调试信息：打印当前密码的验证结果
-    cerr << "密码验证 - 大写:" << hasUpper
-         << " 小写:" << hasLower
-         << " 数字:" << hasDigit << endl;
+    LOG_DEBUG("UserManager", "密码验证 - 大写:" << hasUpper
+                                                << " 小写:" << hasLower
+                                                << " 数字:" << hasDigit);
 
     // 3. 必须同时满足三个条件
     return hasUpper && hasLower && hasDigit;
@@ -45,12 +67,12 @@ bool UserManager::isPasswordValid(const string &password)
 
 bool UserManager::registerUser(const string &username, const string &password)
 {
-    cout << "Attempting to register user: " << username << endl;
+    LOG_INFO("UserManager", "Attempting to register user: " << username);
 
     // 1. 检查用户名是否已存在
     if (users.find(username) != users.end())
     {
-        cerr << "Registration failed: Username '" << username << "' already exists." << endl;
+        LOG_WARN("UserManager", "Registration failed: Username '" << username << "' already exists.");
         return false; // 用户名已存在
     }
 
@@ -63,19 +85,20 @@ bool UserManager::registerUser(const string &username, const string &password)
     // 4. 调用 saveUsers() 写入文件
     saveUsers();
 
-    cout << "User '" << username << "' registered successfully." << endl;
+    LOG_INFO("UserManager", "User '" << username << "' registered successfully.");
     return true;
 }
 
 UserManager::LoginResult UserManager::login(const string &username, const string &password)
 {
-    cout << "Attempting to login user: " << username << endl;
+    LOG_INFO("UserManager", "Attempting to login user: " << username);
 
     // 1. 检查用户是否存在
     auto it = users.find(username);
     if (it == users.end())
     {
-        cerr << "Login failed: User '" << username << "' not found." << endl;
+        LOG_WARN("UserManager", "Login failed: User '" << username << "' not found.");
+        metrics().login_user_not_found.inc();
         return LoginResult::USER_NOT_FOUND; // 用户未找到
     }
 
@@ -85,25 +108,27 @@ UserManager::LoginResult UserManager::login(const string &username, const string
     // 3. 与存储的加密密码进行比对
     if (it->second == inputHashedPassword)
     {
-        cout << "User '" << username << "' logged in successfully." << endl;
+        LOG_INFO("UserManager", "User '" << username << "' logged in successfully.");
+        metrics().login_success.inc();
         return LoginResult::SUCCESS; // 密码匹配，登录成功
     }
     else
     {
-        cerr << "Login failed: Incorrect password for user '" << username << "'." << endl;
+        LOG_WARN("UserManager", "Login failed: Incorrect password for user '" << username << "'.");
+        metrics().login_incorrect_password.inc();
         return LoginResult::INCORRECT_PASSWORD; // 密码错误
     }
 }
 
 UserManager::ChangePasswordResult UserManager::changePassword(const string &username, const string &oldPassword, const string &newPassword)
 {
-    cout << "Attempting to change password for user: " << username << endl;
+    LOG_INFO("UserManager", "Attempting to change password for user: " << username);
 
     // 1. 检查用户是否存在
     auto it = users.find(username);
     if (it == users.end())
     {
-        cerr << "Password change failed: User '" << username << "' not found." << endl;
+        LOG_WARN("UserManager", "Password change failed: User '" << username << "' not found.");
         return ChangePasswordResult::USER_NOT_FOUND;
     }
 
@@ -111,14 +136,14 @@ UserManager::ChangePasswordResult UserManager::changePassword(const string &user
     string oldHashedPassword = md5(oldPassword);
     if (it->second != oldHashedPassword)
     {
-        cerr << "Password change failed: Incorrect old password for user '" << username << "'." << endl;
+        LOG_WARN("UserManager", "Password change failed: Incorrect old password for user '" << username << "'.");
         return ChangePasswordResult::INCORRECT_PASSWORD;
     }
 
     // 3. 检查新密码的合法性
     if (!isPasswordValid(newPassword))
     {
-        cerr << "Password change failed: New password does not meet complexity requirements." << endl;
+        LOG_WARN("UserManager", "Password change failed: New password does not meet complexity requirements.");
         return ChangePasswordResult::INVALID_PASSWORD;
     }
 
@@ -129,26 +154,26 @@ UserManager::ChangePasswordResult UserManager::changePassword(const string &user
     // 5. 保存到文件
     saveUsers();
 
-    cout << "Password for user '" << username << "' changed successfully." << endl;
+    LOG_INFO("UserManager", "Password for user '" << username << "' changed successfully.");
     return ChangePasswordResult::SUCCESS;
 }
 
 UserManager::ChangePasswordResult UserManager::updatePassword(const string &username, const string &newPassword)
 {
-    cout << "Attempting to update password for logged-in user: " << username << endl;
+    LOG_INFO("UserManager", "Attempting to update password for logged-in user: " << username);
 
     // 1. 检查用户是否存在（双重保险）
     auto it = users.find(username);
     if (it == users.end())
     {
-        cerr << "Password update failed: User '" << username << "' not found." << endl;
+        LOG_WARN("UserManager", "Password update failed: User '" << username << "' not found.");
         return ChangePasswordResult::USER_NOT_FOUND;
     }
 
     // 2. 检查新密码的合法性
     if (!isPasswordValid(newPassword))
     {
-        cerr << "Password update failed: New password does not meet complexity requirements." << endl;
+        LOG_WARN("UserManager", "Password update failed: New password does not meet complexity requirements.");
         return ChangePasswordResult::INVALID_PASSWORD;
     }
 
@@ -159,20 +184,20 @@ UserManager::ChangePasswordResult UserManager::updatePassword(const string &user
     // 4. 保存到文件
     saveUsers();
 
-    cout << "Password for user '" << username << "' updated successfully." << endl;
+    LOG_INFO("UserManager", "Password for user '" << username << "' updated successfully.");
     return ChangePasswordResult::SUCCESS;
 }
 
 UserManager::DeleteResult UserManager::deleteUser(const string &username)
 {
-    cout << "Attempting to delete user: " << username << endl;
+    LOG_INFO("UserManager", "Attempting to delete user: " << username);
 
     // 1. 先检查用户是否存在于内存中
     auto it = users.find(username);
     if (it == users.end())
     {
         // 如果内存中不存在，也尝试删除文件以防万一，但报告操作失败
-        cerr << "Deletion failed: User '" << username << "' not found in map." << endl;
+        LOG_WARN("UserManager", "Deletion failed: User '" << username << "' not found in map.");
         string task_file = username + "_tasks.dat";
         remove(task_file.c_str()); // 清理可能存在的孤立文件
         return DeleteResult::FAILURE;
@@ -180,7 +205,7 @@ UserManager::DeleteResult UserManager::deleteUser(const string &username)
 
     // 2. 如果存在，则从内存的map中擦除
     users.erase(it);
-    cout << "User '" << username << "' erased from memory map." << endl;
+    LOG_INFO("UserManager", "User '" << username << "' erased from memory map.");
 
     // 3. 重写整个用户文件，此时被删除的用户已不在map中
     saveUsers();
@@ -193,17 +218,18 @@ UserManager::DeleteResult UserManager::deleteUser(const string &username)
         perror(("Info: Could not remove task file " + task_file).c_str());
     }
 
-    cout << "User '" << username << "' and associated data deleted successfully." << endl;
+    LOG_INFO("UserManager", "User '" << username << "' and associated data deleted successfully.");
     return DeleteResult::SUCCESS;
 }
 
 void UserManager::loadUsers()
 {
+    Metrics::ScopedTimer timer(metrics().load_time);
     ifstream file(users_file);
     if (!file.is_open())
     {
-        cerr << "Could not open users file: " << users_file
-             << ". It will be created upon first user registration." << endl;
+        LOG_WARN("UserManager", "Could not open users file: " << users_file
+                                                              << ". It will be created upon first user registration.");
         return;
     }
 
@@ -218,15 +244,17 @@ void UserManager::loadUsers()
         }
     }
     file.close();
-    cout << "Loaded " << users.size() << " users from " << users_file << endl;
+    metrics().user_count.set(static_cast<int64_t>(users.size()));
+    LOG_INFO("UserManager", "Loaded " << users.size() << " users from " << users_file);
 }
 
 void UserManager::saveUsers()
 {
+    Metrics::ScopedTimer timer(metrics().save_time);
     ofstream file(users_file, ios::out | ios::trunc);
     if (!file.is_open())
     {
-        cerr << "Error: Could not open users file for writing: " << users_file << endl;
+        LOG_ERROR("UserManager", "Error: Could not open users file for writing: " << users_file);
         return;
     }
 
@@ -235,5 +263,6 @@ void UserManager::saveUsers()
         file << pair.first << " " << pair.second << endl;
     }
     file.close();
-    cout << "Saved " << users.size() << " users to " << users_file << endl;
+    metrics().user_count.set(static_cast<int64_t>(users.size()));
+    LOG_INFO("UserManager", "Saved " << users.size() << " users to " << users_file);
 }
\ No newline at end of file
@@ -0,0 +1,340 @@
+#include "WeekTimelineView.h"
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <utility>
+
+using namespace std;
+
+WeekTimelineView::WeekTimelineView()
+{
+    add_events(Gdk::BUTTON_PRESS_MASK);
+    set_hexpand(true);
+    set_size_request(-1, kHourHeight * 24);
+    m_days.resize(7);
+}
+
+void WeekTimelineView::layout_day(vector<Block> &blocks, time_t start_of_day)
+{
+    for (auto &block : blocks)
+    {
+        block.start_sec = static_cast<int>(clamp<time_t>(block.display_start - start_of_day, 0, 86400));
+        block.end_sec = block.continues_next_day
+                            ? 86400
+                            : static_cast<int>(clamp<time_t>(block.display_end - start_of_day, 0, 86400));
+        // 零长度占位或极短任务按最小高度参与布局，保证绘制时不会相互覆盖
+        block.end_sec = max(block.end_sec, min(block.start_sec + kMinBlockSeconds, 86400));
+        if (block.end_sec <= block.start_sec)
+            block.start_sec = block.end_sec - kMinBlockSeconds;
+    }
+
+    // 按开始时间排序，开始相同则长的在前，使长任务占据靠左的列
+    sort(blocks.begin(), blocks.end(), [](const Block &a, const Block &b)
+         {
+             if (a.start_sec != b.start_sec)
+                 return a.start_sec < b.start_sec;
+             if (a.end_sec != b.end_sec)
+                 return a.end_sec > b.end_sec;
+             return a.id < b.id; });
+
+    // 正在占用的列：(结束秒数, 列号) 的小顶堆；已释放的列号也用小顶堆，保证总是复用最左侧的空列
+    using ActiveColumn = pair<int, int>;
+    priority_queue<ActiveColumn, vector<ActiveColumn>, greater<ActiveColumn>> active;
+    priority_queue<int, vector<int>, greater<int>> free_columns;
+    size_t cluster_begin = 0;
+    int cluster_end = -1;
+    int cluster_columns = 0;
+
+    auto close_cluster = [&](size_t cluster_finish)
+    {
+        for (size_t k = cluster_begin; k < cluster_finish; ++k)
+            blocks[k].column_count = cluster_columns;
+    };
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        Block &block = blocks[i];
+
+        // 与当前簇不再重叠：结束上一个簇，所有列全部释放
+        if (block.start_sec >= cluster_end)
+        {
+            close_cluster(i);
+            cluster_begin = i;
+            cluster_columns = 0;
+            active = {};
+            free_columns = {};
+        }
+
+        // 释放在本任务开始之前已经结束的列
+        while (!active.empty() && active.top().first <= block.start_sec)
+        {
+            free_columns.push(active.top().second);
+            active.pop();
+        }
+
+        if (!free_columns.empty())
+        {
+            block.column = free_columns.top();
+            free_columns.pop();
+        }
+        else
+        {
+            block.column = cluster_columns++;
+        }
+        active.push({block.end_sec, block.column});
+        cluster_end = max(cluster_end, block.end_sec);
+    }
+    close_cluster(blocks.size());
+}
+
+// 两组任务块的布局与显示内容是否完全一致
+bool WeekTimelineView::same_blocks(const vector<Block> &a, const vector<Block> &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        const Block &x = a[i];
+        const Block &y = b[i];
+        if (x.id != y.id || x.start_sec != y.start_sec || x.end_sec != y.end_sec ||
+            x.column != y.column || x.column_count != y.column_count || x.priority != y.priority ||
+            x.has_conflict != y.has_conflict || x.is_highest_priority_in_conflict != y.is_highest_priority_in_conflict ||
+            x.label != y.label)
+            return false;
+    }
+    return true;
+}
+
+void WeekTimelineView::set_week(time_t week_start, vector<vector<Block>> days)
+{
+    days.resize(7);
+
+    time_t day_starts[7];
+    tm day_tm = *localtime(&week_start);
+    day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
+    for (int d = 0; d < 7; ++d)
+    {
+        tm current = day_tm;
+        current.tm_mday += d;
+        day_starts[d] = mktime(&current);
+        layout_day(days[d], day_starts[d]);
+    }
+
+    bool week_changed = (day_starts[0] != m_day_starts[0]);
+    for (int d = 0; d < 7; ++d)
+    {
+        if (week_changed || !same_blocks(days[d], m_days[d]))
+        {
+            m_days[d] = move(days[d]);
+            if (!week_changed)
+                queue_draw_day(d);
+        }
+        m_day_starts[d] = day_starts[d];
+    }
+    m_week_start = day_starts[0];
+
+    if (week_changed)
+        queue_draw();
+}
+
+void WeekTimelineView::set_selected_day(time_t day_time)
+{
+    tm day_tm = *localtime(&day_time);
+    day_tm.tm_hour = day_tm.tm_min = day_tm.tm_sec = 0;
+    time_t day = mktime(&day_tm);
+    if (day == m_selected_day)
+        return;
+
+    for (int d = 0; d < 7; ++d)
+    {
+        if (m_day_starts[d] == m_selected_day || m_day_starts[d] == day)
+            queue_draw_day(d);
+    }
+    m_selected_day = day;
+}
+
+double WeekTimelineView::day_column_width() const
+{
+    return max(1.0, (get_allocated_width() - kGutterWidth) / 7.0);
+}
+
+Gdk::Rectangle WeekTimelineView::day_column_rect(int day) const
+{
+    double width = day_column_width();
+    int x = kGutterWidth + static_cast<int>(day * width);
+    int next_x = kGutterWidth + static_cast<int>((day + 1) * width);
+    return Gdk::Rectangle(x, 0, next_x - x + 1, get_allocated_height());
+}
+
+Gdk::Rectangle WeekTimelineView::block_rect(int day, const Block &block) const
+{
+    double width = day_column_width();
+    double column_width = width / max(1, block.column_count);
+    double x = kGutterWidth + day * width + block.column * column_width;
+    double y = block.start_sec * kHourHeight / 3600.0;
+    double height = (block.end_sec - block.start_sec) * kHourHeight / 3600.0;
+    return Gdk::Rectangle(static_cast<int>(x) + 1, static_cast<int>(y) + 1,
+                          max(1, static_cast<int>(column_width) - 2), max(1, static_cast<int>(height) - 2));
+}
+
+// 只让某一天所在的列失效，其余区域保持不动
+void WeekTimelineView::queue_draw_day(int day)
+{
+    if (day < 0 || day >= 7 || !get_realized())
+        return;
+    Gdk::Rectangle rect = day_column_rect(day);
+    queue_draw_area(rect.get_x(), rect.get_y(), rect.get_width(), rect.get_height());
+}
+
+int WeekTimelineView::day_index_at(double x) const
+{
+    if (x < kGutterWidth)
+        return -1;
+    int day = static_cast<int>((x - kGutterWidth) / day_column_width());
+    return (day >= 0 && day < 7) ? day : -1;
+}
+
+bool WeekTimelineView::on_draw(const Cairo::RefPtr<Cairo::Context> &cr)
+{
+    const int width = get_allocated_width();
+    const int height = get_allocated_height();
+
+    // 只绘制与失效区域相交的部分
+    double clip_x1, clip_y1, clip_x2, clip_y2;
+    cr->get_clip_extents(clip_x1, clip_y1, clip_x2, clip_y2);
+
+    auto style = get_style_context();
+    Gdk::RGBA fg = style->get_color(style->get_state());
+
+    if (!m_layout)
+        m_layout = create_pango_layout("");
+
+    // 1. 选中日期列的底色
+    for (int d = 0; d < 7; ++d)
+    {
+        if (m_day_starts[d] != m_selected_day)
+            continue;
+        Gdk::Rectangle rect = day_column_rect(d);
+        cr->set_source_rgba(fg.get_red(), fg.get_green(), fg.get_blue(), 0.06);
+        cr->rectangle(rect.get_x(), rect.get_y(), rect.get_width(), rect.get_height());
+        cr->fill();
+    }
+
+    // 2. 小时网格线和刻度
+    cr->set_line_width(1.0);
+    int first_hour = max(0, static_cast<int>(clip_y1) / kHourHeight);
+    int last_hour = min(24, static_cast<int>(clip_y2) / kHourHeight + 1);
+    for (int hour = first_hour; hour <= last_hour; ++hour)
+    {
+        double y = hour * kHourHeight + 0.5;
+        cr->set_source_rgba(fg.get_red(), fg.get_green(), fg.get_blue(), 0.15);
+        cr->move_to(kGutterWidth, y);
+        cr->line_to(width, y);
+        cr->stroke();
+
+        if (hour < 24 && clip_x1 < kGutterWidth)
+        {
+            char hour_buf[6];
+            snprintf(hour_buf, sizeof(hour_buf), "%02d:00", hour);
+            m_layout->set_text(hour_buf);
+            cr->set_source_rgba(fg.get_red(), fg.get_green(), fg.get_blue(), 0.6);
+            cr->move_to(4, hour * kHourHeight + 2);
+            m_layout->show_in_cairo_context(cr);
+        }
+    }
+    for (int d = 0; d <= 7; ++d)
+    {
+        double x = kGutterWidth + static_cast<int>(d * day_column_width()) + 0.5;
+        if (x < clip_x1 - 1 || x > clip_x2 + 1)
+            continue;
+        cr->set_source_rgba(fg.get_red(), fg.get_green(), fg.get_blue(), 0.15);
+        cr->move_to(x, 0);
+        cr->line_to(x, height);
+        cr->stroke();
+    }
+
+    // 3. 任务色块
+    for (int d = 0; d < 7; ++d)
+    {
+        Gdk::Rectangle column = day_column_rect(d);
+        if (column.get_x() > clip_x2 || column.get_x() + column.get_width() < clip_x1)
+            continue;
+
+        for (const auto &block : m_days[d])
+        {
+            Gdk::Rectangle rect = block_rect(d, block);
+            // 任务块按开始时间有序，越过失效区域底部即可结束
+            if (rect.get_y() > clip_y2)
+                break;
+            if (rect.get_y() + rect.get_height() < clip_y1)
+                continue;
+
+            switch (block.priority)
+            {
+            case Priority::HIGH:
+                cr->set_source_rgba(0.83, 0.18, 0.18, 0.75);
+                break;
+            case Priority::MEDIUM:
+                cr->set_source_rgba(0.21, 0.52, 0.89, 0.75);
+                break;
+            case Priority::LOW:
+                cr->set_source_rgba(0.30, 0.69, 0.31, 0.75);
+                break;
+            }
+            cr->rectangle(rect.get_x(), rect.get_y(), rect.get_width(), rect.get_height());
+            cr->fill();
+
+            // 冲突组中的最高优先级任务加描边
+            if (block.has_conflict && block.is_highest_priority_in_conflict)
+            {
+                cr->set_source_rgb(0.83, 0.18, 0.18);
+                cr->set_line_width(2.0);
+                cr->rectangle(rect.get_x() + 1, rect.get_y() + 1, rect.get_width() - 2, rect.get_height() - 2);
+                cr->stroke();
+                cr->set_line_width(1.0);
+            }
+
+            // 色块太小时不绘制文字，文字排版是绘制中开销最大的部分
+            if (rect.get_height() >= 14 && rect.get_width() >= 24)
+            {
+                cr->save();
+                cr->rectangle(rect.get_x(), rect.get_y(), rect.get_width(), rect.get_height());
+                cr->clip();
+                m_layout->set_text(block.label);
+                cr->set_source_rgb(1.0, 1.0, 1.0);
+                cr->move_to(rect.get_x() + 3, rect.get_y() + 1);
+                m_layout->show_in_cairo_context(cr);
+                cr->restore();
+            }
+        }
+    }
+    return true;
+}
+
+bool WeekTimelineView::on_button_press_event(GdkEventButton *event)
+{
+    int day = day_index_at(event->x);
+    if (day < 0)
+        return false;
+
+    // 从后往前查找，与绘制顺序相反，保证命中最上层的色块
+    const auto &blocks = m_days[day];
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it)
+    {
+        Gdk::Rectangle rect = block_rect(day, *it);
+        if (event->x >= rect.get_x() && event->x < rect.get_x() + rect.get_width() &&
+            event->y >= rect.get_y() && event->y < rect.get_y() + rect.get_height())
+        {
+            return m_signal_block_pressed.emit(event, it->id, m_day_starts[day]);
+        }
+    }
+
+    // 空白处：换算为点击位置的时间，按半小时取整
+    int half_hours = clamp(static_cast<int>(event->y / (kHourHeight / 2.0)), 0, 47);
+    tm clicked_tm = *localtime(&m_day_starts[day]);
+    clicked_tm.tm_hour = half_hours / 2;
+    clicked_tm.tm_min = (half_hours % 2) * 30;
+    clicked_tm.tm_sec = 0;
+    return m_signal_empty_pressed.emit(event, mktime(&clicked_tm));
+}
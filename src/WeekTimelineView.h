@@ -0,0 +1,74 @@
+#pragma once
+
+#include <gtkmm.h>
+#include "Task.h"
+#include <ctime>
+#include <string>
+#include <vector>
+
+// 周视图的 7×24 小时时间轴控件
+// 任务按时间绘制为色块，相互重叠的任务在同一簇内并排分列显示
+class WeekTimelineView : public Gtk::DrawingArea
+{
+public:
+    // 时间轴上的一个任务块（由 SchedulerApp 根据当天的任务片段生成）
+    struct Block
+    {
+        long long id = -1;
+        string label;
+        time_t display_start = 0; // 在当天显示的开始时间
+        time_t display_end = 0;   // 在当天显示的结束时间
+        bool continues_next_day = false; // 任务延续到次日，色块画到 24:00
+        Priority priority = Priority::MEDIUM;
+        bool has_conflict = false;
+        bool is_highest_priority_in_conflict = false;
+
+        // 以下字段由布局算法填写
+        int start_sec = 0;    // 相对当天 00:00 的秒数
+        int end_sec = 0;      // 相对当天 00:00 的秒数（已按最小显示高度修正）
+        int column = 0;       // 所在列
+        int column_count = 1; // 所在重叠簇的总列数
+    };
+
+    WeekTimelineView();
+
+    // 设置要显示的一周（week_start 为周日 00:00），days 为 7 天各自的任务块
+    // 只有内容发生变化的日期列会被重绘
+    void set_week(time_t week_start, vector<vector<Block>> days);
+    // 设置选中日期，用于高亮对应的日期列
+    void set_selected_day(time_t day_time);
+
+    // 点击任务块：参数为事件、任务ID、所在日期的零点
+    sigc::signal<bool, GdkEventButton *, long long, time_t> &signal_block_pressed() { return m_signal_block_pressed; }
+    // 点击空白区域：参数为事件、点击位置对应的时间（按半小时取整）
+    sigc::signal<bool, GdkEventButton *, time_t> &signal_empty_pressed() { return m_signal_empty_pressed; }
+
+    // 对单日的任务块做分列布局：区间按开始时间排序后贪心分配最小可用列，
+    // 传递重叠的任务组成一个簇，簇内所有任务共享该簇的总列数
+    static void layout_day(vector<Block> &blocks, time_t start_of_day);
+
+protected:
+    bool on_draw(const Cairo::RefPtr<Cairo::Context> &cr) override;
+    bool on_button_press_event(GdkEventButton *event) override;
+
+private:
+    static constexpr int kHourHeight = 48;     // 每小时的像素高度
+    static constexpr int kGutterWidth = 48;    // 左侧小时刻度栏宽度
+    static constexpr int kMinBlockSeconds = 900; // 色块最小显示时长（15 分钟），避免零长度片段不可见
+
+    time_t m_week_start = 0;
+    time_t m_selected_day = 0;
+    time_t m_day_starts[7] = {0};
+    vector<vector<Block>> m_days;
+    Glib::RefPtr<Pango::Layout> m_layout; // 复用的文本布局，避免每个色块重新创建
+
+    double day_column_width() const;
+    Gdk::Rectangle day_column_rect(int day) const;
+    Gdk::Rectangle block_rect(int day, const Block &block) const;
+    void queue_draw_day(int day);
+    static bool same_blocks(const vector<Block> &a, const vector<Block> &b);
+    int day_index_at(double x) const;
+
+    sigc::signal<bool, GdkEventButton *, long long, time_t> m_signal_block_pressed;
+    sigc::signal<bool, GdkEventButton *, time_t> m_signal_empty_pressed;
+};
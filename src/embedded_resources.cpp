@@ -1,5978 +1,32 @@
 #include "embedded_resources.h"
-#include <fstream>
 #include <iostream>
 
-// GTK UI Design XML
-const unsigned char EmbeddedResources::gui_design_xml[] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,
-    0x2e,0x30,0x22,0x20,0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,0x55,0x54,
-    0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,
-    0x72,0x61,0x74,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x67,0x6c,0x61,0x64,0x65,
-    0x20,0x33,0x2e,0x34,0x30,0x2e,0x30,0x20,0x2d,0x2d,0x3e,0x0a,0x3c,0x69,0x6e,0x74,
-    0x65,0x72,0x66,0x61,0x63,0x65,0x3e,0x0a,0x20,0x20,0x3c,0x72,0x65,0x71,0x75,0x69,
-    0x72,0x65,0x73,0x20,0x6c,0x69,0x62,0x3d,0x22,0x67,0x74,0x6b,0x2b,0x22,0x20,0x76,
-    0x65,0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x33,0x2e,0x32,0x34,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x44,0x69,0x61,0x6c,0x6f,0x67,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x61,0x64,0x64,0x5f,0x74,0x61,0x73,0x6b,0x5f,0x64,0x69,0x61,0x6c,0x6f,0x67,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,
-    0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,0x6c,0x65,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,
-    0xe6,0xb7,0xbb,0xe5,0x8a,0xa0,0xe6,0x96,0xb0,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,
-    0x65,0x73,0x69,0x7a,0x61,0x62,0x6c,0x65,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,
-    0x6f,0x64,0x61,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x6e,0x64,0x6f,0x77,
-    0x2d,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,
-    0x72,0x2d,0x6f,0x6e,0x2d,0x70,0x61,0x72,0x65,0x6e,0x74,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x65,0x73,0x74,0x72,
-    0x6f,0x79,0x2d,0x77,0x69,0x74,0x68,0x2d,0x70,0x61,0x72,0x65,0x6e,0x74,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x74,0x79,0x70,0x65,0x2d,0x68,0x69,0x6e,0x74,0x22,0x3e,0x64,
-    0x69,0x61,0x6c,0x6f,0x67,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x20,0x69,0x6e,0x74,0x65,
-    0x72,0x6e,0x61,0x6c,0x2d,0x63,0x68,0x69,0x6c,0x64,0x3d,0x22,0x76,0x62,0x6f,0x78,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x72,0x69,
-    0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,0x74,0x69,0x63,
-    0x61,0x6c,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x32,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x20,0x69,0x6e,0x74,0x65,0x72,
-    0x6e,0x61,0x6c,0x2d,0x63,0x68,0x69,0x6c,0x64,0x3d,0x22,0x61,0x63,0x74,0x69,0x6f,
-    0x6e,0x5f,0x61,0x72,0x65,0x61,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x42,0x6f,0x78,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x73,0x74,0x79,0x6c,
-    0x65,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,
-    0x3d,0x22,0x61,0x64,0x64,0x5f,0x74,0x61,0x73,0x6b,0x5f,0x6f,0x6b,0x5f,0x62,0x75,
-    0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe7,0xa1,0xae,0xe5,0xae,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,
-    0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x61,0x64,0x64,0x5f,
-    0x74,0x61,0x73,0x6b,0x5f,0x63,0x61,0x6e,0x63,0x65,0x6c,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,
-    0x8f,0x96,0xe6,0xb6,0x88,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,
-    0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,
-    0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,
-    0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,
-    0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,
-    0x2d,0x20,0x6e,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3d,0x33,0x20,0x6e,0x2d,
-    0x72,0x6f,0x77,0x73,0x3d,0x38,0x20,0x2d,0x2d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x47,0x72,0x69,0x64,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x73,0x74,
-    0x61,0x72,0x74,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,
-    0x61,0x72,0x67,0x69,0x6e,0x2d,0x65,0x6e,0x64,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x22,
-    0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,
-    0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x72,0x6f,0x77,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,
-    0x3e,0x31,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x75,0x6d,
-    0x6e,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,
-    0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,
-    0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xbb,0xbb,0xe5,0x8a,
-    0xa1,0xe5,0x90,0x8d,0xe7,0xa7,0xb0,0x3a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,
-    0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,
-    0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x74,0x61,0x73,0x6b,0x5f,0x6e,0x61,0x6d,0x65,0x5f,0x65,0x6e,
-    0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x78,0x70,0x61,0x6e,
-    0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,
-    0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,
-    0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,
-    0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0xbc,0x80,0xe5,0xa7,0x8b,0xe6,0x97,0xb6,0xe9,
-    0x97,0xb4,0x3a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,
-    0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x74,0x61,0x73,0x6b,0x5f,0x73,0x74,0x61,0x72,0x74,0x5f,0x74,0x69,0x6d,0x65,0x5f,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,
-    0x73,0x22,0x3e,0xe9,0x80,0x89,0xe6,0x8b,0xa9,0xe5,0xbc,0x80,0xe5,0xa7,0x8b,0xe6,
-    0x97,0xb6,0xe9,0x97,0xb4,0x2e,0x2e,0x2e,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,
-    0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,
-    0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,
-    0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,
-    0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x8c,
-    0x81,0xe7,0xbb,0xad,0xe6,0x97,0xb6,0xe9,0x97,0xb4,0x3a,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,
-    0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x32,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,
-    0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x53,0x70,0x69,0x6e,0x42,0x75,0x74,
-    0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x61,0x73,0x6b,0x5f,0x64,0x75,
-    0x72,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x70,0x69,0x6e,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,
-    0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,
-    0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x88,0x86,0xe9,0x92,0x9f,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,
-    0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,
-    0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,
-    0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,
-    0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,
-    0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0xbb,0x93,
-    0xe6,0x9d,0x9f,0xe6,0x97,0xb6,0xe9,0x97,0xb4,0x3a,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,
-    0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x33,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x61,0x73,0x6b,0x5f,0x65,0x6e,0x64,0x5f,0x74,
-    0x69,0x6d,0x65,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x73,0x74,0x61,0x72,0x74,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,
-    0x65,0x73,0x22,0x3e,0x5b,0xe8,0x87,0xaa,0xe5,0x8a,0xa8,0xe8,0xae,0xa1,0xe7,0xae,
-    0x97,0x5d,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,
-    0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,
-    0x63,0x68,0x22,0x3e,0x33,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe4,0xbc,0x98,0xe5,0x85,0x88,0xe7,0xba,0xa7,0x3a,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,
-    0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x34,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x43,0x6f,0x6d,0x62,
-    0x6f,0x42,0x6f,0x78,0x54,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x61,
-    0x73,0x6b,0x5f,0x70,0x72,0x69,0x6f,0x72,0x69,0x74,0x79,0x5f,0x63,0x6f,0x6d,0x62,
-    0x6f,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x61,0x63,0x74,0x69,0x76,0x65,0x22,
-    0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,
-    0x74,0x65,0x6d,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe9,0xab,0x98,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,
-    0x74,0x65,0x6d,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xb8,0xad,0x3c,0x2f,0x69,0x74,0x65,0x6d,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,
-    0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xbd,0x8e,
-    0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x73,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,
-    0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x34,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,
-    0x65,0x73,0x22,0x3e,0xe5,0x88,0x86,0xe7,0xb1,0xbb,0x3a,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,
-    0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x35,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x43,0x6f,0x6d,0x62,
-    0x6f,0x42,0x6f,0x78,0x54,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x61,
-    0x73,0x6b,0x5f,0x63,0x61,0x74,0x65,0x67,0x6f,0x72,0x79,0x5f,0x63,0x6f,0x6d,0x62,
-    0x6f,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x61,0x63,0x74,0x69,0x76,0x65,0x22,
-    0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,
-    0x74,0x65,0x6d,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe5,0xad,0xa6,0xe4,0xb9,0xa0,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,
-    0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0xa8,0xb1,0xe4,0xb9,0x90,
-    0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,
-    0x73,0x22,0x3e,0xe7,0x94,0x9f,0xe6,0xb4,0xbb,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,0x64,0x3d,0x22,0x63,0x61,0x74,
-    0x65,0x67,0x6f,0x72,0x79,0x5f,0x6f,0x74,0x68,0x65,0x72,0x5f,0x69,0x74,0x65,0x6d,
-    0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,
-    0x79,0x65,0x73,0x22,0x3e,0xe5,0x85,0xb6,0xe4,0xbb,0x96,0x2e,0x2e,0x2e,0x3c,0x2f,
-    0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x73,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,
-    0x61,0x63,0x68,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,
-    0x61,0x73,0x6b,0x5f,0x63,0x75,0x73,0x74,0x6f,0x6d,0x5f,0x63,0x61,0x74,0x65,0x67,
-    0x6f,0x72,0x79,0x5f,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6e,0x6f,0x2d,0x73,0x68,0x6f,0x77,0x2d,0x61,
-    0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2d,
-    0x74,0x65,0x78,0x74,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe8,0xaf,0xb7,0xe8,0xbe,0x93,0xe5,
-    0x85,0xa5,0xe8,0x87,0xaa,0xe5,0xae,0x9a,0xe4,0xb9,0x89,0xe5,0x88,0x86,0xe7,0xb1,
-    0xbb,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,
-    0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,
-    0x68,0x22,0x3e,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,
-    0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,
-    0xe6,0x8f,0x90,0xe5,0x89,0x8d,0xe6,0x8f,0x90,0xe9,0x86,0x92,0x3a,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x37,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x43,0x6f,
-    0x6d,0x62,0x6f,0x42,0x6f,0x78,0x54,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x74,0x61,0x73,0x6b,0x5f,0x72,0x65,0x6d,0x69,0x6e,0x64,0x65,0x72,0x5f,0x63,0x6f,
-    0x6d,0x62,0x6f,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x73,0x2d,0x65,
-    0x6e,0x74,0x72,0x79,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x73,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x6d,0x69,0x6e,0x64,
-    0x5f,0x6e,0x6f,0x6e,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,
-    0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xb8,0x8d,0xe6,0x8f,0x90,
-    0xe9,0x86,0x92,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,
-    0x65,0x6d,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x6d,0x69,0x6e,0x64,0x5f,0x35,0x6d,
-    0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,
-    0x79,0x65,0x73,0x22,0x3e,0x35,0xe5,0x88,0x86,0xe9,0x92,0x9f,0xe5,0x89,0x8d,0x3c,
-    0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,
-    0x64,0x3d,0x22,0x72,0x65,0x6d,0x69,0x6e,0x64,0x5f,0x31,0x30,0x6d,0x22,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,
-    0x22,0x3e,0x31,0x30,0xe5,0x88,0x86,0xe9,0x92,0x9f,0xe5,0x89,0x8d,0x3c,0x2f,0x69,
-    0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,0x64,0x3d,
-    0x22,0x72,0x65,0x6d,0x69,0x6e,0x64,0x5f,0x33,0x30,0x6d,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,
-    0x33,0x30,0xe5,0x88,0x86,0xe9,0x92,0x9f,0xe5,0x89,0x8d,0x3c,0x2f,0x69,0x74,0x65,
-    0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,0x64,0x3d,0x22,0x72,
-    0x65,0x6d,0x69,0x6e,0x64,0x5f,0x31,0x68,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,
-    0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0x31,0xe5,0xb0,
-    0x8f,0xe6,0x97,0xb6,0xe5,0x89,0x8d,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x69,0x74,0x65,0x6d,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x6d,0x69,0x6e,
-    0x64,0x5f,0x31,0x64,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0x31,0xe5,0xa4,0xa9,0xe5,0x89,0x8d,
-    0x3c,0x2f,0x69,0x74,0x65,0x6d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x69,0x74,0x65,0x6d,0x73,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x20,0x69,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,
-    0x2d,0x63,0x68,0x69,0x6c,0x64,0x3d,0x22,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,
-    0x61,0x73,0x6b,0x5f,0x72,0x65,0x6d,0x69,0x6e,0x64,0x65,0x72,0x5f,0x65,0x6e,0x74,
-    0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x37,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,
-    0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,
-    0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,
-    0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,
-    0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,
-    0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,
-    0x77,0x69,0x6e,0x64,0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,
-    0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x33,0x38,0x30,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,
-    0x69,0x74,0x6c,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x97,0xa5,0x20,0xe7,0xa8,0x8b,
-    0x20,0xe7,0xae,0xa1,0x20,0xe7,0x90,0x86,0x20,0xe7,0xb3,0xbb,0x20,0xe7,0xbb,0x9f,
-    0x20,0x2d,0x20,0xe4,0xbf,0xae,0x20,0xe6,0x94,0xb9,0x20,0xe5,0xaf,0x86,0x20,0xe7,
-    0xa0,0x81,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x72,0x65,0x73,0x69,0x7a,0x61,0x62,0x6c,0x65,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2d,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x63,0x65,
-    0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x64,0x65,0x73,0x74,0x72,0x6f,0x79,0x2d,0x77,0x69,0x74,0x68,
-    0x2d,0x70,0x61,0x72,0x65,0x6e,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,
-    0x6e,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3d,0x33,0x20,0x6e,0x2d,0x72,0x6f,
-    0x77,0x73,0x3d,0x35,0x20,0x2d,0x2d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x47,0x72,0x69,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x73,0x74,0x61,0x72,
-    0x74,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
-    0x65,0x6e,0x64,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,
-    0x6e,0x2d,0x74,0x6f,0x70,0x22,0x3e,0x31,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,
-    0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x22,0x3e,0x31,0x35,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x72,0x6f,0x77,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x31,
-    0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x2d,0x73,0x70,0x61,0x63,
-    0x69,0x6e,0x67,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,
-    0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,
-    0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0x94,0xa8,
-    0xe6,0x88,0xb7,0xe5,0x90,0x8d,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,
-    0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x63,0x70,0x5f,0x75,0x73,0x65,0x72,0x6e,0x61,0x6d,0x65,
-    0x5f,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x68,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,
-    0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,
-    0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,
-    0x61,0x62,0x65,0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x70,0x5f,0x6f,0x6c,0x64,
-    0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,
-    0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,
-    0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,
-    0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x8e,0x9f,0xe5,0xaf,0x86,0xe7,0xa0,
-    0x81,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,
-    0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x63,0x70,0x5f,0x6f,0x6c,0x64,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,
-    0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,
-    0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,
-    0xe6,0x96,0xb0,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,
-    0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x32,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,
-    0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x70,0x5f,0x6e,0x65,0x77,0x5f,0x70,
-    0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,
-    0x74,0x79,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,
-    0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,
-    0x6e,0x22,0x3e,0x65,0x6e,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,
-    0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,
-    0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0xa1,0xae,0xe8,0xae,0xa4,0xe6,0x96,
-    0xb0,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,
-    0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x33,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x70,0x5f,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,
-    0x5f,0x6e,0x65,0x77,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x65,0x6e,
-    0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,
-    0x3e,0x33,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x70,0x5f,0x63,
-    0x6f,0x6e,0x66,0x69,0x72,0x6d,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,
-    0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0xa1,0xae,0xe8,0xae,0xa4,0xe4,0xbf,0xae,0xe6,
-    0x94,0xb9,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,
-    0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x31,0x32,0x31,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,
-    0x73,0x74,0x22,0x3e,0x33,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,
-    0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,
-    0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,
-    0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,
-    0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x34,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x22,0x3e,0x32,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,
-    0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,
-    0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,
-    0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x4d,0x65,0x6e,0x75,0x22,0x20,0x69,0x64,0x3d,0x22,0x65,0x6d,0x70,0x74,0x79,0x5f,
-    0x73,0x70,0x61,0x63,0x65,0x5f,0x63,0x6f,0x6e,0x74,0x65,0x78,0x74,0x5f,0x6d,0x65,
-    0x6e,0x75,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,
-    0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x63,0x74,0x78,0x5f,0x6d,0x65,0x6e,0x75,0x5f,0x61,0x64,0x64,
-    0x5f,0x74,0x61,0x73,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,
-    0xb7,0xbb,0xe5,0x8a,0xa0,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x54,0x65,0x78,0x74,0x42,0x75,0x66,0x66,0x65,0x72,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x68,0x65,0x6c,0x70,0x5f,0x74,0x65,0x78,0x74,0x5f,0x62,0x75,
-    0x66,0x66,0x65,0x72,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,
-    0x65,0x73,0x22,0x3e,0xe8,0xbd,0xaf,0xe4,0xbb,0xb6,0xe5,0x8a,0x9f,0xe8,0x83,0xbd,
-    0xe7,0xae,0x80,0xe4,0xbb,0x8b,0xef,0xbc,0x9a,0x0a,0x31,0x2e,0x20,0xe8,0xb4,0xa6,
-    0xe6,0x88,0xb7,0xe7,0xae,0xa1,0xe7,0x90,0x86,0xef,0xbc,0x9a,0xe6,0x94,0xaf,0xe6,
-    0x8c,0x81,0xe7,0x94,0xa8,0xe6,0x88,0xb7,0xe6,0xb3,0xa8,0xe5,0x86,0x8c,0xe3,0x80,
-    0x81,0xe7,0x99,0xbb,0xe5,0xbd,0x95,0xe3,0x80,0x81,0xe6,0xb3,0xa8,0xe9,0x94,0x80,
-    0xe3,0x80,0x81,0xe4,0xbf,0xae,0xe6,0x94,0xb9,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xe3,
-    0x80,0x81,0xe5,0x88,0xa0,0xe9,0x99,0xa4,0xe8,0xb4,0xa6,0xe6,0x88,0xb7,0xe3,0x80,
-    0x82,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xe4,0xbd,0xbf,0xe7,0x94,0xa8,0x4d,0x44,0x35,
-    0xe5,0x8a,0xa0,0xe5,0xaf,0x86,0xe5,0xad,0x98,0xe5,0x82,0xa8,0xef,0xbc,0x8c,0xe6,
-    0xb3,0xa8,0xe5,0x86,0x8c,0xe5,0x92,0x8c,0xe4,0xbf,0xae,0xe6,0x94,0xb9,0xe5,0xaf,
-    0x86,0xe7,0xa0,0x81,0xe6,0x97,0xb6,0xe6,0x9c,0x89,0xe6,0x9c,0x89,0xe6,0x95,0x88,
-    0xe6,0x80,0xa7,0xe6,0xa0,0xa1,0xe9,0xaa,0x8c,0xe3,0x80,0x82,0x0a,0x32,0x2e,0x20,
-    0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe7,0xae,0xa1,0xe7,0x90,0x86,0xef,0xbc,0x9a,0x0a,
-    0x20,0x20,0x20,0x2d,0x20,0xe6,0xb7,0xbb,0xe5,0x8a,0xa0,0xe4,0xbb,0xbb,0xe5,0x8a,
-    0xa1,0xef,0xbc,0x9a,0xe7,0x82,0xb9,0xe5,0x87,0xbb,0xe4,0xb8,0xbb,0xe7,0x95,0x8c,
-    0xe9,0x9d,0xa2,0xe7,0x9a,0x84,0xe2,0x80,0x9c,0xe6,0xb7,0xbb,0xe5,0x8a,0xa0,0xe4,
-    0xbb,0xbb,0xe5,0x8a,0xa1,0xe2,0x80,0x9d,0xe6,0x8c,0x89,0xe9,0x92,0xae,0xef,0xbc,
-    0x8c,0xe6,0x88,0x96,0xe5,0x9c,0xa8,0xe4,0xb8,0xbb,0xe7,0x95,0x8c,0xe9,0x9d,0xa2,
-    0xe7,0xa9,0xba,0xe7,0x99,0xbd,0xe5,0xa4,0x84,0xe5,0x8f,0xb3,0xe9,0x94,0xae,0xe8,
-    0x8f,0x9c,0xe5,0x8d,0x95,0xe9,0x80,0x89,0xe6,0x8b,0xa9,0xe2,0x80,0x9c,0xe6,0xb7,
-    0xbb,0xe5,0x8a,0xa0,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe2,0x80,0x9d,0xef,0xbc,0x8c,
-    0xe5,0xa1,0xab,0xe5,0x86,0x99,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe8,0xaf,0xa6,0xe6,
-    0x83,0x85,0xe3,0x80,0x82,0x0a,0x20,0x20,0x20,0x2d,0x20,0xe5,0x88,0xa0,0xe9,0x99,
-    0xa4,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xef,0xbc,0x9a,0xe9,0x80,0x89,0xe4,0xb8,0xad,
-    0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe5,0x90,0x8e,0xe7,0x82,0xb9,0xe5,0x87,0xbb,0xe2,
-    0x80,0x9c,0xe5,0x88,0xa0,0xe9,0x99,0xa4,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe2,0x80,
-    0x9d,0xe6,0x88,0x96,0xe5,0x8f,0xb3,0xe9,0x94,0xae,0xe8,0x8f,0x9c,0xe5,0x8d,0x95,
-    0xe3,0x80,0x82,0x0a,0x20,0x20,0x20,0x2d,0x20,0xe4,0xbf,0xae,0xe6,0x94,0xb9,0xe4,
-    0xbb,0xbb,0xe5,0x8a,0xa1,0xef,0xbc,0x9a,0xe5,0x8f,0xb3,0xe9,0x94,0xae,0xe4,0xbb,
-    0xbb,0xe5,0x8a,0xa1,0xe9,0xa1,0xb9,0xe9,0x80,0x89,0xe6,0x8b,0xa9,0xe2,0x80,0x9c,
-    0xe4,0xbf,0xae,0xe6,0x94,0xb9,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe2,0x80,0x9d,0xe6,
-    0x88,0x96,0xe9,0x80,0x9a,0xe8,0xbf,0x87,0xe7,0x9b,0xb8,0xe5,0x85,0xb3,0xe6,0x8c,
-    0x89,0xe9,0x92,0xae,0xe3,0x80,0x82,0x0a,0x20,0x20,0x20,0x2d,0x20,0xe4,0xbb,0xbb,
-    0xe5,0x8a,0xa1,0xe5,0xb1,0x9e,0xe6,0x80,0xa7,0xef,0xbc,0x9a,0xe5,0x8c,0x85,0xe6,
-    0x8b,0xac,0xe5,0x90,0x8d,0xe7,0xa7,0xb0,0xe3,0x80,0x81,0xe5,0xbc,0x80,0xe5,0xa7,
-    0x8b,0xe6,0x97,0xb6,0xe9,0x97,0xb4,0xe3,0x80,0x81,0xe6,0x97,0xb6,0xe9,0x95,0xbf,
-    0xe3,0x80,0x81,0xe4,0xbc,0x98,0xe5,0x85,0x88,0xe7,0xba,0xa7,0xe3,0x80,0x81,0xe5,
-    0x88,0x86,0xe7,0xb1,0xbb,0xe3,0x80,0x81,0xe6,0x8f,0x90,0xe9,0x86,0x92,0xe6,0x97,
-    0xb6,0xe9,0x97,0xb4,0xe3,0x80,0x81,0xe6,0x8f,0x90,0xe9,0x86,0x92,0xe9,0x80,0x89,
-    0xe9,0xa1,0xb9,0xe3,0x80,0x81,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe7,0x8a,0xb6,0xe6,
-    0x80,0x81,0xe3,0x80,0x82,0x0a,0x20,0x20,0x20,0x2d,0x20,0xe4,0xbb,0xbb,0xe5,0x8a,
-    0xa1,0xe6,0x98,0xbe,0xe7,0xa4,0xba,0xef,0xbc,0x9a,0xe6,0x94,0xaf,0xe6,0x8c,0x81,
-    0xe6,0x9c,0x88,0xe8,0xa7,0x86,0xe5,0x9b,0xbe,0xe3,0x80,0x81,0xe5,0x91,0xa8,0xe8,
-    0xa7,0x86,0xe5,0x9b,0xbe,0xe5,0x92,0x8c,0xe6,0x80,0xbb,0xe8,0xa7,0x86,0xe5,0x9b,
-    0xbe,0xe5,0x88,0x87,0xe6,0x8d,0xa2,0xef,0xbc,0x8c,0xe6,0x94,0xaf,0xe6,0x8c,0x81,
-    0xe6,0x97,0xa5,0xe6,0x9c,0x9f,0xe5,0xaf,0xbc,0xe8,0x88,0xaa,0xe5,0x92,0x8c,0xe2,
-    0x80,0x9c,0xe4,0xbb,0x8a,0xe6,0x97,0xa5,0xe2,0x80,0x9d,0xe8,0xb7,0xb3,0xe8,0xbd,
-    0xac,0xe3,0x80,0x82,0x0a,0x33,0x2e,0x20,0xe5,0xa4,0x9a,0xe7,0xba,0xbf,0xe7,0xa8,
-    0x8b,0xe6,0x8f,0x90,0xe9,0x86,0x92,0xef,0xbc,0x9a,0xe5,0x90,0x8e,0xe5,0x8f,0xb0,
-    0xe7,0xba,0xbf,0xe7,0xa8,0x8b,0xe5,0x91,0xa8,0xe6,0x9c,0x9f,0xe6,0x80,0xa7,0xe6,
-    0xa3,0x80,0xe6,0x9f,0xa5,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xef,0xbc,0x8c,0xe5,0x88,
-    0xb0,0xe8,0xbe,0xbe,0xe6,0x8f,0x90,0xe9,0x86,0x92,0xe6,0x97,0xb6,0xe9,0x97,0xb4,
-    0xe8,0x87,0xaa,0xe5,0x8a,0xa8,0xe5,0xbc,0xb9,0xe7,0xaa,0x97,0xe6,0x8f,0x90,0xe9,
-    0x86,0x92,0xe5,0xb9,0xb6,0xe6,0x92,0xad,0xe6,0x94,0xbe,0xe8,0x87,0xaa,0xe5,0xae,
-    0x9a,0xe4,0xb9,0x89,0xe9,0x9f,0xb3,0xe9,0xa2,0x91,0xef,0xbc,0x8c,0xe6,0x94,0xaf,
-    0xe6,0x8c,0x81,0xe8,0x87,0xaa,0xe5,0xae,0x9a,0xe4,0xb9,0x89,0xe6,0x8f,0x90,0xe9,
-    0x86,0x92,0xe6,0x97,0xb6,0xe9,0x97,0xb4,0xe3,0x80,0x82,0x0a,0x34,0x2e,0x20,0xe5,
-    0x90,0x8e,0xe5,0x8f,0xb0,0xe9,0x9d,0x99,0xe9,0xbb,0x98,0xe8,0xbf,0x90,0xe8,0xa1,
-    0x8c,0xef,0xbc,0x9a,0xe6,0x94,0xaf,0xe6,0x8c,0x81,0xe6,0x9c,0x80,0xe5,0xb0,0x8f,
-    0xe5,0x8c,0x96,0xe5,0x88,0xb0,0xe7,0xb3,0xbb,0xe7,0xbb,0x9f,0xe6,0x89,0x98,0xe7,
-    0x9b,0x98,0xef,0xbc,0x8c,0xe6,0x9c,0x80,0xe5,0xb0,0x8f,0xe5,0x8c,0x96,0xe5,0x90,
-    0x8e,0xe4,0xbb,0x8d,0xe7,0x84,0xb6,0xe5,0x85,0xb7,0xe6,0x9c,0x89,0xe6,0x8f,0x90,
-    0xe9,0x86,0x92,0xe5,0x8a,0x9f,0xe8,0x83,0xbd,0xe3,0x80,0x82,0x0a,0x35,0x2e,0x20,
-    0xe6,0x95,0xb0,0xe6,0x8d,0xae,0xe6,0x8c,0x81,0xe4,0xb9,0x85,0xe5,0x8c,0x96,0xef,
-    0xbc,0x9a,0xe6,0x89,0x80,0xe6,0x9c,0x89,0xe7,0x94,0xa8,0xe6,0x88,0xb7,0xe5,0x92,
-    0x8c,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0xe4,0xbf,0xa1,0xe6,0x81,0xaf,0xe5,0x9d,0x87,
-    0xe4,0xbf,0x9d,0xe5,0xad,0x98,0xe5,0x9c,0xa8,0xe6,0x9c,0xac,0xe5,0x9c,0xb0,0xe6,
-    0x96,0x87,0xe4,0xbb,0xb6,0xef,0xbc,0x8c,0xe6,0x94,0xaf,0xe6,0x8c,0x81,0xe5,0xa4,
-    0x9a,0xe7,0x94,0xa8,0xe6,0x88,0xb7,0xe7,0x8b,0xac,0xe7,0xab,0x8b,0xe6,0x95,0xb0,
-    0xe6,0x8d,0xae,0xe3,0x80,0x82,0x0a,0x36,0x2e,0x20,0xe5,0xb8,0xae,0xe5,0x8a,0xa9,
-    0xe8,0xaf,0xb4,0xe6,0x98,0x8e,0xef,0xbc,0x9a,0xe5,0x86,0x85,0xe7,0xbd,0xae,0xe5,
-    0xb8,0xae,0xe5,0x8a,0xa9,0xe7,0xaa,0x97,0xe5,0x8f,0xa3,0xef,0xbc,0x8c,0xe9,0x9a,
-    0x8f,0xe6,0x97,0xb6,0xe6,0x9f,0xa5,0xe7,0x9c,0x8b,0xe8,0xbd,0xaf,0xe4,0xbb,0xb6,
-    0xe4,0xbd,0xbf,0xe7,0x94,0xa8,0xe8,0xaf,0xb4,0xe6,0x98,0x8e,0xe3,0x80,0x82,0x0a,
-    0x37,0x2e,0x20,0xe8,0xae,0xbe,0xe7,0xbd,0xae,0xe5,0x8a,0x9f,0xe8,0x83,0xbd,0xef,
-    0xbc,0x9a,0xe6,0x94,0xaf,0xe6,0x8c,0x81,0xe4,0xbf,0xae,0xe6,0x94,0xb9,0xe5,0xaf,
-    0x86,0xe7,0xa0,0x81,0xe3,0x80,0x81,0xe5,0x88,0xa0,0xe9,0x99,0xa4,0xe8,0xb4,0xa6,
-    0xe6,0x88,0xb7,0xe3,0x80,0x81,0xe6,0xb3,0xa8,0xe9,0x94,0x80,0xe7,0xad,0x89,0xe6,
-    0x93,0x8d,0xe4,0xbd,0x9c,0xe3,0x80,0x82,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x68,0x65,0x6c,0x70,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,
-    0x3e,0x38,0x36,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,
-    0x73,0x74,0x22,0x3e,0x34,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,0x6c,0x65,0x22,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe6,0x97,0xa5,0x20,0xe7,0xa8,0x8b,0x20,0xe7,0xae,0xa1,0x20,0xe7,0x90,0x86,
-    0x20,0xe7,0xb3,0xbb,0x20,0xe7,0xbb,0x9f,0x20,0x2d,0x20,0xe5,0xb8,0xae,0x20,0xe5,
-    0x8a,0xa9,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x6e,
-    0x64,0x6f,0x77,0x2d,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x63,0x65,
-    0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x64,0x65,0x73,0x74,0x72,0x6f,0x79,0x2d,0x77,0x69,0x74,0x68,
-    0x2d,0x70,0x61,0x72,0x65,0x6e,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x6f,0x72,0x69,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,
-    0x74,0x69,0x63,0x61,0x6c,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,
-    0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x53,0x63,0x72,0x6f,0x6c,
-    0x6c,0x65,0x64,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x73,0x74,0x61,0x72,0x74,
-    0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,
-    0x69,0x6e,0x2d,0x65,0x6e,0x64,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x22,0x3e,0x31,0x30,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,
-    0x61,0x72,0x2d,0x70,0x6f,0x6c,0x69,0x63,0x79,0x22,0x3e,0x6e,0x65,0x76,0x65,0x72,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x68,0x61,0x64,0x6f,0x77,0x2d,0x74,
-    0x79,0x70,0x65,0x22,0x3e,0x69,0x6e,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x54,0x65,0x78,0x74,0x56,0x69,0x65,0x77,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x68,0x65,0x6c,0x70,0x5f,0x74,0x65,0x78,0x74,0x5f,0x76,
-    0x69,0x65,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x64,0x69,0x74,0x61,0x62,
-    0x6c,0x65,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x77,0x72,0x61,0x70,0x2d,0x6d,0x6f,0x64,0x65,0x22,0x3e,
-    0x77,0x6f,0x72,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x75,0x72,0x73,0x6f,0x72,0x2d,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x62,0x75,0x66,0x66,0x65,0x72,0x22,0x3e,0x68,0x65,0x6c,0x70,0x5f,0x74,0x65,
-    0x78,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x68,0x65,0x6c,0x70,0x5f,0x63,0x6c,0x6f,0x73,0x65,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x85,0xb3,0xe9,0x97,
-    0xad,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,
-    0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x31,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,
-    0x74,0x22,0x3e,0x32,0x37,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,
-    0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,0x22,0x3e,0x63,
-    0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,
-    0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x22,0x3e,0x31,0x30,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,
-    0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x41,
-    0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x57,0x69,0x6e,0x64,0x6f,0x77,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x6c,0x6f,0x67,0x69,0x6e,0x5f,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,
-    0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x33,0x38,0x30,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,
-    0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x31,0x38,0x30,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,
-    0x74,0x6c,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,
-    0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x97,0xa5,0x20,0xe7,0xa8,0x8b,0x20,
-    0xe7,0xae,0xa1,0x20,0xe7,0x90,0x86,0x20,0xe7,0xb3,0xbb,0x20,0xe7,0xbb,0x9f,0x20,
-    0x2d,0x20,0xe7,0x99,0xbb,0x20,0xe5,0xbd,0x95,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x73,0x69,0x7a,0x61,0x62,
-    0x6c,0x65,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2d,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x46,0x69,0x78,0x65,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,
-    0x65,0x73,0x22,0x3e,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xef,0xbc,0x9a,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x73,0x63,0x61,0x6c,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x31,
-    0x2e,0x32,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x79,0x22,0x3e,0x36,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,
-    0x94,0xa8,0xe6,0x88,0xb7,0xe5,0x90,0x8d,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,
-    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,
-    0x63,0x61,0x6c,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x31,0x2e,0x32,
-    0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x78,0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,
-    0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x6c,0x6f,0x67,
-    0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x6e,0x61,0x6d,0x65,0x5f,0x65,0x6e,0x74,0x72,
-    0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x32,
-    0x33,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,
-    0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x38,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x31,0x34,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x6c,0x6f,0x67,0x69,0x6e,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,
-    0x72,0x64,0x5f,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,
-    0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x33,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,
-    0x3e,0x32,0x38,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,
-    0x79,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,0x75,0x72,0x70,0x6f,0x73,0x65,0x22,0x3e,0x70,
-    0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x31,0x34,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x36,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x6c,0x6f,0x67,0x69,0x6e,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0x99,0xbb,0xe5,0xbd,0x95,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,
-    0x75,0x65,0x73,0x74,0x22,0x3e,0x38,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,
-    0x32,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,
-    0x34,0x37,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x31,0x32,0x39,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x69,
-    0x6e,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x73,0x68,
-    0x6f,0x77,0x5f,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0xb2,0xa1,0xe6,0x9c,
-    0x89,0xe8,0xb4,0xa6,0xe5,0x8f,0xb7,0xef,0xbc,0x9f,0xe5,0x88,0x9b,0xe5,0xbb,0xba,
-    0xe4,0xb8,0x80,0xe4,0xb8,0xaa,0xef,0xbc,0x81,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,
-    0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,
-    0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x32,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x39,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x69,0x6e,0x6b,0x42,0x75,0x74,0x74,0x6f,
-    0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x73,0x68,0x6f,0x77,0x5f,0x63,0x68,0x61,0x6e,
-    0x67,0x65,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xbf,0xae,0xe6,0x94,
-    0xb9,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,
-    0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x38,0x34,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,
-    0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x34,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,
-    0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,
-    0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x32,0x38,0x30,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x39,0x31,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,0x6e,0x75,0x22,0x20,
-    0x69,0x64,0x3d,0x22,0x6d,0x6f,0x72,0x65,0x5f,0x6d,0x65,0x6e,0x75,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x4d,0x65,0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,
-    0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6d,0x69,0x6e,0x69,0x6d,0x69,0x7a,
-    0x65,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x9c,0x80,0xe5,0xb0,
-    0x8f,0xe5,0x8c,0x96,0xe7,0xaa,0x97,0xe5,0x8f,0xa3,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x75,0x73,
-    0x65,0x2d,0x75,0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,
-    0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-    0x5f,0x69,0x74,0x65,0x6d,0x5f,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x70,0x61,0x73,
-    0x73,0x77,0x6f,0x72,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,
-    0xbf,0xae,0xe6,0x94,0xb9,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x75,
-    0x73,0x65,0x2d,0x75,0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,
-    0x65,0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x65,0x6e,
-    0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x6f,0x67,0x6f,0x75,0x74,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,
-    0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0xb3,0xa8,0xe9,0x94,0x80,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x75,0x73,0x65,0x2d,0x75,0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x4d,0x65,0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,
-    0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x68,0x65,0x6c,0x70,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,
-    0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0xb8,0xae,0xe5,0x8a,0xa9,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x75,0x73,0x65,0x2d,0x75,0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x53,0x65,0x70,0x61,0x72,0x61,0x74,0x6f,0x72,0x4d,0x65,0x6e,0x75,0x49,0x74,
-    0x65,0x6d,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,0x6e,0x75,0x49,
-    0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-    0x65,0x6d,0x5f,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x61,0x63,0x63,0x6f,0x75,0x6e,
-    0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x88,0xa0,0xe9,0x99,
-    0xa4,0xe8,0xb4,0xa6,0xe6,0x88,0xb7,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x75,0x73,0x65,0x2d,0x75,
-    0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x41,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x61,
-    0x69,0x6e,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x74,0x69,0x74,0x6c,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,
-    0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x88,0x91,0x20,0xe7,0x9a,
-    0x84,0x20,0xe6,0x97,0xa5,0x20,0xe5,0x8e,0x86,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2d,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x2d,0x77,0x69,0x64,0x74,0x68,0x22,0x3e,0x39,
-    0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,
-    0x22,0x3e,0x37,0x35,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x72,0x69,0x65,0x6e,0x74,0x61,0x74,
-    0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x20,0x69,0x64,0x3d,0x22,0x64,0x61,0x74,0x65,
-    0x5f,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x6f,0x78,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,
-    0x6e,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x64,
-    0x61,0x74,0x65,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0x32,0x30,0x32,0x35,0x20,
-    0xe5,0xb9,0xb4,0x20,0x37,0x20,0xe6,0x9c,0x88,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x77,0x65,0x69,0x67,0x68,0x74,0x22,0x20,0x76,0x61,0x6c,
-    0x75,0x65,0x3d,0x22,0x62,0x6f,0x6c,0x64,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x74,
-    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,
-    0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x70,0x72,
-    0x65,0x76,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x49,0x6d,0x61,0x67,0x65,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x69,
-    0x63,0x6f,0x6e,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x70,0x61,0x6e,0x2d,0x73,0x74,
-    0x61,0x72,0x74,0x2d,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x69,0x63,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,
-    0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x6e,0x65,0x78,0x74,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,
-    0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,
-    0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x49,0x6d,0x61,0x67,0x65,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x70,0x61,0x6e,
-    0x2d,0x65,0x6e,0x64,0x2d,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x69,0x63,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,
-    0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x68,0x6f,0x6d,0x6f,0x67,0x65,0x6e,0x65,0x6f,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,
-    0x3d,0x22,0x6d,0x6f,0x6e,0x74,0x68,0x5f,0x76,0x69,0x65,0x77,0x5f,0x62,0x75,0x74,
-    0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,
-    0xe6,0x9c,0x88,0xe8,0xa7,0x86,0xe5,0x9b,0xbe,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,
-    0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,
-    0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x76,0x69,0x65,0x77,0x5f,
-    0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,
-    0x73,0x22,0x3e,0xe5,0x91,0xa8,0xe8,0xa7,0x86,0xe5,0x9b,0xbe,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,
-    0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,
-    0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,
-    0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,
-    0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x61,0x67,0x65,0x6e,0x64,0x61,0x5f,
-    0x76,0x69,0x65,0x77,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,
-    0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,
-    0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x97,0xa5,0xe7,0xa8,0x8b,0xe5,0x88,
-    0x97,0xe8,0xa1,0xa8,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,
-    0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,
-    0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,
-    0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x53,0x74,0x61,0x63,0x6b,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x6d,0x61,0x69,0x6e,0x5f,0x73,0x74,0x61,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x73,0x74,0x61,
-    0x72,0x74,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,
-    0x67,0x69,0x6e,0x2d,0x65,0x6e,0x64,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x68,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x72,0x61,0x6e,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2d,0x74,0x79,0x70,0x65,0x22,0x3e,0x73,0x6c,0x69,
-    0x64,0x65,0x2d,0x6c,0x65,0x66,0x74,0x2d,0x72,0x69,0x67,0x68,0x74,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x50,0x61,0x6e,
-    0x65,0x64,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,0x6e,0x74,0x68,0x5f,0x76,0x69,
-    0x65,0x77,0x5f,0x70,0x61,0x6e,0x65,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x72,
-    0x69,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,0x74,0x69,
-    0x63,0x61,0x6c,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x33,0x30,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x72,0x69,0x65,0x6e,
-    0x74,0x61,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,
-    0x2d,0x2d,0x20,0x6e,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3d,0x33,0x20,0x6e,
-    0x2d,0x72,0x6f,0x77,0x73,0x3d,0x33,0x20,0x2d,0x2d,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x47,0x72,0x69,0x64,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,
-    0x6e,0x74,0x68,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x67,0x72,0x69,0x64,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x6f,0x6c,0x75,0x6d,0x6e,0x2d,0x68,0x6f,0x6d,0x6f,0x67,0x65,0x6e,0x65,0x6f,0x75,
-    0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,
-    0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,
-    0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,
-    0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,
-    0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,
-    0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,
-    0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,
-    0x6e,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3d,0x33,0x20,0x6e,0x2d,0x72,0x6f,
-    0x77,0x73,0x3d,0x33,0x20,0x2d,0x2d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x47,0x72,0x69,0x64,0x22,0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,0x6e,0x74,0x68,
-    0x5f,0x76,0x69,0x65,0x77,0x5f,0x67,0x72,0x69,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,
-    0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x78,0x70,0x61,0x6e,
-    0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x65,0x78,0x70,0x61,
-    0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x6f,0x77,0x2d,
-    0x68,0x6f,0x6d,0x6f,0x67,0x65,0x6e,0x65,0x6f,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x2d,0x68,0x6f,0x6d,0x6f,
-    0x67,0x65,0x6e,0x65,0x6f,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,
-    0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,
-    0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,
-    0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,
-    0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,
-    0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,
-    0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x73,0x69,0x7a,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x68,0x72,0x69,0x6e,0x6b,0x22,0x3e,0x46,0x61,
-    0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x65,0x64,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x6d,0x6f,0x6e,0x74,0x68,0x5f,0x64,0x65,0x74,0x61,0x69,
-    0x6c,0x73,0x5f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x65,0x64,0x5f,0x77,0x69,0x6e,0x64,
-    0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x73,0x68,0x61,0x64,0x6f,0x77,0x2d,0x74,0x79,0x70,0x65,
-    0x22,0x3e,0x69,0x6e,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x56,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x4c,0x69,0x73,0x74,0x42,0x6f,0x78,0x22,0x20,0x69,0x64,0x3d,0x22,0x73,0x65,0x6c,
-    0x65,0x63,0x74,0x65,0x64,0x5f,0x64,0x61,0x79,0x5f,0x65,0x76,0x65,0x6e,0x74,0x73,
-    0x5f,0x6c,0x69,0x73,0x74,0x62,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x73,0x69,0x7a,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x73,0x68,0x72,0x69,0x6e,0x6b,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x6e,0x61,0x6d,0x65,0x22,0x3e,0x6d,0x6f,0x6e,0x74,0x68,0x5f,0x76,0x69,0x65,0x77,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,0x6c,
-    0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,
-    0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x9c,0x88,0xe8,0xa7,0x86,0xe5,0x9b,0xbe,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6f,0x72,0x69,0x65,0x6e,0x74,0x61,0x74,
-    0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,
-    0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x21,0x2d,0x2d,0x20,0x6e,
-    0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3d,0x37,0x20,0x6e,0x2d,0x72,0x6f,0x77,
-    0x73,0x3d,0x33,0x20,0x2d,0x2d,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x47,0x72,0x69,0x64,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x68,0x65,0x61,0x64,0x65,
-    0x72,0x5f,0x67,0x72,0x69,0x64,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,
-    0x2d,0x74,0x6f,0x70,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x2d,0x68,0x6f,
-    0x6d,0x6f,0x67,0x65,0x6e,0x65,0x6f,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x52,
-    0x61,0x64,0x69,0x6f,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,
-    0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
-    0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,
-    0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x72,0x61,0x77,0x2d,
-    0x69,0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x20,0x69,
-    0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x6c,0x61,0x62,0x65,
-    0x6c,0x5f,0x30,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x97,0xa5,0x0a,0x30,0x30,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x22,0x3e,
-    0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x52,0x61,0x64,0x69,
-    0x6f,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,
-    0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x31,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,
-    0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,
-    0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x72,0x61,0x77,0x2d,0x69,0x6e,0x64,
-    0x69,0x63,0x61,0x74,0x6f,0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,
-    0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,
-    0x5f,0x64,0x61,0x79,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,
-    0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,
-    0x22,0x3e,0xe4,0xb8,0x80,0x0a,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,
-    0x61,0x63,0x68,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,
-    0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x52,0x61,0x64,0x69,0x6f,0x42,0x75,0x74,0x74,0x6f,0x6e,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,
-    0x75,0x74,0x74,0x6f,0x6e,0x5f,0x32,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x64,0x72,0x61,0x77,0x2d,0x69,0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,0x72,0x22,
-    0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,
-    0x3e,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-    0x5f,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x6c,0x61,
-    0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,
-    0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xba,0x8c,0x0a,0x30,
-    0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,
-    0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x32,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x52,0x61,
-    0x64,0x69,0x6f,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,
-    0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x33,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,
-    0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,
-    0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,
-    0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x72,0x61,0x77,0x2d,0x69,
-    0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x77,0x65,0x65,0x6b,0x5f,0x64,
-    0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x30,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,
-    0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,
-    0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,
-    0x65,0x73,0x22,0x3e,0xe4,0xb8,0x89,0x0a,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,
-    0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,
-    0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x33,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,
-    0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,
-    0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x52,0x61,0x64,0x69,0x6f,0x42,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,
-    0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x34,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,
-    0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x64,0x72,0x61,0x77,0x2d,0x69,0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,
-    0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,
-    0x70,0x22,0x3e,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x5f,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,
-    0x6c,0x61,0x62,0x65,0x6c,0x5f,0x34,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,
-    0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x9b,0x9b,
-    0x0a,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6a,0x75,0x73,0x74,0x69,
-    0x66,0x79,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,
-    0x34,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,
-    0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x52,0x61,0x64,0x69,0x6f,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-    0x5f,0x35,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,
-    0x74,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,
-    0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x64,0x72,0x61,0x77,
-    0x2d,0x69,0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x67,0x72,0x6f,0x75,0x70,0x22,0x3e,0x77,0x65,0x65,0x6b,
-    0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x35,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,
-    0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,
-    0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xba,0x94,0x0a,0x30,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x22,0x3e,0x63,0x65,0x6e,
-    0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,
-    0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,
-    0x70,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x52,0x61,0x64,0x69,0x6f,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,
-    0x61,0x79,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x36,0x22,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,
-    0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x64,0x72,0x61,0x77,0x2d,0x69,0x6e,0x64,0x69,0x63,0x61,
-    0x74,0x6f,0x72,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x67,0x72,
-    0x6f,0x75,0x70,0x22,0x3e,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,0x79,0x5f,0x62,0x75,
-    0x74,0x74,0x6f,0x6e,0x5f,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,
-    0x62,0x65,0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x61,
-    0x79,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x36,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,
-    0x85,0xad,0x0a,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6a,0x75,0x73,
-    0x74,0x69,0x66,0x79,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x65,0x66,0x74,0x2d,0x61,0x74,0x74,0x61,0x63,0x68,
-    0x22,0x3e,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x6f,0x70,0x2d,0x61,0x74,0x74,0x61,0x63,
-    0x68,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,
-    0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,
-    0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,
-    0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,
-    0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,
-    0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,
-    0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,
-    0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,
-    0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,
-    0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x53,0x63,
-    0x72,0x6f,0x6c,0x6c,0x65,0x64,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x20,0x69,0x64,
-    0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x64,0x65,0x74,0x61,0x69,0x6c,0x73,0x5f,0x73,
-    0x63,0x72,0x6f,0x6c,0x6c,0x65,0x64,0x5f,0x77,0x69,0x6e,0x64,0x6f,0x77,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,
-    0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x68,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x62,0x61,0x72,0x2d,0x70,0x6f,0x6c,0x69,
-    0x63,0x79,0x22,0x3e,0x6e,0x65,0x76,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x68,0x61,0x64,0x6f,0x77,0x2d,
-    0x74,0x79,0x70,0x65,0x22,0x3e,0x69,0x6e,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x56,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-    0x22,0x47,0x74,0x6b,0x4c,0x69,0x73,0x74,0x42,0x6f,0x78,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x77,0x65,0x65,0x6b,0x5f,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x64,
-    0x61,0x79,0x5f,0x65,0x76,0x65,0x6e,0x74,0x73,0x5f,0x6c,0x69,0x73,0x74,0x62,0x6f,
-    0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,
-    0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x77,0x65,0x65,0x6b,0x5f,0x76,0x69,0x65,
-    0x77,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,
-    0x6c,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x91,0xa8,0xe8,0xa7,0x86,0xe5,0x9b,0xbe,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x6f,0x72,0x69,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x76,0x65,0x72,
-    0x74,0x69,0x63,0x61,0x6c,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,
-    0x74,0x6f,0x6e,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,
-    0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x61,0x6c,0x69,0x67,0x6e,
-    0x22,0x3e,0x73,0x74,0x61,0x72,0x74,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x73,0x74,
-    0x61,0x72,0x74,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,
-    0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x36,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x79,
-    0x6f,0x75,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x22,0x3e,0x73,0x74,0x61,0x72,0x74,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,
-    0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x61,0x67,0x65,0x6e,
-    0x64,0x61,0x5f,0x61,0x64,0x64,0x5f,0x74,0x61,0x73,0x6b,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,
-    0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0xb7,0xbb,0xe5,0x8a,0xa0,0xe4,0xbb,0xbb,
-    0xe5,0x8a,0xa1,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,
-    0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,
-    0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x61,0x67,0x65,0x6e,0x64,0x61,0x5f,
-    0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x74,0x61,0x73,0x6b,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,
-    0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0x88,0xa0,0xe9,0x99,0xa4,0xe4,0xbb,0xbb,
-    0xe5,0x8a,0xa1,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,
-    0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x65,0x64,0x57,0x69,0x6e,
-    0x64,0x6f,0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x73,0x68,0x61,0x64,0x6f,0x77,0x2d,0x74,0x79,0x70,0x65,0x22,0x3e,
-    0x69,0x6e,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x54,0x72,0x65,0x65,0x56,0x69,0x65,0x77,0x22,0x20,0x69,0x64,0x3d,0x22,
-    0x74,0x61,0x73,0x6b,0x5f,0x74,0x72,0x65,0x65,0x5f,0x76,0x69,0x65,0x77,0x22,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,
-    0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x20,0x69,0x6e,0x74,0x65,0x72,0x6e,0x61,0x6c,0x2d,0x63,0x68,0x69,
-    0x6c,0x64,0x3d,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x54,0x72,0x65,0x65,
-    0x53,0x65,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6e,0x61,0x6d,0x65,0x22,0x3e,
-    0x61,0x67,0x65,0x6e,0x64,0x61,0x5f,0x76,0x69,0x65,0x77,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,0x6c,0x65,0x22,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,
-    0x3e,0xe6,0x97,0xa5,0xe7,0xa8,0x8b,0xe5,0x88,0x97,0xe8,0xa1,0xa8,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,
-    0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x42,0x6f,0x78,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x6f,0x64,0x61,0x79,0x5f,
-    0x69,0x6e,0x64,0x69,0x63,0x61,0x74,0x6f,0x72,0x5f,0x62,0x6f,0x78,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
-    0x73,0x74,0x61,0x72,0x74,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x65,0x6e,0x64,0x22,0x3e,0x31,0x30,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,
-    0x74,0x74,0x6f,0x6d,0x22,0x3e,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,
-    0x70,0x61,0x63,0x69,0x6e,0x67,0x22,0x3e,0x31,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x6f,0x64,0x61,0x79,0x5f,0x62,0x75,0x74,0x74,
-    0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,
-    0xbb,0x8a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,
-    0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x30,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x69,0x64,0x3d,0x22,0x77,0x65,0x65,0x6b,0x5f,0x6f,0x66,0x5f,0x79,
-    0x65,0x61,0x72,0x5f,0x6c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
-    0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0xac,0xac,0x20,0x32,
-    0x38,0x20,0xe5,0x91,0xa8,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x31,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,
-    0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x42,0x6f,0x78,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,
-    0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,
-    0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x68,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,
-    0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,0x65,0x68,
-    0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x6c,0x61,0x63,
-    0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,
-    0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,
-    0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,
-    0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x32,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,0x6e,0x75,0x42,0x75,
-    0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,0x73,0x65,0x74,0x74,0x69,0x6e,
-    0x67,0x73,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
-    0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x72,0x65,0x6c,0x69,0x65,0x66,0x22,0x3e,0x6e,0x6f,0x6e,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x70,0x75,0x70,0x22,
-    0x3e,0x6d,0x6f,0x72,0x65,0x5f,0x6d,0x65,0x6e,0x75,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,
-    0x74,0x6b,0x49,0x6d,0x61,0x67,0x65,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,
-    0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x69,0x63,0x6f,0x6e,0x2d,
-    0x6e,0x61,0x6d,0x65,0x22,0x3e,0x65,0x6d,0x62,0x6c,0x65,0x6d,0x2d,0x73,0x79,0x73,
-    0x74,0x65,0x6d,0x2d,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x69,0x63,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,
-    0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,
-    0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,0x54,0x72,0x75,0x65,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x34,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,0x3e,0x46,0x61,0x6c,
-    0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x6c,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x33,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x57,0x69,0x6e,0x64,0x6f,0x77,0x22,0x20,0x69,0x64,
-    0x3d,0x22,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x5f,0x77,0x69,0x6e,0x64,0x6f,
-    0x77,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,
-    0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x33,0x38,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,
-    0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x31,0x38,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,
-    0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x74,0x69,0x74,
-    0x6c,0x65,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,
-    0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0x97,0xa5,0x20,0xe7,0xa8,0x8b,0x20,0xe7,
-    0xae,0xa1,0x20,0xe7,0x90,0x86,0x20,0xe7,0xb3,0xbb,0x20,0xe7,0xbb,0x9f,0x20,0x2d,
-    0x20,0xe6,0xb3,0xa8,0x20,0xe5,0x86,0x8c,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x73,0x69,0x7a,0x61,0x62,0x6c,
-    0x65,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6d,0x6f,0x64,0x61,0x6c,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2d,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x22,0x3e,0x63,0x65,0x6e,0x74,0x65,0x72,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x46,0x69,0x78,0x65,0x64,0x22,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,
-    0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe7,0x94,
-    0xa8,0xe6,0x88,0xb7,0xe5,0x90,0x8d,0xef,0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,
-    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x63,
-    0x61,0x6c,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x31,0x2e,0x32,0x22,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,
-    0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x78,0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,
-    0x3e,0x32,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,
-    0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,
-    0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,
-    0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x67,0x69,
-    0x73,0x74,0x65,0x72,0x5f,0x75,0x73,0x65,0x72,0x6e,0x61,0x6d,0x65,0x5f,0x65,0x6e,
-    0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,
-    0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,
-    0x3e,0x32,0x33,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x38,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,
-    0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,
-    0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x31,0x34,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x32,0x30,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,
-    0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,
-    0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,
-    0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,
-    0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xef,0xbc,0x9a,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
-    0x65,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x73,0x63,0x61,0x6c,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,
-    0x22,0x31,0x2e,0x32,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x32,0x35,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x79,0x22,0x3e,0x36,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-    0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,
-    0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,
-    0x72,0x64,0x5f,0x65,0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,
-    0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x33,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,
-    0x3e,0x32,0x38,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,
-    0x79,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,0x75,0x72,0x70,0x6f,0x73,0x65,0x22,0x3e,0x70,
-    0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x31,0x34,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x36,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,
-    0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,
-    0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,
-    0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,
-    0x73,0x22,0x3e,0xe7,0xa1,0xae,0xe8,0xae,0xa4,0xe5,0xaf,0x86,0xe7,0xa0,0x81,0xef,
-    0xbc,0x9a,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,
-    0x62,0x75,0x74,0x65,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x73,0x63,0x61,0x6c,0x65,0x22,0x20,0x76,0x61,0x6c,
-    0x75,0x65,0x3d,0x22,0x31,0x2e,0x32,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
-    0x74,0x65,0x73,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x35,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x31,0x30,0x30,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
-    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x45,0x6e,0x74,0x72,0x79,0x22,
-    0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x5f,0x63,0x6f,
-    0x6e,0x66,0x69,0x72,0x6d,0x5f,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x5f,0x65,
-    0x6e,0x74,0x72,0x79,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,
-    0x22,0x3e,0x32,0x33,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x68,0x65,0x69,
-    0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,0x32,0x38,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,
-    0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x22,0x3e,0x46,
-    0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x69,0x6e,0x70,0x75,
-    0x74,0x2d,0x70,0x75,0x72,0x70,0x6f,0x73,0x65,0x22,0x3e,0x70,0x61,0x73,0x73,0x77,
-    0x6f,0x72,0x64,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,
-    0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,
-    0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,0x31,0x34,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x79,0x22,0x3e,0x31,0x30,0x30,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-    0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
-    0x3d,0x22,0x47,0x74,0x6b,0x42,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6c,
-    0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,0x62,
-    0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe6,0xb3,0xa8,0xe5,0x86,0x8c,0x3c,
-    0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x2d,0x72,0x65,0x71,
-    0x75,0x65,0x73,0x74,0x22,0x3e,0x38,0x35,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x2d,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x22,0x3e,
-    0x32,0x36,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,0x6c,
-    0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,
-    0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,
-    0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,
-    0x6e,0x61,0x6d,0x65,0x3d,0x22,0x72,0x65,0x63,0x65,0x69,0x76,0x65,0x73,0x2d,0x64,
-    0x65,0x66,0x61,0x75,0x6c,0x74,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x78,0x22,0x3e,0x31,
-    0x34,0x37,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,
-    0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x79,0x22,0x3e,0x31,0x34,0x30,
-    0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x61,0x63,0x6b,0x69,0x6e,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x3c,0x6f,0x62,
-    0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,
-    0x65,0x6e,0x75,0x22,0x20,0x69,0x64,0x3d,0x22,0x74,0x61,0x73,0x6b,0x5f,0x63,0x6f,
-    0x6e,0x74,0x65,0x78,0x74,0x5f,0x6d,0x65,0x6e,0x75,0x22,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,
-    0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,
-    0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x63,
-    0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6f,0x62,0x6a,
-    0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x47,0x74,0x6b,0x4d,0x65,
-    0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x74,0x78,0x5f,
-    0x6d,0x65,0x6e,0x75,0x5f,0x72,0x65,0x76,0x69,0x73,0x65,0x5f,0x74,0x61,0x73,0x6b,
-    0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,
-    0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x73,0x69,0x62,
-    0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,
-    0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x2d,
-    0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,0x65,0x3c,0x2f,0x70,0x72,
-    0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x61,
-    0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe4,0xbf,0xae,0xe6,0x94,0xb9,
-    0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x63,0x68,0x69,0x6c,0x64,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-    0x47,0x74,0x6b,0x4d,0x65,0x6e,0x75,0x49,0x74,0x65,0x6d,0x22,0x20,0x69,0x64,0x3d,
-    0x22,0x63,0x74,0x78,0x5f,0x6d,0x65,0x6e,0x75,0x5f,0x64,0x65,0x6c,0x65,0x74,0x65,
-    0x5f,0x74,0x61,0x73,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,
-    0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x22,0x3e,0x54,0x72,0x75,0x65,0x3c,0x2f,0x70,
-    0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-    0x22,0x63,0x61,0x6e,0x2d,0x66,0x6f,0x63,0x75,0x73,0x22,0x3e,0x46,0x61,0x6c,0x73,
-    0x65,0x3c,0x2f,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x20,0x6e,
-    0x61,0x6d,0x65,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x22,0x20,0x74,0x72,0x61,0x6e,
-    0x73,0x6c,0x61,0x74,0x61,0x62,0x6c,0x65,0x3d,0x22,0x79,0x65,0x73,0x22,0x3e,0xe5,
-    0x88,0xa0,0xe9,0x99,0xa4,0xe4,0xbb,0xbb,0xe5,0x8a,0xa1,0x3c,0x2f,0x70,0x72,0x6f,
-    0x70,0x65,0x72,0x74,0x79,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6f,
-    0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x63,0x68,0x69,
-    0x6c,0x64,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x3e,0x0a,
-    0x3c,0x2f,0x69,0x6e,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x3e,0x0a
-};
-
-const size_t EmbeddedResources::gui_design_xml_size = 67869;
-
-// Notification sound MP3
-const unsigned char EmbeddedResources::notification_mp3[] = {
-    0x49,0x44,0x33,0x04,0x00,0x00,0x00,0x00,0x00,0x23,0x54,0x53,0x53,0x45,0x00,0x00,
-    0x00,0x0f,0x00,0x00,0x03,0x4c,0x61,0x76,0x66,0x35,0x37,0x2e,0x32,0x37,0x2e,0x31,
-    0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfb,0x90,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x49,0x6e,0x66,0x6f,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x40,0x00,0x00,0x6a,
-    0x1e,0x00,0x07,0x0b,0x0b,0x0f,0x13,0x13,0x17,0x1b,0x1b,0x1f,0x23,0x23,0x27,0x27,
-    0x2b,0x2f,0x2f,0x33,0x37,0x37,0x3b,0x3f,0x3f,0x42,0x46,0x46,0x4a,0x4a,0x4e,0x52,
-    0x52,0x56,0x5a,0x5a,0x5e,0x62,0x62,0x66,0x66,0x6a,0x6e,0x6e,0x72,0x76,0x76,0x7a,
-    0x7e,0x7e,0x81,0x85,0x85,0x89,0x89,0x8d,0x91,0x91,0x95,0x99,0x99,0x9d,0xa1,0xa1,
-    0xa5,0xa5,0xa9,0xad,0xad,0xb1,0xb5,0xb5,0xb9,0xbd,0xbd,0xc0,0xc4,0xc4,0xc8,0xc8,
-    0xcc,0xd0,0xd0,0xd4,0xd8,0xd8,0xdc,0xe0,0xe0,0xe4,0xe4,0xe8,0xec,0xec,0xf0,0xf4,
-    0xf4,0xf8,0xfc,0xfc,0xff,0x00,0x00,0x00,0x00,0x4c,0x61,0x76,0x63,0x35,0x37,0x2e,
-    0x32,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0x1e,0x39,0xf8,0xfe,0x86,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfb,
-    0x90,0x64,0x00,0x00,0x02,0x40,0x0d,0x47,0x9d,0x61,0x20,0x00,0x35,0xc1,0x87,0xf0,
-    0xa4,0xa4,0x00,0x13,0xad,0x3b,0x55,0xb9,0x99,0x80,0x11,0x25,0x9f,0xe7,0xb7,0x16,
-    0x50,0x00,0x05,0x4b,0x20,0x8b,0xb5,0x29,0x2a,0xb4,0xb4,0x87,0x40,0x3b,0x43,0x2f,
-    0x61,0xbd,0xe6,0xb1,0xac,0xf5,0xa0,0x80,0x44,0x88,0x75,0x28,0x5f,0xf0,0x00,0x00,
-    0x01,0x02,0x4c,0x9a,0x34,0x60,0xe0,0x60,0x4e,0x0f,0x9f,0x13,0xf2,0x81,0x8e,0x50,
-    0xe7,0xc1,0xf7,0x89,0xff,0xc3,0x05,0xcf,0xc1,0x37,0x88,0x37,0xfb,0x20,0xf8,0xe0,
-    0x7d,0xe7,0x3f,0x7f,0xfe,0x20,0x83,0x87,0x16,0x1f,0x9c,0xff,0xf0,0x50,0x80,0x10,
-    0x00,0x60,0x0c,0x01,0x81,0xb0,0x4c,0x9d,0xb5,0x05,0x00,0x98,0x26,0x1b,0x27,0x46,
-    0x8c,0x1f,0x7f,0x04,0x01,0xf0,0x7c,0x1f,0x07,0xc1,0xc0,0x40,0x10,0x04,0x01,0x00,
-    0x7c,0x3f,0x2e,0x0e,0x02,0x01,0x88,0x80,0x1f,0x3f,0xa3,0xa8,0x1f,0x7f,0xf0,0x7e,
-    0x5c,0x00,0x24,0xef,0x5b,0x5a,0xef,0x67,0xda,0xd9,0x64,0x91,0xa4,0xa4,0xa9,0xf9,
-    0x1a,0x11,0x06,0xa0,0x86,0x4a,0xee,0xc2,0x42,0x29,0xb8,0x89,0x14,0x71,0x3a,0x54,
-    0x68,0x39,0xbb,0xd6,0x20,0xbb,0x41,0x76,0x06,0x82,0x00,0x36,0x03,0x03,0x84,0x8c,
-    0x3d,0x44,0x08,0xc1,0x28,0x1e,0x15,0xe0,0xc4,0x68,0x90,0x30,0x70,0x83,0x0a,0x09,
-    0xd0,0xd1,0x12,0x54,0x36,0xf3,0x24,0xc3,0x34,0x01,0x48,0x1c,0xf2,0x35,0x67,0x58,
-    0xa0,0x33,0x07,0x0e,0x92,0x67,0x0a,0x28,0x18,0x9f,0x93,0xc6,0x88,0x22,0x60,0x41,
-    0x0c,0x0c,0x94,0x62,0x52,0x1e,0x13,0x33,0x29,0x9a,0x94,0x88,0x47,0xb2,0x69,0x99,
-    0x9f,0xa6,0xe6,0x8a,0x44,0xaf,0x52,0x09,0x32,0x8f,0xe9,0x13,0x8e,0x9f,0x20,0x17,
-    0x20,0x66,0x8c,0xf5,0x91,0x3b,0x0e,0x61,0x7d,0x4f,0x8e,0x11,0x94,0x2d,0x7d,0x3e,
-    0x1f,0x8b,0xb7,0x4c,0xda,0xd1,0x5b,0x7e,0x69,0xe8,0xfe,0x7f,0xf5,0x5c,0x00,0x08,
-    0x00,0xa3,0x02,0xa7,0xac,0xdb,0x0d,0xd3,0x60,0x00,0x04,0x49,0x9b,0xb7,0x6f,0x28,
-    0x16,0x0f,0x00,0x3c,0x8b,0x10,0x08,0x0f,0xb9,0xe1,0xc1,0x60,0xf0,0x02,0xc4,0xab,
-    0x10,0xaa,0x79,0xcf,0x21,0x32,0x0e,0x72,0x36,0xd5,0x45,0x56,0x2d,0xd5,0x6d,0x9e,
-    0xc4,0x57,0xd9,0x48,0x63,0xff,0xa3,0x9e,0xe4,0x98,0x40,0x4c,0xd1,0x67,0xef,0xef,
-    0x34,0xdc,0xad,0xd9,0x74,0x1a,0x45,0x90,0x80,0x01,0x00,0x02,0xc8,0x0c,0x41,0x98,
-    0xbd,0x0b,0xed,0xca,0x7a,0x00,0x20,0x11,0x84,0xc1,0xf1,0x84,0xc0,0xe9,0x8b,0xff,
-    0xfb,0x92,0x64,0x0c,0x00,0x03,0xfd,0x58,0x4d,0xe7,0x76,0x80,0x00,0x3f,0xc8,0x2a,
-    0xcd,0xe7,0xa8,0x00,0x8e,0xe1,0x61,0x33,0x4c,0xfa,0x87,0x08,0xe3,0x8e,0xeb,0xf4,
-    0xf6,0x1d,0x6a,0x84,0xc9,0xe2,0x09,0x51,0x8e,0x82,0x2b,0x20,0x98,0x65,0xc9,0x13,
-    0x0e,0xbd,0x0e,0x4c,0x87,0xb2,0x3a,0x84,0xec,0x6a,0x2c,0xd3,0x42,0x2c,0x54,0x21,
-    0xa4,0x88,0x0a,0x58,0x05,0x87,0x10,0x63,0x6c,0xd0,0x64,0x88,0x4b,0x21,0xa2,0x7a,
-    0xa4,0x96,0x51,0x19,0x8f,0x45,0x31,0xe1,0xd6,0xa3,0xfa,0x2f,0xd4,0x5f,0x52,0x2c,
-    0xda,0x68,0x54,0x9b,0x29,0x02,0xaf,0xa0,0xa5,0x3f,0xf5,0x2e,0x50,0x26,0x89,0x65,
-    0x7b,0xff,0xa4,0x92,0x24,0xd0,0xdf,0x0b,0xda,0x3b,0xc9,0xdf,0xff,0xf7,0x32,0x35,
-    0x4f,0xd7,0xff,0x53,0xef,0xd9,0xd8,0xba,0x1b,0xff,0x54,0xbe,0x80,0xe4,0x60,0x41,
-    0x24,0x68,0x0f,0xa7,0xd1,0x00,0x35,0x13,0xc0,0x67,0x07,0x6b,0x09,0x7f,0x1e,0x8e,
-    0xd6,0xbb,0x3f,0x4f,0x11,0xdc,0x43,0x80,0x98,0x08,0x82,0xec,0x0a,0xa7,0x1c,0xc9,
-    0xd0,0x84,0xbf,0xc4,0xb1,0xda,0x2e,0xbf,0xfd,0x5d,0xf7,0x6f,0xf7,0x5f,0xff,0x6f,
-    0x99,0x3f,0xff,0x98,0xcf,0xff,0xff,0x42,0xe8,0x48,0xee,0x00,0x00,0x00,0x54,0x00,
-    0x00,0xe7,0x4d,0xa8,0xa2,0x9b,0x3e,0x89,0xa6,0x04,0x60,0xed,0x08,0x20,0x24,0xcc,
-    0x12,0x87,0x88,0xd7,0x48,0x53,0x40,0xc2,0x20,0x2c,0x02,0xeb,0xa2,0x2f,0x18,0x8d,
-    0x27,0x8c,0xaa,0xda,0x8f,0x65,0x1d,0x45,0x66,0x3a,0x99,0xd1,0x7c,0x07,0x06,0xa0,
-    0x2c,0x28,0xbe,0x82,0x4a,0x90,0x71,0x83,0x9a,0xe6,0x48,0xd4,0xd2,0x3c,0x5c,0xad,
-    0xaa,0x51,0x22,0x4a,0xa0,0x95,0x53,0x65,0x6a,0x3c,0x4b,0x9e,0xdd,0x68,0xa3,0xb6,
-    0x91,0xb3,0xf5,0x19,0x27,0xfe,0xcf,0x32,0x1f,0x26,0x09,0x7a,0x3f,0xf3,0x14,0x87,
-    0xd0,0xdc,0x0c,0x66,0x42,0x23,0xff,0xfe,0xc9,0x9a,0xfd,0x6f,0xff,0x7f,0xe8,0xc9,
-    0xe1,0xbb,0xe6,0x03,0xdb,0x1f,0x35,0xc1,0x90,0x18,0x22,0x2e,0xc7,0x93,0x1a,0x22,
-    0x19,0xbd,0xa2,0x36,0x2c,0x7b,0x8b,0xff,0x08,0x0a,0x97,0x5d,0xe7,0x3c,0x84,0x73,
-    0x33,0x33,0x2f,0x8a,0x06,0x2f,0x1e,0xd8,0xe8,0x6c,0x5f,0xfc,0xe7,0x8f,0x03,0x87,
-    0xf2,0xa3,0xbf,0x86,0x9f,0xbb,0xff,0xd8,0xdf,0xfa,0x55,0x05,0x80,0x01,0x34,0x42,
-    0xb5,0x00,0x00,0xd5,0xf2,0xa5,0x60,0xe9,0xd2,0x0a,0x01,0x80,0x80,0x19,0x8b,0x61,
-    0xe1,0x95,0xa2,0x51,0x90,0x75,0xf1,0xbe,0xf1,0xb9,0x8d,0x62,0x01,0xd9,0xe5,0xf2,
-    0x4c,0xff,0xfb,0x92,0x64,0x13,0x00,0x03,0xd1,0x58,0x4c,0x6b,0xb8,0x6a,0xd2,0x4f,
-    0x28,0x0a,0x1d,0x69,0xa7,0x76,0x8c,0x99,0x37,0x41,0xac,0x71,0x49,0x91,0x59,0x20,
-    0x65,0xf5,0xbf,0x15,0x28,0x55,0x8c,0xec,0x3c,0xff,0x1a,0x66,0x37,0xb3,0xfb,0xb6,
-    0xb1,0xc2,0xb2,0xa8,0x8f,0x61,0x07,0x96,0x74,0x86,0x19,0xbd,0x74,0x26,0xa4,0xad,
-    0x4b,0xd8,0xfd,0x4f,0x13,0x51,0xd3,0xae,0x2c,0x41,0x3e,0x35,0x50,0xfc,0x5f,0xa4,
-    0x5a,0x5d,0x67,0xb9,0x51,0x1d,0x15,0x73,0x14,0x5f,0xda,0xfd,0x49,0x23,0xfe,0xbb,
-    0x2c,0x95,0x33,0x7f,0xff,0xcc,0xd0,0x38,0x26,0x21,0x52,0x18,0x35,0x7f,0xff,0xa4,
-    0x74,0xd5,0xbe,0xff,0xeb,0xab,0xf5,0xca,0x32,0xb9,0x00,0x0c,0xa6,0x1b,0x76,0x32,
-    0x10,0x8a,0xd8,0x89,0xbd,0x8f,0x3a,0xa0,0x9f,0x41,0x41,0x61,0xa2,0x0e,0xa7,0x2b,
-    0x03,0x45,0x0a,0x80,0x8c,0xb0,0xea,0xb5,0xb1,0xa8,0x76,0xb4,0xa8,0xe1,0xfa,0xe7,
-    0x42,0xaa,0x28,0x94,0x1c,0xdb,0x01,0xa3,0x6f,0x98,0xd5,0x68,0x8a,0x7f,0xb8,0xd4,
-    0x05,0xbc,0xf1,0xea,0x0a,0x89,0x5f,0x43,0x1f,0xef,0xf3,0x55,0xba,0x39,0xdf,0xfd,
-    0x59,0x3f,0xff,0xe8,0x5a,0x73,0xfc,0xf2,0x5b,0x40,0x00,0xee,0x55,0xcb,0x1a,0x30,
-    0xaa,0xfa,0x8f,0xba,0x96,0x35,0xb4,0xf4,0x51,0xf0,0x31,0x20,0xc0,0x78,0xce,0x36,
-    0x86,0x0e,0x11,0xb3,0x48,0x7e,0xc3,0x6e,0xca,0x1c,0xf6,0x96,0xf5,0x21,0xe4,0x2b,
-    0x08,0x9b,0x91,0x7b,0x7c,0xdd,0x86,0xc4,0x8e,0x50,0xfd,0x49,0x56,0x52,0x50,0x34,
-    0x3b,0x97,0xca,0x93,0x4a,0x3a,0x13,0x10,0xfc,0xb0,0x1d,0x1c,0x71,0x28,0x83,0x37,
-    0xd4,0x81,0x7e,0xa9,0xb6,0x8f,0xf1,0xf9,0x9f,0xeb,0xa9,0x4f,0xdb,0xff,0xa9,0x28,
-    0x6a,0x49,0xff,0xff,0x34,0x49,0x25,0x37,0xc8,0x91,0xcc,0x17,0xea,0x0c,0x00,0x02,
-    0x9d,0x24,0xaa,0x00,0x21,0xad,0xc4,0x1b,0x78,0x01,0x7d,0x8a,0x04,0x13,0x07,0x81,
-    0x84,0x4d,0x7a,0x94,0xd1,0x30,0x20,0x43,0x02,0xa0,0x98,0x06,0x95,0x6b,0xdc,0xe6,
-    0xbf,0x52,0xc8,0xc4,0xbd,0xde,0xce,0xf4,0xad,0xb8,0x67,0xab,0x59,0xc4,0x23,0x01,
-    0xf0,0x57,0x15,0xc1,0x83,0x2a,0x3b,0x13,0x6a,0x50,0x49,0xfe,0x82,0xe3,0xe6,0x5f,
-    0xf5,0x4f,0xff,0xfe,0xeb,0xff,0xc6,0xb1,0xbf,0xff,0x9e,0x34,0x3a,0x60,0x1f,0xfd,
-    0x77,0xff,0xfa,0xd5,0x00,0x00,0x32,0x26,0x00,0x0b,0xf5,0x19,0x8f,0x10,0x04,0x5a,
-    0x43,0x02,0x4e,0x2c,0x63,0xcd,0x24,0xc2,0x70,0x1b,0x4c,0x3c,0x87,0xac,0xe1,0xc0,
-    0xa1,0x0c,0x40,0xff,0xfb,0x92,0x64,0x0f,0x88,0x13,0x94,0x57,0xc8,0xcb,0x5e,0x69,
-    0xf0,0x4e,0xc8,0x19,0x9d,0x6d,0x62,0x92,0x8f,0x91,0x61,0x29,0x55,0xd9,0x00,0x11,
-    0x10,0x0e,0xe7,0x36,0xb6,0xd0,0x02,0x81,0x6c,0xc1,0x14,0x07,0x8c,0x05,0x80,0x44,
-    0x04,0x01,0x48,0x0d,0x62,0x51,0x8a,0x6a,0x57,0x5f,0xbd,0xa1,0x75,0x77,0xba,0x2f,
-    0xd2,0xff,0x52,0x17,0xf9,0x96,0x31,0x80,0xc8,0x95,0x7e,0x7e,0x9b,0x51,0x53,0xf5,
-    0x92,0x66,0x28,0x56,0x6b,0xfe,0x33,0x1e,0x7e,0xb4,0xbf,0xbf,0xa8,0xd1,0x3f,0xf3,
-    0x15,0xb2,0x26,0xe6,0x0d,0xd5,0xff,0x9d,0x3e,0x3b,0xc1,0x6a,0x02,0x86,0x35,0xff,
-    0xff,0xd4,0x75,0x5f,0xff,0xba,0x4f,0xfd,0x01,0xdc,0xa0,0xc8,0x00,0x17,0x0b,0x31,
-    0x46,0x80,0x16,0x7a,0xf6,0x15,0x01,0xe7,0x1b,0xf6,0xac,0x63,0xe1,0x46,0x52,0x10,
-    0x17,0xce,0x10,0xfc,0x98,0x48,0x52,0xaa,0xba,0x51,0x18,0x6a,0xad,0x35,0xea,0x36,
-    0x99,0xad,0xc9,0x59,0x2e,0x1d,0xf6,0x07,0x81,0xba,0xf6,0xa2,0x02,0xdf,0x89,0x9d,
-    0x91,0xcb,0xf0,0x49,0xb1,0xbf,0xb8,0x61,0x63,0x74,0x3d,0x77,0xbd,0xfa,0x0e,0x4f,
-    0xf6,0x99,0x9c,0x2f,0x9a,0xdf,0xf8,0x31,0xe0,0x8b,0xe4,0xea,0x88,0x02,0x2b,0xd3,
-    0xc4,0x13,0xf2,0x80,0x54,0x0d,0x04,0x83,0x26,0x47,0x82,0x26,0x65,0x92,0xa6,0x95,
-    0x53,0x87,0x56,0x5e,0x66,0x50,0x89,0x66,0x1e,0x83,0x68,0x76,0x50,0x44,0x02,0x17,
-    0x3d,0xe7,0x1f,0x61,0x75,0x60,0xd8,0x08,0xb7,0xa6,0x5d,0x2a,0x0c,0x79,0x1c,0x6a,
-    0x60,0x45,0x00,0x03,0x44,0xea,0x7e,0x58,0x30,0x0f,0x9c,0x39,0x55,0xac,0x86,0xf2,
-    0xc8,0x7b,0xc6,0x02,0xde,0x63,0x48,0xc9,0x24,0x13,0x94,0xd9,0x49,0xb1,0xe4,0xbf,
-    0xac,0x81,0x0b,0x12,0x5b,0x97,0x5d,0x02,0xea,0x9f,0x5f,0xa0,0x46,0x17,0xd5,0xfe,
-    0xad,0x46,0x2b,0xff,0xfe,0xe8,0x20,0x3b,0xc3,0xde,0x22,0xcd,0xff,0xff,0x45,0xdf,
-    0xaf,0xfe,0xba,0xff,0xcd,0x58,0x20,0x00,0x2e,0xb4,0xe6,0x93,0xf5,0xa8,0x02,0x9f,
-    0x28,0xfa,0x9a,0x23,0x71,0x86,0x90,0x1e,0x4a,0x82,0xb5,0xb3,0x57,0xbe,0x75,0xfa,
-    0x79,0x1e,0x80,0x52,0xca,0x83,0x30,0xc8,0xb2,0x0a,0x77,0xa0,0x36,0x85,0x99,0xbe,
-    0x81,0x7c,0x6d,0x54,0x9a,0xbd,0x31,0xe4,0x81,0x0d,0x6b,0x45,0x1f,0x40,0xf2,0x23,
-    0x11,0xe0,0xaf,0xfc,0x51,0xff,0x63,0x3f,0xd2,0x55,0x92,0x80,0x00,0x3b,0x3b,0x2e,
-    0xdb,0x6d,0x24,0x62,0x34,0xd2,0x40,0x05,0xe4,0x21,0x0b,0x6e,0x22,0x32,0xe8,0xd1,
-    0x8f,0x1a,0x08,0x0b,0xce,0xff,0xfb,0x92,0x64,0x0d,0x80,0x04,0x16,0x4b,0x51,0xee,
-    0x6e,0x60,0x04,0x40,0x83,0xca,0xcf,0xc6,0x3c,0x00,0x8f,0x9d,0x97,0x54,0x19,0xb8,
-    0x00,0x08,0xfd,0x0f,0xeb,0x37,0x10,0xa0,0x02,0x3c,0x08,0x08,0x4c,0x6e,0x44,0x46,
-    0x1a,0x22,0x66,0x29,0x2c,0xda,0xc2,0xbd,0xbe,0xa8,0xa1,0xf0,0x0c,0x00,0xe4,0x05,
-    0xd1,0x24,0x80,0x0e,0xe1,0x6b,0x83,0x3e,0x55,0x0c,0xd9,0x48,0x6e,0x8c,0x20,0x0e,
-    0xe0,0x94,0x40,0x29,0x82,0xf0,0x5a,0x8a,0x86,0x02,0x58,0x1a,0xa4,0xb8,0x64,0x0d,
-    0x98,0x02,0xc4,0x0c,0x26,0x18,0x2c,0xd1,0xe5,0x19,0xe6,0x3a,0x59,0x70,0x06,0xf9,
-    0xc1,0x71,0x85,0xa7,0x91,0xcf,0xaf,0x43,0x5b,0x51,0xeb,0x57,0xab,0xfe,0x83,0x54,
-    0x7a,0x85,0x95,0xf3,0x0f,0xf7,0x6b,0x7c,0x9c,0x34,0xff,0xc9,0xb7,0xff,0x94,0x9f,
-    0xa1,0x55,0x00,0x01,0x4c,0x19,0xdd,0xdd,0xe2,0x23,0xfe,0x00,0x00,0x00,0x00,0x00,
-    0x0e,0x17,0xf8,0xc6,0x89,0x56,0x0e,0x96,0x33,0x96,0x01,0x17,0xed,0xdf,0x2a,0xbe,
-    0x6b,0xae,0xd3,0x2a,0x35,0x5b,0x10,0x6f,0x43,0x82,0xba,0xb1,0x0b,0x38,0x14,0x47,
-    0x0e,0x29,0x55,0xd4,0xf0,0x0d,0x04,0x04,0xde,0x9f,0xe2,0xfa,0xff,0x1f,0x58,0xec,
-    0x90,0xfe,0x57,0x53,0xef,0x6d,0x96,0x82,0x42,0x18,0x71,0x8a,0x04,0xa6,0xe9,0x31,
-    0x92,0x7a,0x03,0x80,0x0d,0x1d,0x88,0x58,0x20,0xd2,0xa5,0xdb,0x71,0x8e,0x2e,0x97,
-    0x09,0xe2,0xf4,0x9f,0x2a,0x8e,0x79,0x48,0x92,0x4c,0xe1,0x5c,0xe1,0x5c,0x87,0x8e,
-    0x79,0xf1,0xc2,0x98,0x6c,0xa5,0x77,0x50,0x35,0x14,0x41,0xcf,0x9a,0x24,0x81,0xe2,
-    0x5e,0x8c,0x6a,0x15,0xad,0xa1,0xa6,0x9a,0xaa,0x65,0x9f,0xd3,0xac,0xfd,0xba,0x6e,
-    0xbf,0x46,0xb7,0xea,0xff,0x4d,0x3f,0xa1,0x45,0xfe,0xb9,0xcb,0x69,0xbd,0xd0,0xfa,
-    0x94,0x89,0x92,0x5f,0xda,0x4c,0xb7,0xd0,0x26,0x09,0xc2,0x0e,0xff,0xd0,0x41,0xd6,
-    0x90,0x6a,0xf2,0x31,0x5f,0xa6,0xca,0xd3,0x16,0x12,0x2b,0xfc,0xc1,0x78,0x4a,0x80,
-    0x00,0x01,0x20,0x04,0x15,0x5c,0xc0,0x01,0x03,0x81,0x80,0x07,0x2b,0x7c,0xa9,0xe3,
-    0x02,0x02,0xc2,0xe6,0x66,0x38,0x7e,0x33,0x03,0xa2,0xd8,0xb6,0x45,0x9e,0xda,0x3b,
-    0x7b,0x37,0x2c,0x48,0x2b,0xea,0x3f,0x06,0xc5,0x7a,0xb0,0x2f,0x0f,0x90,0xdc,0x80,
-    0x78,0x73,0xff,0xf3,0x5f,0xfa,0x98,0xc1,0x40,0xeb,0x7e,0x70,0xd5,0xea,0xab,0x73,
-    0x00,0x00,0x00,0x00,0x27,0x82,0x07,0x00,0x43,0x80,0xac,0x41,0x2b,0x9e,0xdb,0x73,
-    0x0c,0x12,0x00,0x18,0x09,0x85,0x00,0xff,0xfb,0x92,0x64,0x0c,0x80,0x04,0x01,0x63,
-    0x53,0x77,0x72,0x40,0x00,0x3f,0xa6,0x0a,0xed,0xe7,0x94,0x00,0x8f,0x11,0x8d,0x3e,
-    0x8e,0xe5,0xad,0x41,0x07,0x0c,0x2b,0x3d,0x94,0x1d,0xd8,0xc5,0xa2,0x06,0x0e,0xcd,
-    0x13,0x0c,0x0b,0x07,0x0c,0x1a,0x02,0x6f,0xa7,0x49,0xd5,0x95,0x4e,0x95,0x0f,0xa0,
-    0x74,0x7d,0x24,0x7d,0x23,0x13,0x03,0xe3,0xe8,0xd4,0xbc,0x64,0x8a,0x06,0xe0,0x26,
-    0x44,0xa2,0x4e,0x9c,0x3a,0x56,0x21,0xc4,0xf2,0xdd,0x5a,0xec,0x83,0xb6,0x6c,0xdd,
-    0x68,0xa5,0xb5,0x65,0x07,0x7f,0x30,0xfb,0x29,0x5d,0xcc,0x8f,0x2d,0x5d,0x5f,0xab,
-    0xd7,0x38,0x97,0xa9,0xdb,0xff,0xab,0xd4,0x81,0x1c,0xed,0xed,0xff,0xf5,0xa9,0x6a,
-    0x38,0x6c,0x1f,0xb1,0x1c,0x46,0x17,0x4d,0x8d,0x92,0x5f,0xff,0xad,0x5e,0xe5,0x24,
-    0x42,0xd5,0xcb,0x60,0x00,0x90,0x00,0x02,0x50,0x00,0x71,0x78,0xc2,0xfa,0xad,0xec,
-    0xa9,0x8d,0x35,0xc6,0x6c,0x27,0xe1,0x03,0x14,0x68,0x08,0x51,0x44,0x05,0xd9,0xeb,
-    0x79,0x15,0xba,0x2f,0x75,0x0f,0x8c,0xb6,0x9f,0xff,0xfe,0x85,0x7e,0xa4,0x08,0x15,
-    0x9d,0x94,0x44,0x58,0xad,0x91,0x8f,0xa0,0x98,0x90,0x89,0xef,0xff,0xff,0xff,0xfe,
-    0x4c,0x5e,0x74,0xc0,0x00,0xa2,0xba,0xf3,0x91,0xca,0x9b,0xa5,0x52,0x40,0x08,0xb4,
-    0x0a,0xf4,0x10,0x17,0x8d,0x23,0x2b,0x54,0xc0,0x60,0xd8,0xe9,0x0d,0xf4,0xc0,0x00,
-    0x1c,0x48,0x59,0x4e,0xac,0xd4,0x5c,0x56,0xa9,0x75,0x4d,0xd7,0xc2,0x82,0xae,0x1c,
-    0xad,0x94,0x37,0x45,0xcc,0xb5,0xa4,0xfd,0x32,0xb8,0x4f,0x3b,0xd2,0xab,0x6b,0x2f,
-    0x08,0x63,0x67,0xeb,0x37,0x47,0xd4,0x9b,0x73,0xa4,0x92,0x35,0x67,0x49,0x53,0x6f,
-    0xaf,0xf5,0xb7,0x5b,0x2b,0xed,0xff,0xec,0x74,0xf7,0x51,0x79,0x2f,0x7f,0xdd,0x3f,
-    0x51,0x34,0x9e,0x68,0x79,0x2d,0x2f,0xff,0xd1,0xba,0x89,0xc1,0x64,0x25,0xe3,0x08,
-    0x2d,0x52,0x66,0xab,0xff,0xe8,0xf9,0xe7,0x3c,0xea,0xaf,0x29,0x10,0x41,0x19,0xda,
-    0x8b,0xe7,0x10,0x05,0xd3,0x7a,0xfd,0x9a,0xf7,0x6b,0x61,0x3a,0xaa,0x2a,0x42,0xbc,
-    0x38,0x69,0x6c,0xfc,0x41,0x30,0x04,0x2c,0x03,0x24,0x9b,0x0c,0x73,0x01,0xab,0x3d,
-    0xae,0x48,0xf5,0xf5,0x07,0xa4,0x7c,0x54,0x0b,0x74,0x2b,0x04,0x9f,0x46,0xb3,0x1a,
-    0xce,0xd2,0x47,0x05,0x7f,0xfd,0x3f,0xf1,0x0f,0xff,0xcf,0x13,0x59,0x43,0x00,0x00,
-    0x7d,0x48,0x04,0x15,0x80,0x93,0xca,0xdc,0x31,0x1b,0x82,0xa4,0x6d,0x91,0x32,0x2b,
-    0xa0,0x90,0x79,0x7a,0x9d,0x26,0x07,0x16,0x1f,0xff,0xfb,0x92,0x44,0x0e,0x80,0x03,
-    0x08,0x63,0x50,0xfb,0x92,0x3c,0xa0,0x62,0x6c,0x59,0xff,0x75,0xe7,0x6a,0x4b,0xcd,
-    0x8d,0x51,0xcc,0x98,0xf4,0x31,0x80,0x2b,0x2c,0xbd,0x87,0x9d,0xae,0x5d,0xa8,0x10,
-    0x12,0x5e,0xb0,0xf7,0x1b,0xa2,0x72,0xa4,0x14,0x65,0x81,0x34,0xe7,0x86,0x22,0x1d,
-    0x41,0xe3,0xa9,0x63,0xa8,0x93,0xeb,0x26,0x00,0x3e,0x4a,0x8e,0xad,0x43,0x3f,0x4f,
-    0xcf,0x6f,0x42,0xdf,0x35,0xff,0x2f,0xf3,0x4d,0x6e,0xc4,0x7f,0x7f,0xff,0x3c,0xdf,
-    0x9d,0xf7,0xff,0xf9,0x23,0x7f,0xff,0xff,0xca,0x96,0x08,0x57,0x6f,0xff,0xff,0xb1,
-    0x56,0x46,0x42,0x00,0x00,0x7a,0x24,0x09,0x11,0x00,0x4a,0x00,0x6c,0xf5,0xea,0x25,
-    0x6a,0x99,0x41,0x2e,0xac,0x20,0x70,0x90,0xda,0x8b,0x01,0x66,0xd2,0xe4,0x80,0x61,
-    0xa8,0x34,0x56,0xa6,0x1a,0x06,0x88,0x0e,0x89,0x19,0xbe,0xe2,0x99,0xc8,0x0c,0xf6,
-    0x6d,0x66,0x2c,0xb2,0xff,0xb5,0x68,0x8e,0x23,0x23,0xeb,0xb8,0xe8,0x3d,0x18,0xff,
-    0xf6,0xf2,0xa3,0x4f,0xa1,0xef,0xf2,0x44,0xbe,0x6f,0xad,0x5b,0xdf,0xff,0xe6,0xa7,
-    0xa3,0xbf,0x77,0xff,0xf8,0xea,0x37,0xff,0xff,0xf5,0x02,0x23,0xe3,0xae,0xdf,0xff,
-    0xfe,0xb1,0xd4,0x4a,0xcc,0x80,0x00,0x4b,0x09,0xa5,0xe8,0x4a,0x8b,0x1e,0x57,0x89,
-    0x35,0x09,0x7b,0x20,0x9e,0x40,0x82,0x38,0xc1,0x84,0x2d,0x9b,0x58,0xb8,0x6c,0xa2,
-    0x27,0x28,0x54,0x8b,0xd9,0x6b,0x4f,0xe7,0x61,0xd3,0x5a,0xcc,0x29,0xed,0xe7,0xd6,
-    0xcd,0x00,0x0e,0x67,0xa8,0x12,0x01,0xa4,0xbd,0x4d,0xff,0xf5,0x6f,0x2a,0x12,0xd6,
-    0xae,0x20,0x11,0x3e,0xa4,0x3e,0xb5,0xec,0x6b,0x7f,0xf7,0xfc,0xd7,0xfb,0xbf,0x37,
-    0xfd,0x3e,0x44,0x79,0xff,0xff,0xff,0xb0,0x64,0x16,0x0c,0xaa,0xff,0xff,0xfe,0xc3,
-    0xab,0xa9,0xe1,0x9c,0x88,0x11,0xe9,0xac,0xbf,0x78,0x9c,0x59,0xdb,0xc3,0xaf,0x54,
-    0xcd,0x72,0xe8,0xda,0x6c,0x8c,0x56,0x9a,0x22,0x08,0xbc,0x84,0x93,0x2c,0xce,0x8b,
-    0x39,0x88,0x73,0xeb,0xf7,0xec,0x94,0x7b,0x6c,0xba,0xd7,0xc6,0xa1,0x7f,0xf0,0x4c,
-    0xda,0x37,0xfe,0x0b,0x7f,0x31,0xfc,0xd0,0x70,0x9c,0xd1,0x18,0x71,0xfb,0x84,0x01,
-    0xb6,0xe8,0x1c,0x7f,0xcf,0x22,0x6a,0x54,0xd1,0xa9,0xbe,0xad,0xe8,0xbf,0xba,0xbf,
-    0xbf,0x5f,0xff,0xe5,0x0e,0x23,0xff,0xff,0xf6,0x68,0x08,0x12,0xc1,0x3f,0xff,0x0d,
-    0x9d,0xaa,0x20,0x00,0x30,0x0d,0x60,0x18,0xb7,0xd7,0x81,0xe4,0xab,0x7c,0x08,0x15,
-    0x41,0x73,0x18,0x81,0x8c,0x3b,0x24,0x39,0x6a,0x04,0xc2,0xff,0xfb,0x92,0x64,0x0c,
-    0x80,0x03,0xd7,0x63,0xca,0xcb,0x9e,0x92,0xc0,0x3e,0x84,0x4a,0x9d,0x07,0x0b,0x19,
-    0x8e,0x6d,0x59,0x2f,0x4e,0x79,0xab,0x01,0x2c,0x2b,0x26,0x68,0x2e,0x94,0xa0,0x62,
-    0x10,0x50,0x00,0x99,0x04,0x36,0xe1,0x83,0x38,0x2a,0x0a,0x00,0x2a,0x69,0x53,0xbf,
-    0x70,0xcc,0x37,0x7a,0x3f,0x6e,0x6e,0x82,0x25,0x20,0xfa,0xf1,0xf3,0xd2,0x78,0xdc,
-    0xdd,0xd2,0x44,0xbe,0x03,0xa8,0x85,0x67,0x69,0x2a,0x27,0xa1,0xed,0xba,0xd3,0xa9,
-    0xaa,0x25,0x08,0xae,0xaa,0x0e,0x7b,0xe5,0x83,0xff,0x77,0xff,0x5e,0xb3,0x4f,0x5c,
-    0xff,0x53,0xfe,0xe8,0x7d,0x33,0x0d,0x66,0x23,0xc1,0xef,0xe8,0x75,0x1f,0x26,0xcc,
-    0x1b,0xff,0xff,0xf2,0xc1,0x88,0x15,0x22,0x81,0x35,0x7f,0xff,0xff,0x59,0xe7,0x3f,
-    0xd0,0x85,0xa0,0x00,0xf4,0x91,0xe6,0x00,0x05,0x77,0xa6,0x33,0x9b,0x69,0xd9,0xaa,
-    0x69,0xe5,0x6d,0x23,0x6a,0x88,0x17,0xd3,0xd3,0x28,0x7b,0x2b,0x55,0x48,0x6d,0x41,
-    0x37,0xcd,0x8b,0xab,0x85,0x70,0x76,0x4a,0x9a,0xf5,0x49,0x75,0xff,0x3f,0x37,0xc1,
-    0x10,0xf5,0xdf,0x28,0x3b,0x80,0x7f,0xff,0xff,0xff,0xd2,0xbf,0xfe,0xa1,0x62,0xa7,
-    0x00,0x07,0x00,0x2a,0xb0,0xa1,0xff,0x01,0xd0,0x36,0xaa,0xb8,0x48,0x3f,0x29,0x6e,
-    0xc0,0x61,0x71,0xdc,0x44,0x01,0xc4,0xf1,0x60,0x71,0x31,0x8d,0x42,0xf0,0x30,0xa8,
-    0x94,0x00,0xfa,0xb0,0x40,0xf1,0xf9,0x23,0xbd,0x3e,0xf4,0xd8,0xdd,0x47,0xa5,0xff,
-    0xce,0x6a,0x58,0xd9,0xb2,0x67,0xd7,0x2e,0x84,0x98,0x74,0xf4,0x4a,0x86,0xf4,0xfe,
-    0xa4,0xda,0xb2,0xf9,0x70,0xa6,0x9a,0xe9,0x29,0xbe,0x5c,0x36,0x6e,0xa2,0xb6,0xfe,
-    0xa5,0xba,0x49,0x19,0xa5,0xf4,0xf5,0x1c,0xdf,0x55,0x06,0x5f,0xb9,0xd6,0xac,0xc0,
-    0x83,0xfe,0xbf,0x51,0x82,0xbe,0xaf,0xff,0xf9,0x90,0xca,0x19,0x61,0xa8,0xa0,0x20,
-    0xff,0xfe,0x7c,0x00,0x00,0xc6,0x1d,0x54,0x10,0x3a,0x44,0x52,0x4b,0x25,0xe2,0x80,
-    0xa0,0x18,0xb0,0x64,0xa2,0xa1,0x21,0x8c,0xb1,0x19,0x86,0xe0,0x0c,0x00,0xe5,0xcb,
-    0x03,0x82,0x52,0x88,0x8f,0xb2,0x8f,0xa0,0x78,0xcc,0x41,0x23,0xbe,0x50,0x04,0x39,
-    0xe7,0x0b,0x0c,0x26,0xda,0x91,0xe8,0x37,0x64,0xa7,0xf2,0x27,0xa1,0xbf,0xfa,0x3d,
-    0xbf,0xff,0xff,0xdf,0xae,0x9f,0xff,0xaf,0xff,0xff,0xf8,0x69,0xd4,0x36,0x30,0x00,
-    0x10,0x83,0x55,0xa0,0x0c,0x37,0x0f,0xc7,0x1b,0x90,0x70,0x00,0x18,0x07,0x04,0x00,
-    0x22,0x40,0xc1,0x80,0xa3,0xb9,0x91,0xc5,0x31,0x8a,0x02,0x31,0x81,0xff,0xfb,0x92,
-    0x64,0x0f,0x80,0x03,0xc1,0x55,0xcb,0xd5,0x75,0xa0,0x00,0x47,0x23,0xea,0x1a,0xad,
-    0xac,0x00,0x90,0xaa,0x11,0x56,0xb9,0x9a,0x00,0x01,0x0f,0x90,0x2b,0xb7,0x34,0xd0,
-    0x03,0xc0,0x31,0xb2,0xd2,0xe0,0x72,0xe6,0x60,0xa0,0x20,0x90,0x8a,0xc0,0x25,0x83,
-    0xd8,0x70,0x24,0x50,0x3c,0x5c,0x44,0xac,0x73,0x32,0x89,0x72,0xe2,0xc9,0x86,0x46,
-    0xcc,0xe8,0x17,0x06,0x14,0x72,0xaf,0xac,0x76,0x92,0x26,0xfe,0xea,0x45,0x35,0x31,
-    0x75,0x22,0xf2,0x74,0x16,0xed,0xf3,0x26,0x3d,0xe7,0x53,0xff,0x5b,0xb1,0xc3,0x03,
-    0x7f,0xda,0xee,0xd5,0x6b,0xa4,0x93,0xfd,0x68,0x53,0x51,0x4c,0xff,0xf5,0x7b,0x2f,
-    0xff,0xff,0xfd,0x6b,0x15,0x4a,0x22,0x64,0x7f,0xf7,0x1c,0x01,0x3c,0xdb,0xb2,0x80,
-    0x87,0xff,0xf7,0xb6,0x6b,0xcb,0xdc,0x71,0x10,0x22,0x02,0x5d,0x87,0xc0,0xc9,0x21,
-    0x05,0x8b,0x8b,0x60,0x9d,0x10,0x21,0x83,0x18,0xb0,0xec,0x86,0x1f,0x56,0xa6,0x9c,
-    0x71,0x89,0xa0,0xce,0xb4,0x85,0x68,0x33,0x67,0x22,0x2b,0xea,0x3f,0xa9,0x86,0x56,
-    0xf3,0x8f,0x63,0x1f,0x90,0x3b,0x2e,0xec,0xcd,0x81,0x17,0x7f,0xff,0xff,0xff,0xeb,
-    0x04,0x70,0x00,0x29,0x93,0x4b,0xee,0x6f,0xb4,0x5b,0x91,0x2b,0x6c,0x32,0x82,0xd1,
-    0x24,0x69,0x32,0x41,0x87,0xc3,0x88,0x39,0x26,0x03,0x04,0x1e,0x18,0x83,0xc9,0x80,
-    0x0b,0x3e,0x43,0x40,0xdc,0x8e,0x28,0xac,0xa8,0x98,0xec,0x19,0x52,0x18,0x92,0xd2,
-    0xba,0x0c,0x44,0xc8,0xe2,0xf9,0x54,0x9a,0x52,0xec,0x66,0x9b,0xa0,0x4e,0x94,0x47,
-    0xb2,0x38,0xc5,0x14,0x02,0xe2,0x14,0xdb,0x4f,0xa6,0x36,0x4c,0xa6,0x4b,0x23,0x11,
-    0x74,0x7f,0xec,0x5d,0x48,0xce,0x74,0xae,0xdb,0xe5,0xaf,0xfa,0x96,0xea,0xd6,0xf5,
-    0xa5,0xf6,0xff,0xfa,0xdd,0x5b,0xff,0x55,0x4d,0xff,0xff,0xfa,0x8b,0x89,0x13,0x85,
-    0x7a,0x90,0xe8,0xfb,0xa8,0xd8,0xff,0xfb,0xff,0xff,0xff,0xea,0x51,0x0e,0x0d,0xb3,
-    0xff,0xff,0xfe,0xa2,0x30,0x3f,0x7f,0x83,0x49,0x91,0x00,0xee,0xc2,0x68,0x3c,0x00,
-    0x00,0x00,0x00,0x00,0x9a,0x67,0x36,0x55,0xbb,0xfd,0x54,0x45,0x91,0x3c,0x0b,0x72,
-    0x46,0xc3,0xce,0x0a,0x75,0xb8,0x44,0x22,0xb3,0x26,0xaa,0x0e,0xf3,0x72,0xe2,0x65,
-    0x17,0x0b,0x48,0xe4,0x20,0xb2,0xe2,0x56,0x5e,0x2e,0x68,0x1a,0x69,0x75,0xd3,0x24,
-    0x07,0x80,0x73,0xcd,0xfe,0xea,0x7d,0x6a,0x34,0x56,0x15,0xcf,0xca,0x62,0x10,0x03,
-    0x3d,0x15,0xd7,0x7c,0xd4,0xb5,0xcc,0x65,0x6b,0x75,0x3b,0xd1,0x59,0xbf,0x62,0xff,
-    0xfb,0x92,0x64,0x0a,0x00,0x03,0xd6,0x6c,0x59,0x7f,0x65,0x40,0x0a,0x37,0x0b,0x6b,
-    0x1d,0xe7,0x9c,0x00,0x8c,0xc1,0x69,0x71,0xec,0x19,0x50,0x71,0x05,0x98,0xeb,0xfc,
-    0xbc,0x15,0x48,0xf9,0x32,0xa5,0x63,0xc7,0x15,0xb3,0x4f,0x54,0x60,0x03,0xa0,0x30,
-    0xbe,0x0d,0xd5,0x89,0x4c,0x7a,0x1c,0x86,0x38,0xfc,0xe1,0xe0,0x0a,0xaa,0x2b,0xcc,
-    0x73,0x4e,0x34,0xfb,0x32,0x0c,0x81,0xb8,0x0b,0x4b,0x1c,0x2b,0x21,0xd4,0x72,0xe0,
-    0x3c,0x8a,0x73,0x98,0x84,0xac,0x69,0xe6,0x31,0xae,0xe8,0x71,0xec,0x93,0x90,0x89,
-    0x3d,0x12,0x71,0xc2,0xd8,0x58,0x30,0xe6,0x45,0x24,0x35,0xaa,0x69,0xdf,0xf4,0x21,
-    0xf9,0xaa,0xb9,0x13,0x9d,0xb8,0xfa,0xfc,0x7e,0x4a,0x6f,0xff,0xff,0xea,0x95,0x6e,
-    0xb1,0x55,0xce,0xff,0xff,0xff,0xfe,0x83,0x67,0xad,0xdb,0x00,0x04,0x12,0x40,0x20,
-    0x40,0x25,0xef,0x6b,0x52,0x67,0xb1,0x7e,0x71,0xf4,0xea,0xb8,0x6c,0x06,0xc0,0x16,
-    0x22,0x49,0x91,0x55,0x1a,0x9b,0xd3,0xff,0xfe,0x61,0x0f,0xf9,0xed,0xff,0xff,0xff,
-    0xff,0x89,0x7c,0xc6,0x5a,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xe4,
-    0x1e,0x61,0xd9,0x0d,0x00,0xd5,0x9c,0x32,0x47,0x1b,0x43,0x9b,0xa9,0xa7,0x41,0xc1,
-    0x72,0x24,0x6d,0x02,0x75,0x8c,0xae,0x6c,0x6d,0x2a,0xa9,0x32,0xfd,0xb1,0x24,0x1d,
-    0x95,0xfd,0x15,0xc8,0x02,0xd3,0x21,0x91,0xd0,0x45,0xcd,0x42,0x2d,0x96,0x44,0x75,
-    0x4d,0xfc,0x27,0x8a,0x32,0x8e,0x8b,0x8a,0xa2,0x50,0x59,0x4f,0x56,0xf3,0x94,0xd9,
-    0xc8,0xc9,0x34,0xa0,0xf5,0xbe,0x8e,0x70,0xac,0x2a,0x8b,0x3d,0x4d,0x6f,0xb7,0xfd,
-    0x1f,0xa2,0x3a,0x4d,0x95,0xe8,0xe5,0x5b,0x91,0x10,0xa3,0xff,0xff,0xfe,0xa7,0x35,
-    0x66,0xa9,0x0a,0x0a,0xc0,0xaf,0xb7,0x3d,0x68,0x00,0x40,0x19,0x25,0x0f,0xff,0xfb,
-    0x00,0x52,0x49,0x24,0x16,0xe1,0xa8,0xf2,0xdf,0xd6,0x1e,0xce,0xdb,0x01,0xd0,0x21,
-    0xaa,0xac,0x30,0x5d,0x56,0xb7,0x32,0xb2,0x07,0x1f,0x56,0x29,0xb5,0xfc,0xe7,0xdd,
-    0xfb,0x16,0xfe,0x76,0xff,0x63,0x7d,0x0c,0xff,0x9a,0x03,0x20,0xcf,0xff,0xfb,0xaf,
-    0xde,0x4b,0xff,0xfb,0x55,0xff,0xfd,0x96,0x2a,0xba,0xd4,0x00,0x12,0xc6,0x14,0x72,
-    0x44,0x45,0x7a,0x92,0xe5,0xe2,0x89,0xcb,0xe9,0x99,0x05,0xc3,0x29,0x6b,0xa3,0xcd,
-    0xa2,0x97,0x02,0x2c,0xb7,0x9d,0xc0,0x69,0x33,0xd2,0x89,0x6e,0xbf,0x19,0xf2,0x2d,
-    0x09,0xb3,0x85,0xfc,0xd7,0x8b,0xe5,0x9e,0xb7,0x28,0x24,0x07,0x45,0xef,0x8c,0xdb,
-    0x5f,0xff,0xfb,0x92,0x64,0x1c,0x00,0x03,0x63,0x5a,0x55,0x6b,0x1a,0x53,0x44,0x37,
-    0x24,0x0a,0xed,0x19,0xe2,0x1c,0x8b,0x4d,0x69,0x6d,0xe7,0xb0,0xf0,0xb1,0x2b,0x99,
-    0x2c,0xbc,0xf3,0x1e,0x0e,0x91,0x88,0x91,0x0a,0xd2,0xe6,0xf9,0xa3,0x11,0x5b,0xb9,
-    0x47,0xeb,0x47,0xd4,0xa7,0x91,0x08,0x63,0xff,0xd4,0xb0,0x16,0x96,0xd5,0x8d,0x6e,
-    0xe4,0xad,0xfe,0xac,0xbe,0x4d,0xea,0xfd,0x0d,0x4c,0xd2,0x52,0x13,0x9f,0xff,0xff,
-    0xea,0x54,0x53,0xa7,0xb8,0xf4,0x97,0xff,0xf1,0xf3,0x6f,0x00,0x01,0xc6,0xc2,0x09,
-    0x8a,0xf2,0x8f,0x13,0x62,0x60,0x65,0x06,0xa2,0xac,0x2f,0x3e,0x47,0xcb,0x9e,0x41,
-    0x90,0x19,0xcb,0xd3,0xfe,0xa3,0xb7,0x12,0x65,0xb8,0x20,0xc9,0x7c,0x51,0x1d,0xd7,
-    0xea,0x61,0x5d,0xbe,0x14,0xae,0xff,0xfe,0x84,0xff,0xff,0xff,0x77,0xfe,0xdf,0x79,
-    0x17,0x97,0x73,0x20,0x03,0x67,0xf9,0xed,0x6b,0x50,0x51,0x65,0xc0,0x9f,0x0b,0xaa,
-    0x29,0x50,0x1a,0x51,0x92,0x47,0x5d,0xf0,0x61,0x38,0x6d,0x12,0x12,0x82,0xc4,0x49,
-    0x59,0xaa,0x25,0x1c,0xda,0xbf,0xab,0xeb,0x79,0xac,0x69,0xc2,0x36,0xd9,0x1c,0x4c,
-    0x4f,0xfd,0x42,0x41,0x9c,0xea,0xb7,0x3c,0x06,0x93,0xea,0x46,0x8d,0xe3,0xed,0x1c,
-    0xf1,0xa8,0xd8,0xbf,0xfe,0x1b,0x22,0xfb,0x33,0x6a,0xc8,0xff,0xff,0xdb,0xff,0xfa,
-    0x7f,0xff,0xff,0xee,0xf5,0x6d,0x23,0x63,0x1f,0xff,0x3c,0xd1,0x0e,0x86,0x00,0x6c,
-    0xd2,0x9d,0x64,0x01,0xfc,0x58,0xe0,0x2e,0x26,0x52,0x30,0x4c,0xe7,0x30,0x06,0x2e,
-    0xb1,0x02,0x36,0x44,0x10,0x10,0x22,0xde,0x43,0xe9,0xc8,0x84,0xab,0xf6,0x31,0x08,
-    0x56,0x41,0x29,0xa8,0x90,0x72,0x52,0xa9,0xf5,0x07,0xa5,0xb3,0x59,0x4e,0xe2,0x90,
-    0x2a,0x18,0xf3,0x28,0xdc,0xee,0xde,0x35,0x2a,0x47,0xfe,0x55,0x09,0x4a,0xa6,0x4b,
-    0xff,0xff,0xff,0xfe,0xa7,0xa6,0x68,0x66,0x42,0x00,0x15,0x8b,0x6d,0x8e,0xd9,0x1d,
-    0x6e,0x4c,0xb3,0xd8,0x9b,0xad,0x42,0xc5,0x70,0x70,0xd8,0x35,0xac,0x53,0xdd,0xf2,
-    0xcd,0x37,0x01,0x5d,0x03,0x63,0xf9,0xd8,0x9c,0x34,0x90,0x50,0x25,0x09,0x08,0x32,
-    0x00,0xf0,0x9a,0xd5,0x1b,0x93,0x77,0x64,0x63,0xc3,0xc0,0x43,0x15,0x94,0xf6,0x47,
-    0x6e,0x42,0x36,0x26,0xf5,0xfe,0x6e,0xbe,0xff,0xfd,0x02,0x9c,0xbf,0x22,0x7a,0x69,
-    0xff,0xcc,0x53,0xf4,0x18,0xae,0xa8,0xbd,0x53,0x96,0x36,0xbf,0xff,0xff,0xa8,0xc0,
-    0x2d,0x7e,0x92,0x54,0x04,0xcc,0xa1,0x80,0x1a,0x46,0xb3,0x6b,0xec,0x93,0x1c,0x64,
-    0xfd,0x4c,0x21,0xff,0xfb,0x92,0x64,0x36,0x80,0x02,0xf1,0x5a,0x59,0x7b,0x09,0x53,
-    0xac,0x46,0xa6,0x6b,0x5f,0x01,0xea,0x0f,0x8d,0x81,0x6b,0x69,0xec,0x3d,0x4f,0x30,
-    0xe8,0x8d,0x68,0xb4,0x2d,0x14,0x74,0xa1,0x0e,0xb2,0x98,0xa7,0xdf,0xb6,0xf9,0x54,
-    0x1b,0xeb,0x25,0xea,0x2d,0x8d,0xec,0x82,0x0c,0x35,0x23,0xc6,0x62,0x20,0x6a,0x9a,
-    0x0d,0xd7,0xfc,0xa1,0xed,0xef,0xea,0xc5,0xbd,0x3f,0xf5,0xe8,0x4c,0xad,0xff,0x41,
-    0x81,0x29,0x68,0x89,0x2c,0x09,0x13,0xff,0x67,0xeb,0xff,0xf1,0x77,0xea,0xa5,0xa5,
-    0xe5,0x0c,0x40,0xda,0x7f,0xbf,0xff,0xa5,0xef,0x27,0xa5,0x0b,0x2d,0x44,0x47,0xb6,
-    0x4c,0x5a,0x56,0xe2,0xbf,0x2c,0x66,0xa5,0x33,0xfc,0x6e,0xc3,0x5f,0x21,0xa2,0x94,
-    0xcb,0x18,0xe9,0x57,0x3d,0xb3,0xd2,0x88,0x46,0x5c,0x60,0xfc,0x3e,0x14,0xfb,0xe3,
-    0x1d,0xac,0x5c,0x54,0x1a,0xf1,0xda,0xb6,0x40,0x36,0xef,0xb4,0xdc,0xf0,0x29,0xb2,
-    0xf3,0x47,0x75,0x73,0xec,0x4d,0x37,0xd0,0xd3,0x8b,0xfe,0x90,0xb8,0x2e,0x25,0x91,
-    0x3e,0x4e,0x6b,0x23,0x7f,0x6f,0xb1,0xc4,0xb6,0x27,0x0d,0x89,0xbf,0xaa,0x77,0x16,
-    0xcf,0xff,0xff,0xff,0x41,0x20,0x75,0x55,0xba,0x49,0x98,0x6b,0x48,0x00,0x6a,0xa2,
-    0x71,0xa6,0x47,0x11,0x1d,0x8b,0xd1,0x3a,0xb6,0x5f,0x15,0xf5,0x66,0x7d,0x1f,0x07,
-    0x83,0x35,0x80,0xaa,0x63,0xb7,0x29,0x0c,0x61,0xac,0xf0,0x0f,0x90,0xe4,0xcb,0xea,
-    0xac,0x9c,0x0a,0x2b,0xab,0x53,0x30,0x0e,0x2a,0xee,0x05,0x7f,0xd5,0x77,0xf8,0xcf,
-    0xff,0xa7,0xff,0xff,0xd5,0x07,0x56,0x22,0x10,0x18,0x8f,0x6e,0x96,0xd6,0x3f,0xf9,
-    0x2b,0x89,0xaf,0xc6,0x02,0xbd,0xbb,0x00,0x2a,0x1b,0x33,0x43,0x8c,0x7c,0xe5,0x08,
-    0x73,0x39,0xa1,0xbd,0x79,0x2d,0xf0,0x78,0x69,0xf0,0xbf,0xe1,0x0d,0xbb,0x84,0xab,
-    0x72,0x8c,0x44,0xe5,0x18,0x26,0x0f,0xb8,0xfa,0xcc,0x3e,0x78,0xeb,0xb6,0xd7,0xde,
-    0x33,0xbc,0x8a,0x6e,0xa7,0xd2,0x9a,0x7a,0x34,0x0d,0x12,0xdb,0xef,0xe6,0xce,0xdf,
-    0xe7,0x5f,0xf9,0x30,0xd0,0xd9,0x17,0x8e,0xad,0x7f,0xfe,0x7a,0x94,0x2e,0x69,0x83,
-    0xe0,0xe0,0x8d,0x59,0xd3,0x3c,0xce,0x78,0x3c,0x37,0xff,0xff,0xfc,0x88,0x28,0x70,
-    0x3a,0xb2,0xa0,0x81,0xcb,0x6d,0x70,0x90,0x31,0x98,0x36,0x52,0xf0,0x15,0x71,0x4e,
-    0xd1,0x35,0x83,0x81,0x4e,0xc6,0x1f,0x88,0x1a,0x4d,0xe5,0xe8,0x4d,0x57,0x9f,0xd7,
-    0xa9,0xee,0xec,0x1a,0x64,0x6c,0x05,0x05,0x26,0x1a,0x7c,0xc6,0xa8,0xf0,0x96,0xb3,
-    0xff,0x26,0x1f,0xff,0xfe,0xff,0xfb,0x92,0x64,0x50,0x00,0x03,0x55,0x55,0xd7,0x7b,
-    0x0f,0x3d,0x2c,0x3c,0xa3,0xfb,0x0f,0x09,0xe7,0x1f,0x8b,0xcd,0x59,0x67,0xec,0x30,
-    0xf2,0xf1,0x0d,0x0d,0xa9,0x71,0x84,0x16,0x4e,0xb1,0x2e,0xef,0xff,0xff,0xff,0xe5,
-    0x5e,0x55,0xcc,0x8c,0x06,0x1e,0xff,0xb7,0xd2,0xc8,0x46,0x4f,0x02,0xc0,0xe0,0xf1,
-    0x39,0x6c,0xb3,0x24,0x74,0x76,0x27,0x26,0xc0,0x4b,0x81,0x74,0xd8,0x54,0x62,0xd4,
-    0xee,0x5e,0x86,0xca,0x85,0xce,0x79,0x1f,0xa6,0x42,0x09,0x9f,0xfd,0x2b,0x3d,0xf8,
-    0xd9,0xe1,0x12,0xd1,0x5d,0xcb,0x6b,0x4f,0x69,0xc1,0x61,0x64,0xf7,0x3c,0xa8,0xd8,
-    0x7e,0xdd,0x7b,0x67,0xb3,0x27,0xf3,0x3d,0x12,0x28,0x00,0xd7,0x25,0x6b,0x98,0x7b,
-    0xcc,0xeb,0xff,0xd3,0xcd,0x7f,0xff,0x9f,0xff,0xff,0xff,0x24,0x07,0x0c,0x30,0xad,
-    0x90,0x00,0xae,0xaa,0xa0,0x3f,0xdd,0x88,0x06,0xfb,0xb9,0x2f,0x50,0x09,0xc0,0x43,
-    0x0c,0x42,0x68,0x14,0xe8,0x27,0x63,0xb4,0x05,0x5b,0x9b,0xe9,0x07,0x41,0xd9,0x6d,
-    0xbe,0x57,0x8d,0x3d,0x9c,0x23,0xf2,0x0f,0x80,0x79,0x55,0xaa,0xa4,0x70,0xee,0xc8,
-    0xbc,0x70,0x33,0xd6,0x84,0x33,0x6e,0xdf,0xbb,0xc1,0xd6,0x41,0x2f,0xfe,0xbf,0xff,
-    0xff,0x1c,0x96,0x30,0x00,0x0e,0xc8,0x9d,0x71,0x31,0x2d,0xc7,0x6f,0xfd,0x89,0x2c,
-    0x49,0xc7,0x93,0xa1,0xd1,0x60,0x65,0x9e,0x99,0xb6,0xf2,0x5a,0x22,0x62,0xaa,0x9e,
-    0xe3,0xea,0xbb,0xae,0xbd,0xe3,0x82,0xa0,0x5a,0xa9,0x1e,0xbf,0x0c,0x56,0xaa,0x3d,
-    0xc7,0x17,0xff,0x46,0x21,0xfc,0x72,0x72,0x73,0x0c,0x99,0x76,0x52,0x0b,0x3b,0xfa,
-    0xff,0x43,0xa7,0x0b,0x52,0x69,0x9c,0x6c,0xdd,0xb6,0xff,0xec,0x67,0xff,0xd9,0xbf,
-    0xff,0xff,0xe4,0x02,0x31,0x8b,0xfd,0x45,0x07,0xb6,0xb6,0xdb,0x24,0x51,0x7e,0x6a,
-    0x7f,0x92,0x95,0x51,0xb9,0x85,0x39,0x5d,0xbb,0x02,0x24,0xf2,0xca,0xe0,0x66,0x93,
-    0x26,0x7a,0x76,0x3d,0x87,0x4d,0x8b,0x4b,0x69,0x8d,0x6c,0x01,0xa5,0xd3,0xe6,0x44,
-    0x55,0xae,0xdd,0x74,0x8b,0x7c,0x62,0x42,0xd7,0xf2,0x0b,0x87,0x1b,0x95,0x3e,0x72,
-    0x4a,0xb3,0x7d,0xbf,0x51,0x27,0x33,0x93,0x5a,0xff,0xff,0xe7,0xe8,0x72,0x7f,0xfd,
-    0xbf,0xff,0xff,0xea,0x03,0x86,0x38,0xfe,0x00,0x01,0x8e,0xc7,0x2a,0x91,0x07,0xa6,
-    0x08,0x88,0xbb,0xae,0xcb,0x2f,0xb4,0xb2,0x86,0x8f,0x9d,0x45,0x8d,0x96,0x6f,0x42,
-    0x74,0x83,0xe1,0x93,0x68,0x32,0x86,0xf8,0x03,0x0a,0x8e,0x22,0x1d,0x2a,0xcd,0x00,
-    0x93,0xf6,0xcd,0xce,0x17,0x8d,0x5b,0xff,0xfb,0x92,0x44,0x6a,0x80,0x02,0x9c,0x55,
-    0xd5,0x6b,0x2f,0x3b,0xcc,0x51,0x2a,0xca,0xed,0x3d,0x65,0x89,0x8a,0x21,0x55,0x57,
-    0xa0,0x60,0xe1,0xb1,0x43,0x2a,0xe9,0x71,0x95,0x96,0x26,0xf2,0x31,0xaa,0xd2,0x63,
-    0xd0,0xf5,0x61,0xfa,0x2a,0x7f,0xff,0xea,0x67,0x43,0xea,0x7b,0x7f,0xf5,0xaf,0x51,
-    0x68,0xdd,0xf7,0xe8,0xfe,0xa4,0xbf,0xff,0xff,0xd0,0xd1,0x48,0xbe,0x00,0x02,0x93,
-    0xff,0xf0,0x3f,0xf3,0xc5,0xea,0x2f,0x98,0xc0,0x2c,0xd3,0x06,0x32,0xc3,0x2e,0xd4,
-    0x30,0x5e,0x5f,0x94,0xe2,0x8c,0x0f,0x98,0xb9,0x93,0x3f,0x0d,0xa1,0x2a,0x36,0x5b,
-    0xac,0x9b,0x60,0xc4,0xd6,0x7e,0x93,0x5c,0xff,0x1f,0x48,0xd7,0x00,0x0c,0x4d,0x66,
-    0x9c,0x4c,0x3b,0x74,0xbe,0xef,0xe7,0x64,0x7e,0x5e,0x94,0x4f,0x82,0x8a,0x94,0xab,
-    0xd8,0x47,0x4d,0x7f,0xff,0xef,0xff,0xff,0xff,0xff,0xff,0x1a,0xf5,0x1f,0xc2,0x00,
-    0x36,0x4b,0x2d,0xb2,0x31,0xff,0x66,0x01,0x7f,0x1a,0xcc,0x4d,0xd9,0xbd,0x40,0xef,
-    0x7d,0xd2,0xa0,0xf1,0xda,0x2f,0x38,0x70,0xd2,0xda,0xdc,0xce,0xe2,0x3b,0xce,0xf5,
-    0x95,0x0c,0xdb,0x99,0x19,0x5f,0x9d,0x4a,0x59,0x2d,0xc6,0xb4,0xee,0xc4,0xd9,0x08,
-    0x60,0x71,0xfe,0xe2,0xa9,0x91,0x5c,0x9d,0xff,0x4a,0x8f,0x26,0x79,0xdd,0xdb,0xea,
-    0x25,0x92,0x31,0x8b,0xea,0xba,0xb7,0xff,0xd5,0xb5,0x21,0x13,0x8b,0xfe,0xbf,0x72,
-    0x15,0x5f,0xff,0xff,0xe5,0xc5,0x41,0xb0,0xb0,0x00,0x02,0x8a,0x34,0xd2,0x24,0x0f,
-    0xf8,0xfc,0xa6,0xbb,0x91,0x5e,0x5b,0xc6,0x64,0x03,0xba,0x2f,0x40,0x14,0x92,0x55,
-    0x80,0xed,0x66,0x88,0x08,0x50,0x3c,0x25,0x3f,0x93,0x8b,0xc9,0xab,0xfc,0x60,0x8a,
-    0x03,0x29,0xae,0x27,0x59,0x97,0x4e,0x03,0x47,0xd7,0xaf,0xd3,0x76,0x81,0x82,0x77,
-    0xd6,0x70,0x23,0xe1,0x14,0xba,0x7d,0x9f,0xff,0x6f,0xc8,0xaa,0xa2,0x9f,0xff,0xe4,
-    0x8d,0x7f,0xff,0xf4,0x8b,0x10,0x00,0x39,0x1b,0x6d,0xc6,0xc8,0xff,0xc2,0xc4,0x19,
-    0x4f,0x83,0xaf,0x5d,0x84,0x2f,0xdb,0xd2,0xa3,0x00,0xa7,0x9a,0x94,0x64,0x42,0x35,
-    0xc5,0x0f,0x0e,0x69,0xc5,0x97,0x03,0x56,0x56,0x51,0xf4,0x81,0x14,0x28,0xc0,0x6a,
-    0x91,0x17,0x46,0x25,0x7b,0x29,0xd9,0x00,0x06,0x3b,0xfa,0x91,0x32,0x91,0xfc,0xd7,
-    0xf6,0xaf,0xf9,0x94,0xed,0x13,0x47,0xf9,0x72,0xfc,0xc3,0xd1,0x17,0xff,0xce,0xcb,
-    0x66,0x8c,0x45,0x86,0xfd,0x3e,0x60,0xc3,0xff,0xff,0xfe,0x82,0x57,0xff,0xff,0xd6,
-    0x25,0x00,0x00,0x32,0x55,0xcb,0x40,0x43,0x30,0xff,0xfb,0x92,0x64,0x86,0x00,0x02,
-    0xd5,0x55,0xd5,0xeb,0x0f,0x53,0xcc,0x4c,0x86,0x3a,0x2d,0x65,0x62,0x89,0x8b,0x79,
-    0x55,0x4d,0xac,0xa1,0x50,0xf1,0x23,0x10,0x67,0x74,0x2d,0x20,0x7c,0xd7,0x2a,0xdb,
-    0x70,0x63,0xb0,0x94,0x3a,0x3f,0x34,0x86,0x65,0xda,0x30,0xc5,0xc4,0x5a,0x4f,0x40,
-    0xc6,0xd9,0x33,0x6d,0x6e,0x9a,0x33,0x6e,0xec,0xdf,0x02,0xcd,0x56,0x29,0xe8,0xc4,
-    0x80,0x28,0xac,0xfc,0xcd,0xf8,0x90,0x43,0x29,0x3e,0xf7,0x4b,0xcd,0x15,0xe5,0x5d,
-    0xb9,0xe6,0xb1,0x44,0x40,0x80,0x0f,0xff,0xff,0xff,0xff,0x16,0x52,0x0e,0x90,0x00,
-    0x0e,0x38,0xdc,0x72,0x33,0xff,0xb9,0x50,0xe0,0x13,0xed,0x0e,0xa6,0x7a,0xb5,0x88,
-    0xc6,0x8c,0xfc,0x36,0x1e,0x76,0x42,0x29,0xd5,0x65,0xd0,0x28,0x28,0xfe,0x38,0xa0,
-    0x3b,0xed,0x4b,0x92,0x76,0x15,0x53,0xee,0x98,0xad,0x69,0x2b,0x9e,0xe5,0x5c,0xdb,
-    0x2f,0x47,0x3c,0xee,0xeb,0x7d,0xcc,0xd1,0xaa,0x2e,0x8b,0xd2,0x7b,0x7d,0x12,0xa0,
-    0xbb,0x51,0xeb,0xf4,0x5f,0x52,0xff,0x53,0xf9,0xff,0xc5,0xc9,0xb7,0x53,0xd7,0x5f,
-    0xff,0x5a,0x16,0xd4,0xb0,0x68,0x4b,0xff,0xea,0x3f,0xff,0xff,0xff,0x96,0x11,0x63,
-    0x57,0xfe,0x9f,0xff,0xff,0xff,0xf3,0x4b,0x8b,0xd8,0x2c,0x5d,0xa5,0x96,0x80,0xd0,
-    0xe4,0xa4,0x5d,0x44,0x63,0xf2,0x27,0xf0,0xbb,0x09,0x01,0x8f,0x94,0x89,0xca,0x00,
-    0xad,0x4e,0x94,0x8e,0x39,0xd3,0x43,0xb9,0xeb,0xd6,0xbb,0xa4,0x1e,0x9f,0x51,0x53,
-    0xf6,0x05,0x5c,0xfd,0x73,0x4f,0x90,0x4a,0xac,0x5d,0x0f,0xff,0xff,0xfe,0x83,0x3f,
-    0xff,0xfd,0x00,0xca,0x84,0x00,0x02,0xf1,0xac,0x96,0x36,0x87,0xfe,0x6f,0x46,0xdb,
-    0x03,0xf8,0xcf,0xe9,0x13,0x4c,0x89,0x2b,0xf9,0x83,0x89,0x97,0xe0,0x42,0x38,0xdb,
-    0x44,0xc5,0x19,0x7e,0x9f,0x56,0x5c,0xc4,0x07,0x53,0xc7,0xa8,0x70,0x66,0xad,0x35,
-    0x1d,0xe2,0xa9,0x39,0x0a,0x1b,0xf6,0x36,0x05,0x5b,0x0c,0x7f,0x5c,0x3e,0x9b,0xb7,
-    0xab,0xa0,0xdb,0xa1,0xf5,0x2c,0x37,0x7a,0xb7,0x39,0xbb,0x0c,0x49,0xce,0x27,0x7a,
-    0x99,0xe6,0x7d,0x4a,0x08,0x77,0x67,0x7e,0x61,0xff,0xff,0xf9,0xfa,0x90,0x12,0xbf,
-    0xeb,0xf9,0x2f,0xff,0xff,0xfa,0x28,0x62,0x78,0xb5,0x20,0x42,0x96,0xb4,0xec,0x00,
-    0x0f,0x92,0x21,0x68,0xba,0xdb,0x61,0x95,0xa3,0x1f,0x64,0x8b,0xf2,0x5d,0x5d,0xa2,
-    0x94,0x8d,0xb0,0xd6,0xb3,0xa9,0xa7,0x2d,0x00,0xce,0xe0,0xa8,0x1a,0x25,0x41,0x9a,
-    0xf6,0xfa,0x29,0xae,0x24,0x66,0x48,0x78,0x39,0x49,0xd1,0xff,0xfb,0x92,0x64,0x9f,
-    0x00,0x03,0x59,0x6b,0xcf,0x6b,0x6f,0x54,0x44,0x3a,0x43,0xfa,0xcd,0x05,0xe8,0x1d,
-    0x8c,0xc9,0x57,0x4f,0xec,0xbd,0x4f,0x70,0xf2,0x8a,0xa9,0xb4,0xbc,0x18,0xe6,0x01,
-    0xa0,0x50,0x41,0x3b,0x2c,0x1d,0xc5,0xc9,0x80,0x2a,0x1a,0xb0,0x40,0x32,0x26,0xad,
-    0x89,0xa1,0xff,0x6d,0xe8,0x6c,0xac,0x6a,0x44,0xde,0xce,0xab,0x2a,0x3d,0x50,0xe8,
-    0x02,0x28,0x4e,0x8a,0x8d,0x0c,0xd4,0x45,0xcd,0xef,0x0e,0x5b,0x87,0x1d,0xa1,0x1f,
-    0x29,0x5c,0xac,0x89,0x2d,0x6f,0xfb,0xae,0x49,0x3f,0xec,0xee,0x45,0x41,0xa8,0x6c,
-    0x44,0x59,0xf5,0x7c,0xf1,0x8e,0x31,0x95,0xe4,0xf4,0xfd,0x48,0x51,0x6b,0x7d,0xff,
-    0xff,0xf4,0xd5,0x01,0xff,0xfe,0x43,0x7f,0xff,0xff,0xa0,0xf6,0x0d,0x13,0x50,0x80,
-    0x12,0x58,0xac,0x81,0x01,0xff,0xbc,0x9a,0x2a,0x5b,0x27,0x12,0x86,0xd9,0x80,0x51,
-    0xf2,0x96,0xe2,0x02,0xad,0x5c,0x2c,0x1d,0xad,0x55,0x67,0xf5,0xa8,0xaf,0xa9,0x1a,
-    0x6f,0x9d,0x37,0x35,0xbd,0x10,0x08,0x91,0xa8,0x80,0xf8,0x3d,0x48,0xfb,0x62,0x28,
-    0xbb,0x30,0xe5,0x62,0xa5,0x85,0xc5,0x10,0x8a,0x95,0x6a,0xae,0x63,0x0d,0x16,0x5f,
-    0x7f,0xbb,0x3e,0xb1,0x49,0x87,0x37,0xff,0xff,0xfa,0x36,0x84,0xd3,0xf2,0xdf,0xff,
-    0x33,0x35,0x80,0x00,0x6d,0x71,0x59,0xf2,0xaf,0x73,0x48,0x23,0x53,0xc7,0x8d,0x57,
-    0x23,0x53,0xd0,0x21,0x2a,0xfd,0x93,0x11,0xd0,0xd8,0xed,0x58,0x36,0x40,0x14,0x89,
-    0x1a,0xe1,0x71,0x5a,0x88,0x31,0x18,0xaf,0x57,0x1e,0x58,0x8c,0x57,0x34,0x6f,0xf2,
-    0x13,0xa2,0x64,0x65,0x70,0x44,0x0c,0xc2,0x17,0x21,0x3d,0x02,0x04,0x6e,0x87,0xff,
-    0xf5,0x06,0xff,0xff,0xff,0xea,0x7d,0x54,0xdf,0xff,0xab,0xff,0xff,0xff,0x53,0x98,
-    0x58,0xdd,0xa0,0x01,0x72,0xeb,0x6c,0x0d,0x0f,0xde,0x28,0x0a,0x80,0x1d,0x10,0xb3,
-    0x70,0xfd,0x2c,0x27,0xba,0x17,0x0c,0xf7,0xbe,0x0f,0x51,0xe0,0xb8,0xf7,0xf5,0xfb,
-    0xde,0xef,0xde,0x61,0x33,0x28,0x9e,0x46,0x25,0xce,0x18,0x72,0x70,0x79,0xca,0x30,
-    0xf6,0xec,0xb5,0x16,0x2b,0x22,0xd6,0x6d,0x73,0x18,0x24,0x2a,0x2f,0xb7,0x44,0x3b,
-    0xc6,0x3a,0xa7,0xff,0xd3,0x29,0xdf,0xff,0xff,0xfe,0x9c,0x48,0x77,0xff,0xcb,0xff,
-    0xff,0xff,0x8c,0x7a,0x9a,0x30,0x00,0x4e,0x44,0xac,0x8d,0xa1,0x2d,0x5d,0x27,0x6a,
-    0x85,0x29,0x91,0xdd,0x70,0x2d,0x2f,0x5f,0x00,0x42,0x7d,0xb5,0xc0,0x20,0xa7,0x3b,
-    0x9e,0x37,0x2c,0x1b,0x61,0x79,0xbb,0xc3,0x96,0x8c,0xda,0x7c,0xca,0xff,0xfb,0x92,
-    0x44,0xb9,0x81,0x02,0x98,0x55,0xd3,0xeb,0x08,0x2c,0x5c,0x53,0xe8,0x1a,0x4d,0x61,
-    0xe7,0x77,0x89,0xf9,0x57,0x57,0xa7,0xa4,0x4f,0x31,0x4b,0xaa,0xea,0x74,0xf6,0x15,
-    0xee,0xce,0xb5,0xc1,0xc0,0x5e,0x7e,0xc4,0x8b,0x6f,0xc8,0x8e,0x47,0x06,0xe4,0x2b,
-    0xe6,0x13,0xec,0x28,0xaf,0xd9,0x13,0xed,0xf0,0x6e,0x53,0xfb,0x7f,0xfb,0x7d,0x48,
-    0xb5,0x38,0x8f,0xe8,0xff,0x12,0xff,0xff,0xff,0xe5,0x18,0xcf,0x34,0x40,0x05,0x37,
-    0x1c,0x71,0xb4,0x37,0x93,0x5e,0x7f,0xed,0x3f,0xd1,0xa7,0xd3,0x49,0xea,0x78,0x14,
-    0x35,0x34,0xb4,0x2b,0x6d,0xe0,0x22,0xca,0x5a,0x3d,0x2d,0x6d,0xff,0xe0,0x7c,0x97,
-    0x02,0x3d,0xfe,0x69,0xe4,0x07,0x66,0xa9,0xa7,0xbe,0x8d,0x9b,0x1c,0x18,0xf5,0x4b,
-    0x20,0xef,0x6f,0x46,0xe9,0xbe,0x67,0x7f,0xab,0x66,0x93,0xf5,0x9e,0xa4,0x1d,0x97,
-    0xff,0xed,0x34,0x78,0x47,0x34,0xdf,0xff,0x3b,0xff,0xff,0xff,0x10,0x19,0x3d,0xa1,
-    0x80,0xa4,0x85,0xc9,0x23,0x43,0xfb,0x0c,0xbd,0x2e,0xcb,0x14,0x83,0x56,0xb5,0xa7,
-    0xc0,0xb3,0x72,0xaa,0x13,0x7a,0x2f,0x72,0x36,0x4d,0x71,0x6b,0x0b,0x65,0xdb,0x4b,
-    0x47,0xcc,0xbb,0x3a,0xd2,0xe0,0x58,0x8d,0x6a,0x6a,0x01,0xed,0xd0,0x6c,0x8e,0x8a,
-    0x3a,0xdb,0xaf,0x56,0x28,0xed,0x9e,0x6f,0xb8,0x66,0x9d,0x7f,0xfe,0x6a,0x21,0x44,
-    0xf4,0x7f,0xfa,0x3f,0xdd,0x93,0x38,0xdf,0xff,0x45,0x4f,0xff,0xff,0xf5,0x41,0x53,
-    0x3d,0x58,0x04,0x26,0xdd,0x9a,0xa8,0xc8,0xfe,0xca,0x68,0xdd,0xd6,0x72,0xe8,0x2a,
-    0x69,0xe5,0x80,0x27,0x0d,0x15,0xc4,0x42,0x5c,0x1b,0x82,0x81,0x4b,0x08,0x82,0x73,
-    0x64,0xd7,0x6f,0xf5,0x00,0x44,0x08,0x87,0xb9,0xf1,0xe4,0x8f,0x64,0xe1,0xa9,0xbe,
-    0xfb,0xf7,0x6a,0x8d,0x3f,0x17,0x8e,0x97,0x54,0x1b,0x45,0xc7,0x29,0x24,0x66,0xd3,
-    0x51,0xbf,0xff,0xd0,0x43,0xea,0x8f,0x0c,0x52,0xff,0xfe,0x9a,0x06,0x07,0xfa,0x1b,
-    0xff,0xe4,0x2a,0x16,0xc0,0x00,0x56,0xa2,0xa4,0x89,0x11,0xff,0x7d,0xba,0xa5,0x3b,
-    0x4f,0x50,0xe4,0xbd,0xb4,0xb6,0x89,0x83,0x5a,0x7e,0x0e,0xe1,0xd4,0x99,0x95,0x12,
-    0x0d,0x10,0x16,0x6c,0x43,0xc1,0x5e,0xeb,0x30,0x33,0xab,0x6a,0x95,0xd8,0x92,0x4c,
-    0x6e,0x5a,0xca,0x29,0x2c,0xfa,0x01,0xe0,0x09,0xf3,0x8a,0x3d,0xc2,0x3d,0x3d,0x86,
-    0x0e,0x01,0x1a,0xa0,0x23,0xf8,0x9d,0xc8,0x47,0x95,0xfd,0x11,0x7c,0xec,0x83,0x4c,
-    0x3b,0xaa,0x7f,0xf5,0xf5,0xd3,0x30,0x3f,0xfe,0xb9,0x8f,0xff,0xff,0xfe,0xa4,0xff,
-    0xfb,0x92,0x44,0xd3,0x80,0x02,0x9b,0x55,0xd5,0x69,0xed,0x15,0x9c,0x52,0x8a,0xba,
-    0x7d,0x61,0xe7,0x77,0x8a,0x49,0x57,0x55,0xac,0x30,0xee,0xf1,0x48,0xa0,0x6a,0x35,
-    0x85,0x89,0xf6,0x12,0x0c,0xff,0xff,0xfa,0x4e,0x00,0x0c,0x08,0xef,0xac,0x23,0xfb,
-    0x4a,0xcf,0xd6,0xdb,0xf3,0x2a,0x0e,0x0f,0x01,0x27,0x00,0x7e,0x0c,0x6e,0x6c,0xbd,
-    0xc2,0x20,0x33,0x2b,0xa1,0x01,0x32,0xa7,0x30,0xe0,0xb9,0x81,0xfe,0x26,0xf2,0x66,
-    0xbf,0x76,0x49,0x63,0x52,0xf7,0x52,0x21,0x42,0x28,0xbd,0x07,0xc5,0xa2,0x22,0xbf,
-    0xee,0x22,0x5c,0x63,0x20,0x79,0xf0,0xf0,0xa7,0xa1,0x71,0xbe,0x82,0xff,0xd5,0xbe,
-    0x6c,0xa4,0x15,0x4e,0x9d,0x3f,0xff,0xdb,0x3b,0xff,0xfd,0xff,0xff,0xff,0xf4,0x1c,
-    0x9f,0xff,0xff,0xff,0xff,0xf8,0x6d,0x61,0x50,0x00,0x07,0x54,0x0d,0xbd,0xd2,0x3f,
-    0xf1,0xc9,0x16,0x01,0x20,0x87,0xf9,0xba,0xcb,0x92,0x18,0x0c,0xbb,0x51,0xd1,0xd3,
-    0x01,0xd4,0x51,0x65,0x01,0xe6,0x76,0x1c,0x11,0x39,0xe1,0xac,0x1c,0x23,0x4a,0x98,
-    0x32,0x65,0xe2,0x88,0xcd,0x6d,0x47,0xa2,0xb5,0x27,0x25,0xea,0x48,0xd8,0xbd,0xe2,
-    0xc4,0x15,0x27,0xbd,0x4b,0x54,0xc2,0xa4,0x36,0x6f,0x28,0x48,0x23,0xd4,0x8f,0xcd,
-    0x4a,0x5e,0xd7,0xe6,0xfd,0x37,0x1e,0x17,0x2f,0xff,0xff,0xd7,0x46,0x45,0x1c,0xff,
-    0xfb,0x16,0xff,0xff,0xff,0xb4,0xb7,0xff,0xff,0xff,0xff,0xfd,0x94,0x90,0x80,0x00,
-    0x00,0xa9,0xe9,0xbe,0x8c,0x8f,0xd5,0xd5,0x14,0x6e,0x31,0x04,0xf7,0x7d,0x01,0x41,
-    0x23,0x12,0x9d,0x84,0xfb,0xe2,0x43,0x61,0x10,0x1c,0xc1,0x50,0x13,0x29,0x81,0xe8,
-    0x40,0x84,0x43,0x92,0x43,0x42,0xe0,0xb5,0x27,0x0e,0x4f,0xc5,0x2d,0xe1,0x9e,0xb4,
-    0x04,0xd4,0x2c,0x50,0x8c,0xca,0x40,0x9c,0x92,0x8e,0x09,0x42,0xba,0x91,0x79,0xe1,
-    0xa4,0x1f,0x36,0xd2,0xd6,0x54,0x20,0x69,0xf4,0x36,0x5f,0x40,0x68,0xd5,0xfb,0xfa,
-    0x3e,0x64,0x1a,0xde,0xff,0xff,0xfd,0xb4,0xff,0xfd,0xbf,0xff,0xff,0xf8,0xef,0xf7,
-    0xff,0xff,0xff,0xff,0x8d,0x16,0xae,0x00,0x00,0x09,0x33,0x2d,0x68,0x0f,0xc3,0x3a,
-    0xa8,0x34,0x8c,0x8c,0x5c,0x38,0x82,0x62,0x40,0x08,0xab,0x1c,0xe1,0x2e,0x80,0x40,
-    0x0c,0xc6,0x21,0x93,0x53,0x16,0xc2,0x4d,0x44,0x41,0xa9,0x84,0x64,0x01,0xcc,0xe4,
-    0x61,0x83,0x81,0x00,0x28,0x2e,0x60,0xb0,0x34,0x66,0x9b,0x1c,0xa6,0xa3,0x15,0x68,
-    0xa0,0x1c,0x75,0x84,0x1f,0x67,0xf1,0xa5,0x66,0x2b,0xb5,0xb7,0xff,0xf9,0x09,0x1d,
-    0x47,0xff,0xfb,0x92,0x44,0xed,0x00,0x03,0x0a,0x55,0xd1,0xeb,0x47,0x2d,0x1c,0x5f,
-    0x2d,0x89,0x8a,0x6d,0xa5,0x84,0x0c,0xc9,0xaf,0x31,0xae,0x34,0xf4,0x41,0xa4,0xb6,
-    0x25,0xf5,0xc6,0x96,0x60,0xe2,0x48,0x85,0x69,0xdf,0x88,0xe1,0xa1,0xd3,0x7f,0x39,
-    0x77,0x2f,0x2a,0x72,0xf6,0x7f,0xe8,0xc3,0x71,0x39,0x7d,0xff,0xff,0xfb,0x58,0x97,
-    0xfe,0xbe,0x7f,0xff,0xff,0xfd,0xd4,0x70,0xea,0x7d,0xbf,0xff,0xff,0xff,0xd8,0x47,
-    0x32,0x64,0x5d,0x09,0x02,0x6b,0x2c,0xb6,0x00,0x47,0x22,0x89,0x0c,0xcc,0xa1,0xb1,
-    0x23,0x45,0x94,0x68,0x2e,0xb9,0x24,0x4c,0x64,0x72,0xdf,0x80,0x00,0xd1,0x12,0xe2,
-    0xc6,0xc9,0x77,0x8f,0xe4,0xed,0xd1,0x2d,0xac,0xb9,0x6f,0xc7,0xd7,0x84,0xfc,0x98,
-    0x84,0x67,0x1b,0xff,0xe6,0xff,0xd9,0x4f,0x15,0xbc,0xb9,0x72,0xbc,0x56,0x4d,0x7f,
-    0xef,0xff,0xff,0xff,0xff,0xd2,0xc0,0x00,0x00,0x61,0xd6,0x90,0x19,0x63,0x34,0xd2,
-    0x52,0x3d,0x1b,0x10,0xa0,0x80,0x0c,0xc5,0x81,0x4c,0xd2,0x64,0x0c,0x85,0x86,0x06,
-    0x40,0x1a,0xb7,0x8c,0x07,0xd0,0xc0,0x42,0x08,0xce,0x58,0x80,0x00,0xcc,0x74,0x02,
-    0x98,0xb7,0x60,0xe0,0x29,0x4f,0xa6,0xf6,0x7a,0x86,0x9a,0xaf,0x6b,0xcc,0xf3,0x56,
-    0xff,0x38,0xce,0x7f,0x4f,0xf3,0x31,0x46,0x85,0x9f,0xfa,0x2e,0xae,0x32,0x0f,0x9e,
-    0x8b,0xe4,0x02,0x48,0x2b,0x24,0x6e,0xbd,0x0d,0xc4,0x03,0xcd,0xa7,0x4f,0xf7,0x3c,
-    0x49,0x57,0xec,0xf4,0xff,0xfd,0xaa,0xd6,0x1d,0xff,0xa7,0x9c,0xdf,0xff,0xff,0xe6,
-    0x11,0x8a,0x1a,0xde,0x87,0xff,0xff,0xff,0xff,0x67,0x11,0xc3,0x89,0x28,0xe4,0x80,
-    0x02,0x34,0x96,0x68,0x01,0xff,0xf0,0x12,0xa8,0xbe,0x0d,0x75,0x01,0x8c,0xd0,0xc0,
-    0xe2,0xf3,0x89,0x98,0x84,0x81,0x66,0x00,0x0d,0x98,0x23,0x38,0x65,0xa0,0x22,0xa7,
-    0x02,0x1f,0x0d,0x7e,0x56,0xb6,0x34,0x0e,0x7e,0x65,0x42,0xce,0x9b,0xf2,0xfa,0x05,
-    0x1c,0xa0,0x59,0x76,0x95,0x80,0x9b,0x57,0x5d,0xc0,0x11,0xf5,0xf8,0x36,0x7d,0x55,
-    0x02,0x9b,0xff,0xa1,0x1f,0xff,0xff,0xff,0xf8,0xc4,0xd5,0x34,0x00,0x1d,0xb9,0x2c,
-    0x6d,0x0f,0xfe,0x3a,0x6f,0xeb,0x0c,0xc5,0xa9,0xaf,0x62,0x11,0x63,0x02,0x27,0x75,
-    0x91,0xf4,0xcf,0x6a,0x43,0x16,0x5c,0xe0,0xb1,0x91,0x91,0x11,0x81,0xcc,0xaf,0xac,
-    0x27,0x90,0x26,0xbc,0x17,0x37,0xdb,0xb4,0xf7,0xc1,0xdd,0x3c,0xf4,0xf7,0x4c,0x2a,
-    0x29,0xfc,0x7b,0xb4,0x41,0x37,0xea,0xa3,0x21,0xb7,0xad,0xb1,0x7b,0xdf,0xca,0x4a,
-    0xd0,0x71,0x7f,0xff,0xfb,0x92,0x64,0xe4,0x00,0x03,0xb6,0x6b,0xc9,0xd3,0x9d,0x53,
-    0x50,0x44,0x23,0x5a,0x5d,0x03,0x0f,0x0d,0x8f,0x11,0xb7,0x23,0x4d,0xf9,0x49,0xc1,
-    0x2f,0x10,0x25,0x29,0xc3,0x0a,0x10,0xae,0xd4,0x59,0x05,0xcc,0x61,0x66,0xf5,0xff,
-    0xa0,0x21,0xff,0xff,0xff,0xd7,0x51,0x8b,0xff,0xf2,0xff,0xff,0xff,0xdc,0x2c,0x77,
-    0xff,0xff,0xff,0xff,0xff,0x1d,0x50,0xa0,0x00,0xc9,0xbb,0x00,0x00,0x26,0x12,0x21,
-    0x75,0xf8,0x5a,0xa2,0x40,0x53,0x00,0x12,0x4d,0x6c,0x32,0x40,0x0a,0x78,0x98,0x57,
-    0x5a,0x62,0x20,0x9a,0xd8,0x00,0x82,0x0d,0x02,0x57,0x03,0x03,0x59,0x14,0x13,0x03,
-    0x9b,0x6b,0xd7,0x3f,0xbb,0x27,0x7d,0x37,0x19,0xfc,0xd1,0x41,0x3e,0x7c,0xf7,0x51,
-    0x6d,0x19,0x10,0xb6,0x66,0xd4,0xe7,0x3d,0x54,0x64,0x50,0xf7,0x6b,0x59,0xa0,0x0f,
-    0xfc,0x08,0x35,0xb0,0x30,0x64,0x91,0xcb,0x23,0x43,0xfe,0x28,0xcc,0x5d,0xb5,0x69,
-    0x44,0x54,0xfe,0x89,0x04,0x04,0x8c,0x5d,0x30,0xc9,0x23,0x85,0x0c,0xa5,0x2f,0x98,
-    0xd4,0x69,0x7e,0xf9,0xc3,0xf2,0xf2,0xf8,0x01,0x81,0x72,0x59,0x3c,0x48,0x12,0x01,
-    0xa1,0x30,0x98,0x79,0x31,0x98,0x02,0x60,0xdc,0x4b,0x56,0x38,0x1e,0x89,0x67,0xe6,
-    0x6b,0x2b,0x34,0x59,0x0a,0xf2,0x41,0xe7,0xaf,0x7d,0xb5,0xeb,0xfe,0xac,0x93,0x0f,
-    0x16,0x2c,0x06,0x85,0x85,0x8b,0x16,0x1f,0xbe,0x76,0x4f,0xb5,0xdf,0xb6,0xd2,0x73,
-    0xa6,0x69,0x4a,0x5e,0xff,0x37,0x3b,0x33,0xb9,0x03,0xcb,0xee,0x37,0x3c,0x7d,0x4c,
-    0x4f,0xea,0x7d,0x0c,0xbe,0xe4,0x7f,0xa7,0xdc,0xe6,0xff,0xff,0xfe,0xd0,0xbb,0x1e,
-    0x00,0x04,0x01,0x52,0x30,0x05,0x4a,0x48,0xe5,0xbe,0x48,0x9f,0xe5,0xf0,0x6e,0x1f,
-    0x2b,0x51,0xc3,0xa1,0xe0,0x37,0x6a,0x9c,0x2a,0x59,0xc7,0x60,0x09,0xf6,0x3f,0x02,
-    0x51,0x80,0xc0,0x64,0xc9,0x85,0x80,0x08,0x21,0x06,0x10,0x08,0x43,0xb4,0x3d,0x83,
-    0xa7,0xde,0xe0,0x81,0x0f,0x0f,0xa2,0x08,0x59,0x34,0xee,0xef,0xc3,0x90,0x42,0x20,
-    0x82,0x11,0x10,0x9d,0xdd,0xdb,0xdf,0xfd,0xa3,0x3f,0xf1,0x17,0x7f,0xfb,0x27,0xb2,
-    0xdf,0xa3,0xd5,0x50,0xb0,0x00,0x00,0x86,0xe4,0xb1,0x91,0x29,0x95,0x57,0xb1,0x76,
-    0x00,0x88,0xbc,0x12,0x15,0x0f,0x05,0x45,0x03,0xb5,0x83,0x47,0xa7,0xb5,0xae,0x03,
-    0x53,0xcf,0x7c,0xbc,0xbe,0x4f,0xf3,0x5a,0x8b,0x46,0xa1,0xea,0xd6,0xad,0x5d,0xbd,
-    0x57,0x9c,0xab,0xb9,0x37,0xf2,0xed,0x9c,0x39,0x8e,0x34,0xb3,0x32,0xbc,0xb5,0x4f,
-    0x4d,0x11,0x06,0x07,0x32,0xff,0xfb,0x92,0x64,0xe3,0x00,0x03,0x3d,0x6c,0x4d,0x53,
-    0x6f,0x2b,0xe4,0x4b,0x44,0x19,0x5a,0x0b,0x89,0x1d,0x0f,0xa9,0x57,0x4d,0xac,0xb0,
-    0xf1,0xf1,0x4c,0x98,0xa7,0x28,0x0c,0x98,0x3d,0xf8,0x3b,0x53,0x12,0xbb,0xdc,0xc2,
-    0x9a,0xba,0xd5,0x90,0x63,0xbd,0x59,0xd3,0x47,0x1e,0x99,0x3b,0xed,0xa7,0x1d,0x71,
-    0xe7,0x53,0xcd,0x0f,0x3a,0xdd,0xdb,0x5a,0x5b,0x86,0xd7,0x55,0xe6,0xb6,0xf5,0x92,
-    0xf5,0x6a,0xdb,0xaf,0xff,0xf9,0x35,0x5c,0x00,0x82,0xa3,0x92,0x58,0xda,0x1c,0xeb,
-    0x93,0x3b,0x51,0xda,0x6b,0xcd,0x02,0x95,0xbb,0xbe,0x93,0x65,0xc9,0x32,0x59,0x80,
-    0xcb,0x67,0x56,0xd8,0x41,0xe7,0xb5,0xf2,0xdd,0x34,0xf6,0xb0,0xf7,0xe5,0xd8,0x7e,
-    0xa9,0xe0,0x97,0x66,0x43,0x20,0x6b,0xd0,0x34,0x66,0x24,0xbb,0x9a,0xd8,0x39,0x50,
-    0x94,0x17,0x2e,0x1a,0x8c,0x1f,0xa3,0xb4,0x1c,0x4a,0x1a,0x4e,0xc8,0xdb,0x15,0x9b,
-    0x6f,0x6b,0xaf,0xb9,0x9f,0x78,0x56,0xca,0x8c,0xa4,0x73,0xd7,0x8f,0x0c,0x36,0xcb,
-    0xf4,0xf1,0xbc,0x16,0x11,0x3b,0x23,0xf3,0x5e,0xf5,0x1d,0x15,0x12,0x34,0xd7,0xa9,
-    0x9e,0xab,0xea,0xc5,0xf9,0xc7,0x1c,0x19,0x38,0xbb,0xa1,0xe6,0x36,0x6c,0xd3,0x8d,
-    0xce,0x3c,0x74,0x2c,0x35,0x4f,0xff,0xfe,0x8f,0x51,0xd0,0x04,0x09,0xdd,0xb4,0x80,
-    0x03,0x56,0xfd,0xd1,0x86,0x71,0xaa,0x68,0x9a,0xf4,0x7a,0x65,0xb6,0x5e,0x16,0x81,
-    0x87,0xad,0xb7,0x96,0x1a,0x24,0xf9,0x01,0x25,0x0e,0x6d,0xac,0x62,0x2d,0x1a,0x6d,
-    0x96,0x59,0x11,0x41,0x4e,0xe8,0x9d,0x93,0x53,0x2c,0x96,0x93,0xa8,0x28,0x0a,0x2e,
-    0xb3,0x45,0x52,0x53,0x92,0x83,0xc8,0xb1,0x79,0xaa,0x60,0x12,0x02,0xb6,0x8a,0xe4,
-    0xfc,0xb8,0x4d,0xe2,0xc0,0x2b,0x11,0xbf,0xef,0xfe,0xbf,0xfe,0x58,0x32,0xf6,0xc8,
-    0x90,0x9b,0x49,0xc9,0x22,0x43,0xfb,0x15,0xa6,0x72,0x9e,0x16,0x76,0xd2,0x2f,0x2f,
-    0x15,0x69,0xb9,0x0f,0x18,0x1a,0xe9,0xc5,0xc6,0x7a,0x99,0x89,0x06,0xab,0xe7,0xbd,
-    0xa8,0x2c,0xda,0x87,0x39,0x46,0xf2,0xdd,0xc0,0x22,0x3b,0x6b,0x83,0xa8,0x96,0x19,
-    0x5e,0xee,0x1b,0x7e,0xa5,0xef,0x09,0x8a,0x7b,0x88,0x07,0xda,0x98,0x92,0xfd,0xfe,
-    0x47,0x6f,0xaf,0x4d,0xba,0xc8,0x4f,0xfd,0xff,0xff,0x52,0x7f,0xff,0xff,0xc4,0x86,
-    0x2a,0x7a,0xc4,0x40,0x0e,0x38,0x5c,0x6d,0x11,0x5b,0x29,0xa5,0x87,0x60,0xad,0x1d,
-    0x9a,0x34,0x2f,0x6a,0x89,0x8b,0x85,0xd2,0xa8,0x18,0xbd,0xa1,0x10,0x72,0x78,0x21,
-    0xb0,0xe9,0x74,0xa4,0xd7,0x35,0x43,0xff,0xfb,0x92,0x44,0xe0,0x00,0x03,0x7c,0x34,
-    0xce,0xeb,0x3b,0x5b,0x78,0x86,0xca,0xba,0x5d,0x69,0xe7,0xc5,0x8a,0x14,0x8b,0x4d,
-    0x8c,0x19,0xb0,0xf1,0x49,0x2a,0xea,0x75,0xa5,0x95,0xee,0xa4,0x54,0x6b,0x79,0x04,
-    0x2b,0xdb,0x34,0xe4,0x4e,0xb1,0x7e,0xff,0xe0,0x12,0xc8,0xde,0x81,0xed,0xaa,0xb8,
-    0x94,0x20,0x9f,0xfc,0x85,0xad,0x42,0x39,0x59,0x41,0xaf,0xaa,0x7e,0x8b,0x43,0x88,
-    0xd6,0xde,0x88,0xbf,0xff,0xca,0xff,0xff,0xaf,0xff,0xff,0xfd,0x81,0x0b,0xa2,0x00,
-    0x2d,0x20,0x71,0xd0,0x88,0xff,0xa9,0x8a,0x47,0xb8,0xad,0x65,0x8c,0x59,0x65,0x0c,
-    0x57,0x91,0xf3,0x14,0x84,0x62,0xdb,0xa2,0x0e,0x25,0x13,0x66,0xd7,0x95,0x62,0x61,
-    0x45,0x39,0x18,0x42,0x86,0x6a,0xeb,0x75,0x57,0x38,0xd9,0xef,0x00,0x71,0xdd,0x0a,
-    0x05,0xf8,0xe1,0xd1,0x62,0x8c,0x8f,0x8c,0xdc,0x88,0xed,0xd4,0x78,0x5f,0xe6,0x9c,
-    0xad,0xcc,0x77,0x99,0x51,0xe9,0x27,0x17,0x0a,0xe1,0x5f,0xff,0x4b,0xd6,0xaf,0xe7,
-    0xbf,0xfc,0x50,0x42,0x40,0x00,0x28,0x50,0x57,0xf5,0x4c,0xf0,0x3a,0x54,0x2f,0x93,
-    0x76,0x75,0x96,0x50,0x2d,0xea,0x66,0xb4,0x79,0x34,0x03,0xd8,0xa8,0x03,0x20,0x29,
-    0x1a,0x82,0x02,0x32,0x04,0x16,0x11,0x2f,0xd8,0x1a,0x05,0x9e,0xb3,0xd6,0x41,0x89,
-    0x73,0x32,0x20,0x2b,0x3d,0xa8,0x4d,0x3b,0x9d,0xc8,0xc3,0x71,0x67,0x76,0xcd,0xa8,
-    0xc4,0xdf,0x39,0xbd,0x7f,0xf3,0x0d,0xfc,0x81,0xf7,0x37,0xff,0xff,0xff,0xdb,0xff,
-    0xff,0xff,0xff,0xfe,0xed,0xff,0xff,0xff,0xff,0xff,0x95,0x60,0xdd,0x00,0x03,0x64,
-    0x49,0x96,0x00,0x1f,0xfc,0xdb,0x65,0x87,0x5c,0x17,0x42,0x44,0x81,0x45,0x60,0xd7,
-    0xd0,0x10,0x62,0x3e,0x63,0xc2,0x0f,0x78,0xe0,0x20,0xd1,0x69,0x02,0x41,0x5f,0x1a,
-    0xdd,0x15,0x8f,0xc8,0x4f,0xf9,0xdc,0xa7,0xe9,0xe6,0xee,0xde,0xc6,0x09,0xc2,0x47,
-    0x4f,0xaf,0x38,0x47,0x36,0x87,0xbc,0xe6,0xd0,0x5a,0x36,0x3c,0xc7,0xd4,0x89,0xdf,
-    0x3f,0xfb,0xe7,0x75,0xe1,0x42,0x66,0x3f,0xfd,0x39,0x8f,0xd4,0xcf,0xff,0x07,0x7f,
-    0xff,0xfe,0xda,0x09,0x12,0x00,0x0e,0x68,0x1c,0xa0,0x01,0xfb,0xe4,0xad,0xe1,0x6e,
-    0x2c,0xfa,0x32,0xf3,0x3b,0xa6,0x32,0x0a,0x2e,0xd4,0xca,0x30,0x8b,0x91,0x13,0x14,
-    0x20,0xc6,0xab,0xd3,0x9e,0xb2,0x8c,0x58,0x28,0x2c,0xa3,0xd3,0x34,0x0e,0x96,0x56,
-    0xae,0x63,0x2d,0x2c,0x66,0x82,0xa5,0x05,0xaa,0xb1,0x6e,0xe8,0xf9,0x5d,0xf1,0x1c,
-    0x35,0x2d,0xf5,0x1b,0x6a,0x4d,0xea,0xde,0x96,0xff,0xfb,0x92,0x44,0xd2,0x01,0x02,
-    0xc1,0x55,0x52,0x6b,0x4b,0x13,0xec,0x55,0xa5,0xfa,0x3d,0x6d,0xea,0x77,0x8b,0x19,
-    0xaf,0x2d,0xac,0xf1,0x4c,0x81,0x5c,0x17,0xe7,0x75,0xb7,0x9d,0xe6,0xe9,0xe7,0x9b,
-    0xf4,0x2e,0xce,0xa6,0x7f,0xff,0xff,0xfd,0xbf,0xff,0xff,0xff,0xff,0xdc,0xaf,0xff,
-    0xff,0xff,0xff,0xff,0x2a,0xe1,0x44,0x00,0x02,0x38,0x9c,0xb0,0x22,0x74,0x68,0x71,
-    0x90,0x34,0x75,0x8e,0xdb,0x12,0x88,0x16,0xae,0x1c,0x2e,0x51,0x83,0x75,0x13,0x0f,
-    0xbd,0x84,0x84,0xc1,0x91,0x0d,0xca,0x07,0xe6,0xee,0x63,0x41,0x46,0x3d,0x26,0x4a,
-    0xe2,0xa8,0x34,0x37,0x21,0x01,0x51,0x35,0x7a,0x8c,0x92,0x78,0x35,0x25,0x5b,0x40,
-    0xa7,0x30,0x9c,0xd7,0xe3,0x22,0x76,0xea,0x48,0x5d,0xbd,0x7b,0x7f,0x26,0x25,0xab,
-    0xff,0xf4,0x7f,0xff,0xfa,0xd3,0xff,0xff,0xeb,0x18,0x00,0x09,0x30,0xdb,0x80,0x0f,
-    0xd6,0x70,0xc3,0x86,0xdd,0x57,0x82,0xeb,0x7c,0xc7,0x0e,0x0d,0x78,0xbd,0xe2,0x26,
-    0x04,0x33,0xb2,0x90,0x92,0x11,0x20,0xac,0xc4,0x27,0x74,0xfa,0x03,0xd8,0xc1,0xf1,
-    0x00,0xc4,0xc0,0x24,0xbe,0x4c,0xb5,0xfe,0x8c,0xcf,0x63,0x6a,0xde,0x3c,0xaf,0x7b,
-    0xe5,0x4c,0xb7,0x9e,0x7b,0x43,0x61,0x82,0xff,0xc5,0x20,0xf0,0x3b,0x44,0x95,0x09,
-    0x5d,0x24,0x9b,0xfd,0x07,0x67,0x73,0x7f,0xfa,0x09,0xd7,0x7f,0x67,0xff,0xff,0xfd,
-    0x3f,0xff,0xff,0xff,0xff,0xe7,0x33,0xff,0xaf,0xff,0xff,0xff,0xfb,0x31,0x7a,0xc0,
-    0x90,0x03,0xf9,0x9c,0xa2,0x58,0xa0,0x81,0xc4,0x28,0xba,0x94,0x1d,0x3a,0x1b,0x62,
-    0x0d,0x8f,0x0a,0x46,0x19,0x02,0xe6,0xc3,0xdd,0x21,0x0a,0xc1,0x83,0x20,0xc9,0x85,
-    0x8f,0xc1,0xb0,0x04,0x08,0xf0,0xae,0x34,0x41,0xae,0x49,0x39,0x23,0xc5,0xb5,0x53,
-    0x64,0x74,0x20,0x1a,0x1c,0xf9,0xc1,0x28,0xd3,0xdf,0x61,0x81,0x69,0x51,0xab,0x7d,
-    0x42,0xf4,0xb1,0xde,0x97,0xfb,0x3d,0xbf,0xff,0x95,0x7f,0xff,0xff,0xfe,0xfd,0x14,
-    0xef,0xff,0xb7,0xff,0xff,0xfe,0x40,0x5c,0x93,0xfa,0xff,0xff,0xa7,0xff,0xfb,0x09,
-    0xe8,0xcd,0x00,0x00,0x2a,0x15,0x62,0x00,0x0f,0xfe,0xdc,0x7d,0xd0,0x71,0x98,0x2a,
-    0x04,0x1d,0x10,0x89,0x4d,0x32,0x26,0x78,0x89,0x41,0x66,0x4c,0x6e,0x87,0x10,0x88,
-    0x04,0xa6,0x46,0x79,0x1e,0xda,0x1a,0x4c,0x3e,0x16,0x29,0xac,0xc8,0x3c,0x7d,0x33,
-    0x96,0x17,0x11,0xfd,0x89,0xe5,0x4c,0x67,0xef,0xaa,0x6d,0xfc,0x23,0x72,0xc1,0xc1,
-    0x67,0xc5,0xe6,0x21,0x94,0x9d,0x35,0x5f,0xbf,0xf8,0xc7,0xff,0xfb,0x92,0x44,0xe2,
-    0x00,0x02,0xf3,0x6b,0xca,0x6b,0x89,0x54,0x30,0x53,0xa6,0x09,0xad,0x07,0x6a,0x1e,
-    0x8c,0xc9,0xb1,0x21,0x4d,0xf4,0xed,0x01,0x89,0xb6,0x23,0x49,0x9e,0xa9,0x19,0x2b,
-    0x7f,0xfe,0xe5,0xff,0xff,0xff,0xff,0xbf,0xff,0xff,0xff,0xff,0xfb,0x05,0x7f,0xd3,
-    0xff,0xff,0xff,0xfe,0x14,0x1b,0x58,0x20,0x01,0x4d,0x2a,0x18,0x00,0x7e,0xfe,0xd3,
-    0x21,0x61,0xb0,0xfb,0x57,0x4a,0xe0,0xa8,0xa4,0x30,0x1e,0xb2,0xe4,0x81,0x32,0xcd,
-    0x55,0x08,0x01,0x0c,0x09,0x06,0x4c,0x58,0x2d,0x4e,0x9a,0x1f,0xce,0x77,0x0c,0x00,
-    0x5b,0x24,0xc9,0x11,0xd4,0x48,0xcb,0x1e,0xfd,0x35,0x2d,0x80,0x05,0x77,0xfc,0x4b,
-    0xbd,0x3c,0xfe,0xe2,0xb5,0xc4,0x1f,0x87,0xf5,0xbc,0xec,0x89,0xe9,0x09,0x9f,0xf6,
-    0x7a,0x86,0x7f,0xff,0xff,0xff,0xfa,0x0f,0x8f,0xef,0x71,0x14,0xca,0x79,0x06,0x00,
-    0x3b,0x60,0xd1,0x2c,0xc9,0xa1,0x18,0x30,0x39,0x30,0x2c,0x02,0x32,0x08,0xd0,0x0c,
-    0x1f,0x8c,0x24,0x0b,0xcc,0x15,0x2e,0x0e,0x79,0x25,0xc9,0x40,0xd0,0x10,0x2c,0x60,
-    0x58,0x26,0x89,0x49,0x11,0x14,0x61,0xef,0xf3,0x81,0xa0,0xbb,0x5b,0x56,0x4a,0xed,
-    0xe3,0xf8,0xf0,0xf1,0x49,0x6f,0x4a,0xc7,0xc4,0xef,0x20,0xb9,0x40,0x8a,0x45,0x21,
-    0x0c,0xaa,0x86,0x38,0xd3,0x43,0x91,0x8a,0xae,0x4c,0xec,0x10,0x63,0x98,0xa7,0xa3,
-    0x19,0x74,0xaf,0xb9,0x93,0x8c,0x5b,0x19,0x56,0x08,0x4b,0xd7,0xff,0xff,0xff,0xef,
-    0xff,0xff,0xff,0xff,0xff,0x73,0x7f,0xff,0xff,0xff,0xff,0xf1,0x01,0x76,0xa0,0x80,
-    0x00,0x00,0x41,0x54,0x00,0x3f,0x55,0xe5,0xf6,0xdb,0x8b,0x11,0x53,0xb5,0x06,0x28,
-    0x27,0x13,0x2e,0x65,0x2a,0xc6,0x75,0x14,0x82,0x46,0xc6,0x24,0x56,0x61,0x4c,0x47,
-    0x79,0x1a,0x4a,0x20,0x61,0x21,0x61,0xc0,0xf2,0xa0,0x82,0x22,0x00,0x5c,0xf8,0x6c,
-    0xe3,0x28,0xd2,0x30,0x8d,0x87,0x41,0x5e,0x08,0x03,0x61,0x14,0x9c,0x89,0xe2,0x87,
-    0x82,0xc2,0x29,0x96,0xe0,0x88,0x40,0x78,0x4e,0x69,0x4d,0xe7,0xff,0xf9,0x3c,0x27,
-    0x84,0x6f,0x91,0x63,0x34,0x3c,0x00,0x07,0x4b,0xf4,0x00,0x0f,0xce,0x76,0x5d,0x16,
-    0x58,0x16,0x03,0x21,0x18,0x06,0x30,0x05,0xd3,0xbf,0x5f,0x30,0xe0,0x55,0x30,0x38,
-    0x53,0x24,0x45,0x48,0x40,0x28,0x9c,0xe1,0xa3,0x20,0x50,0x35,0x3d,0xd6,0x1a,0x48,
-    0x4f,0xcb,0x4f,0x2c,0xc9,0x80,0x38,0x02,0x2b,0x10,0x05,0x85,0xe8,0xa1,0x59,0xa6,
-    0xde,0xbe,0x5b,0x10,0x49,0x47,0xf6,0xf9,0x49,0x58,0xfa,0x8f,0xb0,0xff,0xfb,0x92,
-    0x64,0xe3,0x89,0x03,0x05,0x6c,0x48,0xd3,0x8b,0x2c,0x50,0x50,0xa3,0xf9,0x1a,0x77,
-    0x29,0x70,0x0e,0xf1,0xaf,0x20,0x2e,0xbc,0xf3,0x11,0x58,0x98,0x24,0xa9,0xb4,0x8e,
-    0x11,0xfb,0xbf,0x95,0x7f,0xff,0xff,0xff,0xff,0x5f,0xff,0xff,0xd4,0x62,0x60,0x10,
-    0x16,0xd7,0x7d,0xa8,0x43,0x0d,0xbc,0xd6,0x25,0x92,0xcb,0xce,0xf5,0xa8,0x09,0xa4,
-    0xce,0xcb,0xb0,0x72,0xdf,0x42,0xf1,0x9a,0x9a,0x16,0x99,0xc9,0xb3,0x40,0xf3,0xbf,
-    0xaf,0xa4,0x28,0xca,0x8c,0xc3,0x74,0xd2,0x04,0x2b,0x50,0x34,0x33,0x50,0xb0,0x2b,
-    0x80,0xa1,0xce,0x81,0x99,0x02,0x74,0xb9,0x4f,0x9a,0x96,0xad,0x27,0xbd,0x74,0xca,
-    0x95,0xd0,0xb1,0xe7,0x6c,0xb8,0x25,0xf2,0x47,0xb6,0x8c,0x6a,0x88,0x1c,0x78,0x20,
-    0xa1,0x09,0x22,0xc5,0x46,0x95,0x23,0xca,0x22,0x11,0x0b,0x81,0x44,0x05,0xc9,0x5f,
-    0x19,0xd3,0x08,0x27,0x07,0x01,0x15,0x04,0x65,0x92,0x55,0xb4,0x38,0xf5,0x63,0x4e,
-    0xa2,0x9f,0xb2,0xc2,0xdc,0x44,0x21,0xeb,0x13,0x7b,0xd7,0x26,0xa4,0xaa,0xa9,0xbe,
-    0xf1,0x5f,0xbe,0x5d,0xa3,0x0d,0x70,0x6e,0x5e,0xd5,0xa5,0x18,0xc3,0x23,0x06,0x18,
-    0x3d,0x36,0xdf,0xff,0xff,0xf5,0x92,0x00,0x1a,0xe5,0xd5,0x80,0x01,0x6f,0xc0,0x94,
-    0xce,0x83,0x27,0x4b,0x91,0x63,0x51,0x4b,0xb3,0x83,0x24,0x1e,0x06,0x43,0xf3,0x68,
-    0x87,0x2d,0xea,0x8a,0x02,0x1e,0x4c,0x69,0x68,0xba,0x49,0x03,0x2f,0x90,0x9a,0x1d,
-    0x33,0x42,0xf6,0x3c,0x36,0x10,0x06,0xd2,0x8b,0x21,0x17,0x34,0x13,0x9b,0x3e,0xed,
-    0x90,0xba,0x81,0x82,0xd7,0xff,0xaa,0x3b,0x09,0x41,0x7f,0xd8,0x9f,0xed,0x67,0xff,
-    0xff,0xff,0xff,0x5f,0xff,0xff,0xd5,0x75,0xd0,0x30,0x5e,0xb6,0x6b,0x60,0x41,0x3d,
-    0x1d,0x9a,0x74,0x41,0xec,0xa5,0x2f,0x0d,0x4e,0x6b,0x5b,0x88,0x24,0x87,0x55,0xd6,
-    0x60,0x02,0xab,0xeb,0x3d,0x96,0xef,0x5a,0xee,0xe2,0x10,0xed,0x34,0x5e,0x05,0x94,
-    0x48,0xa6,0x5e,0xb9,0x07,0xc6,0xa6,0xe7,0x65,0x15,0xe3,0x35,0x28,0x25,0x1f,0xce,
-    0x6e,0xe1,0x55,0xc9,0xed,0x0c,0xdf,0x83,0xb7,0xdd,0x6e,0xad,0x29,0x54,0xa8,0x1f,
-    0x39,0x2e,0xa7,0x42,0xa1,0xfd,0xe8,0x61,0x53,0x87,0xee,0x55,0xd5,0xe3,0x87,0x76,
-    0x1f,0x7e,0x7a,0xb6,0x0b,0x89,0x1c,0x1d,0x2a,0xfd,0xdf,0xff,0xff,0xfe,0xba,0x20,
-    0x12,0x58,0x18,0x00,0x37,0x02,0xc1,0x4d,0x26,0x1f,0x66,0xa1,0x85,0x26,0x09,0xae,
-    0x7c,0x08,0x00,0x20,0xd7,0xfc,0xd2,0x51,0x8a,0x0d,0xa0,0x80,0x61,0x99,0xd5,0xff,
-    0xfb,0x90,0x44,0xe3,0x00,0x02,0x9f,0x1f,0x4a,0xd3,0x7c,0x5b,0x10,0x99,0x46,0x8a,
-    0x1d,0x67,0x4f,0xb4,0x8a,0x18,0x7d,0x29,0x40,0xed,0x61,0xc1,0x9e,0x99,0x2a,0xb4,
-    0xfc,0x25,0xbe,0x27,0x8d,0x01,0xb0,0x59,0x56,0x29,0x4d,0xdc,0x53,0xb0,0x11,0x12,
-    0xaa,0x48,0x26,0x2e,0xe3,0x7b,0x91,0xa4,0xfb,0x3a,0x5f,0x55,0x94,0x90,0xea,0x26,
-    0x5f,0xfd,0xcc,0x59,0x52,0xff,0xff,0xf6,0x37,0xff,0xff,0xff,0xff,0x59,0x3f,0xff,
-    0xff,0x91,0x9a,0xd4,0x88,0x2e,0x28,0x65,0xac,0x21,0x1a,0xad,0x23,0x95,0xaa,0xb3,
-    0x0e,0xa3,0x69,0xb6,0x5b,0xa8,0x60,0x92,0x99,0xa2,0xa8,0x4d,0xe5,0x54,0xca,0x1b,
-    0xda,0x05,0x69,0xd6,0x6d,0x0f,0x4e,0x67,0x69,0x21,0x39,0x95,0x8c,0x8b,0x5b,0x16,
-    0xdf,0x3b,0xf0,0x9c,0x14,0xb8,0xf8,0x9b,0xaa,0x85,0xc8,0x01,0x8c,0xc8,0x62,0x71,
-    0xf5,0x9f,0xdc,0x72,0xe8,0xb3,0x39,0x94,0x98,0x6a,0x57,0x59,0xf6,0x3e,0x36,0x02,
-    0xa1,0x41,0x61,0x7d,0x3f,0xff,0xff,0xff,0x13,0x81,0xb1,0xc9,0x08,0x00,0x7e,0xf5,
-    0xed,0x82,0x7a,0xb2,0x25,0x33,0x40,0x23,0xf9,0xed,0x27,0xa6,0x02,0x87,0x99,0xe1,
-    0x22,0xd6,0x82,0x13,0x10,0x69,0xec,0x10,0x05,0x09,0xef,0xd8,0xb6,0x31,0xae,0x60,
-    0x03,0x3d,0x04,0xc7,0x56,0x97,0x85,0x88,0xbf,0xb3,0x44,0x6a,0xa3,0x91,0xab,0xef,
-    0x82,0x16,0x05,0xf6,0xf6,0xb2,0x7f,0xff,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-    0xff,0xfd,0x6f,0xff,0xff,0xff,0xff,0xff,0xa0,0xf5,0x8e,0x80,0x1e,0xe8,0x6e,0xa0,
-    0x06,0xf9,0xa9,0xe7,0xf6,0x05,0x97,0x35,0x28,0xb2,0x52,0x18,0x50,0x56,0xda,0x29,
-    0x49,0x92,0xc4,0xe0,0x26,0xa8,0xe0,0x40,0xc6,0xf0,0x93,0xde,0x9a,0x0c,0x54,0x01,
-    0x08,0x20,0x32,0xf8,0x71,0x46,0xe1,0x1e,0x97,0xe9,0xc5,0x54,0x7f,0xf4,0x4c,0xd0,
-    0x32,0x5b,0x52,0x99,0x2c,0x3a,0xb6,0x27,0xe8,0x42,0x15,0xc0,0xf9,0x78,0xac,0x36,
-    0x6f,0x28,0x25,0x8a,0x3f,0xfd,0x3f,0x95,0x10,0xa3,0x9e,0xa1,0x0b,0xbf,0xff,0xff,
-    0xff,0xf4,0xff,0xff,0xfc,0x8d,0x02,0x90,0x00,0x4d,0xeb,0x28,0x00,0x01,0xc6,0xd6,
-    0xd9,0x6b,0x0f,0x67,0x4d,0x00,0xa8,0x66,0x0e,0x37,0x6a,0x68,0xe8,0x04,0x40,0x08,
-    0x28,0x76,0x84,0x41,0xc7,0x48,0x5c,0x21,0x02,0x62,0x2f,0xd4,0xe9,0xcb,0x7f,0x71,
-    0x2a,0x3b,0x28,0x06,0xdc,0x9d,0xc8,0x38,0x6f,0xcc,0x2b,0x7c,0x07,0x06,0x7f,0xf1,
-    0x3d,0x94,0x2b,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xff,0xfd,0xe3,0x28,0x03,
-    0xff,0xfb,0x92,0x44,0xce,0x88,0x02,0x78,0x20,0xc9,0x38,0x7b,0x58,0xe0,0x57,0x26,
-    0x3a,0x5d,0x65,0x49,0x8b,0x8a,0x21,0xb1,0x23,0x4d,0xa0,0x51,0x01,0x6e,0x16,0x65,
-    0x29,0xc7,0xaa,0x18,0xa8,0xa2,0x44,0x01,0xb9,0xd7,0x7a,0xac,0x8e,0x1c,0x77,0x93,
-    0x98,0x14,0x8c,0xb1,0x88,0x00,0x47,0x7b,0xc2,0xc0,0x22,0xa0,0x86,0x2d,0xde,0x7f,
-    0xdd,0x06,0x0a,0x10,0x06,0x4d,0x57,0x4f,0xc9,0xd4,0xad,0x7d,0x58,0xd8,0x1c,0xce,
-    0x31,0x7f,0xc8,0xe5,0x8b,0xb8,0x3a,0xc0,0x77,0x17,0x7d,0xd7,0x15,0xa6,0xff,0xea,
-    0x01,0x72,0xbf,0x43,0x5c,0x7f,0xff,0x75,0x2c,0x08,0x4b,0xbe,0x8f,0x77,0xa7,0xff,
-    0xff,0xff,0xff,0xa7,0xff,0xff,0xe9,0x12,0x3f,0xef,0xfa,0x72,0xbf,0xad,0xf9,0x80,
-    0x80,0x71,0x88,0xc0,0xa9,0x84,0xc9,0x99,0x9b,0x05,0xb2,0x49,0x98,0x04,0x21,0x9c,
-    0x06,0xc2,0x99,0x70,0x18,0x86,0x01,0xc2,0x26,0x68,0xea,0x44,0xb4,0xed,0xd8,0x5c,
-    0xb8,0x12,0x8c,0xc7,0x9e,0x51,0x88,0x07,0xc3,0x15,0xa8,0xb9,0xcf,0x25,0x90,0x81,
-    0x38,0xb6,0xfc,0xd3,0x72,0xa1,0xe0,0x9a,0xf4,0x76,0x43,0xac,0xc0,0xbd,0x5e,0xdf,
-    0xd3,0x4f,0xff,0xef,0x33,0xff,0xe8,0xff,0xfe,0xab,0xff,0xff,0xff,0xff,0xff,0x1e,
-    0x0e,0xed,0xf7,0xff,0xff,0xff,0xff,0x41,0x1c,0x6d,0x26,0x80,0x00,0x16,0x00,0x00,
-    0x7e,0xf4,0xfd,0x2b,0x84,0xc0,0x87,0x19,0xaa,0x28,0x85,0x85,0x24,0x4a,0x02,0xe2,
-    0x81,0x84,0xe6,0xf6,0xda,0x9e,0x04,0x12,0x60,0x0e,0x07,0x26,0x17,0x01,0xf4,0x6e,
-    0x78,0x6a,0xa6,0x17,0x60,0xa6,0x60,0x66,0x05,0x20,0x40,0x02,0x53,0x37,0x62,0x57,
-    0x49,0x5e,0x92,0x91,0xeb,0x83,0xbf,0xfe,0x38,0xcf,0x29,0xf3,0x6c,0x6e,0x32,0xff,
-    0xca,0x01,0xc0,0xe5,0x7f,0xa1,0xe5,0x0e,0xff,0xf4,0x5a,0x7f,0xff,0xa5,0xff,0xff,
-    0xff,0xff,0xff,0xf5,0xff,0xff,0xff,0xca,0x0b,0xbf,0xcf,0xff,0xff,0xff,0xff,0x89,
-    0xcb,0xb5,0x2a,0x00,0x44,0x50,0x01,0xfb,0xf8,0x35,0x01,0x10,0x40,0x20,0x44,0x39,
-    0x2a,0xa9,0xf8,0x09,0xcb,0x41,0x51,0x40,0x7a,0x60,0xa8,0x42,0x6f,0xc3,0x7e,0x66,
-    0x48,0x36,0x34,0x02,0x80,0x55,0xa3,0x4d,0x89,0x42,0xa0,0x98,0x4c,0x23,0xce,0x66,
-    0xae,0xa3,0x42,0x8c,0x2a,0x5b,0x22,0x88,0x8c,0xce,0xe3,0x70,0x09,0x39,0xcc,0xa2,
-    0x1c,0xf3,0x41,0x41,0x6e,0x88,0x7a,0x3b,0xa3,0x89,0x2d,0xd3,0xd0,0xee,0xcc,0xff,
-    0xff,0xe8,0xdf,0xff,0xff,0xfd,0x5f,0xff,0xf7,0xff,0xff,0xff,0xce,0x2f,0xfe,0xdf,
-    0xff,0xff,0xff,0xfb,0x92,0x44,0xe4,0x01,0x02,0x3b,0x20,0x4a,0x68,0x3b,0x40,0xe0,
-    0x55,0xa4,0x19,0x5a,0x03,0x6f,0x0e,0x8c,0x7d,0xaf,0x12,0x4e,0xe5,0x4e,0x01,0x9e,
-    0x36,0x22,0xe5,0xcf,0x1d,0xa1,0xff,0xf1,0x59,0x66,0xc0,0x00,0x0a,0xa8,0x00,0x3f,
-    0x5b,0x93,0x12,0x80,0x83,0x94,0xc2,0x5e,0xf6,0x7a,0x14,0x01,0x22,0x61,0x1c,0x47,
-    0x93,0x00,0x90,0x3a,0x30,0x7a,0x28,0xe3,0x17,0x50,0x4c,0x30,0x2c,0x02,0x33,0x06,
-    0x51,0xb2,0x37,0x2f,0x18,0x33,0x7a,0x3c,0x38,0x73,0x83,0x18,0x0d,0x07,0x01,0x28,
-    0x2b,0x5e,0x7f,0x65,0xc6,0xa6,0x4b,0x47,0x91,0x04,0xec,0xd1,0x4a,0xc4,0xf4,0x4a,
-    0x9f,0xfc,0x2e,0xc0,0x8c,0x1b,0x50,0xf9,0xc2,0x54,0x9e,0x8f,0xff,0xab,0x57,0xff,
-    0xfa,0x91,0xff,0xff,0xff,0xf4,0xbf,0xff,0xff,0xff,0xff,0xe7,0x0d,0xff,0xd0,0xff,
-    0xff,0xff,0xff,0x95,0xa2,0xc0,0x40,0x03,0x29,0xc6,0x10,0x00,0x3d,0x48,0xf9,0x44,
-    0xb5,0x90,0x38,0x44,0xa0,0x6a,0x46,0x2a,0x41,0x3f,0x8d,0x0e,0xf8,0x1c,0x35,0x26,
-    0x0b,0x37,0x1d,0x21,0x1a,0x4d,0x0f,0x0b,0x4b,0x61,0xba,0x4c,0x4e,0xc2,0x70,0x4e,
-    0xb9,0xba,0x5c,0x8d,0x84,0x11,0x78,0x50,0x34,0x61,0xd3,0xe9,0x0a,0x0f,0x9a,0x5d,
-    0xb2,0x70,0xa3,0x9f,0x5f,0x7c,0xa3,0xe6,0x7f,0xff,0xff,0xbf,0xff,0xff,0xff,0xff,
-    0xb3,0xff,0xff,0xe4,0x84,0x11,0x31,0xf9,0xe5,0x41,0x28,0x06,0x94,0xb5,0x43,0x17,
-    0x12,0x08,0x67,0xc0,0x6e,0xec,0x48,0xbe,0x86,0x3c,0x9b,0x86,0x02,0x80,0x00,0xc0,
-    0xa0,0xc3,0x95,0xcc,0xc6,0x69,0xe8,0x58,0x2c,0x26,0x26,0x48,0x81,0x25,0x9a,0xf3,
-    0x48,0x6d,0x5e,0x38,0x6e,0xa9,0x9b,0xe3,0xd7,0x76,0x32,0x1e,0xa1,0x0a,0x66,0xf7,
-    0xf5,0x97,0x43,0xca,0x14,0x9f,0xcc,0x8b,0xe7,0x3f,0xfe,0xbf,0xff,0xfe,0xff,0xff,
-    0xff,0xff,0x47,0xff,0xff,0xff,0xff,0xfe,0x71,0x2f,0xf5,0xff,0xff,0xff,0xff,0xd1,
-    0x28,0xd5,0x05,0x00,0x00,0x0a,0xd9,0xa3,0x20,0x01,0xcb,0xb4,0xd2,0x98,0xe3,0x26,
-    0x84,0x31,0x74,0x82,0x30,0x33,0x83,0x97,0x1f,0x31,0x10,0xc3,0x0e,0x5f,0x38,0xd3,
-    0x13,0x64,0x1c,0x12,0x37,0x1c,0x3e,0x36,0xf1,0x14,0x90,0x12,0x13,0x83,0x2a,0x8b,
-    0xc3,0xb1,0xea,0x75,0x60,0x52,0xb7,0x51,0xa7,0x32,0x98,0x83,0xdc,0x8c,0xa9,0x0c,
-    0xcc,0xdb,0xf7,0x56,0xd4,0xd1,0x61,0x63,0xd3,0x73,0x3b,0xfd,0x74,0xcb,0x71,0x07,
-    0x50,0xcc,0x55,0x6a,0xd8,0xde,0x9d,0x36,0x60,0x50,0xa3,0x08,0xbe,0xb1,0xcc,0xff,
-    0xb3,0xff,0xff,0xff,0xff,0xfb,0x92,0x44,0xee,0x80,0x53,0x18,0x6c,0x45,0x33,0x3d,
-    0x3a,0x30,0x6b,0xad,0x78,0xa9,0x7b,0x6d,0x72,0x49,0xd4,0x83,0x25,0x40,0x6d,0x23,
-    0x91,0x76,0xb6,0x23,0x1d,0x9e,0xb5,0x58,0xff,0xff,0xff,0xfe,0x87,0xa4,0x00,0xde,
-    0xf0,0x92,0x2f,0x31,0x10,0x0e,0x97,0x0a,0x08,0xd1,0x0c,0x13,0x00,0xcd,0x2d,0x01,
-    0xc9,0x83,0x36,0x98,0x61,0xd1,0xd0,0x0e,0x40,0x0c,0x1d,0x00,0x4c,0x70,0x07,0x4f,
-    0xf6,0x68,0x4c,0x71,0x02,0x0c,0x1e,0x05,0xd0,0xc9,0xa4,0x9f,0xcc,0x30,0xab,0x1d,
-    0xd7,0xf5,0x9f,0xfb,0xcf,0x77,0xd8,0x84,0x83,0x8b,0x1e,0x5b,0x67,0x59,0x72,0x89,
-    0xca,0x07,0x0a,0xff,0xb9,0x10,0xc1,0xbf,0x4a,0xf4,0x31,0x36,0xff,0xfa,0xff,0xff,
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0xa6,0xff,0x4f,0xff,0xfb,0xff,0xff,0x50,
-    0xea,0x84,0x00,0x0e,0xa9,0xad,0x58,0xbb,0x17,0x4c,0x46,0xfd,0xb2,0xa7,0xc1,0x80,
-    0xc6,0xe6,0xe9,0x14,0x07,0x08,0xcc,0x10,0x5e,0x3f,0xa5,0xd4,0xc9,0x40,0xc8,0xf9,
-    0x82,0x40,0x83,0x87,0x40,0x67,0x19,0xae,0xd5,0x0a,0xf6,0xaa,0xc3,0x5d,0x49,0x2c,
-    0x69,0xb3,0x67,0x08,0x78,0xde,0x36,0xd4,0x0c,0xc7,0x7f,0xf9,0x5a,0x90,0xd9,0xab,
-    0x68,0xf1,0x77,0xb7,0x18,0xb6,0x0e,0x0c,0x2d,0xd3,0x7f,0xa7,0xff,0xff,0xff,0xff,
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0xff,0xff,0xff,0xff,0xff,0xd4,0x65,0x6e,
-    0xcf,0x28,0x31,0x54,0x86,0x05,0x03,0x85,0x00,0x42,0xc2,0x02,0x15,0x28,0xe2,0x11,
-    0x07,0xc3,0x02,0xa6,0xdb,0x33,0x86,0x5b,0x4c,0x0e,0x13,0x31,0x95,0xf0,0xd2,0x88,
-    0xd0,0xa8,0xb8,0x69,0x04,0x99,0xae,0xb0,0x42,0x72,0xb8,0xab,0xcf,0x16,0xe8,0x2c,
-    0xca,0x8c,0x3c,0xdd,0xed,0x9a,0xa8,0xaa,0x0e,0x3d,0xf7,0xe1,0xd1,0x31,0x73,0x7a,
-    0xff,0x7f,0xff,0xfd,0x8d,0xff,0xff,0xff,0xfb,0xff,0xfe,0xdf,0xff,0xff,0xf8,0xc6,
-    0xbf,0xe7,0xff,0xff,0xff,0xff,0xa8,0x2d,0x4a,0x07,0x00,0x3d,0xe9,0x10,0x40,0x1c,
-    0xb9,0xaa,0xb1,0xea,0x28,0xa9,0x30,0x01,0x16,0x4c,0x04,0x79,0x34,0x60,0xb8,0x20,
-    0x2a,0x61,0x30,0x59,0xfa,0xc3,0x62,0x47,0x77,0x44,0x46,0xae,0x35,0xb0,0x3d,0xb7,
-    0x28,0x4e,0x43,0x6e,0xe5,0x2e,0x34,0xb8,0xda,0xa4,0xed,0x27,0x7d,0xde,0x95,0x52,
-    0x76,0xa6,0x69,0xbc,0x77,0xa6,0xe2,0x55,0xb1,0xf4,0x35,0xe5,0x95,0x7e,0xeb,0x48,
-    0x79,0xaf,0xfa,0x36,0x08,0x61,0x48,0x22,0x9f,0xeb,0xff,0xff,0xef,0xfd,0xbf,0xff,
-    0xff,0x5f,0xff,0xff,0xff,0xff,0xff,0xfb,0x92,0x44,0xf0,0x01,0xd3,0x34,0x1f,0xc9,
-    0x6b,0x78,0x2b,0xd8,0x64,0xcd,0x88,0xa2,0x75,0xe7,0x88,0x0b,0xa9,0xaf,0x1e,0xee,
-    0x3c,0x4f,0x41,0x67,0xb6,0x22,0x45,0xc4,0x16,0x1a,0xfc,0xed,0xfe,0x9f,0xff,0xff,
-    0xff,0xf5,0x18,0x01,0x88,0x10,0x28,0x19,0x96,0x1b,0x99,0x9b,0x7b,0x1e,0x32,0xfc,
-    0x98,0x34,0x02,0x85,0x4b,0x93,0x41,0x44,0x01,0x00,0x12,0x34,0x13,0x9f,0x4f,0x43,
-    0x18,0x04,0x0d,0x11,0x05,0x85,0xa9,0x4f,0x6a,0x7c,0x20,0xdd,0x12,0x71,0xc6,0x9a,
-    0x96,0xe5,0x8b,0xb8,0xe1,0x7a,0xc7,0xf1,0xfe,0xa6,0xd7,0xf3,0xaa,0xa4,0x65,0xe3,
-    0xee,0x45,0x7c,0xb1,0xa9,0x4f,0x46,0x12,0x7a,0x36,0xa7,0x0f,0x84,0x89,0x2f,0xdd,
-    0xff,0x57,0x17,0xde,0xbf,0xe9,0xff,0xf6,0xff,0x4b,0xba,0xff,0xff,0xd4,0x41,0x00,
-    0x00,0x23,0x55,0xc8,0x68,0x0f,0x7f,0xad,0xbb,0x6f,0x51,0x20,0x11,0x89,0x3f,0x20,
-    0xc0,0x89,0xa9,0x83,0xeb,0xc0,0xc0,0x03,0x13,0xe9,0x51,0x00,0xc2,0x86,0x4e,0x42,
-    0x8e,0x36,0x89,0x35,0x14,0x43,0xad,0x0e,0xc3,0xd3,0xb1,0x6a,0x5a,0x77,0xd2,0xe7,
-    0xd4,0xd7,0x77,0x2d,0x84,0x7f,0x3f,0x05,0xb6,0x73,0x24,0x3f,0x53,0xba,0x51,0xa2,
-    0x8d,0x9c,0x7f,0x7a,0x9c,0x0f,0x31,0x75,0xfe,0x75,0xbb,0xff,0xff,0x7e,0x8a,0xea,
-    0xa9,0x22,0x35,0x5b,0xff,0xfd,0xbf,0xff,0xff,0xff,0xff,0xe3,0x7f,0xef,0xff,0xff,
-    0xff,0xff,0x1a,0x38,0x4e,0xc0,0x01,0xbc,0x72,0xc5,0xc3,0x70,0x9d,0x82,0x20,0x80,
-    0x51,0x08,0x13,0x14,0xce,0x0b,0x05,0x40,0x0c,0x16,0x22,0xce,0x36,0x44,0x4c,0x7a,
-    0x02,0x4c,0x01,0x02,0x04,0x65,0x69,0x13,0x8c,0x60,0xa0,0x08,0x5e,0x8a,0xf1,0xa4,
-    0x8d,0xa6,0x85,0x27,0x5d,0xeb,0x26,0x4a,0xce,0xba,0x02,0x33,0x00,0xb6,0x4d,0x16,
-    0x46,0x75,0x03,0xf9,0x5c,0xb5,0x64,0x44,0x2e,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,
-    0xdb,0xff,0xff,0xf2,0x35,0x80,0x00,0x1a,0x55,0x08,0x8c,0x0f,0xee,0x1b,0x65,0x32,
-    0xf2,0x40,0x02,0xe6,0x76,0x4a,0x82,0x03,0x21,0x01,0x53,0x8c,0xc2,0x06,0xa3,0x8f,
-    0xd3,0xc4,0x99,0x2d,0x38,0xc2,0x20,0x63,0x7e,0x9d,0x80,0xc2,0x46,0x94,0xf0,0x3d,
-    0x3b,0x83,0x56,0xab,0x0b,0x4e,0xf2,0x7a,0x22,0xf5,0x5d,0xbe,0x0c,0x52,0x52,0xe3,
-    0x8d,0xf7,0x51,0xdd,0x46,0x43,0xd7,0xe0,0x20,0x9a,0x90,0x33,0x5f,0xed,0xff,0xff,
-    0xaf,0xe9,0xeb,0x6e,0xff,0x5d,0x1d,0xa9,0xb2,0x74,0xd7,0xff,0xff,0xff,0xfe,0x63,
-    0xff,0xaf,0xff,0xff,0xff,0xfc,0x4e,0x68,0xff,0xfb,0x92,0x64,0xed,0x80,0x83,0x2e,
-    0x6b,0xc7,0x53,0x99,0x13,0xd0,0x5b,0x24,0x08,0xa7,0x77,0x65,0x6a,0x0c,0xbd,0xaf,
-    0x1d,0xae,0x60,0xaf,0x01,0x42,0x8d,0x62,0xd9,0xbe,0xc9,0x50,0x01,0x51,0x24,0x90,
-    0x43,0xf7,0xcd,0xbf,0x32,0x36,0x50,0x9d,0x09,0xe2,0x61,0x03,0x69,0xc7,0x04,0x45,
-    0xb1,0x00,0x21,0x03,0x96,0xa5,0x00,0x98,0x08,0x10,0xb3,0x3a,0xd3,0x00,0x0a,0x08,
-    0x0c,0x12,0xb2,0xe8,0x75,0xf5,0x6d,0x57,0xd1,0xb3,0xaa,0xfe,0xd7,0x17,0xda,0xb6,
-    0x12,0x12,0x7b,0x17,0x75,0xd4,0xa4,0xc6,0x87,0x00,0xa5,0xf9,0xc5,0x4a,0x32,0xbf,
-    0xfb,0xff,0xef,0xdd,0x4f,0xbb,0xff,0xff,0xd1,0xff,0xff,0xf2,0x6c,0xa0,0x81,0xbf,
-    0xca,0x54,0x87,0x65,0x17,0x7a,0x90,0xd8,0x48,0x17,0x20,0x19,0x12,0xf4,0x14,0x04,
-    0x18,0x82,0x38,0x1b,0x45,0x14,0x9a,0x16,0x13,0x99,0x10,0x41,0x8d,0xed,0x9b,0x6a,
-    0x98,0x71,0x09,0x31,0x44,0x5a,0x96,0xd5,0x5c,0xa6,0xe6,0x91,0xb4,0xe6,0x1f,0x01,
-    0x71,0x7a,0x9c,0x68,0x55,0x1f,0x1e,0xc7,0xcf,0x1b,0x35,0x41,0x74,0xe4,0xf8,0xed,
-    0x24,0x7a,0x57,0xef,0xf7,0x4e,0x9f,0xcd,0xfe,0x95,0xdb,0xd6,0xdf,0xfe,0x8b,0xff,
-    0xfa,0xff,0xff,0xff,0xe2,0x57,0xef,0xa7,0xff,0xff,0xff,0xfc,0x2a,0x8d,0xe4,0xca,
-    0x01,0x1b,0xf7,0x84,0x68,0x84,0x0a,0x4c,0xb4,0x3f,0x62,0xc2,0x30,0x08,0xc2,0x62,
-    0x28,0xe0,0x01,0xf4,0x88,0x50,0x30,0xdc,0xb6,0x35,0x36,0x5b,0x07,0x26,0xc1,0x40,
-    0x44,0xc4,0x21,0xa8,0xee,0x65,0xf4,0x07,0x91,0x96,0x2b,0x0c,0x86,0xce,0x12,0x52,
-    0xd0,0x65,0x3d,0x4b,0xf5,0x21,0x9f,0xf8,0xaa,0x81,0xda,0xfb,0x95,0xe7,0x80,0x22,
-    0x0d,0x33,0x0d,0x95,0xf4,0xe9,0xfd,0x42,0x19,0x6a,0xcc,0x21,0xf4,0xd0,0xd9,0x67,
-    0xb5,0xdf,0xaf,0xce,0xcf,0xdf,0xe8,0xf7,0x7f,0xff,0x93,0x80,0x00,0x03,0x00,0xfe,
-    0xe1,0x55,0xff,0x2c,0xa8,0xc3,0x15,0x10,0x08,0x46,0x15,0x18,0x6d,0x80,0x9a,0x17,
-    0x85,0x80,0xd8,0xc7,0xf5,0x19,0x04,0x00,0x80,0x93,0x86,0x03,0x02,0x46,0x60,0x28,
-    0x15,0x46,0x01,0x00,0x2c,0x34,0x0b,0x2e,0x53,0xbb,0x47,0x02,0x6a,0x92,0x9f,0x78,
-    0x6f,0x3c,0x7e,0x3e,0xeb,0x5e,0xfd,0x04,0x05,0xdd,0x75,0x73,0x68,0x1c,0x2f,0x77,
-    0xde,0x63,0x2d,0xfa,0xfd,0x75,0x4f,0xeb,0xe6,0x63,0xcd,0xf5,0xb3,0x7f,0xff,0x6f,
-    0xdc,0x9f,0xff,0x4b,0xa7,0xab,0x69,0xdb,0xf6,0xfc,0x99,0x67,0xf7,0xca,0x7f,0x5f,
-    0xff,0xff,0xf8,0xe8,0x7d,0x62,0x07,0xfd,0x4a,0xee,0xff,0xfb,0x92,0x64,0xf0,0x88,
-    0x83,0x15,0x6b,0xc6,0x53,0x8f,0x3b,0xc0,0x50,0xc3,0xd8,0xb7,0x71,0xe5,0x86,0x0c,
-    0x5d,0xaf,0x0e,0x4e,0xed,0x4c,0x81,0x6f,0x0d,0x61,0x89,0xdc,0xa5,0xc0,0xd8,0x30,
-    0x0c,0x00,0x0e,0x0a,0x06,0x03,0x27,0x18,0xee,0x61,0xf7,0xd0,0x98,0x88,0x20,0x5c,
-    0x07,0x32,0x77,0x88,0x30,0x38,0x08,0x10,0x00,0xe6,0x0b,0x9c,0x06,0xb7,0x84,0x26,
-    0x01,0x00,0x40,0x61,0x39,0x33,0x5e,0xfa,0x5b,0x36,0x69,0xa7,0x77,0x73,0xbb,0x7a,
-    0x22,0x7b,0x89,0x31,0xd0,0xee,0x08,0xf3,0x0a,0x17,0x7c,0xf0,0xd7,0x61,0x4a,0xff,
-    0xd9,0x97,0x2a,0x97,0x7f,0xfb,0x9f,0xd7,0xf5,0xfd,0x1f,0xff,0xff,0xfa,0x95,0xfa,
-    0xa6,0x99,0x4f,0x41,0x80,0x25,0x24,0x50,0x1a,0x2c,0x0c,0x0a,0x0c,0xe6,0x15,0x8a,
-    0x83,0xc1,0x91,0x82,0xc2,0x29,0x88,0xd8,0x39,0x96,0xc1,0x68,0x18,0x4a,0x31,0x10,
-    0x79,0x3a,0x48,0x24,0x30,0x84,0x0e,0x0e,0x06,0x54,0xb1,0xab,0x3a,0x57,0x63,0x12,
-    0x9c,0x4e,0xa7,0x18,0xce,0xa1,0x04,0xdb,0x54,0x88,0x47,0x8a,0xba,0x5d,0x9a,0x66,
-    0xa0,0x4c,0x28,0x55,0xc1,0x6c,0xe3,0x04,0xd3,0xfc,0x4a,0x5f,0xcd,0xff,0x6f,0x7e,
-    0x88,0x5b,0xff,0xb5,0xff,0xe6,0x77,0xf4,0xff,0xfd,0x7f,0x6a,0xfd,0xa6,0x7f,0xc2,
-    0xaa,0xff,0xd7,0xff,0xff,0xff,0xfe,0x14,0x0f,0x92,0x80,0x37,0x49,0x0d,0xae,0x76,
-    0xdc,0x98,0xb0,0x34,0x8b,0x2f,0x43,0xc0,0x75,0x89,0xa0,0xe2,0x80,0xb0,0x4c,0x60,
-    0x70,0x2a,0x61,0xac,0x06,0x63,0x60,0x26,0x10,0x07,0x85,0x01,0x63,0x08,0x45,0x24,
-    0x87,0x69,0x4d,0xeb,0xf0,0x0f,0x1b,0x30,0xe4,0x23,0xca,0xa2,0x25,0x6a,0x71,0x6d,
-    0xb6,0xf5,0x98,0x90,0x92,0xe2,0xc8,0x21,0xdd,0x2d,0x54,0xde,0xac,0xfa,0x5e,0x58,
-    0xa8,0xb0,0x16,0x1f,0xa9,0xdf,0xf4,0x7d,0x03,0xf5,0x55,0xe9,0xa3,0xef,0xeb,0xff,
-    0xfa,0xff,0xff,0xd4,0x01,0x00,0x2a,0x30,0xd0,0x00,0x04,0x21,0x00,0xb1,0x19,0x08,
-    0x92,0x48,0x04,0x5a,0xc8,0x80,0x4c,0xe4,0x08,0x11,0xe5,0x1b,0x8d,0x20,0x98,0xcf,
-    0x41,0x00,0x83,0x26,0x16,0xc8,0x7a,0x0a,0xc4,0xd4,0xc6,0x04,0x0c,0xa6,0x6c,0xc9,
-    0x2f,0x57,0x73,0x5d,0x5f,0xcf,0x6b,0x40,0x69,0xed,0x61,0xff,0x4f,0x45,0x3b,0x55,
-    0x64,0x0c,0xd4,0xb8,0xc9,0xa1,0x20,0x2e,0x40,0x8c,0x80,0x6d,0x99,0x45,0xf0,0x98,
-    0x7c,0x03,0xb5,0xab,0x9f,0x74,0xd4,0x8a,0xe0,0x0c,0x95,0xe6,0x41,0x39,0xc5,0x69,
-    0xff,0xff,0xff,0xff,0xff,0xf4,0xff,0xff,0xfc,0x88,0x54,0x20,0xff,0xfb,0x92,0x64,
-    0xf6,0x85,0x03,0x53,0x6c,0x43,0x43,0x1e,0x3a,0x60,0x54,0xe4,0x08,0x61,0x6f,0xa2,
-    0x58,0x0d,0x79,0xaf,0x0c,0x2e,0xa0,0xf3,0x01,0x67,0x8f,0x22,0x19,0x8e,0xa5,0x18,
-    0x7c,0xdb,0xb6,0xef,0xc1,0xe1,0x43,0x0c,0xa3,0x8f,0x8f,0x08,0x48,0x26,0xba,0x7a,
-    0x0b,0x68,0x0c,0x42,0x1d,0x00,0x0c,0x0c,0x3c,0x62,0x03,0x0a,0x12,0x5c,0xc1,0x08,
-    0x41,0x72,0xe9,0x85,0x42,0x40,0xe0,0x1b,0xfc,0xd6,0x16,0x24,0x86,0x1b,0x86,0xed,
-    0xd1,0xe7,0x24,0x60,0x0c,0xb2,0xc7,0xe7,0xcc,0xc5,0xdd,0xdd,0x3d,0x04,0x8f,0x50,
-    0x18,0x71,0x3e,0x20,0x1d,0x67,0x1d,0xe9,0xb7,0x6f,0xff,0xfe,0xdf,0xfa,0x53,0xff,
-    0xfe,0xff,0xff,0xff,0xff,0xff,0xfb,0x3f,0xfb,0x7f,0xff,0xff,0xff,0xc2,0x9c,0x0f,
-    0x34,0xa2,0x54,0x74,0xf3,0xcf,0x02,0x42,0xcb,0x12,0x4d,0x2c,0x87,0x11,0x0d,0xa8,
-    0xee,0x3a,0xe9,0x18,0x3c,0xe0,0xa1,0x04,0x0a,0x63,0x22,0x40,0x70,0xf1,0xea,0x3c,
-    0x1d,0x84,0x00,0xf2,0xa5,0xa6,0x8f,0x7f,0x98,0x0a,0x05,0xa8,0xf0,0x1a,0x9c,0x20,
-    0x3a,0x3f,0xf7,0xad,0xdf,0x75,0xbf,0xa5,0x23,0xfc,0x53,0xce,0x27,0x04,0xdb,0x3d,
-    0xb6,0xfe,0x2b,0xe6,0xcb,0x2b,0x1a,0x0f,0x9a,0xb9,0x07,0x77,0x7e,0x84,0x3e,0x8f,
-    0xfe,0x8f,0xff,0xff,0x57,0xa7,0xff,0xfd,0x5e,0xa0,0x01,0x37,0x4b,0x72,0xa3,0xaa,
-    0xc6,0x51,0x38,0xb5,0xe1,0x84,0xb1,0x86,0x4c,0x11,0xe8,0x87,0xa9,0x82,0xc2,0x88,
-    0x10,0x4c,0xcc,0xdd,0x53,0x34,0xc4,0xc1,0x40,0x9a,0x07,0x8c,0xc6,0x61,0xa1,0xa5,
-    0x62,0x68,0x9a,0xd8,0xe9,0x5e,0xf8,0xbc,0xfd,0x59,0xdb,0xf8,0x2b,0xe1,0x21,0xd7,
-    0xcb,0x92,0x5e,0xc4,0x5f,0x4a,0xdb,0x94,0x57,0xfd,0xf0,0xf7,0x72,0xa8,0x41,0x9b,
-    0xab,0x62,0xff,0xff,0xff,0xff,0xed,0xfd,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-    0xe9,0xff,0x7f,0xff,0xff,0xff,0xf8,0x2a,0x19,0x00,0x0a,0xb1,0x9a,0x70,0x6b,0xb7,
-    0xaf,0xcd,0xbf,0xcd,0xd5,0x99,0xe9,0xe6,0x10,0x87,0x01,0xa8,0xdb,0x3b,0x34,0x0b,
-    0x94,0x0f,0x26,0x28,0x79,0x85,0xd9,0x1f,0xab,0xca,0x82,0x81,0x8d,0xa2,0xae,0x35,
-    0x3c,0xf7,0xa0,0x75,0x0e,0xae,0xa4,0x3a,0x0e,0x84,0xc5,0x6b,0xa6,0x49,0x23,0x45,
-    0xaf,0xd6,0x62,0x13,0x24,0xb4,0x10,0x99,0x5d,0x31,0xb4,0xc5,0x90,0xef,0xff,0xa5,
-    0x3f,0xff,0xbf,0xff,0xff,0xd8,0x2c,0xac,0xef,0x40,0x32,0x28,0x4a,0x6e,0x4d,0x4a,
-    0x61,0xa1,0xe0,0x08,0xb7,0x85,0x02,0x91,0x91,0x21,0xa1,0x0c,0x10,0x61,0xff,0xfb,
-    0x92,0x44,0xf3,0x00,0xc3,0x2d,0x20,0xc6,0xd1,0x9b,0x49,0xf0,0x61,0x2d,0x78,0x82,
-    0x67,0x85,0x3e,0x0b,0x34,0x81,0x18,0x4d,0xf5,0xec,0x41,0x7c,0xb5,0xa2,0x49,0xdd,
-    0x89,0x70,0x98,0xb2,0x63,0x28,0xb0,0x09,0x02,0xc0,0xa4,0xd9,0x86,0x60,0x38,0x18,
-    0x08,0x30,0xa4,0x20,0x39,0x2c,0xa5,0x17,0xe0,0xc9,0x1a,0x01,0x5d,0xd9,0x53,0x59,
-    0xc1,0x6b,0x48,0xe8,0x10,0xe2,0x8e,0xf5,0x3d,0x26,0xa6,0x7f,0xa1,0xad,0x4e,0x81,
-    0xf7,0xc0,0x42,0x43,0x68,0xfd,0x3f,0xfd,0xf4,0x7f,0xb2,0xad,0x1f,0xef,0xfe,0xa7,
-    0x7f,0xff,0xfa,0x84,0x80,0x06,0x23,0x2c,0x95,0xc0,0x8c,0x45,0x77,0xa0,0x7a,0x10,
-    0xa4,0x80,0x34,0x25,0x31,0xd4,0x82,0x4d,0x71,0xc0,0x3c,0xc9,0x57,0x7c,0xc2,0xc0,
-    0xcc,0x08,0x14,0x18,0xa2,0x11,0x1f,0xba,0xdd,0x18,0xb8,0x03,0x85,0x80,0x05,0xb7,
-    0x14,0x6d,0x5c,0x28,0x66,0xc5,0x35,0x1a,0xd1,0x2c,0xba,0x2d,0x75,0x8d,0xdf,0x54,
-    0x9f,0xff,0x8d,0x6b,0xee,0xa1,0x82,0x80,0xde,0x42,0x0a,0xc1,0x19,0x87,0x02,0x3d,
-    0xbf,0xf4,0xff,0x6d,0x3b,0x55,0x5f,0xed,0xf4,0xff,0xff,0xbf,0xff,0xf6,0xe9,0xff,
-    0xfd,0xaf,0xd3,0xdb,0xf4,0xfd,0xbf,0xff,0xff,0xc1,0x0c,0x76,0xa8,0xae,0xe1,0xb6,
-    0xec,0xe4,0x16,0xa8,0x51,0xa6,0x72,0x98,0x7a,0x09,0x18,0xbe,0x99,0x1f,0x2a,0x70,
-    0x98,0x72,0x05,0x01,0x80,0xd1,0xe2,0x80,0x14,0x79,0x85,0x00,0x01,0x01,0x02,0x67,
-    0x43,0x64,0x0a,0x06,0x81,0xc1,0x6a,0xd6,0x71,0x65,0xd2,0xdc,0xb9,0xda,0xdc,0xec,
-    0x41,0xa9,0x7f,0xe3,0xdf,0x96,0xab,0xfd,0x5d,0x89,0x82,0x60,0xb1,0xf4,0xe8,0xfe,
-    0xb6,0x6e,0x8a,0xa9,0x5f,0x4f,0x7a,0xae,0xdf,0xfb,0xff,0x31,0xf6,0xd3,0xdf,0xcd,
-    0xe7,0xbe,0x8b,0xff,0xff,0xff,0xd1,0x9f,0x6f,0x7a,0x27,0xdb,0xff,0xff,0xfc,0xa5,
-    0x2d,0x00,0x0d,0xe3,0x5e,0x0d,0x15,0x00,0x94,0x59,0x03,0xc0,0xc2,0x28,0x38,0x5d,
-    0x30,0x24,0xd1,0x37,0xa5,0x1a,0x10,0x82,0x65,0xae,0x32,0x88,0x6a,0x08,0x52,0xa1,
-    0xd3,0x0b,0x88,0x03,0x8e,0x94,0x13,0xa6,0xb1,0xc2,0x57,0x33,0xeb,0x2a,0xc7,0x2d,
-    0xa8,0xc5,0xea,0x29,0x6a,0x77,0x75,0xa8,0xc4,0xd3,0x52,0xcd,0x0f,0xb9,0x88,0xee,
-    0x07,0xe1,0xc3,0xfa,0xb3,0xa6,0xff,0xfe,0xa7,0xfe,0xdf,0xfd,0x7f,0xff,0x7f,0xff,
-    0xff,0xd7,0xfd,0xab,0xff,0xff,0x7e,0x97,0xa1,0xfe,0xdf,0xff,0xff,0xfb,0xfe,0x70,
-    0xfd,0x01,0x5a,0x57,0x1c,0x6b,0xd0,0x72,0x4f,0x82,0x01,0x21,0xe2,0x68,0xc4,0x10,
-    0xff,0xfb,0x92,0x44,0xf2,0x00,0x82,0x8d,0x20,0xc8,0x53,0x6c,0x6c,0x20,0x55,0xa3,
-    0x68,0x92,0x77,0x31,0x72,0x0c,0xdd,0xad,0x0e,0x4e,0xbc,0x51,0x01,0x96,0x35,0xa2,
-    0x59,0x8e,0xa8,0xf8,0x28,0xc2,0xc4,0xc0,0xfa,0x07,0x84,0xc4,0x21,0x20,0xc1,0x30,
-    0xd4,0xcb,0x48,0x84,0xca,0x10,0xc4,0x18,0x16,0x01,0x07,0xf3,0x17,0x29,0x01,0x24,
-    0xce,0xe2,0xc3,0x06,0x5d,0x28,0x53,0x2c,0x68,0xb6,0xa4,0x7b,0x54,0xe1,0xa6,0x5f,
-    0xc5,0xb6,0xff,0xf7,0xff,0x15,0x89,0xbf,0x95,0xd0,0xeb,0x64,0xec,0x2e,0x3b,0x7d,
-    0x7b,0xbb,0x9d,0x62,0xf5,0xed,0xea,0x6d,0x8d,0x58,0xbb,0xc7,0x57,0xca,0x2f,0xb1,
-    0xdf,0xfd,0xc1,0xae,0x76,0x1f,0xe7,0x5d,0x88,0xf3,0x59,0x2e,0x10,0xa0,0x04,0xc2,
-    0xc0,0x53,0x0d,0x24,0xce,0xec,0x3e,0x31,0x40,0x1c,0x2e,0x16,0x31,0x1f,0x00,0xc4,
-    0x01,0xc1,0x50,0x39,0x04,0x70,0x26,0xe4,0x16,0x1c,0x4c,0x26,0x9b,0x0f,0x59,0xb5,
-    0x8f,0x59,0x6e,0x8f,0x41,0x84,0xde,0x40,0xad,0x9e,0xda,0xb8,0x0f,0x13,0x7d,0x29,
-    0x63,0x1f,0xff,0x5a,0xf6,0x7a,0x7b,0x6e,0x8c,0xfa,0x7f,0xff,0xe9,0xff,0x66,0xf4,
-    0xff,0xb7,0xff,0xd7,0xfa,0x77,0x64,0xfe,0xff,0xff,0xdf,0xff,0x6f,0xe3,0xb5,0x92,
-    0x58,0xd6,0x9d,0x99,0x4c,0x41,0x10,0x42,0x87,0x9c,0x75,0x18,0xb2,0x15,0x18,0xca,
-    0xa6,0x1f,0x16,0x76,0x98,0xe2,0x02,0x31,0x03,0x18,0x8a,0xe3,0x44,0xc0,0x00,0x08,
-    0x36,0x63,0x04,0x08,0x76,0x25,0x12,0x63,0x38,0xc2,0x61,0xc8,0x1e,0x9c,0x8e,0x99,
-    0x02,0x6a,0x5c,0x12,0x67,0x2c,0xf7,0xa2,0x5b,0xf7,0x9d,0x88,0x5f,0xf7,0xda,0xdc,
-    0x80,0x59,0x57,0x66,0x28,0x21,0x72,0x5f,0xa4,0x28,0x46,0x22,0x0b,0x9e,0x6f,0x72,
-    0x4c,0x45,0x19,0x44,0x6d,0xa3,0xce,0x66,0xba,0xc0,0xcb,0x70,0xc2,0xe7,0x9f,0xf8,
-    0x6f,0xde,0x69,0x90,0x0f,0xde,0xa3,0x51,0x05,0xea,0x5b,0xc1,0xe2,0x20,0xc1,0xa1,
-    0xc5,0x63,0x4c,0xcd,0x21,0x02,0x0c,0x0d,0x3a,0x90,0x30,0x9f,0xd1,0x60,0x71,0x8a,
-    0x55,0xc7,0xc9,0x0c,0x98,0x80,0x52,0x5c,0x27,0xae,0x48,0x56,0x7f,0xb9,0x84,0x68,
-    0x2b,0x64,0x39,0xe2,0xe2,0x74,0x4d,0x4c,0x51,0xd0,0x24,0x7f,0xe8,0x6a,0x39,0x3a,
-    0x66,0x68,0xdb,0x6d,0x5f,0xff,0xd3,0x6f,0xd7,0xff,0xff,0xef,0xf7,0xff,0xff,0xfe,
-    0x9f,0xfd,0x5b,0x5e,0xff,0xb7,0x4f,0xff,0xa7,0xfe,0x54,0x95,0x6d,0x2b,0x4f,0xfc,
-    0xcf,0x6a,0x1c,0x18,0x00,0x13,0x01,0x42,0xc2,0x00,0x08,0x2d,0x0b,0x93,0xa6,0x74,
-    0xa2,0x00,0xff,0xfb,0x92,0x64,0xf7,0x08,0xc3,0x05,0x6b,0xc4,0x13,0xb9,0x6b,0x90,
-    0x5d,0xc3,0x58,0x51,0x77,0x2f,0x70,0x0b,0x99,0xb1,0x12,0xce,0x65,0x4e,0x41,0x8b,
-    0x0d,0x61,0x05,0x9e,0xa4,0xe0,0x90,0x35,0x34,0x0c,0x11,0x40,0x8c,0x23,0x03,0x84,
-    0x40,0x09,0x86,0x69,0xf1,0xe6,0xe0,0x89,0xc4,0xc9,0xe6,0x62,0x0e,0xb5,0xe7,0xf6,
-    0x35,0x4b,0x96,0x58,0x72,0x50,0x7b,0xe6,0x33,0x4d,0x27,0x70,0x14,0x1b,0x51,0x06,
-    0xbe,0xfb,0x13,0xa5,0xc8,0xe8,0xbd,0xd4,0xd5,0xbc,0x38,0x7a,0x2b,0x83,0x68,0xa1,
-    0x2b,0x5a,0x35,0x8b,0x67,0x7f,0xca,0x77,0x75,0xb0,0x1f,0x87,0xc9,0x21,0x94,0x2b,
-    0x58,0x34,0x7c,0x42,0xa0,0x70,0x74,0x6b,0x48,0x44,0x0a,0x0d,0x84,0x00,0xd8,0x12,
-    0x2d,0x30,0xf8,0x39,0x15,0x00,0x8c,0x15,0x13,0x4d,0x9f,0x2c,0x8d,0x05,0x16,0x23,
-    0xf7,0x18,0x41,0x02,0x11,0x90,0x91,0x32,0xc8,0x38,0xd0,0x10,0x50,0xea,0x8f,0xb3,
-    0xd4,0xb0,0x80,0xb7,0xfc,0xa3,0x97,0xf4,0xaf,0xed,0x6f,0xff,0x4a,0x6d,0xff,0x45,
-    0xff,0xf4,0xff,0xfe,0xf5,0xf4,0xff,0x4f,0xbb,0xd6,0x68,0xd1,0xd6,0xe9,0x5f,0xf5,
-    0xdb,0xff,0x97,0xff,0x1a,0x32,0x8b,0x96,0x6a,0x30,0x97,0xf0,0xec,0x50,0x0e,0x01,
-    0x01,0x30,0x68,0x13,0x31,0xa0,0x87,0x3f,0x30,0x13,0x16,0x39,0x4c,0x05,0x07,0xcc,
-    0x8b,0x50,0x44,0x86,0x33,0x0d,0x04,0x63,0x20,0xd7,0x33,0xf9,0xda,0x43,0x1c,0x00,
-    0x13,0x14,0x80,0xc1,0x20,0x3d,0x8a,0x3d,0xf2,0x6e,0xd8,0x62,0x69,0xc8,0x19,0x06,
-    0x4c,0xe9,0xe0,0xe1,0x6c,0x7a,0x68,0x36,0x34,0x3c,0x7b,0x05,0xb7,0xb3,0x3a,0x1f,
-    0x36,0x44,0x44,0xc2,0x6c,0x6c,0x60,0x3e,0xbd,0xe8,0x72,0xba,0x04,0x33,0xe3,0x97,
-    0x16,0x42,0x60,0x13,0xed,0x18,0xf8,0xc4,0x04,0x16,0xe6,0x99,0x6f,0xf3,0x15,0xe3,
-    0x3e,0xf7,0x60,0x0b,0x85,0xf5,0x1a,0x26,0x66,0xa1,0x1b,0x82,0x86,0x83,0x31,0xe6,
-    0xee,0x3d,0x0c,0xc1,0xc2,0xc3,0x91,0x47,0x06,0x99,0x42,0x20,0x31,0x88,0xa3,0x27,
-    0xda,0x50,0x30,0x83,0x20,0x01,0x51,0x29,0x58,0x5a,0x53,0xfb,0x3d,0xa3,0x47,0x63,
-    0x00,0x10,0x16,0x0e,0xc8,0xa4,0x41,0xdf,0x4d,0x57,0x0f,0xa6,0x90,0x73,0xf1,0x65,
-    0xb2,0x83,0xdb,0x53,0x73,0x76,0xe9,0x4b,0x16,0xf8,0xe8,0x23,0x2c,0x82,0x0f,0x58,
-    0xb1,0x22,0xce,0x1a,0x46,0xf3,0xd8,0xda,0x4c,0x3b,0x55,0x76,0xb3,0xb1,0x47,0x7f,
-    0xb5,0x6f,0xf0,0xf6,0xf2,0x86,0x15,0xb0,0x44,0x00,0x8c,0x85,0xde,0x07,0x14,0x99,
-    0x60,0x19,0x57,0xd4,0xff,0xfb,0x92,0x64,0xf7,0x0c,0xc2,0xd3,0x6c,0x43,0x93,0x7c,
-    0x3b,0x10,0x58,0xc3,0x58,0x72,0x77,0x22,0x72,0x0b,0xad,0xb1,0x0c,0x2e,0xe0,0xae,
-    0x01,0x9f,0x8d,0x60,0x81,0x8e,0x98,0xe8,0xc9,0x78,0x0c,0x38,0x74,0xcb,0xcf,0x63,
-    0x8f,0x20,0x0c,0xc6,0x81,0x34,0x39,0x44,0x39,0x36,0x79,0x76,0x98,0x18,0x8a,0x09,
-    0x0b,0x0b,0x01,0x14,0xc1,0x3a,0x16,0x83,0x4c,0x72,0x05,0x83,0x98,0x0f,0x11,0xc4,
-    0x33,0x31,0x2c,0x09,0x93,0xce,0xc9,0x0b,0x10,0x8a,0x81,0x21,0x24,0xde,0x66,0x03,
-    0xa3,0x8c,0xf9,0x6a,0xa4,0x4d,0xc4,0x80,0x31,0x41,0x46,0x74,0xb7,0x46,0xcd,0xcc,
-    0xa2,0x66,0xb5,0x36,0x8e,0xde,0xaf,0xe8,0x4e,0x8a,0xb9,0xd6,0x76,0x2b,0xfd,0xab,
-    0x7f,0x87,0x83,0x20,0xb2,0x3b,0x8c,0xd9,0x90,0x38,0x4a,0x0c,0xce,0x04,0x80,0x02,
-    0x97,0x1b,0xcd,0x82,0x7e,0x12,0x11,0x3c,0xd8,0x76,0x08,0x30,0x00,0x91,0x66,0x14,
-    0x0f,0x1d,0x20,0xc6,0x18,0x12,0x69,0x75,0x6a,0xa4,0x79,0xad,0xfe,0x00,0x7e,0x1a,
-    0xd6,0x7c,0x36,0x7c,0x50,0xff,0xb3,0xd1,0xfa,0x57,0xbf,0xd8,0xae,0x73,0xd4,0x17,
-    0x27,0x98,0xb3,0xff,0x4e,0xbf,0xc9,0x7b,0xb5,0xec,0xed,0xfc,0x34,0x12,0x63,0x05,
-    0xa0,0xe6,0xe8,0x29,0xb7,0x69,0xe1,0x99,0x90,0x17,0x84,0x28,0x19,0x0e,0x8a,0x08,
-    0xc0,0x81,0x09,0x23,0x89,0xfb,0xcc,0x2e,0x14,0x02,0x0c,0x32,0xf2,0x4f,0x5d,0x20,
-    0xc1,0x89,0xe2,0xf6,0x41,0xce,0x99,0x5e,0xca,0x7a,0xa3,0x20,0x42,0xa3,0x64,0x8f,
-    0x19,0x9f,0x45,0x65,0xae,0x80,0x5f,0x4d,0x6f,0xf6,0xa3,0x78,0x6f,0xc5,0x8f,0xee,
-    0xe5,0x89,0xb5,0xff,0xd6,0x35,0x05,0x9e,0xbe,0xef,0xfe,0x92,0x34,0xeb,0xff,0x4f,
-    0xff,0xfb,0x5f,0xfa,0xf6,0x76,0xfe,0x49,0x4c,0x41,0x4d,0x55,0x65,0x5f,0xc2,0x24,
-    0xe7,0xbd,0x13,0xee,0x61,0xcc,0x06,0x41,0x05,0x08,0x2b,0x07,0x94,0x44,0x98,0x6c,
-    0x28,0x05,0x06,0x9a,0xd8,0xaa,0xfa,0xac,0x19,0x22,0x58,0x2e,0x2f,0x43,0xb0,0xd0,
-    0x89,0xb5,0x85,0x4b,0x75,0x7b,0x3e,0xa0,0x8a,0xaf,0x39,0xee,0x92,0x9d,0x56,0x56,
-    0xeb,0x32,0x38,0x08,0x4b,0x8e,0x1b,0xb5,0x40,0x76,0x7a,0x9a,0x90,0x19,0xc9,0xd4,
-    0x3a,0xf1,0xf1,0x13,0xd3,0xbf,0xba,0xcb,0x11,0x8d,0x37,0x13,0x79,0x30,0xca,0x23,
-    0xde,0xb2,0x6c,0x25,0x6a,0xe7,0x1e,0xd5,0x27,0xfd,0xc0,0x20,0x01,0x11,0x51,0x6d,
-    0x25,0x33,0x73,0xb5,0x62,0x36,0x5e,0x14,0xd6,0x77,0x80,0x02,0x0e,0xe1,0xf0,0x20,
-    0x90,0x70,0x7a,0x6c,0xd6,0x20,0xff,0xfb,0x92,0x44,0xf9,0x88,0x83,0x25,0x1a,0xc2,
-    0x8b,0x5c,0x42,0xb0,0x6a,0xa3,0x58,0x50,0x6f,0x8c,0x56,0x09,0x54,0x47,0x10,0xcd,
-    0x71,0x68,0xc1,0x6b,0x8f,0xe3,0x1d,0xcd,0x3d,0x88,0x63,0x70,0x2e,0x34,0x12,0x80,
-    0x04,0x51,0xa6,0x00,0x5c,0x84,0x05,0xa9,0x3b,0x32,0xb6,0x0b,0x2a,0x84,0x92,0x4f,
-    0x19,0xfd,0x6a,0xbc,0xe3,0x16,0xd9,0xc6,0x02,0x30,0x62,0xe3,0xfc,0x46,0x37,0xdb,
-    0x1c,0xbb,0x74,0x71,0x37,0x11,0xb2,0xdd,0x5f,0xd1,0xaf,0x55,0x5e,0xd2,0x9e,0xca,
-    0x3f,0xfa,0x7d,0xd6,0xdb,0xbb,0xa3,0xdf,0xfd,0x01,0x5d,0xaa,0xaf,0xd7,0xd6,0xac,
-    0xa6,0x49,0x4a,0x09,0x01,0x03,0x86,0xc6,0x11,0x8f,0x1c,0x04,0x7e,0x10,0x2e,0x71,
-    0x03,0x61,0x15,0x93,0x69,0x20,0x58,0x01,0xaa,0x91,0x05,0x11,0xa4,0x33,0xc8,0xfa,
-    0x68,0x00,0x47,0x50,0xae,0xa9,0xb3,0xe5,0x59,0xe8,0x54,0x74,0xdd,0xb1,0x9b,0x93,
-    0x68,0xd9,0xdb,0xec,0x4d,0xcf,0xc9,0x8b,0x28,0xdc,0x67,0x17,0xa4,0x83,0x4f,0xa5,
-    0xf1,0x13,0x92,0x65,0x8a,0x61,0xcf,0x36,0x4c,0x70,0x69,0x6e,0x78,0x1d,0xad,0xa1,
-    0x2c,0x26,0x3a,0x52,0x9f,0xd1,0x0a,0x0a,0x99,0x6b,0x0b,0xef,0xe3,0x36,0x89,0xa9,
-    0x25,0xac,0x55,0x07,0xa1,0xe0,0x24,0x49,0x33,0x01,0xc0,0x40,0x33,0x81,0x5d,0x93,
-    0x0a,0xe0,0x17,0x2c,0xe9,0x86,0x00,0x9e,0x02,0x88,0x5c,0x22,0x16,0xf4,0xcf,0x3d,
-    0xab,0xdc,0x5c,0xf1,0xde,0xb2,0xdb,0x06,0xca,0x18,0x6c,0xd6,0xd9,0xec,0x0f,0x22,
-    0x3a,0xbf,0xfc,0x21,0xbf,0xe1,0x73,0xb2,0x64,0xe2,0xee,0x27,0x01,0x6b,0xfb,0xf5,
-    0xae,0xad,0xe5,0x9a,0xb4,0x90,0x6d,0x82,0x94,0x21,0x49,0xdb,0x76,0xd3,0xf6,0xf8,
-    0xb5,0x1a,0x87,0xff,0xf4,0xfe,0x85,0x00,0x95,0x0f,0xd5,0xb9,0xe8,0x31,0x80,0x21,
-    0xcc,0xc2,0x80,0x00,0x43,0x66,0x27,0xbc,0x76,0xf5,0x81,0x00,0x69,0xbe,0x02,0x9c,
-    0x08,0x5a,0x4e,0x50,0x48,0xf4,0xee,0x26,0x73,0x00,0x07,0x50,0x04,0xd7,0x65,0xc1,
-    0xd3,0x6c,0xe8,0x50,0x2b,0x50,0x7b,0xed,0x32,0xa5,0x56,0xf7,0x57,0x6b,0x3f,0x72,
-    0xd5,0x5f,0x2b,0xd9,0x0d,0x5d,0x98,0x92,0x6c,0xca,0x7f,0xd9,0xd5,0x11,0x53,0x7d,
-    0xd6,0x75,0x46,0xae,0x49,0x36,0x54,0x36,0x8e,0xbe,0x9d,0x33,0x32,0xde,0xcd,0xff,
-    0x9d,0xf7,0xd2,0x8f,0xd7,0x4a,0x17,0x53,0xa5,0x59,0xea,0xbd,0x79,0x7f,0xfc,0x6b,
-    0x7e,0xb5,0xb5,0xb0,0xaf,0x95,0x9d,0x0a,0xc4,0x8b,0x8c,0x26,0x80,0xd2,0x4c,0xcc,
-    0x08,0x48,0x0c,0x20,0x8c,0xb0,0x35,0xdd,0xff,0xfb,0x92,0x44,0xfc,0x88,0x02,0xfb,
-    0x1a,0x43,0x13,0x1c,0x69,0xd0,0x5b,0x03,0x58,0xba,0x6b,0xaf,0x52,0x0b,0x90,0x6b,
-    0x0e,0xce,0x68,0xea,0x81,0x82,0x8d,0x61,0x89,0xed,0xbd,0x88,0x64,0x00,0xc6,0x08,
-    0x2f,0x03,0x04,0xc0,0x08,0x05,0x00,0xb8,0x18,0xb2,0x07,0xc0,0x08,0x06,0x86,0x4c,
-    0x42,0x02,0xbf,0x9d,0x2d,0xbf,0x74,0x4b,0xdd,0x45,0x31,0x3d,0x8b,0x0a,0xb8,0x67,
-    0x25,0x07,0x1f,0x59,0x6a,0xc8,0xfa,0x55,0x39,0x2f,0xa6,0x9d,0x3a,0x57,0xb6,0xeb,
-    0x45,0xa7,0xa5,0xb7,0xdb,0xa5,0x8f,0x69,0xd3,0xfe,0xdd,0x3f,0xa5,0x51,0x1a,0xd9,
-    0xdb,0x77,0xe8,0xfe,0xfe,0xbd,0x52,0xaa,0xf5,0x5e,0xbc,0xbf,0xfe,0x0d,0x80,0x4f,
-    0xdf,0x25,0x2f,0xf3,0xc4,0x8e,0xaa,0xde,0x0a,0x19,0x90,0x2b,0x8e,0x54,0x00,0x0e,
-    0x0c,0x90,0x86,0x0c,0x94,0xe0,0x31,0x50,0x11,0xf8,0x30,0xcb,0xe4,0xfd,0x26,0x03,
-    0x25,0x43,0xa1,0x2b,0xa9,0x75,0xe9,0xc2,0x0a,0x72,0x0f,0xa4,0xf0,0x5a,0x38,0x92,
-    0x55,0x54,0x8a,0xdc,0x77,0xa6,0xf7,0x4f,0xe5,0x09,0x5a,0x9a,0x12,0xe1,0x9b,0x50,
-    0x4d,0x09,0x36,0x1e,0x81,0x5e,0x44,0x24,0x25,0xa2,0xb7,0x27,0x2e,0xb2,0xa6,0x68,
-    0x72,0xad,0x2d,0xd0,0xf4,0x5d,0x7f,0xeb,0x47,0xeb,0xb5,0x1b,0x13,0x36,0x60,0x25,
-    0xc3,0x01,0x2c,0x6a,0xd8,0x69,0xd8,0x76,0x1c,0x23,0x98,0x9c,0x0d,0x9b,0x53,0xb8,
-    0x99,0x64,0x0e,0x04,0x04,0x66,0x0d,0x0a,0x86,0xa2,0x02,0x06,0x04,0x80,0xcf,0xbb,
-    0xf5,0x65,0xa6,0x14,0x6b,0x77,0x1d,0xe6,0xdf,0xf2,0x10,0x9b,0xfd,0x33,0xd5,0xe3,
-    0x21,0x1a,0x9d,0x52,0xbd,0x7d,0x27,0x34,0x31,0xc5,0x58,0x2a,0x2f,0x4b,0xc5,0x4f,
-    0x32,0xf7,0xe5,0x1a,0xab,0xf6,0x2a,0xa5,0xb1,0xad,0x2f,0x2a,0x66,0xc9,0x3b,0x52,
-    0x1f,0xd1,0x45,0xd7,0xfe,0xb5,0xff,0xd3,0xc6,0xcc,0xd4,0xfa,0xee,0x41,0x3a,0x21,
-    0x18,0x14,0x98,0x70,0xf1,0x19,0x73,0x81,0xa2,0x13,0x75,0x2f,0x8c,0x76,0x1f,0x56,
-    0x80,0x41,0x74,0xce,0x02,0xb3,0x05,0x82,0xd7,0x4c,0x43,0x98,0x6f,0xef,0x99,0xfc,
-    0x48,0xb9,0x34,0x7d,0x0f,0x22,0x6c,0xcd,0x9c,0xc1,0x09,0xdc,0xe8,0xa9,0xd5,0xab,
-    0xfe,0x7d,0x4d,0x14,0xc8,0x92,0xcd,0xb2,0xdc,0x51,0x25,0x93,0x77,0xdd,0xe8,0xbb,
-    0xcc,0x66,0x75,0x7b,0x22,0xfb,0x58,0x92,0xec,0x7d,0x16,0xcf,0x40,0x69,0x22,0xd5,
-    0x36,0xd2,0xd5,0xa7,0x54,0xe9,0xff,0xfc,0x1b,0x95,0x7f,0xda,0x90,0x5d,0x2d,0x22,
-    0x09,0x42,0x07,0x66,0x35,0x06,0x10,0xc5,0x8d,0x50,0xff,0xfb,0x92,0x44,0xff,0x8c,
-    0xe3,0x49,0x6b,0xc2,0x13,0x7c,0x2b,0x10,0x6a,0x2d,0x78,0x40,0x6e,0xc2,0x5c,0x0b,
-    0x38,0x41,0x08,0x2e,0x60,0x6e,0x01,0x76,0x0d,0x21,0x05,0x9e,0xa1,0x18,0xb7,0x19,
-    0x00,0x0d,0x05,0x0f,0xf3,0x89,0x0c,0x90,0x04,0x04,0x8b,0x17,0x53,0x94,0x98,0x84,
-    0x4d,0x95,0xdc,0xf9,0xc8,0x18,0x8c,0xa2,0x42,0x8c,0x6e,0x2e,0xfd,0xa2,0x07,0xbe,
-    0xa6,0x8d,0x41,0x41,0xe4,0x27,0xae,0x68,0xa1,0x2e,0x61,0x8b,0xb9,0x85,0xa2,0xe5,
-    0x1a,0xd8,0xb1,0x7b,0x13,0x20,0x5c,0xf3,0xcf,0xd8,0xcb,0xd9,0xb4,0xf3,0xd8,0xd7,
-    0x02,0xaf,0xfd,0xc2,0xae,0xe9,0x53,0xff,0x7d,0x99,0x87,0x19,0x0a,0x6a,0x17,0x44,
-    0x58,0x40,0x2a,0x8e,0x7b,0xa8,0x41,0xc1,0xed,0x60,0xd7,0x5d,0xc3,0x94,0x93,0xd0,
-    0x44,0x43,0x39,0xb9,0xcc,0x08,0x0b,0x6b,0x0e,0xcd,0x18,0xce,0x20,0x42,0xbb,0x9d,
-    0xa8,0xe0,0xf7,0x94,0xa5,0xfa,0xce,0x86,0x45,0xb2,0x2d,0x3b,0xa2,0xdd,0xbe,0xdb,
-    0xda,0xae,0x97,0xb7,0x5c,0xab,0xd5,0x1a,0xc6,0xe9,0x6d,0x6b,0xa6,0xb5,0xfa,0xdf,
-    0xd7,0x4b,0x25,0xd3,0xae,0xfe,0xef,0x4b,0x9e,0xc5,0x74,0x67,0x52,0xbb,0xa4,0xec,
-    0xca,0xc8,0xce,0x96,0xb2,0xe8,0xd3,0x7a,0xe5,0xf0,0x58,0x6c,0x01,0xde,0x79,0xd5,
-    0x5b,0x4d,0xc0,0xbb,0x62,0x40,0xf9,0x84,0x20,0xd1,0x87,0xe5,0xa1,0xc9,0x63,0xa8,
-    0x18,0x6a,0x2a,0x0c,0x4f,0x90,0x99,0x30,0xb8,0xe4,0x80,0x34,0x61,0xeb,0x29,0x80,
-    0x04,0x8c,0x10,0xc5,0x80,0x16,0x25,0x15,0x97,0x52,0xd6,0xc3,0xb5,0x0e,0x0c,0x02,
-    0x09,0x8b,0x06,0x5f,0x0e,0x83,0x45,0x8f,0x35,0x86,0x0c,0x24,0x25,0x0e,0xb9,0x8c,
-    0x63,0xd3,0x71,0x26,0xca,0xe7,0xdc,0x84,0xbf,0x9b,0x5a,0x30,0xf9,0x64,0x07,0x9c,
-    0x6c,0xba,0x9a,0x64,0x60,0xe1,0x8b,0x14,0x2e,0x15,0xff,0xd6,0xe4,0xaa,0xbb,0x2b,
-    0x97,0xca,0xdd,0xb4,0x1f,0x48,0xf2,0xd0,0x83,0x85,0x22,0x25,0xd9,0xb8,0x50,0x41,
-    0x51,0x28,0x04,0x60,0x62,0xa9,0xf1,0xa1,0x0e,0x86,0x60,0x04,0x63,0x14,0x66,0x70,
-    0xec,0xd3,0x85,0x86,0x5d,0xa5,0xf8,0x14,0x02,0x20,0xba,0x3c,0x41,0x9a,0xbc,0xd1,
-    0xb6,0xde,0x6f,0xe8,0xd1,0x87,0x96,0xb7,0xa1,0xca,0x8d,0x42,0xe7,0xf5,0x4a,0xa8,
-    0x6c,0xae,0x86,0x0a,0x7a,0x27,0xee,0x1a,0xd6,0xda,0xd9,0x38,0xcb,0x75,0xa3,0x56,
-    0xd9,0xf9,0x55,0xaa,0xde,0x2d,0x72,0xd4,0x2a,0xfb,0xaa,0xb2,0xba,0x98,0x40,0x03,
-    0x3e,0x57,0xa7,0x91,0x0c,0x81,0x45,0x80,0xaa,0x4d,0x6f,0x05,0xff,0xfb,0x92,0x64,
-    0xf9,0x0f,0xc3,0x19,0x6b,0xc1,0x83,0x81,0x14,0xf0,0x5a,0x23,0x58,0x31,0x73,0x23,
-    0x70,0x0c,0x91,0xa7,0x06,0x0d,0xf0,0x4c,0x41,0x85,0x89,0xa0,0x85,0xde,0x09,0x5a,
-    0x03,0x86,0xd4,0x26,0x98,0x18,0x04,0x17,0x06,0x9a,0x30,0x0e,0x97,0xe6,0x0e,0x10,
-    0x18,0x2c,0xaa,0x46,0xd3,0x2c,0x34,0xcd,0x00,0x53,0x11,0x51,0x85,0xb4,0xf9,0x5c,
-    0x48,0x10,0x48,0x10,0x88,0xac,0x0b,0x6c,0x50,0xf9,0xa4,0x60,0x8d,0x10,0x10,0x49,
-    0x14,0x6d,0xce,0x72,0xc9,0x65,0xbd,0x89,0x4d,0x04,0x6f,0xf7,0x62,0x04,0xf7,0x5e,
-    0x33,0x0f,0x7a,0x77,0x3c,0xfd,0xde,0xf5,0x7f,0x62,0xc9,0x5f,0x66,0x8a,0xef,0xa2,
-    0x31,0xfe,0x2c,0x8e,0xb7,0xdd,0x55,0x95,0xd4,0x01,0x35,0x4e,0xd7,0xde,0xb5,0x6a,
-    0x3d,0x08,0x7d,0x3a,0x1c,0x01,0x0a,0x11,0x4d,0x18,0x1a,0x24,0x04,0x25,0xf9,0xc7,
-    0x46,0x26,0x74,0x09,0xbc,0xa1,0x80,0xd3,0x3d,0x05,0xd2,0xbd,0xd1,0xa4,0xb1,0x52,
-    0x94,0x88,0x84,0xcd,0x22,0x4a,0xe7,0x5e,0x93,0xe1,0xf4,0xfb,0x75,0x9a,0x4b,0x1c,
-    0xab,0xfb,0xff,0xf6,0x4b,0xd4,0xdb,0x6c,0x23,0xf6,0x53,0xfa,0x24,0x6f,0xa2,0xdb,
-    0x7f,0xdf,0x57,0xdd,0x77,0xa8,0x0b,0x96,0x52,0xe4,0x6f,0x70,0xfd,0x25,0xf8,0xdd,
-    0x34,0x3a,0xd6,0x98,0x31,0x79,0x8d,0x0c,0x15,0x42,0x97,0x02,0xb3,0x17,0xa0,0xc3,
-    0x42,0x81,0xab,0x27,0xa5,0xf0,0x60,0xe7,0x0e,0x8b,0x2f,0x47,0x92,0x6a,0x6e,0x0d,
-    0xe5,0x79,0xde,0x37,0xae,0x5b,0x55,0x26,0x11,0x3a,0x48,0x8c,0x4a,0x43,0x43,0x62,
-    0xa1,0x47,0x94,0x45,0x0b,0x0a,0x28,0x91,0x51,0x58,0xaf,0x2c,0x04,0x0c,0x15,0xe4,
-    0xed,0xca,0x3e,0x52,0x15,0xa9,0x15,0x2e,0xa0,0x64,0x2b,0x67,0xd0,0xe7,0xb9,0xc2,
-    0x8b,0x3d,0x5b,0x2f,0xf0,0xed,0x76,0xb9,0x4e,0xff,0xea,0xf9,0x2f,0xfb,0x15,0xd1,
-    0x45,0x80,0x07,0x86,0xb9,0x2d,0xa6,0x56,0xe5,0x0f,0x6e,0xc5,0xca,0x5f,0xc6,0x07,
-    0x05,0x86,0x99,0x05,0x28,0x20,0x25,0x02,0x4f,0x16,0x1f,0x4c,0x22,0x0a,0x4c,0x00,
-    0x44,0x08,0x4c,0x7f,0xec,0x28,0xe2,0x5d,0x2b,0x91,0xa2,0x4c,0xb0,0xf5,0xb6,0x1d,
-    0xcb,0x58,0xed,0xde,0x90,0x0e,0x0f,0x3f,0xf7,0x9d,0xf8,0x4e,0xaa,0x1a,0x27,0x71,
-    0x91,0x53,0x06,0x84,0x30,0xdb,0xd0,0x68,0xd2,0x8b,0x15,0xed,0xe1,0xea,0xf7,0x8d,
-    0xea,0xb9,0x84,0x0c,0x37,0x15,0x79,0x1d,0x7f,0x5b,0x5b,0x2f,0xe7,0x11,0xa1,0x80,
-    0x4c,0xa7,0xc8,0x09,0x23,0x2e,0x2f,0xfc,0x3b,0x71,0x99,0xb0,0x56,0x82,0xff,0xfb,
-    0x92,0x44,0xf6,0x08,0x82,0xfa,0x15,0x42,0x03,0x9b,0x4b,0x10,0x67,0xa4,0x28,0x52,
-    0x73,0x09,0x72,0x09,0x9c,0x61,0x13,0x2e,0x25,0xb0,0x41,0xab,0x90,0xe3,0x29,0xb7,
-    0xc6,0x18,0x9e,0x2d,0x70,0x50,0x68,0x56,0x62,0xcf,0x5b,0x46,0xa4,0x98,0x45,0x10,
-    0xb8,0x32,0x62,0x12,0x1c,0x73,0xe3,0xea,0x60,0x88,0x92,0x60,0x28,0x1a,0xe8,0x30,
-    0x67,0x29,0xe3,0x8c,0xcb,0x47,0xc2,0x69,0xaa,0x05,0xc9,0x26,0xd4,0xd6,0xda,0xe3,
-    0x63,0x69,0x45,0x67,0x14,0xd5,0xbb,0x48,0x0a,0x0e,0xab,0xd1,0x3d,0xff,0x88,0x42,
-    0x47,0x3e,0x8c,0x95,0xff,0xed,0xe2,0xcf,0xe9,0xf8,0xb6,0xd5,0xba,0xe6,0xd1,0xb1,
-    0xbd,0x6b,0xb7,0xef,0xfd,0xfa,0x3e,0x41,0x00,0xfd,0x67,0x34,0xd8,0xa1,0x4c,0xd0,
-    0x20,0x18,0x78,0x78,0x2d,0x4c,0x6a,0x47,0x62,0x00,0x13,0x03,0xc5,0x83,0xba,0xcc,
-    0x73,0x16,0x40,0xc1,0x20,0x54,0x12,0x38,0x99,0x56,0x52,0x21,0x41,0x40,0x01,0x23,
-    0xa2,0x3a,0xba,0x19,0xbc,0x5e,0x93,0x31,0x5e,0x03,0x00,0x79,0x92,0x14,0x81,0xc7,
-    0x1a,0x1e,0xea,0x81,0x73,0xc8,0x10,0xad,0x2f,0x8a,0xee,0x14,0x40,0x60,0x5b,0x72,
-    0xcd,0x4b,0x39,0x8e,0xbd,0xe9,0x61,0x37,0x7c,0xec,0xbc,0x8a,0xe7,0xc6,0xc7,0xd8,
-    0xa0,0xe8,0xbb,0xdd,0x69,0x89,0x76,0x27,0x9b,0x0e,0xe9,0xf9,0x00,0xe7,0xf7,0x2b,
-    0xdd,0xc9,0x60,0x57,0x2b,0x40,0x62,0x72,0x74,0x4c,0x38,0xc2,0x72,0xe8,0x0c,0x01,
-    0x80,0x7b,0xcc,0xcc,0x24,0x0c,0x04,0x98,0x5e,0x8b,0x1e,0x6a,0x21,0x18,0x64,0x09,
-    0x98,0x92,0x0b,0x16,0xb5,0xa7,0x39,0xb0,0xf5,0x2f,0xeb,0x08,0xcd,0xcb,0x4b,0x49,
-    0x21,0xa9,0xba,0xcc,0x52,0x64,0x37,0xf0,0x0c,0xc1,0x2e,0xff,0xe9,0x18,0xed,0x6f,
-    0x50,0xcc,0xc7,0xc5,0xef,0xfb,0x39,0xa7,0x33,0xe0,0x47,0xb7,0xfb,0xfb,0xd6,0xff,
-    0xbb,0xf3,0x7a,0x7e,0x85,0x80,0x00,0x00,0x00,0xf6,0xb7,0x20,0xe3,0x04,0x12,0x42,
-    0x66,0x24,0x1a,0x00,0xa7,0x0c,0x96,0x01,0x15,0x01,0x03,0x55,0xe7,0x04,0xdd,0x09,
-    0x1a,0x5b,0x01,0x81,0x85,0x26,0xea,0x13,0x84,0x02,0xd3,0xa6,0x55,0x54,0xe2,0xa9,
-    0x13,0x3e,0x97,0x8e,0x27,0x10,0x01,0x69,0x66,0xa1,0x4d,0x35,0x2e,0x58,0xe2,0x54,
-    0x68,0xcd,0xd6,0xa8,0x13,0x48,0x85,0x32,0x4a,0x90,0x09,0x52,0x28,0x89,0xc5,0x47,
-    0x5a,0x33,0x04,0x6b,0x75,0x85,0x50,0xb6,0x9e,0x4b,0x25,0xd8,0xcd,0x5a,0x96,0x31,
-    0x9c,0x6a,0x1c,0x08,0xfb,0x51,0xd4,0x00,0x6e,0xba,0xeb,0x5d,0xc6,0x8a,0xd4,0x6a,
-    0xff,0xfb,0x92,0x44,0xf5,0x84,0x83,0x11,0x1a,0xc2,0x2b,0xbb,0x5b,0x10,0x60,0xa4,
-    0x18,0x82,0x6b,0xab,0x64,0x0c,0x98,0x57,0x06,0x2d,0xf5,0x0a,0x81,0x60,0x10,0x61,
-    0xd5,0xbe,0xb5,0x98,0x52,0xe1,0x36,0xc2,0xa0,0xa3,0x2c,0x81,0x5e,0xe6,0x2e,0x65,
-    0xc0,0x28,0x3a,0x16,0x60,0x80,0x91,0x8f,0xda,0xa7,0xcf,0x30,0x18,0xc0,0x0a,0x0e,
-    0x16,0x38,0xf3,0x80,0x71,0x71,0xbc,0xf7,0xc7,0xc9,0xa0,0xcd,0xff,0x10,0x56,0x53,
-    0xdb,0x1f,0xfa,0xa1,0x43,0x8a,0xe1,0xe8,0x5a,0xe3,0x45,0xcb,0x80,0x57,0x24,0xa5,
-    0xe3,0x5a,0x28,0xa5,0xea,0xa2,0xba,0xc8,0x8f,0x02,0x87,0x03,0x88,0x6f,0x18,0xf1,
-    0x0f,0x53,0xfd,0x8c,0xb4,0xa6,0xaa,0xb4,0xc6,0xdc,0x11,0xfa,0x37,0x92,0x13,0x5b,
-    0xaa,0x37,0x25,0xb8,0x40,0x71,0x84,0xb1,0x1e,0xf9,0x58,0x61,0xd1,0x9a,0x39,0x98,
-    0x06,0x99,0xc8,0x01,0x94,0x0d,0x00,0x07,0x0d,0xe5,0x35,0xb3,0xac,0xe9,0x6d,0x35,
-    0x0f,0xf6,0x4a,0xa8,0x7d,0x6f,0xbd,0x4a,0x0b,0x53,0x46,0x25,0xea,0x99,0x41,0x1a,
-    0x8c,0x9d,0x07,0x78,0xa5,0xef,0x63,0xd4,0x90,0xda,0x68,0xa5,0x4c,0x1e,0xa5,0xba,
-    0x96,0xc2,0xe2,0xe2,0x83,0x18,0x44,0x04,0xc6,0xaa,0xf7,0xa6,0xd5,0x9f,0x61,0x56,
-    0xcc,0x25,0x71,0x4b,0x9c,0xe9,0xf2,0xc9,0x3b,0xe4,0x8a,0xef,0xb9,0x7e,0x46,0xdc,
-    0x64,0x0f,0xdb,0x05,0x71,0x4b,0x00,0x93,0x03,0x90,0x1e,0x50,0xa8,0x58,0x03,0xa4,
-    0x34,0x28,0x20,0x42,0x16,0x31,0x06,0xe4,0xf5,0x5c,0x83,0x36,0x70,0xf0,0x13,0x07,
-    0x0a,0x57,0x2e,0x34,0x66,0x9a,0xcb,0xd5,0xfc,0x52,0x6f,0xa1,0x1d,0xea,0xda,0x80,
-    0x90,0x2a,0xde,0x9a,0x06,0x21,0xbc,0x58,0xea,0x77,0xa8,0x55,0x2b,0xb4,0x02,0x5a,
-    0xd1,0x19,0x51,0xcc,0x2d,0x5e,0xa9,0x26,0xb2,0x35,0xe8,0x9b,0x50,0x84,0x04,0xd6,
-    0x20,0xeb,0x3d,0x56,0x8b,0xa7,0x13,0x24,0xef,0x92,0x80,0x00,0x01,0xea,0xe0,0x36,
-    0x56,0x48,0x01,0x31,0xd4,0xe1,0x8e,0x08,0x43,0xe6,0xcd,0x17,0x2c,0x72,0x11,0x91,
-    0xda,0xb4,0x23,0xcc,0x74,0xe0,0x15,0x0b,0x05,0x87,0x8e,0x1c,0x5f,0x5f,0x74,0x55,
-    0x63,0xd6,0x95,0xf4,0x07,0x10,0x41,0x50,0xdb,0x5a,0xc6,0x0a,0x2d,0xc4,0x0e,0x30,
-    0x80,0xc3,0x50,0x3c,0xc5,0xaf,0x20,0x49,0x0d,0x54,0xd9,0xa3,0xe0,0xb3,0x44,0xb0,
-    0xc3,0xf0,0x28,0x15,0xec,0x12,0xd4,0xe1,0x45,0xae,0xe7,0x4f,0x88,0x22,0xaf,0x3c,
-    0x81,0x0e,0xad,0x03,0x10,0xe2,0x65,0x20,0x00,0x01,0xfc,0xca,0x5a,0xfd,0xc5,0xdf,
-    0x68,0x9c,0xff,0xfb,0x92,0x44,0xf4,0x8f,0x83,0x0f,0x15,0x41,0xc1,0xfc,0x39,0xc4,
-    0x61,0x63,0x68,0x86,0x70,0xcf,0x86,0x0b,0xc0,0x55,0x04,0x00,0x6d,0x01,0xc1,0x7f,
-    0x0d,0xa1,0x05,0xcd,0x1d,0xc8,0x12,0xf2,0x99,0x38,0x12,0x8d,0xa6,0x02,0x00,0x19,
-    0x16,0xa4,0x68,0xc1,0x01,0x84,0x20,0xc9,0x8b,0xc3,0xd1,0xfc,0x0e,0x99,0xdd,0x46,
-    0x61,0x44,0xae,0x48,0x9c,0xc5,0x70,0x4d,0x81,0xd6,0xc2,0x4f,0x93,0xbe,0xa2,0xbb,
-    0x4c,0x38,0x06,0xba,0xe1,0x09,0x23,0xe3,0xb6,0xa4,0xd2,0x6a,0x74,0x83,0xf4,0x85,
-    0xb3,0xf3,0x6e,0x1c,0xf5,0x25,0xcb,0x48,0xb6,0xf6,0xef,0x3f,0xb1,0x04,0x3d,0x04,
-    0x0e,0x1a,0x71,0x34,0x3f,0xf3,0xce,0xab,0x8d,0x0f,0x09,0x04,0xa8,0x42,0x01,0x30,
-    0x37,0x32,0x40,0x3c,0x30,0x08,0x01,0x30,0x2c,0x3e,0x35,0x26,0x58,0x00,0x82,0x48,
-    0x01,0x0b,0x82,0xc6,0x29,0x89,0x65,0xc3,0x65,0x52,0xdb,0x81,0xa1,0xe2,0x2d,0xbe,
-    0x6e,0x44,0x6e,0xfd,0x68,0x59,0xf7,0x9f,0x15,0x10,0x3e,0xe5,0xc7,0xa9,0x27,0x47,
-    0x1c,0x09,0xb0,0x99,0xd5,0x8d,0x17,0x6c,0xd9,0xd3,0x09,0x65,0x09,0xe2,0xe6,0xc5,
-    0x24,0xe1,0x20,0xc5,0x26,0xf5,0xa4,0xcd,0xac,0x72,0x06,0xd0,0xf4,0xb1,0x8f,0xe2,
-    0x36,0x2c,0x70,0x5c,0x59,0xda,0x7f,0xf5,0x2f,0x56,0x74,0x2c,0x51,0x07,0x1d,0xa7,
-    0x0c,0x83,0x80,0x50,0x5d,0x78,0x2b,0x09,0x8d,0x66,0x79,0x12,0x92,0xaa,0xe6,0x1b,
-    0x9a,0xc7,0xe3,0x92,0x27,0x18,0xc1,0xbb,0x20,0x0a,0x02,0xb1,0x9d,0xd8,0xd5,0x2e,
-    0x4d,0x6a,0xb6,0x62,0x6c,0xa8,0xe4,0x5a,0x66,0xc1,0x0d,0x22,0x80,0xf2,0x40,0xf3,
-    0x0a,0x2e,0x20,0xe3,0x96,0xd6,0x15,0xae,0xc5,0x8b,0x31,0xb2,0x26,0xd6,0x94,0xd4,
-    0xf1,0xe8,0x5b,0x1a,0xe3,0x1d,0x82,0x37,0x80,0x0d,0x14,0x0a,0xbc,0x1d,0x79,0x12,
-    0x28,0x36,0x7b,0x04,0xd6,0x13,0x16,0x0b,0x9d,0x7e,0x95,0x4c,0x41,0x4d,0x45,0x63,
-    0xbf,0x0e,0x67,0x38,0xb9,0x9c,0xe6,0x6e,0xc1,0x87,0x04,0x46,0x5e,0x14,0xa1,0xc0,
-    0xc0,0x80,0xd3,0x18,0x48,0x43,0x8f,0x26,0x34,0xa9,0x85,0x42,0x7f,0xde,0x13,0x22,
-    0x2e,0xa2,0x40,0x52,0x1a,0x4c,0x59,0x32,0x72,0x79,0x34,0xcf,0x9c,0x96,0x08,0x82,
-    0x41,0x72,0x8d,0x83,0xca,0x1f,0x52,0x2f,0x78,0xde,0x84,0xed,0x50,0xa2,0xd5,0x29,
-    0x3c,0xf3,0x25,0xc6,0x8f,0x87,0x23,0x8f,0xd6,0xb1,0x09,0xa5,0x4e,0xc7,0x24,0x1f,
-    0x83,0x50,0xd3,0xa9,0x6b,0xc8,0x00,0x87,0x20,0x48,0x66,0x34,0x51,0xa7,0x15,0x47,
-    0xfe,0xe5,0x71,0x31,0xff,0xfb,0x92,0x44,0xf3,0x04,0xf2,0xea,0x16,0x41,0xc0,0x7c,
-    0x10,0xe0,0x59,0x81,0x88,0x35,0x73,0xba,0x60,0x8c,0x30,0x55,0x04,0x0c,0xf4,0xc8,
-    0xc1,0x91,0x0d,0x20,0x81,0xdd,0x09,0xc8,0x90,0x98,0x82,0xb1,0xb8,0x49,0xae,0x71,
-    0x62,0xeb,0x19,0x04,0x66,0x70,0xaa,0x68,0x41,0x60,0xc0,0xd1,0x88,0xd9,0xe6,0x3a,
-    0xc8,0x0b,0x12,0x48,0x8a,0xa9,0xe4,0xf9,0x4f,0x59,0xbf,0xc7,0xa1,0x65,0xc6,0x45,
-    0x73,0x96,0xd5,0x75,0xea,0xd1,0xef,0xbc,0x2b,0x3f,0x54,0x73,0xe9,0x9f,0x8a,0xdb,
-    0xa7,0x46,0x9b,0x72,0xd0,0xf6,0x3c,0xe4,0x12,0xfd,0x0f,0x2d,0x02,0xbd,0xfe,0xfb,
-    0xa6,0xdf,0xfe,0x63,0x1c,0x9d,0x8b,0xd7,0xea,0x6b,0xaf,0x5f,0x48,0x77,0xb6,0x74,
-    0x90,0x65,0x5d,0x99,0xc7,0x7b,0x21,0x32,0x51,0x92,0x08,0x27,0x9c,0x8f,0x2a,0x13,
-    0x0a,0xbe,0xb9,0x83,0xa1,0xc0,0xd3,0xe8,0x58,0x84,0x69,0xd2,0x40,0x44,0xf6,0xbd,
-    0x5e,0xcd,0xeb,0x93,0x0e,0x87,0xa6,0xac,0x32,0xd5,0x6c,0x53,0x2f,0xdb,0x7d,0x7f,
-    0xda,0xfe,0x06,0x83,0x23,0x0f,0x8e,0x6a,0xc6,0xbb,0xf6,0x7b,0xbf,0x8c,0xf5,0x7b,
-    0xc9,0x76,0x2c,0xa5,0xff,0xfb,0x9b,0xd3,0xaa,0x90,0x00,0x00,0x04,0x53,0x2c,0xdf,
-    0x1e,0x4c,0x08,0x79,0x96,0x23,0x51,0x2a,0xb2,0x74,0xa5,0x0f,0xcb,0x4c,0x0d,0x5d,
-    0xe1,0x85,0x18,0x60,0xe9,0xf6,0x32,0x8f,0x01,0x2e,0x99,0x55,0x51,0x56,0x15,0x12,
-    0x31,0x4d,0x94,0x43,0x49,0xad,0x0e,0x79,0x15,0x3d,0x87,0xd7,0x99,0xb1,0x09,0x0a,
-    0xaa,0x23,0x72,0x9f,0x4d,0xaf,0x7a,0xcc,0xae,0x98,0xf6,0x35,0xac,0x02,0x84,0x6b,
-    0x59,0x81,0xea,0x7b,0x73,0x0a,0x43,0xd7,0xad,0x8d,0x3c,0x70,0x40,0x93,0x41,0x82,
-    0xa0,0x54,0xc5,0xad,0xa1,0x58,0x18,0x58,0x66,0x66,0xdd,0x2b,0xd0,0xbb,0x9c,0x74,
-    0xd4,0x52,0xd2,0xaa,0xf3,0xa2,0xc9,0x1f,0xdb,0xc3,0x1b,0xb8,0xbc,0x63,0x80,0xe2,
-    0xac,0x2c,0xd4,0xec,0x00,0x82,0xa0,0x38,0x38,0xad,0xf0,0x93,0xfa,0x23,0x89,0xe7,
-    0x99,0xcb,0xd1,0xb6,0x0c,0xa6,0xb6,0xbe,0xef,0x74,0xda,0xdd,0x48,0x26,0x03,0x01,
-    0xbf,0x54,0xa9,0xab,0xd1,0x92,0x09,0x4b,0xb1,0x46,0xd7,0x48,0xa5,0xf1,0x68,0x2e,
-    0x56,0xa3,0x67,0xf5,0xa8,0x5a,0xa5,0xe8,0x66,0x16,0x68,0x15,0x0b,0x4b,0xd8,0xa5,
-    0x84,0x81,0x32,0x47,0xda,0x44,0x54,0xe9,0xa6,0x96,0x1c,0xe2,0x4a,0x65,0x1c,0x05,
-    0x97,0x32,0xe4,0x91,0x65,0x45,0x60,0x06,0x1c,0x6e,0x7d,0x84,0x01,0xc1,0xa1,0xc1,
-    0x66,0xc0,0xee,0x35,0xc6,0x97,0xff,0xfb,0x92,0x44,0xf1,0x88,0x03,0x05,0x0f,0xc2,
-    0x0b,0x9a,0x33,0x10,0x62,0xc3,0x68,0x20,0x6f,0x82,0x64,0x48,0x4c,0x6b,0x19,0x43,
-    0x69,0x07,0x21,0x70,0x05,0xa1,0xb0,0x6c,0xec,0x90,0x22,0x26,0x23,0x3e,0x02,0x04,
-    0x10,0x21,0x7c,0x86,0xd4,0xb7,0x3b,0xfe,0x0e,0x6c,0x68,0xbe,0xc9,0xea,0x0b,0xd2,
-    0x7c,0x22,0x27,0x3d,0x7f,0xd9,0xf8,0x68,0x63,0xd3,0xe1,0xa2,0xba,0x17,0x7a,0x46,
-    0xb9,0x11,0xe8,0x72,0xd3,0x35,0x87,0x5f,0xef,0x0f,0xf7,0xc2,0x5b,0xa3,0xe4,0x4b,
-    0x2b,0xa3,0xfa,0x68,0x90,0x88,0xbb,0x10,0xe9,0x1b,0x46,0xeb,0x1a,0xe6,0x47,0x0f,
-    0xed,0x47,0x35,0x4d,0xc2,0xe3,0xaf,0x39,0x51,0x4b,0x71,0x33,0x4e,0x9b,0x96,0xf8,
-    0x24,0x0c,0xaa,0x55,0x6a,0x58,0xcb,0x96,0x93,0xea,0xfe,0xa7,0xc8,0x80,0x25,0x01,
-    0x23,0x0a,0x70,0xe8,0x03,0x07,0x00,0x70,0xf8,0x24,0x07,0x18,0x30,0x4f,0x9c,0x30,
-    0x17,0x07,0xb8,0x16,0x55,0x8d,0x32,0x0d,0xb6,0x58,0x54,0xb7,0xab,0x42,0xf8,0x68,
-    0x48,0xae,0x7b,0x95,0xba,0xc0,0x04,0x2d,0xc4,0x36,0x88,0xf5,0xa0,0x63,0x85,0x87,
-    0x92,0x15,0xa5,0x8e,0x75,0xf1,0x4f,0xc0,0x96,0x11,0xf2,0x05,0xa2,0xa4,0x5a,0x75,
-    0x88,0x3a,0xbc,0x99,0x03,0x61,0x77,0x2b,0x85,0x9a,0xcd,0xca,0x15,0x75,0xc1,0xc9,
-    0x1e,0x1c,0x2a,0x0e,0x00,0x62,0x40,0xe0,0x41,0x66,0x87,0xf9,0x0b,0xaa,0x38,0x08,
-    0x30,0xe4,0xe0,0x40,0x08,0x70,0xcc,0x0c,0x60,0x36,0xc0,0x91,0xb8,0x33,0x79,0x76,
-    0x25,0x3c,0x86,0xab,0xc0,0x49,0x4b,0x1b,0xd7,0xff,0xcd,0x91,0xb5,0x58,0xf4,0x82,
-    0x5d,0xea,0xda,0xfc,0x7d,0x4f,0xfb,0x3f,0xd4,0x7d,0x4e,0xff,0xe7,0xf9,0x2f,0x5e,
-    0xd9,0xaa,0x88,0x7a,0xce,0xf4,0xac,0xe9,0x33,0x2b,0x9a,0xbf,0xf8,0xac,0x03,0xe4,
-    0x1e,0x1e,0xe7,0x3d,0xfe,0x5a,0xe7,0x7f,0x88,0xa0,0x89,0x9e,0xe1,0x9f,0xb5,0xc7,
-    0xf3,0xbe,0x95,0x29,0xcc,0xb2,0x17,0x11,0x8f,0x00,0x61,0xf2,0x1b,0xbd,0x20,0xa0,
-    0xc6,0x06,0x10,0x9c,0x97,0x02,0x68,0xa0,0x29,0x80,0xc0,0xe6,0x18,0x85,0x1c,0xea,
-    0xb6,0x18,0x2a,0x1e,0x2d,0x2a,0xd7,0x9a,0x43,0x5e,0xf7,0x42,0x23,0x71,0x7d,0x0e,
-    0x35,0x04,0xf4,0x1c,0x29,0x50,0xa2,0x88,0x0a,0xd7,0x25,0x62,0x02,0x5a,0x74,0xa8,
-    0x88,0x46,0x9a,0x15,0x32,0xb3,0x32,0xad,0x24,0x22,0x32,0x2f,0x49,0x8a,0x7e,0x6b,
-    0x10,0x4b,0x9e,0xf2,0xdb,0x47,0xcd,0x96,0x2b,0xe2,0x06,0x74,0x63,0xf0,0x95,0x19,
-    0x29,0x92,0x29,0x5d,0x97,0x22,0x33,0x2d,0xff,0xfb,0x92,0x44,0xff,0x8c,0xf3,0x4b,
-    0x1b,0x42,0x13,0x5c,0x63,0x10,0x6e,0x0a,0xc8,0x00,0x17,0x63,0x1e,0x4c,0x04,0x6d,
-    0x06,0x2e,0xe1,0x0e,0x01,0x78,0x05,0xa0,0x80,0x2d,0x70,0x91,0x33,0x53,0x88,0x04,
-    0x2d,0xef,0x06,0x87,0x8b,0x0a,0x04,0xb4,0xcb,0x3f,0x84,0x26,0x0b,0x50,0x60,0xbc,
-    0xc7,0xe8,0x83,0x90,0xe4,0x02,0x00,0x45,0x34,0xc0,0x11,0xab,0xab,0x72,0xad,0xab,
-    0x28,0x71,0x1a,0x0d,0x5f,0x2d,0x24,0xe5,0xd2,0x03,0x85,0xb2,0x22,0x51,0x90,0xe6,
-    0xcc,0xb6,0xb6,0x0a,0xb1,0x93,0x1d,0x5e,0xc7,0x23,0xf4,0xfa,0xbb,0x59,0xde,0xce,
-    0xbf,0xd0,0x59,0x96,0x7f,0xff,0xf2,0x3f,0xbe,0xde,0x6e,0xce,0xd4,0x71,0x7a,0x34,
-    0xd0,0xc0,0x19,0xaa,0xc2,0x4c,0x99,0x63,0x9b,0xe1,0x52,0x66,0x30,0x78,0xd0,0x20,
-    0xc5,0x60,0xe3,0xb8,0x89,0x01,0xc3,0x80,0x30,0x09,0x9c,0xc6,0xa9,0x69,0xb1,0xb4,
-    0x3a,0x5c,0x9c,0xd9,0x82,0x22,0x49,0x6d,0x00,0x20,0x33,0x6a,0x78,0xdf,0xf0,0x90,
-    0xc0,0xce,0xa6,0xc2,0x14,0xe2,0x28,0x1d,0x5a,0x81,0x3f,0x2b,0x0e,0x6f,0xd2,0x0b,
-    0x94,0x33,0x37,0x62,0xcf,0xa6,0x67,0xef,0x33,0x2b,0x96,0x55,0x7b,0x3b,0x4e,0x2d,
-    0x22,0xb7,0xd3,0xa6,0x6e,0xa5,0xf2,0xe7,0xc2,0x53,0x87,0xb3,0x1f,0xf0,0x6e,0xbf,
-    0x51,0x8b,0x05,0x00,0x10,0x01,0x0b,0xb6,0x28,0x18,0x94,0x99,0x93,0x2b,0x12,0xc5,
-    0x03,0x3e,0x54,0x5b,0x26,0xc3,0x3e,0x61,0xa0,0x2b,0x90,0xc2,0x6c,0xcd,0x3d,0xb8,
-    0x10,0x10,0x34,0x09,0x4f,0x84,0x32,0xbb,0x95,0xfb,0x46,0x79,0x00,0x61,0xac,0x5c,
-    0x91,0x95,0xb9,0x6a,0x3e,0x1d,0x20,0x75,0x66,0x06,0x29,0xe8,0x74,0x40,0x94,0x0f,
-    0x30,0xe7,0x8a,0xb0,0xe9,0x57,0x04,0xd6,0x1f,0x3e,0x40,0x77,0x38,0x26,0x40,0xb4,
-    0x30,0x81,0xba,0x8d,0x94,0x5a,0x3f,0x77,0x58,0xa2,0x02,0xec,0x2c,0x00,0x37,0x87,
-    0x60,0xf0,0x04,0xc3,0xc0,0xd9,0x93,0x14,0x52,0x13,0x69,0x66,0x1a,0x32,0x0c,0x6a,
-    0xb8,0x06,0x42,0x00,0xd2,0x04,0x70,0x66,0x2c,0xa4,0x98,0x85,0x01,0x30,0xab,0x21,
-    0xc1,0xe9,0x11,0x94,0x85,0x1c,0x44,0x55,0xc5,0x48,0xc5,0x5c,0x29,0x68,0xb3,0xc4,
-    0x23,0xe6,0x8f,0x9d,0x7a,0xc7,0x85,0xd4,0x55,0x47,0x2c,0xb5,0x4a,0x1b,0x6b,0x5b,
-    0x6c,0x5a,0xb1,0x41,0x96,0x0c,0x9c,0x16,0x8d,0x45,0xed,0x97,0x69,0x86,0x21,0x4f,
-    0x0d,0x6f,0x36,0x64,0x38,0x99,0xd9,0x4a,0x23,0x5c,0x40,0x00,0x80,0x1f,0xac,0x69,
-    0xdd,0xcc,0x5c,0x15,0x7e,0xdc,0x84,0x02,0x60,0x73,0xff,0xfb,0x92,0x64,0xf3,0x8f,
-    0x04,0x08,0x63,0xbf,0x83,0x5c,0x1a,0xb0,0x33,0x61,0x58,0xbc,0x07,0x09,0x1b,0x0d,
-    0x71,0x9b,0x02,0x0e,0x04,0x73,0xc1,0x68,0x08,0xe0,0x98,0x6d,0x88,0xa8,0x75,0x8a,
-    0x17,0x88,0xda,0x42,0xe0,0xc4,0x54,0x08,0x61,0x27,0x19,0xe4,0x02,0x46,0x75,0x03,
-    0xca,0xe5,0x46,0x45,0x28,0xa2,0x35,0xea,0x9c,0xd5,0xca,0xda,0xa2,0xbc,0xfe,0xf0,
-    0xd9,0x2d,0x64,0x3f,0x34,0x3b,0x35,0x87,0xe9,0xf3,0x75,0xf3,0xfb,0x6e,0xa4,0x59,
-    0x39,0xcb,0x45,0xf9,0x9e,0xba,0xbf,0xce,0x34,0xef,0x79,0xa3,0xb7,0x09,0xd5,0xcf,
-    0xac,0x72,0x8e,0x5a,0x25,0xdf,0x3e,0x4a,0x0d,0x05,0xc8,0x7d,0x1e,0xa7,0x54,0xd5,
-    0xc0,0x00,0x00,0x40,0x7e,0xf5,0x55,0x9f,0x3f,0xee,0xd5,0x9a,0x75,0x3c,0x65,0xe0,
-    0x4c,0x21,0x68,0xa7,0x00,0xf0,0xf5,0x46,0x4c,0x18,0x3d,0x38,0x10,0x44,0xbf,0x49,
-    0xd3,0x2a,0xaa,0x2b,0xf4,0x28,0x53,0xed,0x30,0xb8,0xc8,0x85,0xb0,0x96,0x48,0x8a,
-    0x80,0x41,0xb7,0x11,0x9a,0x22,0x69,0xd9,0xcc,0xd9,0x82,0xcc,0x89,0xd1,0x91,0xfa,
-    0x11,0xbd,0xac,0x66,0x5b,0x6a,0x74,0x3c,0x89,0xea,0xef,0x7a,0x6a,0xab,0xd1,0x74,
-    0xb7,0x5d,0xf4,0x29,0x64,0x95,0x0a,0x45,0x75,0xdc,0xa4,0xde,0xd9,0x65,0xb3,0x3a,
-    0x0b,0xfd,0x6e,0xab,0x1a,0x87,0xd8,0x82,0xfe,0x83,0xc2,0xfd,0x1c,0xb3,0xbd,0xc1,
-    0x60,0x11,0xad,0xdd,0x00,0x62,0x21,0x65,0xc0,0xc3,0xc3,0xa5,0x13,0x41,0x41,0xa5,
-    0x4f,0x18,0xcc,0x45,0x25,0x22,0x57,0xa7,0xb4,0x8e,0x70,0xcb,0xe6,0x7c,0xe7,0x95,
-    0x27,0x42,0xee,0xdf,0x24,0xb9,0x11,0x48,0x6f,0x92,0xd5,0x7e,0x79,0x83,0x25,0x32,
-    0x4b,0x18,0x8e,0xda,0x42,0x99,0x64,0x54,0x34,0x13,0x0a,0x18,0x05,0x09,0xc5,0xd2,
-    0xa5,0x28,0x34,0x25,0x54,0x13,0x48,0x80,0x2c,0x30,0x32,0x86,0xab,0xf6,0x65,0xef,
-    0xb6,0x9a,0x80,0x00,0x05,0x4d,0x40,0xa7,0xd1,0xe1,0x5b,0xc2,0x36,0x08,0x4a,0xeb,
-    0xb6,0x13,0x23,0xb5,0x4d,0xe1,0xb0,0xb2,0x03,0x81,0x1e,0x1e,0x5c,0x52,0x1b,0x57,
-    0x9e,0x3e,0xbe,0xc9,0x7e,0x14,0x93,0xb2,0x3b,0x95,0xda,0x95,0x35,0x47,0xbf,0xeb,
-    0xa1,0xdc,0xce,0xee,0x8b,0xf2,0x5b,0x7f,0x5d,0x22,0x0f,0x3e,0xae,0x3b,0x7d,0x3d,
-    0x75,0xff,0xa9,0xad,0xbb,0x0a,0xf5,0x0e,0xd7,0x03,0xae,0x3c,0x53,0xf4,0xb0,0x1b,
-    0xed,0x83,0x68,0x69,0x3a,0xd4,0x66,0xc8,0xdc,0xcc,0x63,0x24,0xd4,0x31,0x9d,0x24,
-    0x91,0x8d,0x3e,0x0b,0xd1,0x97,0x04,0x03,0x01,0xbc,0x90,0xbc,0xff,0xfb,0x92,0x64,
-    0xf5,0x80,0xb2,0xee,0x0b,0x41,0xa8,0x79,0xd8,0xb0,0x61,0x69,0x98,0x05,0x73,0x03,
-    0x70,0x0c,0x1d,0x85,0x05,0x0e,0x04,0x51,0xc1,0x82,0x1a,0x20,0x01,0x9e,0x0d,0x50,
-    0x60,0x1c,0xcf,0x39,0x48,0x84,0x54,0x4c,0x61,0xb8,0xc8,0x57,0xdd,0x11,0xe1,0xa7,
-    0x56,0x5c,0xa1,0x95,0xb8,0xfc,0xd6,0x8f,0xee,0xa4,0x45,0x97,0x09,0x0a,0x5a,0x8c,
-    0x4a,0x53,0x0f,0x52,0xd6,0x9e,0xa9,0xf0,0x9f,0x87,0xde,0xac,0x3d,0xfb,0x9b,0x9d,
-    0xe4,0x2b,0x12,0xc2,0x32,0x32,0x3f,0x9f,0x2d,0x57,0x33,0x51,0x82,0xa1,0x90,0x80,
-    0x15,0xb1,0xf6,0x90,0x20,0x70,0x7c,0x1e,0x3a,0x00,0x2a,0x4b,0xe5,0xd5,0x61,0x84,
-    0x45,0xd5,0x7f,0xfd,0x05,0x24,0x3a,0x9a,0xed,0xc0,0xb9,0x22,0x42,0x46,0x85,0x50,
-    0x6a,0x44,0x46,0x48,0x4c,0xc6,0xcc,0xf8,0xe0,0x78,0x69,0xa8,0x24,0x31,0xb6,0x89,
-    0x3a,0x8e,0xb5,0x8a,0x1b,0x78,0x73,0xbf,0xad,0x6e,0xbd,0xbf,0xfe,0xff,0xc3,0x54,
-    0x8c,0xae,0x2d,0x99,0x9a,0x9c,0x9c,0xa2,0x17,0x56,0x15,0xd1,0x91,0xc8,0x63,0x85,
-    0x9c,0xee,0x6c,0xbd,0xc4,0x03,0x2c,0x90,0x50,0xd7,0x6d,0x3b,0x99,0x2e,0xfd,0x31,
-    0x1d,0x7e,0xe1,0xcf,0xc9,0x9d,0x88,0xc0,0x65,0xfe,0x79,0xb4,0xdb,0x42,0x42,0x85,
-    0x3e,0x82,0x91,0x16,0x82,0xe4,0x17,0x75,0x27,0x92,0xdc,0x02,0x1e,0x42,0x44,0x66,
-    0x29,0x67,0x37,0x6a,0x11,0xb6,0xc1,0x8c,0xba,0x30,0xa0,0x0e,0x64,0x04,0x04,0x7b,
-    0x60,0x41,0x81,0x2b,0xba,0x23,0x41,0x3b,0x3f,0x9d,0x8b,0x64,0xc6,0xfc,0xcd,0x7e,
-    0xfe,0x66,0x47,0xa3,0xbc,0xa6,0x43,0xab,0x1e,0xb2,0xb1,0xcf,0x79,0x01,0x22,0x6d,
-    0x1a,0x65,0x4a,0x60,0xbd,0x07,0xec,0x49,0xc6,0x98,0x85,0xc7,0x97,0x36,0x16,0xb8,
-    0xf2,0x5a,0x27,0x3e,0x91,0x72,0xe7,0x4c,0x85,0x8e,0x09,0x3e,0x9c,0xe7,0xbd,0x46,
-    0xea,0x01,0x0d,0xb4,0xfa,0x90,0x2a,0xaf,0x13,0x44,0xef,0xb2,0x62,0xa5,0x47,0x7b,
-    0xf1,0xb6,0xec,0x2d,0x94,0xa3,0xaf,0x8a,0x22,0x05,0xd9,0x06,0x96,0xfc,0x37,0xa5,
-    0xaf,0xb2,0x55,0x69,0xf5,0x20,0xed,0xf6,0x9e,0x07,0x93,0x52,0x76,0x3d,0x8a,0xd8,
-    0x85,0xb4,0xda,0x5a,0xf5,0xe8,0xda,0x8f,0xf5,0x54,0xe3,0x6a,0x49,0x94,0x73,0x5d,
-    0x9e,0xdb,0xed,0x00,0x7e,0x51,0x6d,0xfe,0x80,0x5f,0xb7,0x5d,0x88,0x8f,0x0f,0x02,
-    0xec,0x33,0x8f,0xb4,0x05,0x8d,0x49,0x22,0x02,0x8f,0x2b,0x14,0x66,0x42,0x35,0x53,
-    0x83,0x2e,0x48,0x04,0xa0,0x8d,0xc9,0x85,0xc4,0x99,0xa6,0xc0,0x61,0xbd,0xff,0xfb,
-    0x90,0x64,0xf4,0x0f,0x72,0xdf,0x0b,0xc1,0x28,0xb8,0xd1,0x22,0x60,0xc7,0xb8,0x00,
-    0x03,0x63,0x0e,0x0c,0x2d,0x85,0x04,0x0d,0x84,0x77,0xc9,0x71,0x0e,0xa0,0x54,0x2d,
-    0x8c,0x78,0xda,0xc4,0xe6,0x75,0x44,0x46,0x3b,0x25,0x91,0x37,0xeb,0x32,0xd9,0x92,
-    0x9d,0x44,0x17,0x8e,0x6a,0x77,0x0c,0xca,0x74,0xe1,0x4a,0xf2,0x0a,0xdc,0xaf,0xba,
-    0xfc,0x4d,0xe9,0xb5,0x33,0x55,0xf8,0x58,0xf6,0x7f,0xac,0x5a,0x5e,0xe9,0xbf,0xff,
-    0xff,0xff,0xdd,0x7c,0x7d,0xff,0xed,0x4c,0x9d,0x34,0xa9,0xf7,0xb7,0xab,0xd2,0x86,
-    0x8a,0x9f,0xa5,0xae,0x30,0x98,0x60,0x8d,0x4c,0x4c,0x0e,0x6f,0x4c,0x48,0x24,0x22,
-    0x02,0x64,0x42,0x05,0x32,0x48,0x95,0x7e,0x4b,0x31,0xc5,0x8e,0xad,0x70,0xb3,0x7a,
-    0x3d,0x86,0x7b,0xbc,0x8c,0x8b,0xae,0x6d,0x04,0x99,0xcf,0x43,0x95,0xac,0xb9,0x89,
-    0xb9,0x4f,0xcc,0xa3,0x43,0x32,0x78,0xc4,0xc5,0x32,0x36,0xf8,0xd5,0x32,0xad,0x7c,
-    0xbb,0xe4,0xd9,0xfd,0x39,0xf1,0xda,0xf9,0x66,0xa1,0xcf,0x62,0xef,0xfc,0xe6,0xf7,
-    0xd8,0xe9,0xdc,0x65,0x3f,0xda,0x06,0x75,0x80,0x9f,0x50,0xfc,0x30,0xde,0x97,0xc3,
-    0xed,0xfa,0xd5,0xfd,0x3e,0x4f,0xfb,0x17,0x82,0x84,0x84,0x0c,0xc0,0x5c,0xc4,0x3b,
-    0xcf,0x62,0x90,0x78,0x55,0x24,0xcc,0x6a,0x45,0x32,0x5f,0xa3,0x03,0x0b,0x4e,0x28,
-    0x42,0x1a,0x09,0xa1,0xac,0x35,0x62,0x9b,0x1c,0x77,0x97,0x3f,0x51,0xf6,0x3f,0x34,
-    0xb0,0xc5,0x2b,0xbd,0x67,0x34,0x6d,0xcd,0xdc,0xeb,0x1e,0xdc,0xb6,0xdb,0x1c,0xd0,
-    0x89,0x6e,0x5c,0x87,0x57,0x6e,0x99,0x8e,0x46,0xa7,0x84,0x3a,0x86,0xa1,0x42,0xf3,
-    0x06,0x86,0x1e,0x06,0x09,0x03,0x67,0xca,0xb5,0x41,0x15,0x96,0x9c,0x18,0x18,0x18,
-    0x93,0xcd,0x22,0x22,0x84,0x1e,0xb7,0xee,0xcf,0x22,0xb6,0x53,0x21,0xc0,0x00,0x06,
-    0xa7,0x98,0x77,0x66,0x6a,0xa7,0xaa,0x48,0x83,0x2e,0x9a,0x21,0x49,0x72,0xe5,0x06,
-    0x1b,0x9a,0xd2,0x82,0x06,0x55,0x78,0x2a,0xd6,0xee,0x44,0x55,0x0b,0xe5,0x62,0xce,
-    0xfb,0xbe,0xdd,0x96,0x14,0x99,0xf1,0x59,0xe9,0x53,0xb9,0x7e,0x87,0xc3,0xdd,0xf6,
-    0x66,0xe9,0x1c,0x32,0x74,0xfe,0xfe,0x4d,0xc3,0xd6,0x7f,0x96,0x66,0x4c,0x5a,0x9f,
-    0x28,0xfa,0xa4,0x6d,0xce,0x27,0xfd,0x99,0x96,0xfb,0x5e,0x6c,0xd3,0x3e,0x1a,0x64,
-    0xc1,0xc0,0x6c,0xad,0x61,0x29,0xf1,0x69,0x00,0x0c,0x50,0x8c,0x06,0x42,0x5b,0xdb,
-    0x6a,0xd5,0xb2,0xd0,0x5d,0x40,0xe2,0x56,0x08,0x30,0x7a,0x5c,0xfc,0x65,0x80,0xff,
-    0xfb,0x92,0x64,0xf5,0x00,0xe2,0x10,0x0a,0x45,0xc8,0x59,0x49,0x48,0x61,0x64,0xf8,
-    0x11,0x73,0x65,0x54,0x4d,0x35,0x47,0x06,0x4e,0x1c,0x70,0x49,0xab,0x9b,0xdf,0xc1,
-    0xbe,0x0d,0x98,0x81,0x5a,0xb8,0x31,0x28,0x68,0x98,0xf8,0xeb,0x0a,0x08,0xcc,0xac,
-    0xa2,0x64,0xca,0x46,0x2d,0x65,0xd9,0xd9,0xd6,0xa2,0x9b,0x42,0xa5,0x34,0x43,0x6e,
-    0xd6,0x5a,0x67,0xa3,0x68,0xcb,0x95,0xd9,0x9a,0x5a,0xe4,0x33,0x0b,0x6d,0xd3,0xb0,
-    0xd8,0xe1,0x7e,0x79,0xf6,0x53,0x33,0xe4,0x81,0xe4,0xd1,0xd7,0xee,0xf4,0xab,0x35,
-    0xc9,0x47,0x72,0x07,0x83,0x1d,0xd6,0x3d,0x13,0x5a,0x0b,0x87,0x27,0x97,0xf8,0xd6,
-    0x3e,0xaf,0xd0,0x4f,0xd1,0xbf,0xce,0x4f,0xcb,0x8e,0xa4,0x6e,0x85,0x69,0xab,0xd1,
-    0x02,0x33,0x2a,0xce,0x20,0xad,0xe0,0xc5,0xa2,0x43,0xe0,0x82,0xa1,0x83,0xc8,0x41,
-    0x6d,0x53,0xe5,0xe7,0xb7,0xc7,0x93,0x29,0x96,0xe5,0x1f,0xb5,0xdf,0xde,0xed,0x95,
-    0x19,0x7c,0xe7,0xab,0x98,0xd4,0xec,0x4a,0x46,0x28,0xad,0x7f,0x78,0x18,0x1e,0xd6,
-    0xfd,0x9a,0x03,0x39,0x10,0x94,0x89,0xc2,0x17,0x32,0xd3,0xce,0xb7,0xae,0x4b,0x4a,
-    0x0c,0x46,0x56,0xb3,0x78,0x5c,0xc3,0x32,0x3e,0x5d,0x21,0x4d,0x9c,0xfb,0xa1,0x11,
-    0x9c,0x22,0x57,0x71,0x04,0xb9,0x7f,0xca,0xa5,0x49,0x93,0xcd,0x02,0x78,0x01,0xa0,
-    0x80,0xc5,0x85,0x3e,0x2f,0xeb,0xd4,0x18,0x93,0x1a,0x01,0x30,0xaa,0xf3,0xa4,0x82,
-    0x03,0x00,0xcb,0xcc,0x0d,0x24,0x99,0x45,0xff,0x0b,0x0c,0x1b,0x04,0xaa,0x81,0xb7,
-    0xf7,0xba,0xe3,0x68,0xb0,0x5d,0x09,0x7c,0xca,0x22,0x74,0x4c,0x2c,0x91,0x09,0x37,
-    0x17,0x34,0x65,0xed,0x55,0xef,0xb0,0x52,0x84,0x36,0xe4,0xbd,0xf7,0x10,0x08,0x0a,
-    0x2d,0xd1,0x70,0x3b,0x2a,0x20,0xc7,0x42,0xa1,0x12,0x43,0xa5,0x96,0x30,0x86,0x55,
-    0xee,0x3a,0xea,0x84,0xb0,0x09,0xc4,0x82,0x10,0x80,0x79,0xff,0xf8,0xfd,0x48,0xfc,
-    0xcb,0x27,0x60,0xa0,0x81,0x93,0x84,0x37,0x52,0xc8,0x7c,0xc4,0x06,0x53,0xee,0x30,
-    0x17,0x18,0x34,0x72,0xc5,0x54,0x7e,0xb1,0xf4,0x4d,0xcc,0x9b,0x0e,0x43,0x00,0xeb,
-    0x84,0xc3,0xb2,0x6c,0x7f,0xa6,0x76,0x99,0xb8,0xca,0xc9,0xd7,0x54,0x44,0xda,0x32,
-    0x32,0x2e,0xa5,0x72,0xdd,0x8e,0x8c,0xb4,0x2e,0x57,0xb3,0x9b,0xb6,0x89,0xb5,0x55,
-    0x7d,0x1f,0x6a,0x2e,0x9d,0xdd,0x96,0x8b,0x3b,0xac,0xa5,0xdd,0xf8,0x2a,0x49,0x31,
-    0x6c,0x58,0x82,0xd1,0xd8,0x80,0xcf,0x44,0xf9,0xc4,0x24,0x74,0x0a,0x52,0x88,0x8d,
-    0xe1,0xff,0xfb,0x92,0x44,0xf8,0x08,0x73,0x0e,0x51,0xc1,0x40,0x3a,0x18,0xe0,0x66,
-    0x05,0x18,0x10,0x3f,0x82,0x38,0x4c,0xe9,0x83,0x00,0x00,0xe8,0x63,0x89,0x6b,0x05,
-    0xa0,0x94,0x5c,0x6c,0x4a,0x82,0xc2,0xa7,0x45,0x30,0x06,0x08,0xd2,0xf0,0xc0,0x0b,
-    0x23,0x02,0x00,0x18,0x98,0x50,0x34,0x6e,0xc2,0xfb,0x16,0x8e,0xd3,0x62,0x9a,0x33,
-    0x26,0xf2,0x64,0xf0,0xd7,0x25,0x5a,0x46,0xdc,0xd1,0x0e,0xed,0x10,0xf2,0xca,0xdd,
-    0x38,0x43,0x11,0x67,0x95,0x8d,0xc2,0x71,0xd4,0xfe,0x53,0xe7,0x1a,0x96,0x26,0x82,
-    0xf7,0xf6,0x2c,0xb2,0x34,0x43,0xf3,0xd4,0x4f,0x29,0xc8,0xe9,0x78,0x73,0x78,0x08,
-    0xa5,0xe9,0x42,0x94,0x5f,0x29,0x2f,0x47,0x7a,0x75,0xf2,0x01,0x0d,0x2b,0x65,0x4d,
-    0x69,0x53,0x82,0xef,0xaf,0x6a,0x53,0x1a,0x9c,0x99,0x5b,0x90,0x28,0x08,0xa7,0xeb,
-    0x2a,0x8c,0xda,0xc5,0x8b,0xcb,0xbf,0xfa,0xe7,0xe6,0xb7,0x5d,0x0a,0x70,0x97,0xd7,
-    0x95,0x1c,0x4f,0x08,0xbe,0xd6,0x2d,0x2c,0x58,0x53,0xee,0x71,0x67,0x48,0xd0,0xe4,
-    0xed,0xb7,0xcc,0x8e,0xeb,0xf9,0x79,0x39,0x9f,0x33,0x6b,0x0e,0x65,0x09,0x90,0xda,
-    0xb9,0x5d,0xf8,0xb0,0x46,0x74,0xe9,0x53,0x3f,0xa6,0x22,0xd1,0x19,0xff,0x0c,0xff,
-    0x33,0x57,0xf2,0x50,0x1f,0xd4,0xe4,0x67,0x2c,0x28,0x8c,0xb3,0x83,0xf9,0xa9,0x87,
-    0xdf,0xe5,0xa9,0x72,0x1c,0x22,0x60,0x8c,0x67,0x48,0xa0,0x18,0x02,0xb4,0x0d,0x04,
-    0x54,0xa1,0xb5,0xdf,0x20,0x40,0x08,0x4a,0x65,0x0a,0x8a,0x5b,0x68,0x42,0x31,0x15,
-    0xc4,0x67,0x78,0x33,0x09,0xa9,0x9b,0xdb,0x93,0x4e,0x59,0x62,0xde,0xa6,0xa4,0xae,
-    0x66,0x7d,0x3c,0xcb,0xc0,0x49,0x9b,0xf4,0xa7,0x96,0x09,0xa9,0x27,0xd6,0xe3,0xda,
-    0xb4,0x39,0xc0,0x33,0xdd,0x5a,0xa2,0x37,0x16,0x10,0xcc,0xa9,0x0b,0x51,0x68,0xc3,
-    0xae,0xaf,0xbd,0xdf,0x6f,0xff,0xd7,0x67,0xc3,0x6a,0xff,0xdd,0x59,0xa9,0x6c,0xb9,
-    0xb4,0x7b,0x49,0x1d,0x31,0xa4,0x7f,0x64,0x66,0xb4,0x02,0xc5,0x33,0x32,0xad,0x47,
-    0xe0,0x6d,0x9d,0xa9,0x51,0x7a,0x73,0x99,0xf5,0xc0,0xc7,0x91,0xf4,0x47,0xbe,0xa9,
-    0xa1,0x8f,0x10,0x1c,0xd9,0x23,0xa8,0x67,0xce,0x46,0xa6,0x89,0xec,0x06,0x5c,0xd0,
-    0xf2,0xcf,0x2b,0x27,0x27,0x4f,0xe3,0xe7,0x08,0xfe,0xb9,0x67,0xdf,0x97,0x22,0x7f,
-    0xce,0x77,0xbf,0xd3,0xb1,0xf3,0x3a,0x9e,0xf2,0x6c,0x64,0x4e,0x74,0xae,0x21,0xf7,
-    0x5b,0x6e,0x88,0x2f,0xf0,0xde,0x55,0x56,0xfb,0x8c,0xac,0x4d,0xb1,0x83,0x0c,0x1f,
-    0x71,0xfa,0x22,0xff,0xfb,0x92,0x64,0xf2,0x0f,0x72,0xeb,0x60,0xc1,0x03,0x61,0x14,
-    0x70,0x5d,0xc8,0xc8,0x00,0x03,0x83,0x0e,0x0c,0x3d,0x87,0x02,0x01,0x68,0x65,0x49,
-    0x75,0x9d,0x60,0x15,0xb0,0x8e,0x2b,0x37,0x73,0x30,0x59,0x0c,0x01,0x66,0xe0,0x90,
-    0x46,0x5e,0xd0,0x20,0xfb,0x79,0xbc,0xdc,0xa2,0xf3,0x94,0xd8,0xae,0x43,0x3f,0xbd,
-    0x3f,0x22,0xce,0xf4,0x63,0x85,0x3d,0x08,0x4e,0xc6,0xb8,0xdb,0x1d,0x5d,0x73,0x7d,
-    0xc9,0x07,0xd4,0xe9,0x33,0x3a,0xa5,0xf5,0x1e,0x3b,0x0e,0xa8,0x0d,0x48,0xe9,0xa6,
-    0x78,0x93,0x3f,0x67,0xdb,0xde,0xcc,0xfa,0x7e,0x0f,0x30,0x09,0x8b,0x92,0x2e,0xb2,
-    0x80,0xb4,0xff,0xe0,0xec,0x4c,0x4f,0x40,0x0c,0xac,0xd5,0x3f,0xbd,0xe7,0x2b,0xed,
-    0xb8,0xbc,0xdb,0x78,0x0b,0xe5,0x32,0x51,0x6c,0x85,0x07,0x96,0x0f,0x41,0x11,0xe2,
-    0x3c,0x82,0x1e,0xe5,0xb6,0x3c,0x12,0x0f,0xb6,0x46,0xce,0x79,0x30,0x79,0xce,0xc9,
-    0x18,0x8d,0xec,0x4b,0xa3,0x17,0x3b,0x3e,0x99,0x10,0x53,0xa5,0xd9,0xfc,0x6a,0x59,
-    0x1e,0xaf,0x22,0x3e,0xd9,0xf6,0x4e,0x9e,0xcb,0x2e,0x94,0xcc,0x96,0xc2,0xf8,0xc7,
-    0xb1,0x52,0x3c,0xe9,0x3f,0x39,0x86,0xe6,0x4b,0xa6,0x74,0xc3,0x14,0xda,0xd9,0xb9,
-    0x68,0xd4,0x36,0xf1,0x4b,0x3f,0x19,0xd0,0xa1,0x53,0x90,0x04,0x55,0x6b,0x23,0x50,
-    0xca,0x41,0x90,0x85,0xb4,0x03,0x04,0x4a,0x37,0xe8,0x82,0x85,0x06,0x84,0xa0,0x00,
-    0xc0,0xe1,0xf5,0xd6,0x48,0x84,0x36,0xca,0x8d,0x0a,0x31,0xa6,0x30,0x14,0x10,0x04,
-    0x87,0x86,0x53,0x68,0x96,0xd9,0x52,0x30,0x76,0x3e,0x0a,0xae,0x75,0x81,0x7d,0xbc,
-    0x36,0x20,0x05,0xa1,0x8a,0xef,0xea,0x1c,0xac,0xf3,0x3a,0xf2,0x1b,0xfd,0xb3,0xc7,
-    0xf7,0x8f,0x21,0xb4,0x20,0xaa,0xc2,0x7b,0xb7,0xff,0xff,0xfa,0xa8,0xee,0x3f,0xff,
-    0xdf,0x6f,0xff,0xff,0xfe,0xd5,0x80,0x00,0x07,0xf3,0x3a,0xd6,0x22,0x75,0x5e,0xf6,
-    0xf8,0x54,0xb0,0x46,0x06,0xd7,0x0c,0x38,0x34,0xc2,0x36,0x10,0x94,0x4c,0x2c,0x60,
-    0x63,0x26,0x8e,0x64,0xba,0x1d,0xca,0x7b,0xe7,0x59,0x54,0x6d,0xe4,0x46,0xa1,0xb3,
-    0x80,0xaf,0xa2,0x5b,0x63,0xb2,0x4d,0xb8,0x5b,0x57,0xc8,0xae,0x4a,0x49,0xf9,0x3e,
-    0xc6,0x5e,0x73,0x79,0xe9,0x6d,0xe7,0x29,0x76,0x70,0xdf,0xcc,0x9f,0xaa,0xc4,0xf0,
-    0xb7,0xeb,0x66,0x59,0xe5,0x6f,0x32,0x9e,0x50,0xbc,0xbb,0xff,0x97,0x22,0x6d,0x69,
-    0xc2,0x32,0x72,0x74,0x51,0x39,0xb4,0xa6,0xf6,0xda,0x1c,0x98,0xf0,0xa5,0xfe,0x36,
-    0xb8,0x00,0x08,0x00,0xdf,0xff,0xfb,0x92,0x64,0xf3,0x88,0xe2,0xd8,0x5b,0xc1,0x03,
-    0x21,0x1c,0x72,0x5e,0xa8,0xd7,0xf0,0x03,0x63,0x0e,0x0b,0xdd,0x3f,0x0b,0x2c,0x84,
-    0x71,0x89,0x7a,0x85,0xa0,0x44,0x5d,0xa4,0x69,0xdc,0x6a,0x54,0xbf,0x6a,0x99,0x9d,
-    0x05,0x40,0x83,0xcc,0xa7,0x58,0xc2,0x60,0x53,0x81,0xb9,0xcc,0x34,0x05,0x68,0x05,
-    0xb8,0x16,0x28,0x87,0x4f,0xe2,0x46,0x81,0xa4,0xba,0xd2,0xbd,0x3c,0x09,0x3e,0x70,
-    0xee,0x79,0x97,0xa9,0x79,0xf6,0x9a,0x2f,0xfa,0x59,0xf2,0x77,0xa4,0x67,0x62,0xf3,
-    0x6e,0xeb,0x21,0xdc,0x8a,0x79,0x4b,0xf0,0xfe,0x9f,0x9d,0x5f,0x7b,0xf3,0xea,0x2d,
-    0xcb,0x44,0x25,0xf2,0xf1,0xd0,0x83,0x29,0x7f,0xf4,0x19,0x7f,0xff,0xac,0x00,0xd2,
-    0xd4,0xa7,0x6e,0xd4,0x0d,0x67,0xc6,0x99,0x11,0x42,0x1b,0xf4,0xb2,0x4c,0xc6,0x4e,
-    0x46,0xd3,0x92,0x54,0xa1,0x64,0x64,0x25,0xde,0xaa,0x6b,0x52,0xb4,0x5a,0x1a,0x61,
-    0xe2,0xa2,0xcd,0x69,0xf7,0xa2,0x0d,0x55,0x64,0xd1,0x44,0x93,0x14,0xc2,0xec,0x72,
-    0x65,0x9a,0xa0,0x0c,0x0d,0x11,0x39,0x87,0xaa,0x0f,0xd5,0xa1,0x85,0x81,0xa6,0x56,
-    0xe3,0x4c,0xfd,0xa1,0x60,0x29,0xf5,0xa0,0x90,0x47,0x72,0xa6,0xd0,0xca,0x9c,0xb1,
-    0x92,0xe1,0x9f,0x56,0x2c,0x2e,0x8c,0x2e,0x06,0x5e,0x51,0x18,0x3c,0x14,0x66,0x81,
-    0x91,0x14,0xe9,0xd4,0x89,0x7c,0xf0,0x88,0x14,0x92,0xb2,0x78,0x1e,0xce,0x77,0x6a,
-    0xcb,0x4a,0x6e,0xfb,0xd2,0xf0,0x15,0x9a,0xe6,0x3f,0xb6,0x33,0xf6,0x5a,0x58,0x56,
-    0xa0,0xdc,0x79,0x93,0xd4,0xbb,0xc3,0xbe,0x3a,0x8c,0x9a,0x79,0xce,0xf4,0xd7,0x07,
-    0xb1,0xaa,0xd8,0xd4,0xfc,0xc9,0xab,0x2d,0xc7,0xe8,0x51,0x13,0xc1,0xfa,0x9c,0xa5,
-    0xbe,0xda,0xe6,0x2d,0xba,0xef,0x93,0xdf,0xff,0xfc,0xff,0xff,0xff,0xff,0x99,0xff,
-    0xfc,0xaa,0x45,0x29,0x21,0xb6,0xf4,0x84,0x24,0x04,0x9d,0x1f,0x63,0x47,0xad,0x90,
-    0x3c,0x7c,0xfe,0xdb,0x00,0x08,0xc1,0x14,0x7f,0x9f,0x0b,0xfe,0x1e,0x3b,0xbc,0xd7,
-    0x80,0x23,0x19,0xcd,0x4c,0xda,0xa2,0xcd,0x3a,0x79,0xe5,0x3f,0xef,0x53,0xdb,0x84,
-    0x76,0x66,0x54,0x94,0x99,0xba,0x74,0xd2,0x33,0x2e,0xaf,0xde,0x59,0xee,0x89,0x66,
-    0x4a,0x3d,0x97,0xb2,0x51,0xa7,0x22,0x33,0x1d,0xc6,0x0b,0x35,0x48,0x95,0x47,0x1d,
-    0x67,0x66,0x15,0x45,0x21,0x49,0x6a,0x8a,0x19,0x63,0x33,0x3d,0x67,0x8c,0x43,0x8f,
-    0x13,0x61,0x1e,0xee,0x83,0xd0,0x70,0xe0,0x7a,0x8b,0x73,0x00,0x1e,0x96,0x71,0xb5,
-    0x2a,0x8d,0xc2,0x01,0xce,0xd8,0xe8,0xff,0xfb,0x92,0x64,0xf6,0x80,0xc3,0x54,0x63,
-    0x40,0xab,0x65,0x1c,0x40,0x59,0x49,0x48,0x26,0x71,0x43,0x70,0x0a,0x74,0x55,0x0a,
-    0xc3,0x6c,0xe6,0xc1,0x75,0x8a,0x60,0x44,0x9e,0x0c,0xe1,0xf8,0xed,0x78,0x73,0x00,
-    0x00,0x21,0xb2,0x10,0x80,0x41,0x5d,0xf9,0x8b,0x52,0xff,0xd4,0x6e,0x91,0xe7,0xc4,
-    0x8a,0x58,0x21,0xd9,0x6a,0x47,0xd8,0xea,0x9e,0x32,0x5a,0x80,0xc9,0xbb,0xe9,0xa8,
-    0xb4,0xa6,0x65,0x1f,0x05,0xca,0x48,0xc6,0xf3,0x2f,0xbf,0xd3,0xa4,0x69,0xea,0x72,
-    0xb7,0x96,0x4e,0x6a,0x11,0x4c,0x76,0x18,0xa8,0x72,0xb0,0xf1,0x4f,0x0c,0x52,0x5a,
-    0xd7,0x54,0x48,0xb2,0x28,0xf1,0xd9,0xbf,0x61,0x23,0xb9,0x71,0x2e,0xbf,0xff,0xfc,
-    0x9c,0xaf,0xc6,0x23,0xd2,0x36,0xf4,0x94,0x5c,0x58,0xcd,0xdb,0x24,0x0c,0x3b,0xd5,
-    0x30,0x50,0x64,0xad,0x9f,0x88,0x81,0x9f,0x49,0xca,0xbe,0x64,0x46,0x74,0x89,0xb6,
-    0x21,0xf2,0xf9,0xe9,0x9d,0xa4,0x66,0x89,0x93,0xb1,0x6b,0xe7,0x1e,0xd9,0xbc,0xcf,
-    0x5f,0xe3,0x79,0x19,0x1a,0xf9,0xd4,0x42,0xc9,0x0c,0xa7,0x96,0x85,0x4b,0x7c,0x77,
-    0xca,0xd3,0x2a,0xcc,0x4a,0x29,0xd3,0x63,0x6c,0xa8,0xd1,0xa1,0x6b,0x7d,0xc8,0xd5,
-    0x6e,0xc4,0x32,0x99,0xc3,0x59,0xd6,0x36,0x70,0xe7,0x1a,0xb3,0x22,0x2f,0x76,0x51,
-    0xd3,0xb2,0x92,0x3c,0xd9,0x4b,0x86,0x36,0x74,0xdc,0x00,0x06,0xcf,0x92,0x40,0xc0,
-    0xc0,0x8d,0xa8,0x88,0x84,0x1c,0x70,0xcd,0x00,0x22,0x27,0x0d,0xe4,0x0e,0x1b,0x6d,
-    0x1d,0xa0,0x71,0x34,0x3b,0x7f,0x2d,0x52,0xa7,0x12,0x9f,0xf0,0x8f,0xf5,0x36,0xc7,
-    0xd7,0x8e,0x65,0xa5,0xe3,0x93,0xce,0x11,0x14,0x5e,0x17,0x52,0x9f,0x74,0x11,0xa4,
-    0x13,0xa4,0x87,0x29,0x25,0x9d,0x22,0x2f,0x9d,0x3e,0xec,0x83,0xb1,0x0e,0x38,0x9b,
-    0x25,0x86,0xa0,0x8a,0xa6,0xb0,0x00,0x8e,0x4b,0x0d,0xcc,0x09,0xc9,0x97,0x59,0xdf,
-    0x67,0xde,0xbf,0xff,0xff,0x5f,0x9f,0xc5,0xe0,0xe3,0xb2,0x87,0xc2,0x31,0x08,0x1c,
-    0x6c,0x40,0x14,0xa0,0x64,0x93,0x8b,0xc5,0x55,0x98,0x64,0x23,0x72,0xc4,0xb1,0xd7,
-    0x52,0xab,0x93,0x1e,0x7a,0xe5,0xd5,0xaf,0xcc,0xee,0x40,0xa1,0x13,0x9a,0x17,0x92,
-    0xb9,0xf2,0xec,0x45,0xe5,0x48,0xda,0xfb,0x3e,0x79,0xe6,0x14,0x90,0xb2,0x2c,0xe7,
-    0x0c,0xbb,0xad,0x97,0x20,0xea,0x46,0x75,0x44,0x7e,0x5a,0xcf,0xdc,0xb5,0x72,0x6f,
-    0x33,0x77,0x3c,0xea,0x79,0x34,0x57,0x39,0x92,0x01,0x5b,0xef,0xaa,0x43,0xa8,0x19,
-    0x51,0xe0,0x62,0xa2,0x91,0x91,0x99,0x1a,0x33,0xff,0xfb,0x92,0x64,0xfb,0x0f,0x73,
-    0x59,0x66,0x40,0x03,0x63,0x2c,0x70,0x62,0x48,0x67,0xf0,0x0b,0x83,0x2a,0x4d,0x21,
-    0x91,0x00,0x00,0xec,0x63,0x89,0x78,0x9c,0x20,0x10,0x6d,0x8c,0xe1,0xdb,0x83,0xdb,
-    0xff,0x58,0x2d,0x1d,0x6f,0xcb,0xaa,0x45,0x73,0x2c,0x00,0x07,0x9c,0x6b,0xa8,0xb2,
-    0x23,0x53,0x70,0xc5,0x88,0xdf,0x7c,0x37,0x94,0x4f,0x35,0x3b,0xf7,0x68,0x87,0xe4,
-    0xaa,0xab,0x12,0x1f,0x0f,0x28,0x52,0x52,0x25,0x2a,0x77,0x3a,0x99,0xda,0x7d,0x80,
-    0xf5,0xfe,0x9b,0xda,0xfa,0xd6,0x9c,0x3d,0xf4,0xec,0x7a,0x49,0x58,0xf4,0x36,0x4b,
-    0xa5,0x4a,0xe5,0x99,0x33,0x99,0x7f,0x48,0x42,0xb9,0x31,0x11,0xbb,0x52,0x81,0x5c,
-    0xbc,0x23,0xd8,0xf8,0xa5,0xa5,0x94,0xee,0x61,0x75,0xd1,0x98,0x80,0x34,0xa4,0xc2,
-    0x81,0x94,0xd3,0x21,0x8c,0x99,0x5f,0xb9,0x52,0xb4,0x9c,0x0e,0xa6,0x55,0x3f,0xf9,
-    0x6c,0x79,0x5f,0x6e,0x76,0x12,0x1f,0x12,0x2d,0xe7,0x11,0x56,0xd3,0x54,0xe7,0xfd,
-    0xa6,0x31,0x93,0x59,0x1b,0x58,0x79,0x54,0x2e,0x94,0x72,0x33,0xbf,0x9c,0x27,0x58,
-    0x49,0x7f,0x8e,0x90,0x39,0x72,0x97,0xfa,0x29,0x22,0x15,0xdd,0x90,0xc8,0x9e,0x5c,
-    0xde,0x12,0xd9,0x99,0x1b,0xa2,0xf9,0x18,0xe6,0x9c,0x58,0xb1,0x18,0x89,0x98,0x82,
-    0x67,0x72,0x5c,0xee,0x18,0xb0,0x6a,0xd0,0x6a,0x7f,0xd3,0xc1,0xe7,0xb9,0x16,0x79,
-    0x21,0x4c,0xd8,0xa8,0x2c,0x60,0x81,0xef,0x03,0x0f,0x39,0xe2,0xb0,0xc0,0xf7,0x70,
-    0xaa,0x0a,0x2c,0x5d,0x7a,0x8b,0x78,0x09,0x42,0x83,0x4e,0x31,0x07,0x53,0xbc,0xd0,
-    0xfc,0xf0,0xa5,0xec,0xb4,0x5c,0x54,0x4f,0x7c,0xb8,0xd5,0x52,0x26,0xf4,0xf5,0xb2,
-    0x27,0xc9,0x0f,0x52,0x8d,0x44,0xcc,0xf6,0x65,0x31,0x82,0x66,0x0f,0x43,0x25,0x87,
-    0xb6,0x61,0x6b,0xc2,0x84,0xd7,0x72,0xb4,0x32,0x89,0x42,0xac,0x6a,0xac,0x87,0x88,
-    0x99,0x98,0x90,0x4e,0x2f,0x4e,0xa1,0xad,0xa2,0xcd,0xa9,0xe4,0x15,0xff,0xfe,0x67,
-    0x6e,0x57,0x4d,0x93,0xc0,0x10,0x8f,0x60,0x21,0x0e,0x50,0x98,0x2d,0x1d,0x9a,0xcd,
-    0x3c,0x2e,0x93,0x88,0x8e,0x52,0xff,0x3a,0x9e,0xe8,0xda,0x62,0xb1,0x0b,0x29,0x0e,
-    0x29,0xce,0xda,0x97,0x38,0xe4,0x17,0x3c,0xd1,0xaa,0x33,0x69,0xa3,0x42,0xfd,0x3d,
-    0x33,0x36,0x2e,0x17,0x63,0xe6,0x52,0xdd,0xd6,0x4c,0xe2,0xe9,0x99,0xde,0xf9,0xdb,
-    0xab,0x9c,0xae,0xd0,0xdf,0xaa,0x29,0x55,0xca,0xa2,0x79,0x11,0xa6,0x45,0x61,0x64,
-    0x49,0x49,0xcf,0x04,0xe3,0x33,0x96,0x00,0x00,0x16,0x60,0xff,0xfb,0x92,0x64,0xef,
-    0x8f,0xf3,0x1f,0x60,0xc0,0x00,0x59,0x18,0xe0,0x5b,0x09,0xc7,0xf0,0x1b,0x63,0x38,
-    0x0c,0x29,0x93,0x00,0x00,0xe4,0x67,0x01,0x80,0xa6,0x1f,0xc0,0x1d,0x8c,0x70,0xab,
-    0x24,0x90,0x4f,0x3f,0xc9,0x1c,0x25,0xed,0xa7,0xa4,0xe1,0xc7,0x7c,0xa0,0xd7,0x88,
-    0x00,0x83,0x80,0x53,0x42,0x32,0xab,0xf2,0x6f,0x6d,0xdc,0xfd,0x49,0x61,0xd2,0xf7,
-    0x68,0xd5,0x79,0x92,0xcf,0x39,0xd5,0x58,0xe4,0x9c,0xf9,0x32,0xff,0x3d,0x19,0x39,
-    0x9b,0xa7,0x11,0x02,0xa9,0x95,0x7b,0x69,0xe8,0xac,0x65,0x14,0xf8,0xa4,0x93,0x2b,
-    0x49,0xec,0xe2,0xce,0x1b,0xcc,0xfc,0xfb,0x73,0x98,0x93,0x3e,0x5e,0xfb,0xd4,0xb7,
-    0x4d,0x48,0xd4,0x22,0x74,0x9d,0x89,0xba,0xd6,0x44,0x27,0x2b,0x1c,0xaa,0x09,0x30,
-    0xed,0x8e,0xb1,0x06,0xdc,0x5d,0x71,0xd8,0x1e,0x9e,0xeb,0xee,0x49,0xf7,0x8d,0xe8,
-    0xf4,0xbd,0xd4,0xa2,0x06,0x41,0x6a,0x74,0x8f,0x38,0xdd,0xb4,0x99,0x33,0x4e,0xa7,
-    0xdf,0xf3,0x6b,0x7f,0x37,0x3b,0x15,0x37,0xd6,0xe6,0xed,0x96,0x7b,0x31,0x31,0xc9,
-    0xac,0x97,0xd0,0xf7,0xe4,0xce,0x65,0x32,0x65,0x2c,0xeb,0xe5,0xec,0xf8,0xb2,0xbf,
-    0xfb,0xaa,0x13,0x97,0x03,0xe2,0x1b,0x30,0x4c,0xb0,0xb6,0xdb,0xac,0x58,0x62,0x34,
-    0x24,0xf0,0x4f,0x5a,0x30,0xc8,0x2b,0xc1,0xbb,0x4d,0x3b,0x2d,0xa5,0x51,0x31,0x08,
-    0xb8,0xd5,0x41,0x8b,0x68,0x2b,0xbd,0x47,0x07,0xf0,0xf0,0x5c,0x8c,0x63,0x0b,0xf4,
-    0x9c,0x7d,0x98,0xfe,0x3a,0x62,0x8c,0xc8,0xcd,0x24,0xd0,0xc8,0xd5,0xcf,0xfe,0x04,
-    0x32,0xcd,0x9c,0xe2,0xc3,0x3a,0x5d,0xca,0x7c,0x32,0xf2,0xdc,0x8f,0x37,0xcd,0xda,
-    0x2c,0xe6,0x81,0x0c,0xcd,0x6d,0x3e,0xcc,0xb3,0xe6,0x48,0x69,0x64,0x99,0x5b,0x1b,
-    0xfa,0xc4,0x4c,0x65,0x54,0x90,0xff,0xff,0x3f,0x9d,0xe8,0x17,0x3b,0x79,0x35,0x65,
-    0x45,0x0f,0x6d,0x4d,0x45,0x5e,0x24,0x8a,0x3d,0xc3,0xf3,0xa3,0xc1,0x10,0x1b,0xf3,
-    0xe0,0x01,0x67,0xda,0x32,0x1f,0x3e,0x50,0xd4,0xaa,0x7b,0x5d,0xd9,0x1c,0x62,0x36,
-    0xb9,0x0a,0x72,0x82,0x03,0x88,0x96,0xa4,0xc6,0xae,0x6d,0xe4,0xb8,0xcc,0xd5,0x88,
-    0x8e,0x48,0x52,0x50,0xe7,0x10,0xe1,0x69,0x1b,0x78,0x68,0xed,0xb2,0x60,0xcd,0x41,
-    0x1e,0x13,0x71,0xe4,0x2e,0x31,0x6d,0xc2,0xc9,0x51,0x00,0x4e,0xa6,0xdb,0xb6,0x78,
-    0x34,0x5e,0x11,0xd9,0xf0,0xf2,0x5f,0x3e,0x63,0xb5,0x95,0xee,0xe7,0xa8,0x47,0x57,
-    0x73,0x54,0xa4,0xa8,0x99,0x64,0x4b,0x13,0x4d,0xcd,0xc3,0x94,0xc8,0xff,0xfb,0x92,
-    0x64,0xee,0x09,0x42,0xce,0x61,0x40,0x83,0x21,0x1c,0x72,0x58,0x29,0x88,0x05,0x07,
-    0x43,0x1c,0x0c,0x39,0x85,0x02,0xa4,0xe0,0x68,0xc9,0x67,0xab,0x60,0x88,0x2c,0x0c,
-    0xa8,0x05,0xb4,0x52,0x28,0xcd,0x5a,0xbb,0x08,0x55,0x01,0x22,0x56,0xc4,0xeb,0x4d,
-    0xb3,0x64,0x71,0x00,0xa4,0xef,0xfb,0xf7,0x2d,0xe0,0x9c,0xb3,0x06,0x55,0x5f,0x8f,
-    0x0b,0x53,0x72,0xb7,0x2d,0x01,0x19,0x04,0x27,0x77,0x32,0x3e,0xfe,0x57,0x04,0xb0,
-    0xe0,0x81,0x44,0xce,0xb8,0x78,0x30,0x74,0xa1,0xf1,0xa5,0x8b,0xba,0x44,0xc0,0x1d,
-    0xc5,0x0b,0x50,0xa2,0xa5,0x9c,0x38,0xbd,0x8d,0x32,0x1e,0x48,0xd2,0x24,0xc2,0xea,
-    0x25,0xdb,0xc8,0x09,0x7e,0x7d,0x82,0xb5,0xfc,0x10,0x81,0x1b,0x9b,0xa6,0x50,0x45,
-    0x36,0x33,0x05,0x36,0x44,0x22,0x76,0xc6,0x27,0x1f,0xaf,0x68,0x3e,0xc4,0xe2,0xbb,
-    0x1a,0x25,0x54,0xf2,0xa5,0xe9,0xa7,0x7b,0x7b,0xb2,0x09,0x44,0xe9,0xd2,0x91,0xd4,
-    0x6a,0x76,0xd2,0x43,0xcc,0x73,0x08,0xf4,0x8a,0x03,0x1a,0xbe,0xde,0xe6,0x46,0x85,
-    0x75,0xc9,0x1c,0x5c,0x54,0x3d,0x79,0x69,0xb1,0x99,0x98,0xb2,0xa3,0x31,0x73,0x91,
-    0x96,0x65,0x72,0x96,0x70,0x39,0xee,0xef,0xb9,0x97,0xbe,0x70,0xba,0x14,0xc0,0x80,
-    0x30,0x62,0xc2,0xaa,0x0a,0x0c,0x22,0x83,0x67,0x60,0xa3,0xdc,0x82,0x0a,0xd8,0xe0,
-    0x79,0x4c,0x18,0x81,0xc4,0x23,0x75,0xb7,0x49,0x3b,0xdf,0x67,0xc0,0x60,0x78,0xd4,
-    0x14,0x87,0xd4,0x6f,0xe2,0x49,0x9c,0x4a,0x02,0xd4,0x65,0x55,0x72,0xc5,0x19,0xba,
-    0x19,0x53,0x23,0x16,0xcc,0x5c,0xe4,0xdd,0x6a,0xd2,0xe7,0x7e,0xf7,0xad,0xff,0xa9,
-    0x96,0x7f,0xaf,0x76,0x4e,0x51,0x39,0x07,0x38,0x1d,0x2e,0x17,0x4a,0x82,0x62,0x10,
-    0xa0,0x00,0x42,0x40,0xb1,0x2c,0x7a,0x9a,0x1c,0x23,0x7b,0x2c,0x1a,0x17,0x70,0x0c,
-    0x20,0x44,0x5e,0x46,0xef,0x7f,0xd2,0x8d,0x2f,0xfd,0xa8,0xeb,0x90,0xa8,0xb1,0x28,
-    0x01,0x7b,0xfe,0x54,0x48,0x50,0xd1,0x21,0x90,0x49,0x81,0xd9,0x82,0x2b,0xd4,0xfa,
-    0x8c,0xe4,0xac,0xa4,0x84,0x5c,0x06,0xc5,0xfd,0x24,0x4f,0x9a,0x91,0x10,0x56,0x46,
-    0x1f,0x4a,0x8f,0xc8,0x46,0x1b,0x5a,0x40,0xaa,0x97,0xd5,0xf6,0x66,0x67,0x2f,0x31,
-    0x58,0xe6,0x88,0x77,0x99,0x48,0x22,0xeb,0x03,0xb8,0x3a,0xcc,0x8b,0x0a,0x22,0xd3,
-    0x80,0xb8,0x85,0x7c,0xac,0x7b,0xb9,0x43,0x69,0x44,0x2d,0x67,0x2d,0xbc,0xb9,0x3b,
-    0x55,0xea,0x50,0x6e,0xa6,0x74,0x1b,0xac,0x51,0xdd,0x80,0x48,0x94,0x51,0x91,0xff,
-    0xfb,0x92,0x64,0xf6,0x0c,0x03,0x6b,0x63,0x40,0x11,0xfa,0x1b,0x22,0x57,0xc4,0x58,
-    0x47,0x0f,0x23,0x46,0x0d,0xb5,0x8a,0xfe,0x04,0x68,0x67,0x01,0x4d,0x16,0x20,0x00,
-    0x0d,0x8c,0x38,0x1c,0x86,0x4b,0x58,0xe8,0xdf,0xfd,0x1f,0x06,0x55,0xf1,0xc7,0x98,
-    0x41,0x61,0x01,0x4f,0x55,0x50,0xb6,0xd6,0x02,0x2a,0x26,0x26,0x45,0x56,0xd6,0xd6,
-    0x27,0x2a,0xdc,0xc8,0xb2,0xcc,0x47,0x39,0xad,0x28,0x7d,0x9f,0x0b,0x23,0xa7,0xf2,
-    0x1f,0x7c,0xbe,0x72,0x43,0x6c,0xa9,0xc9,0x9e,0x9a,0xe5,0x21,0x9e,0x79,0x5a,0x65,
-    0x72,0xb7,0xa5,0x45,0x11,0xfa,0x9b,0xe7,0xb3,0x43,0xb8,0xc9,0xa1,0xd8,0x5e,0x56,
-    0x9d,0x16,0xab,0x03,0x30,0x34,0xa4,0xdf,0xff,0xce,0x26,0x66,0x96,0xf6,0x3d,0x7a,
-    0x8b,0x7d,0x16,0x96,0x98,0x21,0x0f,0x1b,0x1c,0x19,0x04,0xf5,0x09,0xa6,0xc2,0x2d,
-    0xea,0x9e,0x6e,0x65,0x7c,0x89,0x0c,0x98,0x9e,0xd9,0x11,0x4f,0x72,0x27,0xd9,0xf2,
-    0xa6,0xef,0xb3,0xfb,0x73,0x72,0x41,0xe7,0xb9,0xf3,0x71,0xc8,0x80,0x73,0xcb,0x78,
-    0x5c,0x6e,0x92,0x1d,0x3c,0xe8,0x3d,0xc1,0x13,0xaf,0x9d,0x16,0xab,0xf4,0x98,0xa7,
-    0xe8,0xe7,0x65,0x69,0x7e,0x1e,0x67,0x4c,0x9a,0x79,0xe4,0xed,0x58,0xcc,0x4e,0xcc,
-    0x87,0x5d,0x33,0xa5,0x8b,0x72,0x74,0xdc,0x98,0xa8,0x9d,0xd0,0xaa,0x57,0xbf,0xfd,
-    0x98,0x32,0xc7,0x7b,0xd6,0x0f,0x48,0xd1,0x18,0x76,0xb9,0x80,0x4a,0xd4,0xe5,0xe8,
-    0x20,0x0f,0x60,0xab,0xa6,0xf5,0xd2,0x28,0x88,0x91,0x9f,0x99,0x12,0x4a,0x6a,0x60,
-    0x96,0x92,0xd3,0x0c,0x51,0x59,0xf0,0x46,0xbd,0x2f,0x53,0xf3,0xd7,0x6b,0x07,0x48,
-    0x85,0x90,0xca,0xcd,0xbb,0x2f,0x9d,0x02,0x27,0x70,0x2a,0xf9,0x47,0xaa,0xb4,0xf3,
-    0x8b,0xf3,0x74,0x28,0x48,0x95,0x0e,0xfb,0xd2,0x5c,0xd1,0xb3,0xa3,0xc3,0xd6,0x48,
-    0x24,0x81,0xa1,0x1b,0x96,0x6d,0x13,0x70,0x14,0x9b,0x4f,0x15,0xbc,0x8a,0xec,0x19,
-    0xdc,0x5a,0x04,0x65,0xb6,0x6e,0x85,0x29,0x52,0x32,0xa2,0xc0,0xa6,0xa0,0xd3,0xf0,
-    0x2d,0xfb,0xd4,0x4e,0x80,0xa9,0x19,0x25,0xcb,0x5f,0x18,0x50,0x20,0xb2,0xc8,0x4c,
-    0xd4,0x9c,0x8d,0x08,0xd0,0xda,0x9a,0x9c,0xb7,0xcc,0x4e,0x5a,0xb0,0x52,0x28,0xb6,
-    0xd7,0x73,0xad,0xf6,0x9a,0x3a,0x92,0x1e,0x8b,0xe4,0x4a,0x4f,0xd7,0xd6,0x91,0x11,
-    0x72,0x19,0x60,0xcd,0x4d,0x42,0x12,0x93,0x49,0x6f,0xdc,0xf5,0x73,0x40,0x82,0xd4,
-    0x49,0x90,0x7a,0x10,0x26,0x5b,0xc3,0x44,0x08,0x40,0x46,0xc4,0x03,0x18,0x81,0x1a,
-    0x70,0xff,0xfb,0x92,0x64,0xf2,0x0f,0xf3,0x7b,0x68,0xbf,0x80,0xdb,0x19,0xc0,0x4e,
-    0x69,0x28,0x10,0x03,0x23,0x1c,0x0c,0xe9,0xa3,0x00,0x00,0x64,0x63,0x81,0x6e,0xa6,
-    0x1f,0xc0,0x0d,0x0c,0x70,0xee,0xb0,0xb4,0x0e,0xe0,0x41,0xff,0xfd,0x34,0x57,0x2e,
-    0x55,0x14,0x5f,0x10,0x30,0x3c,0x25,0xc3,0xa1,0x13,0x24,0xfa,0x88,0xa6,0x10,0xdb,
-    0x03,0xb1,0xea,0x5d,0x18,0x33,0x67,0x0e,0x96,0xd3,0x12,0x18,0x7e,0x06,0x1e,0x12,
-    0x02,0xc1,0x53,0x84,0xd1,0x8d,0x41,0x8f,0x48,0xb0,0xe7,0x85,0xdb,0x0e,0x19,0xf3,
-    0x2a,0xe8,0xae,0x07,0x18,0x21,0x33,0x31,0xfa,0xb4,0x34,0xfa,0xa0,0xf2,0x87,0x18,
-    0xc1,0x91,0xd1,0xd6,0xe5,0x29,0x84,0x47,0x25,0x60,0x67,0x22,0x37,0xc5,0x21,0x24,
-    0xed,0xad,0x46,0x78,0xa1,0x07,0xe0,0x87,0x0c,0x77,0x52,0xbc,0xfd,0x79,0x5d,0x62,
-    0xb2,0xda,0x0a,0x8a,0x8b,0xba,0x07,0xd3,0xb9,0xc1,0xed,0x46,0x62,0xcb,0x2b,0x9d,
-    0x13,0xc0,0x1f,0x39,0x7c,0xdd,0x9f,0x63,0x46,0xa6,0x31,0xdb,0xa5,0x55,0x2e,0x2d,
-    0x95,0x5e,0xfd,0x96,0xda,0x51,0x0b,0xb5,0x2b,0x55,0xb9,0x96,0xc7,0xbd,0x5a,0x5c,
-    0x9f,0xd9,0xfd,0xf5,0xce,0xd7,0xe1,0xfd,0x43,0x4c,0x88,0xd4,0xad,0x85,0x5d,0x4f,
-    0x3d,0x74,0x28,0x72,0x23,0x2a,0xfd,0x32,0xee,0xa5,0xae,0x79,0xa7,0x2d,0x23,0x2c,
-    0xf2,0xab,0xce,0x21,0xb0,0x20,0x04,0x15,0x83,0x5a,0x3a,0x31,0x6a,0xe7,0x64,0xac,
-    0x9b,0x2b,0x83,0x05,0x1f,0xab,0x08,0xdc,0x70,0x45,0x4e,0x4a,0xb7,0xff,0xf9,0x93,
-    0x66,0x68,0x5d,0xac,0xe1,0xff,0xfe,0xb5,0xb7,0x9b,0xb2,0x57,0x8c,0xe5,0xd7,0x1e,
-    0x2e,0xef,0xf2,0xd2,0x63,0x51,0x4f,0xd3,0x4b,0x4b,0x81,0x2f,0x50,0xbb,0x39,0xf6,
-    0xa8,0x50,0xd2,0x74,0xf1,0x3b,0x30,0xeb,0x27,0x2c,0xac,0x30,0xb4,0x54,0xc9,0xe6,
-    0x3f,0x02,0x6d,0xc1,0xff,0x9f,0x4f,0xff,0x4b,0xf6,0x93,0xfe,0x78,0x55,0xd6,0xa6,
-    0x2c,0x52,0xc1,0xb4,0x93,0xb2,0x98,0x0e,0xcd,0xc9,0xb0,0x58,0xb7,0x31,0x4b,0x28,
-    0x2c,0x85,0x42,0x32,0x2d,0xa9,0x60,0xc9,0x6b,0x7c,0xc2,0x6c,0xb9,0x32,0xe8,0xfc,
-    0x68,0x60,0xd7,0x2c,0x05,0x23,0x78,0x91,0x61,0x54,0x9b,0x3c,0xb8,0xab,0x15,0x61,
-    0xa4,0x97,0x70,0x2a,0x23,0xd6,0x6a,0xeb,0x38,0x94,0x3d,0x37,0xb9,0x8e,0x2e,0x06,
-    0x8d,0x63,0x0d,0xe8,0x61,0xd2,0x2a,0x73,0x1c,0x49,0x3c,0x45,0x2a,0x5f,0x2a,0x4b,
-    0xbd,0x48,0xcf,0x7c,0xe7,0x57,0x62,0x9a,0xba,0x85,0x58,0x8e,0xba,0x61,0xf0,0xfa,
-    0xfa,0x8d,0xa9,0xff,0xfb,0x92,0x64,0xf0,0x8f,0xf3,0x65,0x60,0xbf,0x80,0x59,0x1a,
-    0x32,0x66,0x29,0xb7,0xe0,0x1f,0x23,0x46,0x4a,0xb1,0x77,0x02,0x09,0x04,0x71,0x01,
-    0x4c,0x9d,0xa0,0x00,0x1d,0x0c,0xa9,0xb8,0x22,0x69,0xa3,0xf8,0xff,0x6a,0xe2,0x10,
-    0xf8,0xbf,0x6f,0xff,0xfc,0x77,0xee,0xb3,0xb7,0x4b,0x58,0xa6,0x2f,0xc9,0x28,0x90,
-    0x0e,0x75,0x54,0x96,0x27,0x7e,0x59,0x16,0xc6,0xe1,0x3d,0xcc,0xa5,0x9a,0x11,0xee,
-    0x99,0x2d,0x1e,0xe5,0x01,0x93,0xfd,0xc2,0xe5,0x4d,0x5f,0x33,0x9b,0x8d,0x89,0x38,
-    0x4f,0x11,0xc9,0x22,0x1e,0xff,0xe9,0x91,0x0b,0x36,0x6a,0x47,0xc9,0x10,0xcf,0x10,
-    0x08,0x8a,0x06,0x1b,0x79,0x02,0x21,0x37,0x89,0xc5,0xd4,0x73,0xee,0x54,0xb1,0x34,
-    0xcf,0xad,0x5c,0xc8,0xa4,0x06,0xf6,0xb3,0xeb,0xea,0x0f,0x53,0xd2,0xa7,0x3f,0x0d,
-    0xfe,0x62,0x4a,0x64,0x2e,0x1f,0xb7,0xff,0xfe,0x37,0xf8,0xbc,0x79,0x59,0x2f,0x01,
-    0x16,0x68,0xb9,0xec,0x98,0xc7,0x80,0x8b,0x3c,0x7c,0x48,0xcd,0x19,0x65,0xbd,0x1a,
-    0x47,0x0e,0x42,0x9c,0xfb,0x82,0xde,0xc3,0xfb,0x91,0x29,0xee,0xf5,0x74,0x50,0xaa,
-    0x5c,0xba,0x6b,0x7d,0x0e,0x22,0x9e,0x15,0x04,0x66,0x4e,0x06,0x80,0xc9,0x60,0x3f,
-    0x2a,0x12,0x1e,0x26,0x3c,0xe1,0xa0,0x61,0xee,0x26,0x60,0x22,0xf5,0x0a,0xa2,0xf2,
-    0xd5,0x3e,0xd7,0x8e,0x91,0x4d,0xcd,0x9f,0x4a,0x1a,0x8f,0x61,0x52,0xca,0x95,0xf4,
-    0x50,0x00,0x12,0x34,0xc1,0x2d,0x1b,0x17,0x5d,0xa0,0x07,0x41,0xa0,0xf6,0x0a,0x12,
-    0x78,0x58,0x69,0xf6,0x1c,0x04,0x67,0xe8,0x24,0x2c,0xd2,0x11,0xc2,0x8c,0x45,0x4f,
-    0x20,0x4d,0x97,0xb6,0x03,0x35,0x09,0x3d,0x69,0x0d,0x35,0xe0,0x60,0xc1,0x21,0x63,
-    0x65,0x18,0xa0,0xf5,0xad,0x75,0xcc,0x26,0x25,0x3b,0x24,0xd2,0x8b,0x0d,0x12,0x86,
-    0x88,0x26,0x5f,0x1b,0x77,0x54,0xeb,0xd9,0x3b,0xee,0xfe,0x41,0xfb,0x59,0x90,0x99,
-    0x5f,0x08,0xa8,0x4b,0x0f,0x26,0xb2,0x31,0xda,0x0a,0x90,0xb1,0x96,0x06,0x6b,0xd7,
-    0x97,0x4b,0x4f,0xbb,0x68,0x2a,0x43,0x35,0xd0,0x7c,0x8a,0xda,0xe5,0x17,0x30,0x2c,
-    0x87,0xd8,0x7d,0x58,0x1e,0x1e,0x91,0xc1,0x4a,0xd6,0x9d,0x30,0x6a,0xe6,0x60,0xb3,
-    0x6f,0x9e,0xeb,0x5a,0xa8,0xc2,0x76,0x9a,0x41,0xf4,0xd0,0x31,0xed,0x85,0x45,0x71,
-    0x33,0x9a,0x13,0x9a,0x34,0x91,0xed,0x27,0x95,0x07,0x6b,0xac,0x70,0xec,0xa3,0xca,
-    0x75,0x75,0x29,0xb1,0x31,0xd5,0x11,0x93,0x1e,0xfc,0xdd,0xf0,0x96,0x98,0xa9,0xc3,
-    0x6c,0x56,0x2c,0x8b,0x2b,0xff,0xfb,0x92,0x44,0xf1,0x8f,0x73,0x9d,0x65,0xbe,0x80,
-    0x18,0x40,0xe0,0x64,0x0c,0xb7,0xf0,0x1b,0x23,0x46,0x0a,0xd0,0x9a,0xfe,0x07,0x98,
-    0x70,0xc1,0x27,0x84,0xa0,0x90,0x14,0xb0,0xc2,0xb7,0xa2,0xe6,0xcd,0x77,0x7f,0xc6,
-    0xc9,0x88,0xff,0xfe,0xfd,0xaa,0x91,0xab,0xd8,0x41,0x2a,0x59,0x7a,0x32,0x40,0xc9,
-    0x76,0x76,0x4b,0x7a,0x6c,0x20,0x78,0xf9,0x0f,0x8a,0x7d,0xd4,0x99,0x99,0xc8,0x42,
-    0xff,0x15,0xf9,0x08,0x75,0xf8,0x40,0x7a,0x29,0x91,0x95,0x60,0x4a,0xf4,0x2a,0xbd,
-    0xaa,0x3b,0xe7,0x4c,0x6a,0xa3,0x7a,0xc0,0x7e,0x49,0x97,0xfd,0x57,0xd4,0x8e,0xa1,
-    0x61,0x4c,0x4a,0x8b,0x0c,0xba,0x8e,0xc7,0xcd,0x9e,0x14,0x91,0xcb,0x68,0x8f,0xde,
-    0x4e,0x75,0x2b,0xfc,0xca,0x39,0x2c,0x9a,0xa9,0x5f,0x4d,0x35,0xed,0x6b,0xee,0x6c,
-    0x7c,0xae,0xf0,0xd6,0xdf,0x21,0x9b,0xcf,0xca,0xa8,0x3e,0x56,0xcc,0xff,0xbf,0x5a,
-    0xd4,0xcc,0x99,0x2e,0x5c,0x23,0x12,0xa4,0x39,0x0a,0x5d,0x24,0x85,0x27,0xa4,0x20,
-    0x89,0x29,0x64,0x4d,0x22,0x96,0xdf,0xb9,0x2b,0x14,0x31,0x4c,0x11,0x42,0x42,0x4c,
-    0x89,0xe5,0x81,0x22,0x64,0x48,0x89,0x88,0x28,0x08,0x95,0xa2,0x56,0x10,0x63,0xd9,
-    0x8d,0xb5,0xe8,0x9e,0x1a,0xc5,0xfd,0x49,0x79,0xd2,0xd6,0xa9,0x78,0x32,0xdc,0x96,
-    0xa8,0xa6,0x61,0x4d,0x0e,0x1f,0x4b,0x6f,0x3f,0x97,0xfe,0x31,0x74,0xaf,0xd8,0x5e,
-    0x72,0xf4,0xbb,0xe0,0x39,0x95,0x3b,0x28,0x88,0xdc,0xe7,0x63,0xf7,0xc9,0x19,0xff,
-    0xd7,0x17,0xad,0x29,0x62,0xc3,0x23,0x60,0xc9,0x68,0xec,0x68,0xc3,0x9b,0x3e,0xbb,
-    0x7c,0xcf,0x6c,0xfc,0xa4,0xfb,0xad,0xdc,0x11,0xed,0xed,0x5d,0x96,0x43,0xf3,0x8c,
-    0xde,0xe3,0x78,0x6e,0xa1,0xe4,0x76,0x19,0xa9,0x17,0x91,0xad,0x1a,0x35,0xd1,0xfb,
-    0x4b,0x52,0x85,0xfd,0x8b,0x3f,0x53,0x2b,0xfa,0xc0,0x46,0x4e,0x87,0x5b,0xff,0x34,
-    0x2f,0x27,0xf9,0x82,0x61,0x67,0xad,0x44,0x45,0x1f,0xaf,0x2c,0x99,0x4a,0x22,0xac,
-    0x46,0x12,0x91,0x4e,0x96,0x9c,0x89,0x2a,0x7c,0xe4,0x41,0x1d,0x58,0x8b,0xea,0xb5,
-    0xda,0xd6,0xb5,0xb7,0x9c,0xc5,0x40,0x65,0x01,0x3c,0x04,0x05,0x49,0x85,0x03,0x66,
-    0x60,0xc2,0xaa,0x37,0x49,0xa9,0x35,0x26,0x86,0xbb,0x31,0xed,0xeb,0x0d,0x7d,0x8a,
-    0xa9,0x1a,0x93,0x7d,0x12,0xc0,0xc0,0x63,0x80,0x83,0x12,0x19,0xc4,0xb5,0x29,0xe5,
-    0xd2,0xe9,0x58,0x6a,0x47,0x48,0x31,0x1a,0x95,0x59,0x97,0x1a,0x97,0xd5,0x6b,0xe0,
-    0xab,0xa8,0xb6,0x69,0x05,0x20,0xb4,0xff,0xfb,0x92,0x44,0xf4,0x8f,0xe3,0xa2,0x53,
-    0xbd,0x01,0xec,0x43,0xe0,0x6e,0x69,0xe7,0xc0,0x61,0x26,0x7e,0x4b,0xa5,0x3e,0xf0,
-    0x06,0x24,0x6d,0x49,0x38,0xa4,0x60,0x08,0xf3,0x0d,0xe0,0xda,0xc5,0xff,0xd9,0x45,
-    0x8a,0xc0,0x00,0x00,0x00,0x00,0xfe,0x7d,0xbe,0x5e,0xd0,0xfe,0x3a,0x5b,0x95,0xc3,
-    0xe8,0xbd,0x1c,0xac,0xa7,0x2b,0x20,0xa4,0x96,0x12,0x94,0xd0,0xb3,0x5e,0x57,0x92,
-    0xeb,0x4c,0x2a,0xf4,0x28,0x45,0x28,0x01,0x22,0x69,0x2a,0x44,0xf5,0x63,0x1a,0x95,
-    0xc6,0xd7,0xd8,0xd4,0xb5,0x12,0x5c,0xa4,0xd6,0xc6,0x33,0xbf,0xb1,0xf5,0x63,0x31,
-    0xb3,0x75,0x4a,0x30,0x65,0x2f,0xd4,0x4f,0xf1,0x99,0x57,0xe7,0xed,0xb3,0x7b,0x1f,
-    0xfe,0xab,0x32,0x86,0x14,0x04,0x25,0x2a,0xbe,0x25,0xfe,0xe0,0x61,0x62,0x52,0xd5,
-    0x89,0x28,0x3a,0x0e,0x43,0xa0,0x74,0x26,0x0c,0x84,0x80,0xf8,0x38,0x24,0x12,0x89,
-    0x0b,0x14,0x3c,0xcb,0xa5,0x89,0x4b,0x56,0x98,0x89,0x4b,0x56,0x52,0x86,0x92,0x30,
-    0x69,0x0e,0x97,0x56,0xcb,0x13,0x17,0x57,0x55,0x13,0x13,0xff,0xf1,0x31,0xff,0x75,
-    0x75,0xfe,0xec,0x6a,0xea,0xeb,0x73,0x25,0x19,0x5d,0x5c,0x35,0xa4,0x28,0x88,0x44,
-    0x43,0x21,0xe1,0xb1,0x80,0xf1,0x72,0x03,0x63,0xa2,0xa1,0x08,0xd0,0xc8,0xc8,0xd0,
-    0x7c,0x60,0x8c,0x14,0x02,0xa5,0xa6,0x60,0xf6,0x88,0xc8,0xbf,0xcc,0x8e,0xd4,0xc8,
-    0x8c,0x8c,0x8c,0x8f,0xe4,0x64,0x64,0x46,0x54,0xe4,0x66,0x46,0x46,0x9f,0xff,0xe6,
-    0x46,0x46,0x4d,0xb9,0xb3,0x52,0x51,0x66,0x94,0x59,0x57,0x1b,0x95,0x52,0x71,0xa5,
-    0x16,0x61,0xe5,0x14,0x5b,0x3b,0x3c,0x5b,0x33,0xc6,0xcd,0x1a,0x71,0xa6,0x8a,0x12,
-    0x28,0x0c,0x40,0xb3,0x0f,0x3e,0x03,0x12,0x95,0xa2,0xaa,0x4c,0x41,0x4d,0x45,0x33,
-    0x2e,0x39,0x39,0x2e,0x35,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xff,0xfb,0x92,0x44,0xec,0x8e,0x03,
-    0x08,0x50,0x35,0x01,0x83,0x45,0x72,0x5a,0x88,0xe7,0x59,0x3d,0x23,0x7a,0x0a,0xe9,
-    0x4e,0x5c,0x44,0x01,0x3e,0x41,0x1f,0x22,0x50,0x24,0x10,0x99,0xfd,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
-    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa
-};
-
-const size_t EmbeddedResources::notification_mp3_size = 27211;
-
-namespace EmbeddedResources {
-
-std::string getXMLContent() {
-    return std::string(reinterpret_cast<const char*>(gui_design_xml), gui_design_xml_size);
-}
-
-const unsigned char* getAudioData(size_t& size) {
-    size = notification_mp3_size;
-    return notification_mp3;
-}
-
-bool writeAudioToTempFile(const std::string& tempPath) {
-    std::ofstream file(tempPath, std::ios::binary);
-    if (!file) return false;
-    file.write(reinterpret_cast<const char*>(notification_mp3), notification_mp3_size);
-    return file.good();
-}
-
+using namespace std;
+
+namespace EmbeddedResources
+{
+    const char *const kResourcePrefix = "/org/cpp/scheduler";
+
+    string uiResourcePath(const string &fragment)
+    {
+        return string(kResourcePrefix) + "/ui/" + fragment + ".ui";
+    }
+
+    GBytes *lookup(const string &path)
+    {
+        GError *error = nullptr;
+        GBytes *bytes = g_resources_lookup_data(path.c_str(), G_RESOURCE_LOOKUP_FLAGS_NONE, &error);
+        if (!bytes)
+        {
+            cerr << "资源查找失败: " << path << " (" << (error ? error->message : "未知错误") << ")" << endl;
+            if (error)
+                g_error_free(error);
+        }
+        return bytes;
+    }
+
+    GBytes *notificationSound()
+    {
+        return lookup(string(kResourcePrefix) + "/notification.mp3");
+    }
 }
@@ -1,25 +1,21 @@
-#ifndef EMBEDDED_RESOURCES_H
-#define EMBEDDED_RESOURCES_H
+#pragma once
 
-#include <cstddef>
+#include <gio/gio.h>
 #include <string>
-#include <memory>
 
-namespace EmbeddedResources {
+// 编译进程序的 GResource 资源包（见 resources.gresource.xml.in）
+// 资源数据位于可执行文件的只读段，未压缩的资源查找时直接返回指向该段的 GBytes，不发生复制
+namespace EmbeddedResources
+{
+    // 资源路径前缀
+    extern const char *const kResourcePrefix;
 
-    // GTK UI Design XML
-    extern const unsigned char gui_design_xml[];
-    extern const size_t gui_design_xml_size;
+    // 界面片段的资源路径，例如 "login_window" -> "/org/cpp/scheduler/ui/login_window.ui"
+    std::string uiResourcePath(const std::string &fragment);
 
-    // Notification sound MP3
-    extern const unsigned char notification_mp3[];
-    extern const size_t notification_mp3_size;
+    // 查找资源，返回新的 GBytes 引用（调用者负责 g_bytes_unref），找不到返回 nullptr
+    GBytes *lookup(const std::string &path);
 
-    // Helper functions
-    std::string getXMLContent();
-    const unsigned char* getAudioData(size_t& size);
-    bool writeAudioToTempFile(const std::string& tempPath);
-
-}
-
-#endif // EMBEDDED_RESOURCES_H
+    // 提醒音效（MP3）
+    GBytes *notificationSound();
+}
\ No newline at end of file
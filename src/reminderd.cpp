@@ -0,0 +1,352 @@
+// 独立的提醒守护进程
+// 只读取用户的任务文件（从不写入），通过 inotify 监视文件变化，用 timerfd 对准下一条提醒的时刻，
+// 到点发送桌面通知并播放提示音。运行期间持有 <用户名>_reminderd.lock 的排他锁，
+// 图形界面检测到该锁后不再自己投递提醒，可以随时关闭而不影响提醒。
+//
+// 用法: scheduler_reminderd <用户名> [-d 数据目录] [--no-sound]
+
+#include "ReminderEngine.h"
+#include "MetricsExporter.h"
+#include "RealtimeTimer.h"
+#include "TaskFile.h"
+#include "AudioService.h"
+#include <gio/gio.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/inotify.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class ReminderDaemon
+{
+public:
+    ReminderDaemon(const string &username, bool sound_enabled);
+    ~ReminderDaemon();
+
+    int run();
+
+private:
+    bool acquire_lock();
+    bool setup_watch();
+    bool setup_signals();
+
+    void reload();
+    void on_inotify();
+    void on_timer();
+    void arm();
+    bool is_pending(const Task &task) const;
+    void deliver(const vector<Task> &reminders);
+    void notify_desktop(const ReminderEngine::Digest &digest);
+
+    string m_username;
+    string m_tasks_file;
+    bool m_sound_enabled;
+    time_t m_start_time;
+    time_t m_last_pass; // 上一次 on_timer 取出到期提醒的时刻，启动时为 m_start_time
+
+    int m_lock_fd = -1;
+    int m_inotify_fd = -1;
+    int m_signal_fd = -1;
+    RealtimeTimer m_timer;
+    MetricsExporter m_metrics_exporter;
+
+    vector<Task> m_tasks;
+    set<pair<long long, time_t>> m_fired; // 已投递的 (任务ID, 提醒时间)，只保存在内存中
+    ReminderEngine m_engine;
+
+    GDBusConnection *m_bus = nullptr;
+    guint32 m_notification_id = 0; // 新通知替换上一条，而不是层层堆叠
+};
+
+ReminderDaemon::ReminderDaemon(const string &username, bool sound_enabled)
+    : m_username(username), m_tasks_file(username + "_tasks.dat"), m_sound_enabled(sound_enabled),
+      m_start_time(time(nullptr)), m_last_pass(m_start_time)
+{
+}
+
+ReminderDaemon::~ReminderDaemon()
+{
+    if (m_bus)
+        g_object_unref(m_bus);
+    if (m_signal_fd >= 0)
+        close(m_signal_fd);
+    if (m_inotify_fd >= 0)
+        close(m_inotify_fd);
+    if (m_lock_fd >= 0)
+        close(m_lock_fd); // 关闭即释放锁
+}
+
+bool ReminderDaemon::acquire_lock()
+{
+    string path = ReminderEngine::daemonLockPath(m_username);
+    m_lock_fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_lock_fd < 0)
+    {
+        cerr << "无法打开锁文件 " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    if (flock(m_lock_fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        cerr << "用户 " << m_username << " 的提醒守护进程已在运行。" << endl;
+        return false;
+    }
+
+    // 写入进程号便于排查
+    string pid = to_string(getpid()) + "\n";
+    if (ftruncate(m_lock_fd, 0) != 0 || write(m_lock_fd, pid.c_str(), pid.size()) < 0)
+        cerr << "写入锁文件失败: " << strerror(errno) << endl;
+    return true;
+}
+
+bool ReminderDaemon::setup_watch()
+{
+    // 监视所在目录而不是文件本身：任务文件可能尚不存在，也可能被删除后重建
+    m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify_fd < 0 ||
+        inotify_add_watch(m_inotify_fd, ".", IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE) < 0)
+    {
+        cerr << "无法监视任务文件: " << strerror(errno) << endl;
+        return false;
+    }
+    return true;
+}
+
+bool ReminderDaemon::setup_signals()
+{
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    if (sigprocmask(SIG_BLOCK, &mask, nullptr) != 0)
+        return false;
+    m_signal_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    return m_signal_fd >= 0;
+}
+
+void ReminderDaemon::reload()
+{
+    if (!TaskFile::load(m_tasks_file, m_tasks))
+        m_tasks.clear();
+
+    // 与图形界面的登录行为一致：守护进程启动前就已过期的提醒不再补发
+    set<pair<long long, time_t>> still_present;
+    for (const auto &task : m_tasks)
+    {
+        if (task.reminderTime <= 0)
+            continue;
+        pair<long long, time_t> key(task.id, task.reminderTime);
+        if (task.reminderTime <= m_start_time || m_fired.count(key))
+            still_present.insert(key);
+    }
+    // 只保留仍然存在的记录，被删除或修改了提醒时间的任务不再占用内存
+    m_fired.swap(still_present);
+
+    cout << "已加载 " << m_tasks.size() << " 个任务。" << endl;
+    arm();
+}
+
+// 尚待本进程投递的提醒。守护进程运行时图形界面不投递，只把到期的提醒标记为已提醒并重写文件；
+// 守护进程来不及处理（例如刚从挂起中恢复）时，重新加载的文件中这些提醒已经标记，
+// 因此提醒时间晚于上一次投递检查的已标记提醒仍由这里投递，早于它的才是此前已经处理过的
+bool ReminderDaemon::is_pending(const Task &task) const
+{
+    if (task.reminderTime <= 0 || m_fired.count({task.id, task.reminderTime}))
+        return false;
+    return !task.reminded || task.reminderTime > m_last_pass;
+}
+
+void ReminderDaemon::arm()
+{
+    time_t next = 0;
+    for (const auto &task : m_tasks)
+    {
+        if (!is_pending(task))
+            continue;
+        if (next == 0 || task.reminderTime < next)
+            next = task.reminderTime;
+    }
+    next = m_engine.nextDelivery(next);
+
+    if (next > 0)
+        m_timer.arm_at(next);
+    else
+        m_timer.disarm();
+}
+
+void ReminderDaemon::on_inotify()
+{
+    alignas(inotify_event) char buffer[4096];
+    bool changed = false;
+    ssize_t len;
+    while ((len = read(m_inotify_fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (char *p = buffer; p < buffer + len;)
+        {
+            auto *event = reinterpret_cast<inotify_event *>(p);
+            if (event->len > 0 && m_tasks_file == event->name)
+                changed = true;
+            p += sizeof(inotify_event) + event->len;
+        }
+    }
+    if (changed)
+        reload();
+}
+
+void ReminderDaemon::on_timer()
+{
+    if (m_timer.consume() == RealtimeTimer::Event::CLOCK_CHANGED)
+        cout << "系统时间已变化，重新设置提醒定时器。" << endl;
+
+    time_t now = time(nullptr);
+    time_t horizon = m_engine.horizon(now);
+    for (const auto &task : m_tasks)
+    {
+        if (task.reminderTime <= horizon && is_pending(task))
+        {
+            m_fired.insert({task.id, task.reminderTime});
+            m_engine.add(task);
+        }
+    }
+    m_last_pass = now;
+
+    vector<Task> digest = m_engine.take(now);
+    if (!digest.empty())
+        deliver(digest);
+    arm();
+}
+
+void ReminderDaemon::deliver(const vector<Task> &reminders)
+{
+    ReminderEngine::Digest digest = ReminderEngine::format(reminders);
+    cout << digest.title << ": " << digest.message << endl;
+    notify_desktop(digest);
+    if (m_sound_enabled)
+        AudioService::instance().playNotification();
+}
+
+void ReminderDaemon::notify_desktop(const ReminderEngine::Digest &digest)
+{
+    GError *error = nullptr;
+    if (!m_bus)
+    {
+        m_bus = g_bus_get_sync(G_BUS_TYPE_SESSION, nullptr, &error);
+        if (!m_bus)
+        {
+            cerr << "无法连接会话总线: " << error->message << endl;
+            g_error_free(error);
+            return;
+        }
+    }
+
+    // org.freedesktop.Notifications.Notify(susssasa{sv}i) -> u
+    GVariant *reply = g_dbus_connection_call_sync(
+        m_bus, "org.freedesktop.Notifications", "/org/freedesktop/Notifications",
+        "org.freedesktop.Notifications", "Notify",
+        g_variant_new("(susssasa{sv}i)", "我的日历", m_notification_id, "appointment-soon",
+                      digest.title.c_str(), digest.message.c_str(), nullptr, nullptr, -1),
+        G_VARIANT_TYPE("(u)"), G_DBUS_CALL_FLAGS_NONE, 5000, nullptr, &error);
+    if (!reply)
+    {
+        cerr << "桌面通知发送失败: " << error->message << endl;
+        g_error_free(error);
+        return;
+    }
+    g_variant_get(reply, "(u)", &m_notification_id);
+    g_variant_unref(reply);
+}
+
+int ReminderDaemon::run()
+{
+    if (!m_timer.is_valid() || !acquire_lock() || !setup_watch() || !setup_signals())
+        return 1;
+
+    if (m_sound_enabled)
+        AudioService::instance().init();
+    // 导出线程在屏蔽信号之后创建，继承信号掩码，SIGTERM 等仍然只由 signalfd 接收。
+    // 图形界面读取同样的环境变量，路径加上 .reminderd 后缀，两个进程不会争用同一个套接字和文件
+    m_metrics_exporter.startFromEnvironment(".reminderd");
+
+    reload();
+    cout << "提醒守护进程已启动，用户: " << m_username << endl;
+
+    pollfd fds[3] = {
+        {m_inotify_fd, POLLIN, 0},
+        {m_timer.fd(), POLLIN, 0},
+        {m_signal_fd, POLLIN, 0}};
+
+    while (true)
+    {
+        if (poll(fds, 3, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            cerr << "poll 失败: " << strerror(errno) << endl;
+            return 1;
+        }
+        if (fds[2].revents & POLLIN)
+            break;
+        // 先处理定时器：同一次唤醒中图形界面已经把到期提醒标记并写回文件时，先按重新加载之前的状态投递
+        if (fds[1].revents & POLLIN)
+            on_timer();
+        if (fds[0].revents & POLLIN)
+            on_inotify();
+    }
+
+    // 退出前补发被限流的提醒
+    if (m_engine.hasPending())
+        deliver(m_engine.takeAll());
+    if (m_sound_enabled)
+        AudioService::instance().stopAll();
+    cout << "提醒守护进程已退出。" << endl;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    string username;
+    string data_dir;
+    bool sound_enabled = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        string arg = argv[i];
+        if (arg == "-d" && i + 1 < argc)
+            data_dir = argv[++i];
+        else if (arg == "--no-sound")
+            sound_enabled = false;
+        else if (username.empty() && arg[0] != '-')
+            username = arg;
+        else
+        {
+            username.clear();
+            break;
+        }
+    }
+
+    if (username.empty())
+    {
+        cerr << "用法: " << argv[0] << " <用户名> [-d 数据目录] [--no-sound]" << endl;
+        return 2;
+    }
+    // 任务文件与图形界面一样相对于工作目录存放
+    if (!data_dir.empty() && chdir(data_dir.c_str()) != 0)
+    {
+        cerr << "无法进入数据目录 " << data_dir << ": " << strerror(errno) << endl;
+        return 1;
+    }
+
+    ReminderDaemon daemon(username, sound_enabled);
+    return daemon.run();
+}
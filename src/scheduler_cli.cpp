@@ -0,0 +1,186 @@
+// 命令行工具：不启动图形界面，直接读写用户的任务文件
+//
+// 用法:
+//   scheduler_cli [-d 数据目录] <用户名> list
+//   scheduler_cli [-d 数据目录] <用户名> day <YYYY-MM-DD>
+//   scheduler_cli [-d 数据目录] <用户名> add <名称> <YYYY-MM-DD HH:MM> <时长(分钟)> [high|medium|low]
+//   scheduler_cli [-d 数据目录] <用户名> delete <任务ID>
+
+#include "TaskManager.h"
+#include "DayLayout.h"
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static void print_usage(const char *program)
+{
+    cerr << "用法:\n"
+         << "  " << program << " [-d 数据目录] <用户名> list\n"
+         << "  " << program << " [-d 数据目录] <用户名> day <YYYY-MM-DD>\n"
+         << "  " << program << " [-d 数据目录] <用户名> add <名称> <YYYY-MM-DD HH:MM> <时长(分钟)> [high|medium|low]\n"
+         << "  " << program << " [-d 数据目录] <用户名> delete <任务ID>" << endl;
+}
+
+static bool parse_time(const string &text, const char *format, time_t &result)
+{
+    tm t = {};
+    const char *end = strptime(text.c_str(), format, &t);
+    if (!end || *end != '\0')
+        return false;
+    t.tm_isdst = -1;
+    result = mktime(&t);
+    return result != -1;
+}
+
+static string format_time(time_t t, const char *format)
+{
+    char buffer[32];
+    strftime(buffer, sizeof(buffer), format, localtime(&t));
+    return buffer;
+}
+
+static const char *priority_name(Priority p)
+{
+    switch (p)
+    {
+    case Priority::HIGH:
+        return "高";
+    case Priority::MEDIUM:
+        return "中";
+    case Priority::LOW:
+        return "低";
+    }
+    return "?";
+}
+
+static int cmd_list(TaskManager &manager)
+{
+    for (const auto &task : manager.getAllTasks())
+    {
+        cout << task.id << "\t" << format_time(task.startTime, "%Y-%m-%d %H:%M") << "\t"
+             << task.duration << "分钟\t" << priority_name(task.priority) << "\t" << task.name << "\n";
+    }
+    return 0;
+}
+
+static int cmd_day(TaskManager &manager, const string &date)
+{
+    time_t day;
+    if (!parse_time(date, "%Y-%m-%d", day))
+    {
+        cerr << "日期格式错误: " << date << endl;
+        return 2;
+    }
+
+    const vector<Task> tasks = manager.getAllTasks();
+    DayLayout::SegmentList segments = DayLayout::getTasksForDay(tasks, day);
+    DayLayout::sortTasksWithConflicts(segments, day);
+    for (const auto &seg : segments)
+    {
+        cout << format_time(seg.display_start, "%H:%M") << " - " << format_time(seg.display_end, "%H:%M") << "\t"
+             << priority_name(seg.priority) << "\t" << tasks[seg.task_index].name;
+        if (seg.is_cross_day)
+            cout << "（跨天）";
+        if (seg.has_conflict)
+            cout << (seg.is_highest_priority_in_conflict ? "（冲突，优先）" : "（冲突）");
+        cout << "\n";
+    }
+    return 0;
+}
+
+static int cmd_add(TaskManager &manager, const vector<string> &args)
+{
+    if (args.size() < 3)
+        return -1;
+
+    Task task;
+    task.name = args[0];
+    if (!parse_time(args[1], "%Y-%m-%d %H:%M", task.startTime))
+    {
+        cerr << "时间格式错误: " << args[1] << endl;
+        return 2;
+    }
+    try
+    {
+        task.duration = stoi(args[2]);
+    }
+    catch (const exception &)
+    {
+        cerr << "时长必须是整数分钟: " << args[2] << endl;
+        return 2;
+    }
+    if (args.size() > 3)
+    {
+        if (args[3] == "high")
+            task.priority = Priority::HIGH;
+        else if (args[3] == "low")
+            task.priority = Priority::LOW;
+        else if (args[3] != "medium")
+        {
+            cerr << "未知的优先级: " << args[3] << endl;
+            return 2;
+        }
+    }
+    return manager.addTask(task) ? 0 : 1;
+}
+
+static int cmd_delete(TaskManager &manager, const string &id_text)
+{
+    try
+    {
+        return manager.deleteTask(stoll(id_text)) ? 0 : 1;
+    }
+    catch (const exception &)
+    {
+        cerr << "任务ID必须是整数: " << id_text << endl;
+        return 2;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    vector<string> args(argv + 1, argv + argc);
+    if (args.size() >= 2 && args[0] == "-d")
+    {
+        // 任务文件与图形界面一样相对于工作目录存放
+        if (chdir(args[1].c_str()) != 0)
+        {
+            cerr << "无法进入数据目录 " << args[1] << ": " << strerror(errno) << endl;
+            return 1;
+        }
+        args.erase(args.begin(), args.begin() + 2);
+    }
+    if (args.size() < 2)
+    {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    TaskManager manager;
+    manager.setCurrentUser(args[0]);
+    const string &command = args[1];
+    vector<string> rest(args.begin() + 2, args.end());
+
+    int result = -1;
+    if (command == "list")
+        result = cmd_list(manager);
+    else if (command == "day" && rest.size() == 1)
+        result = cmd_day(manager, rest[0]);
+    else if (command == "add")
+        result = cmd_add(manager, rest);
+    else if (command == "delete" && rest.size() == 1)
+        result = cmd_delete(manager, rest[0]);
+
+    if (result < 0)
+    {
+        print_usage(argv[0]);
+        return 2;
+    }
+    return result;
+}
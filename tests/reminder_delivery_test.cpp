@@ -0,0 +1,53 @@
+// 主循环提醒投递的回归测试：提醒回调中调用 nextReminderTime（界面在回调里重新布置提醒定时器）不能自锁。
+// 自锁时 alarm 超时结束进程，ctest 判为失败
+
+#include "TaskManager.h"
+#include <unistd.h>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+int main()
+{
+    const string user = "reminder_delivery_test";
+    remove((user + "_tasks.dat").c_str());
+    alarm(10);
+
+    TaskManager manager;
+    manager.setCurrentUser(user);
+    manager.setReminderCoalescing(120, 0);
+
+    time_t now = time(nullptr);
+    Task task;
+    task.name = "回归测试";
+    task.startTime = now + 600;
+    task.duration = 30;
+    task.priority = Priority::MEDIUM;
+    task.category = Category::OTHER;
+    task.reminderTime = now + 60; // 落在合并窗口内，本次投递就会取出
+    task.reminderOption = "自定义";
+    if (!manager.addTask(task))
+    {
+        cerr << "添加任务失败" << endl;
+        return 1;
+    }
+
+    int delivered = 0;
+    time_t next_after_delivery = -1;
+    manager.setReminderCallback([&](const string &, const string &)
+                                {
+                                    ++delivered;
+                                    next_after_delivery = manager.nextReminderTime(); });
+    manager.deliverDueReminders();
+
+    remove((user + "_tasks.dat").c_str());
+    if (delivered != 1 || next_after_delivery != 0)
+    {
+        cerr << "投递次数 " << delivered << "，投递后的下一次提醒时刻 " << next_after_delivery << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+// 任务文件中 id 重复时的载入回归测试：每个 id 只保留最先出现的一条记录，
+// 删除该 id 之后存储和文件中都不再有它（此前重复的记录会留下一条失去索引的孤儿记录）；
+// 以及并行载入所用的 parallel_for 在 body 抛出异常时把异常交回调用线程，而不是挂起
+
+#include "BackgroundExecutor.h"
+#include "TaskFile.h"
+#include "TaskManager.h"
+#include "TaskStore.h"
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const string &what)
+    {
+        if (!condition)
+        {
+            cerr << "失败: " << what << endl;
+            ++failures;
+        }
+    }
+
+    Task makeTask(long long id, const string &name, time_t start)
+    {
+        Task task;
+        task.id = id;
+        task.name = name;
+        task.startTime = start;
+        task.duration = 30;
+        task.priority = Priority::LOW;
+        task.category = Category::OTHER;
+        task.reminderTime = 0;
+        return task;
+    }
+
+    size_t countId(const vector<Task> &tasks, long long id)
+    {
+        size_t count = 0;
+        for (const auto &task : tasks)
+            count += task.id == id;
+        return count;
+    }
+
+    // 逐条载入（TaskManager）：重复的记录被丢弃，文件随之重写
+    void testManagerLoad()
+    {
+        const string user = "task_load_test";
+        const string path = user + "_tasks.dat";
+        const time_t base = time(nullptr) + 86400;
+
+        // id 2 出现三次，其中一条的开始时间不是整分钟（带溢出值），id 1000000007 为离散的大 id
+        vector<Task> file = {makeTask(1, "一", base), makeTask(2, "二", base + 600),
+                             makeTask(3, "三", base + 1200), makeTask(2, "二-重复", base - 3600 + 17),
+                             makeTask(1000000007, "大", base + 60), makeTask(2, "二-再重复", base + 7200),
+                             makeTask(1000000007, "大-重复", base + 120)};
+        TaskFile::rewrite(path, file);
+
+        {
+            TaskManager manager;
+            manager.setCurrentUser(user);
+            vector<Task> tasks = manager.getAllTasks();
+            check(tasks.size() == 4, "载入后应有 4 个任务");
+            check(countId(tasks, 2) == 1 && countId(tasks, 1000000007) == 1, "重复的 id 只保留一条");
+            optional<Task> kept = manager.getTaskById(2);
+            check(kept && kept->name == "二" && kept->startTime == base + 600, "保留最先出现的记录");
+
+            check(manager.deleteTask(2), "删除重复过的 id");
+            check(!manager.getTaskById(2), "删除后按 id 查不到");
+            check(countId(manager.getAllTasks(), 2) == 0, "删除后没有遗留的记录");
+            check(!manager.deleteTask(2), "再次删除应失败");
+            check(manager.deleteTask(1000000007), "删除重复过的大 id");
+            check(manager.getAllTasks().size() == 2, "删除后剩 2 个任务");
+        }
+
+        vector<Task> reloaded;
+        TaskFile::load(path, reloaded);
+        check(reloaded.size() == 2 && countId(reloaded, 2) == 0, "重写后的文件中没有重复或已删除的记录");
+        remove(path.c_str());
+    }
+
+    // 并行载入（mergeSorted）：与前面部分重复的记录被丢弃，溢出值属于保留的记录
+    void testMergeSorted()
+    {
+        const time_t base = time(nullptr) + 86400;
+        vector<TaskStore> parts(3);
+        parts[0].push_back(makeTask(1, "一", base));
+        parts[0].push_back(makeTask(5, "五", base + 300));
+        check(!parts[0].push_back(makeTask(5, "五-部分内重复", base + 60)), "部分内的重复记录被拒绝");
+        parts[1].push_back(makeTask(5, "五-重复", base - 600 + 7));
+        parts[1].push_back(makeTask(2, "二", base + 600 + 7));
+        parts[2].push_back(makeTask(2, "二-重复", base + 900));
+        parts[2].push_back(makeTask(3, "三", base + 1200));
+
+        BackgroundExecutor executor(2);
+        TaskStore store;
+        store.mergeSorted(parts, executor);
+
+        check(store.size() == 4, "合并后应有 4 条记录");
+        check(store.droppedDuplicates() == 3, "丢弃 3 条重复记录");
+        const TaskRecord *five = store.find(5);
+        check(five && store.name(*five) == "五" && store.startTime(*five) == base + 300, "id 5 保留第一部分的记录");
+        const TaskRecord *two = store.find(2);
+        check(two && store.name(*two) == "二" && store.startTime(*two) == base + 600 + 7, "id 2 保留带溢出值的记录");
+
+        check(store.erase(5) && !store.find(5), "删除 id 5");
+        size_t remaining = 0;
+        for (const auto &record : store)
+        {
+            check(record.id != 5, "删除后没有遗留的 id 5");
+            ++remaining;
+        }
+        check(remaining == 3, "删除后剩 3 条记录");
+    }
+
+    // 并行载入的解码在工作线程上执行：body 抛出的异常要回到调用线程，而不是被工作线程吞掉、让调用方一直等待
+    void testParallelForException()
+    {
+        // 只在工作线程上抛出：调用线程自己抛出时异常本来就会传出，测不到挂起。
+        // 每个下标稍作停顿，保证工作线程能领到下标
+        BackgroundExecutor executor(2);
+        const thread::id caller = this_thread::get_id();
+        for (int round = 0; round < 5; ++round)
+        {
+            bool caught = false;
+            try
+            {
+                executor.parallel_for(32, [caller](size_t i)
+                                      {
+                                          this_thread::sleep_for(chrono::milliseconds(1));
+                                          if (this_thread::get_id() != caller)
+                                              throw runtime_error("下标 " + to_string(i));
+                                      });
+            }
+            catch (const runtime_error &)
+            {
+                caught = true;
+            }
+            check(caught, "parallel_for 在调用线程上重新抛出 body 的异常");
+        }
+
+        size_t sum = 0;
+        mutex sum_mutex;
+        executor.parallel_for(100, [&](size_t i)
+                              {
+                                  lock_guard<mutex> lock(sum_mutex);
+                                  sum += i;
+                              });
+        check(sum == 4950, "抛出异常之后线程池仍可正常使用");
+    }
+}
+
+int main()
+{
+    testManagerLoad();
+    testMergeSorted();
+    testParallelForException();
+    return failures == 0 ? 0 : 1;
+}